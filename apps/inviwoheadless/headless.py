@@ -0,0 +1,27 @@
+import sys
+import inviwopy as ivw
+import inviwoheadless as headless
+
+if __name__ == '__main__':
+    # Inviwo requires that a logcentral is created.
+    lc = ivw.LogCentral()
+
+    # Create and register a console logger
+    cl = ivw.ConsoleLogger()
+    lc.registerLogger(cl)
+
+    # Create the inviwo application, no Qt application or OpenGL context is created
+    app = headless.InviwoApplicationHeadless()
+    skipped = app.registerModules()
+    print("Skipped modules: " + ", ".join(skipped))
+
+    # Per processor timings can be collected with ivw.EvaluationStatistics
+    stats = ivw.EvaluationStatistics(app)
+
+    # Load and evaluate each workspace given on the command line
+    for workspace in sys.argv[1:]:
+        timing = app.run(workspace)
+        print(workspace, timing)
+
+    for identifier, s in stats.processors.items():
+        print("{}: process mean {:.2f} ms".format(identifier, s.process.mean))
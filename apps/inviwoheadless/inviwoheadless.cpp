@@ -0,0 +1,224 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <pybind11/pybind11.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/common/inviwomodulefactoryobject.h>
+#include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/moduleregistration.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace py = pybind11;
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * An InviwoApplication without Qt and without an OpenGL context. Only modules that do not depend
+ * on OpenGL or Qt are registered, hence no processor widgets or canvases are ever created, and
+ * the network is evaluated by processing the front queue from the calling thread.
+ */
+class InviwoApplicationHeadless : public InviwoApplication {
+public:
+    using clock = std::chrono::steady_clock;
+
+    struct RunTiming {
+        double load = 0.0;      ///< Seconds spent loading the workspace
+        double evaluate = 0.0;  ///< Seconds until the network and all background jobs finished
+        double total() const { return load + evaluate; }
+    };
+
+    InviwoApplicationHeadless(std::string displayName) : InviwoApplication(displayName) {
+        setPostEnqueueFront([this]() {
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                enqueued_ = true;
+            }
+            enqueuedCondition_.notify_one();
+        });
+    }
+    virtual ~InviwoApplicationHeadless() { setPostEnqueueFront(nullptr); }
+
+    /**
+     * Register all modules of the application except OpenGL, GLFW, and the Qt modules, and
+     * every module depending on those.
+     * @return the names of the modules that were skipped.
+     */
+    std::vector<std::string> registerHeadlessModules() {
+        auto modules = inviwo::getModuleList();
+        std::vector<std::string> excluded{"OpenGL", "GLFW"};
+        for (const auto& module : modules) {
+            if (toLower(module->name).find("qt") != std::string::npos) {
+                excluded.push_back(module->name);
+            }
+        }
+        auto skipped = removeModuleFactoryObjectsAndDependents(modules, excluded);
+        for (const auto& name : skipped) {
+            LogInfo("Skipping module '" << name << "', it requires OpenGL or Qt");
+        }
+        registerModules(std::move(modules));
+        return skipped;
+    }
+
+    /**
+     * Load a workspace, processors that can not be created are logged and skipped. The network
+     * is evaluated when the loading is done.
+     * @return the time spent loading and evaluating in seconds.
+     */
+    double load(const std::string& workspace) {
+        const auto start = clock::now();
+        {
+            NetworkLock lock(getProcessorNetwork());
+            loadWorkspace(workspace);
+        }
+        return seconds(clock::now() - start);
+    }
+
+    /**
+     * Process the front queue until the network is evaluated and at most \p maxJobs background
+     * jobs are still running. The front queue is drained before the jobs are checked. While too
+     * many jobs are running, sleeps until something is enqueued to the front queue, or at most
+     * \p pollInterval, since a job can finish without enqueueing anything.
+     * @return the time spent waiting in seconds.
+     */
+    double waitForNetwork(int maxJobs,
+                          std::chrono::milliseconds pollInterval = std::chrono::milliseconds{10}) {
+        const auto start = clock::now();
+        waitForPool();
+        auto network = getProcessorNetwork();
+        while (true) {
+            // processing the front queue might enqueue more
+            while (processFront() > 0) {
+            }
+            if (network->runningBackgroundJobs() <= maxJobs) break;
+
+            std::unique_lock<std::mutex> lock{mutex_};
+            enqueuedCondition_.wait_for(lock, pollInterval, [this]() { return enqueued_; });
+            enqueued_ = false;
+        }
+        return seconds(clock::now() - start);
+    }
+
+    /**
+     * Load a workspace and wait for the network and all background jobs to finish. The network
+     * is locked while loading, so the evaluation is not included in the load time.
+     */
+    RunTiming run(const std::string& workspace) {
+        RunTiming timing;
+        auto start = clock::now();
+        {
+            NetworkLock lock(getProcessorNetwork());
+            loadWorkspace(workspace);
+            const auto loaded = clock::now();
+            timing.load = seconds(loaded - start);
+            start = loaded;
+        }  // Unlocking the network triggers the evaluation
+        waitForNetwork(0);
+        timing.evaluate = seconds(clock::now() - start);
+
+        LogInfo("Evaluated " << workspace << " in " << timing.total() << "s (load " << timing.load
+                             << "s, evaluate " << timing.evaluate << "s)");
+        return timing;
+    }
+
+private:
+    static double seconds(clock::duration duration) {
+        return std::chrono::duration<double>(duration).count();
+    }
+
+    void loadWorkspace(const std::string& workspace) {
+        getProcessorNetwork()->clear();
+        getWorkspaceManager()->load(workspace, [&](ExceptionContext ec) {
+            try {
+                throw;
+            } catch (const IgnoreException& e) {
+                util::log(e.getContext(),
+                          "Incomplete network loading " + workspace + " due to " + e.getMessage(),
+                          LogLevel::Error);
+            }
+        });
+    }
+
+    std::mutex mutex_;
+    std::condition_variable enqueuedCondition_;
+    bool enqueued_ = false;
+};
+
+}  // namespace
+
+}  // namespace inviwo
+
+PYBIND11_MODULE(inviwoheadless, m) {
+    using namespace inviwo;
+    using RunTiming = InviwoApplicationHeadless::RunTiming;
+
+    auto inviwopy = py::module::import("inviwopy");
+
+    py::class_<RunTiming>(m, "RunTiming")
+        .def_readonly("load", &RunTiming::load)
+        .def_readonly("evaluate", &RunTiming::evaluate)
+        .def_property_readonly("total", &RunTiming::total)
+        .def("__repr__", [](const RunTiming& t) {
+            return "<RunTiming: load = " + toString(t.load) +
+                   "s, evaluate = " + toString(t.evaluate) + "s>";
+        });
+
+    py::class_<InviwoApplicationHeadless, InviwoApplication>(m, "InviwoApplicationHeadless",
+                                                             py::multiple_inheritance{})
+        .def(py::init<std::string>(), py::arg("appName") = "inviwo")
+        .def("registerModules", &InviwoApplicationHeadless::registerHeadlessModules)
+        .def("runningBackgroundJobs",
+             [](InviwoApplicationHeadless* app) {
+                 return app->getProcessorNetwork()->runningBackgroundJobs();
+             })
+        .def("load", &InviwoApplicationHeadless::load, py::arg("workspace"))
+        .def("waitForNetwork",
+             [](InviwoApplicationHeadless* app, int maxJobs) {
+                 return app->waitForNetwork(maxJobs);
+             },
+             py::arg("maxJobs") = 0)
+        .def("run", &InviwoApplicationHeadless::run, py::arg("workspace"));
+
+    m.add_object("py", inviwopy);
+    m.doc() = "Headless python inviwo application, evaluates networks without Qt or OpenGL";
+}
@@ -76,7 +76,7 @@ function(ivw_generate_shader_resource parent_path)
         set(outfile "${CMAKE_CURRENT_BINARY_DIR}/include/${headerpath}")
         set(cmd "${cmd}ivw_generate_shader_header(\"${varName}\" \"${shader_path}\" \"${outfile}\")\n")
         set(includes "${includes}#include <${headerpath}>\n")
-        set(resources "${resources}    manager->addShaderResource(\"${shaderkey}\", ${varName});\n")
+        set(resources "${resources}    manager->addEmbeddedShaderResource(\"${shaderkey}\", ${varName});\n")
     endforeach()
 
     file(WRITE ${CMAKE_CURRENT_BINARY_DIR}/create_shader_resource.cmake ${cmd})
@@ -40,6 +40,44 @@ function(ivw_retrieve_all_modules module_list)
     set(${module_list} ${ivw_all_registered_modules} PARENT_SCOPE)
 endfunction()
 
+#--------------------------------------------------------------------
+# Remove modules and every module that depends on them, directly or
+# indirectly, from a list of modules.
+# Example: ivw_remove_modules_and_dependents(headless_modules
+#              MODULES ${enabled_modules} REMOVE InviwoOpenGLModule InviwoQtWidgetsModule)
+function(ivw_remove_modules_and_dependents retval)
+    set(options "")
+    set(oneValueArgs "")
+    set(multiValueArgs MODULES REMOVE)
+    cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    set(removed ${ARG_REMOVE})
+    set(changed ON)
+    while(changed)
+        set(changed OFF)
+        foreach(module ${ARG_MODULES})
+            list(FIND removed ${module} found)
+            if(${found} EQUAL -1)
+                ivw_mod_name_to_mod_dep(mod ${module})
+                foreach(dependency ${${mod}_dependencies})
+                    list(FIND removed ${dependency} dep_found)
+                    if(NOT ${dep_found} EQUAL -1)
+                        list(APPEND removed ${module})
+                        set(changed ON)
+                        break()
+                    endif()
+                endforeach()
+            endif()
+        endforeach()
+    endwhile()
+
+    set(the_list ${ARG_MODULES})
+    if(removed)
+        list(REMOVE_ITEM the_list ${removed})
+    endif()
+    set(${retval} ${the_list} PARENT_SCOPE)
+endfunction()
+
 #--------------------------------------------------------------------
 # Determine application dependencies. 
 # Creates a list of enabled modules in executable directory if runtime
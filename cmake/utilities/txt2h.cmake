@@ -33,8 +33,8 @@ function(ivw_text_to_header string_name retval)
     string(TOUPPER ${string_name} u_string_name)
     set(the_list "#ifndef ${u_string_name}\n")
     set(the_list "${the_list}#define ${u_string_name}\n\n")
-    set(the_list "${the_list}#include <string>\n\n")
-    set(the_list "${the_list}const std::string ${string_name} =\n")
+    set(the_list "${the_list}#include <string_view>\n\n")
+    set(the_list "${the_list}constexpr std::string_view ${string_name} =\n")
     set(items "${ARGN}")
     string(REPLACE "\\" "\\\\" items ${items})
     string(REPLACE "\"" "\\\"" items ${items})
@@ -62,6 +62,7 @@ class ProcessorNetwork;
 class ProcessorNetworkEvaluator;
 class CommandLineParser;
 struct AppResourceManagerObserver;
+struct AppRepresentationBudgetObserver;
 
 class ResourceManager;
 class CameraFactory;
@@ -479,6 +480,7 @@ protected:
     ModuleManager moduleManager_;
     std::unique_ptr<ProcessorNetwork> processorNetwork_;
     std::unique_ptr<ProcessorNetworkEvaluator> processorNetworkEvaluator_;
+    std::unique_ptr<AppRepresentationBudgetObserver> representationBudgetObserver_;
     std::unique_ptr<WorkspaceManager> workspaceManager_;
     std::unique_ptr<PropertyPresetManager> propertyPresetManager_;
     std::unique_ptr<PortInspectorManager> portInspectorManager_;
@@ -119,4 +119,18 @@ IVW_CORE_API void topologicalModuleFactoryObjectSort(
     std::vector<std::unique_ptr<InviwoModuleFactoryObject>>::iterator start,
     std::vector<std::unique_ptr<InviwoModuleFactoryObject>>::iterator end);
 
+/**
+ * \brief Remove modules and all modules that depend on them
+ *
+ * Removes the modules named in \p names, and every module that directly or indirectly depends on
+ * any of them, from \p modules. Names are compared case insensitively.
+ *
+ * @param modules Module factory objects to filter
+ * @param names Names of the modules to remove
+ * @return The names of the removed modules
+ */
+IVW_CORE_API std::vector<std::string> removeModuleFactoryObjectsAndDependents(
+    std::vector<std::unique_ptr<InviwoModuleFactoryObject>>& modules,
+    const std::vector<std::string>& names);
+
 }  // namespace inviwo
@@ -40,6 +40,7 @@
 
 #include <warn/push>
 #include <warn/ignore/all>
+#include <chrono>
 #include <set>
 #include <vector>
 #include <memory>
@@ -60,6 +61,17 @@ class IVW_CORE_API ModuleManager {
 public:
     using IdSet = std::set<std::string, CaseInsensitiveCompare>;
 
+    /**
+     * Time spent in one step of the module registration. There is one entry per module for
+     * the construction of the module, which includes registering all its processors, properties,
+     * readers etc. Other steps, like loading the libraries of runtime modules and retrieving the
+     * capabilities, have their own entries.
+     */
+    struct RegistrationTime {
+        std::string name;  ///< Module name or name of the registration step
+        std::chrono::duration<double, std::milli> duration;
+    };
+
     ModuleManager(InviwoApplication* app);
     ModuleManager(const ModuleManager& rhs) = delete;
     ModuleManager& operator=(const ModuleManager& that) = delete;
@@ -131,6 +143,11 @@ public:
     bool isProtected(const std::string& module) const;
     void addProtectedIdentifier(const std::string& id);
 
+    /**
+     * \brief Time spent in each step of all calls to registerModules, in registration order
+     */
+    const std::vector<RegistrationTime>& getRegistrationTimes() const;
+
     static std::function<bool(const std::string&)> getEnabledFilter();
     void reloadModules();
 
@@ -155,6 +172,7 @@ private:
     util::OnScopeExit clearLibs_;
     std::vector<std::unique_ptr<InviwoModuleFactoryObject>> factoryObjects_;
     std::vector<std::unique_ptr<InviwoModule>> modules_;
+    std::vector<RegistrationTime> registrationTimes_;
     util::OnScopeExit clearModules_;
 };
 
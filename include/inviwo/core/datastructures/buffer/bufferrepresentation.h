@@ -56,6 +56,11 @@ public:
      * Return size of buffer element in bytes.
      */
     virtual size_t getSizeOfElement() const;
+    /**
+     * Return the number of bytes of buffer data held by the representation, i.e. the number of
+     * elements times the size of an element.
+     */
+    virtual size_t getNumberOfBytes() const;
     BufferUsage getBufferUsage() const;
     BufferTarget getBufferTarget() const;
 
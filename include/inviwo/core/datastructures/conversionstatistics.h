@@ -0,0 +1,83 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <typeindex>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * \brief Global counters of the representation conversions done in Data::getRepresentation
+ *
+ * Counts the number of conversions and the number of bytes of the resulting representations for
+ * each pair of source and destination representation types. Recording is disabled by default,
+ * and has to be turned on using setEnabled, EvaluationStatistics will do that for example.
+ * All functions are thread safe since conversions can happen in background threads.
+ * @see EvaluationStatistics
+ */
+class IVW_CORE_API ConversionStatistics {
+public:
+    struct Entry {
+        std::type_index source;
+        std::type_index destination;
+        size_t count;
+        size_t bytes;
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /**
+     * Record one conversion from source to destination producing a representation holding
+     * bytes number of bytes. Does nothing unless recording is enabled.
+     */
+    static void record(std::type_index source, std::type_index destination, size_t bytes);
+
+    /**
+     * Get the counters for all recorded pairs of source and destination representations.
+     */
+    static std::vector<Entry> getEntries();
+
+    /**
+     * Get the sum of conversions and bytes over all pairs of representations.
+     * @return a pair of the total number of conversions and total number of bytes
+     */
+    static std::pair<size_t, size_t> getTotals();
+
+    static void reset();
+};
+
+}  // namespace inviwo
@@ -33,11 +33,17 @@
 #include <inviwo/core/datastructures/representationfactory.h>
 #include <inviwo/core/datastructures/representationconverterfactory.h>
 #include <inviwo/core/datastructures/representationfactorymanager.h>
+#include <inviwo/core/datastructures/conversionstatistics.h>
+#include <inviwo/core/datastructures/representationmanager.h>
 
+#include <inviwo/tracy/tracy.h>
+
+#include <algorithm>
 #include <typeindex>
 #include <mutex>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace inviwo {
 
@@ -106,6 +112,22 @@ public:
     template <typename T>
     const T* getRepresentation() const;
 
+    /**
+     * Get a representation of type T, see getRepresentation, and share the ownership of it.
+     * Use this when a representation is kept after the data has been processed, for example in a
+     * sampler. As long as the returned pointer is held, releaseRepresentation will not remove the
+     * representation.
+     */
+    template <typename T>
+    std::shared_ptr<const T> getSharedRepresentation() const;
+
+    /**
+     * Share the ownership of a representation of this Data object.
+     * @return the representation or nullptr if it is not a representation of this Data object
+     * @see getSharedRepresentation
+     */
+    std::shared_ptr<const Repr> shareRepresentation(const Repr* representation) const;
+
     /**
      * Get an editable representation. This will invalidate all other representations.
      * They will now have to be updated from this one before use.
@@ -165,6 +187,29 @@ public:
      */
     void invalidateAllOther(const Repr* repr);
 
+    /**
+     * Get the number of bytes held by each of the representations together with the type of the
+     * representation. See for example VolumeRepresentation::getNumberOfBytes.
+     */
+    std::vector<std::pair<std::type_index, size_t>> getRepresentationSizes() const;
+
+    /**
+     * Remove the representation if it can be recreated, that is if it is invalid or if there is a
+     * converter from another valid representation. If a replacement is given and there is no
+     * representation of the same type, it is added as a valid representation before the check,
+     * and removed again if the representation could not be released. Representations shared by
+     * getSharedRepresentation or shareRepresentation are never released.
+     * Used by the RepresentationManager to release memory.
+     * @note Any raw pointer to the released representation will be dangling.
+     * @param representation the representation to release
+     * @param replacement an optional representation holding the same data, for example a disk
+     * representation
+     * @return true if the representation was removed
+     * @see RepresentationManager
+     */
+    bool releaseRepresentation(const Repr* representation,
+                               std::shared_ptr<Repr> replacement = nullptr) const;
+
 protected:
     Data() = default;
     Data(const Data<Self, Repr>& rhs);
@@ -218,6 +263,23 @@ const T* Data<Self, Repr>::getRepresentation() const {
     }
 }
 
+template <typename Self, typename Repr>
+template <typename T>
+std::shared_ptr<const T> Data<Self, Repr>::getSharedRepresentation() const {
+    const auto* repr = getRepresentation<T>();
+    return std::shared_ptr<const T>(shareRepresentation(repr), repr);
+}
+
+template <typename Self, typename Repr>
+std::shared_ptr<const Repr> Data<Self, Repr>::shareRepresentation(
+    const Repr* representation) const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (auto& elem : representations_) {
+        if (elem.second.get() == representation) return elem.second;
+    }
+    return nullptr;
+}
+
 template <typename Self, typename Repr>
 template <typename T>
 const T* Data<Self, Repr>::getValidRepresentation() const {
@@ -226,6 +288,9 @@ const T* Data<Self, Repr>::getValidRepresentation() const {
                                                            std::type_index(typeid(T)))) {
         for (auto converter : package->getConverters()) {
             auto dest = converter->getConverterID().second;
+            TRACY_ZONE_SCOPED_NC("Representation Conversion", 0xCC6600);
+            TRACY_ZONE_TEXT(dest.name(), std::char_traits<char>::length(dest.name()));
+            const auto source = converter->getConverterID().first;
             auto it = representations_.find(dest);
             if (it != representations_.end()) {  // Next repr. already exist, just update it
                 converter->update(lastValidRepresentation_, it->second);
@@ -236,6 +301,10 @@ const T* Data<Self, Repr>::getValidRepresentation() const {
                 if (!result) throw ConverterException("Converter failed to create", IVW_CONTEXT);
                 lastValidRepresentation_ = addRepresentationInternal(result);
             }
+            if (ConversionStatistics::isEnabled()) {
+                ConversionStatistics::record(source, dest,
+                                             lastValidRepresentation_->getNumberOfBytes());
+            }
         }
         return dynamic_cast<const T*>(lastValidRepresentation_.get());
     } else {
@@ -296,6 +365,7 @@ std::shared_ptr<Repr> Data<Self, Repr>::addRepresentationInternal(
     repr->setValid(true);
     repr->setOwner(static_cast<const Self*>(this));
     representations_[repr->getTypeIndex()] = repr;
+    if (RepresentationManager::isEnabled()) RepresentationManager::track(repr);
     return repr;
 }
 
@@ -348,6 +418,63 @@ void Data<Self, Repr>::removeOtherRepresentations(const Repr* representation) {
     std::swap(repr, representations_);
 }
 
+template <typename Self, typename Repr>
+std::vector<std::pair<std::type_index, size_t>> Data<Self, Repr>::getRepresentationSizes() const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::vector<std::pair<std::type_index, size_t>> sizes;
+    sizes.reserve(representations_.size());
+    for (const auto& elem : representations_) {
+        sizes.emplace_back(elem.first, elem.second->getNumberOfBytes());
+    }
+    return sizes;
+}
+
+template <typename Self, typename Repr>
+bool Data<Self, Repr>::releaseRepresentation(const Repr* representation,
+                                             std::shared_ptr<Repr> replacement) const {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto it = std::find_if(representations_.begin(), representations_.end(),
+                           [&](auto& elem) { return elem.second.get() == representation; });
+    if (it == representations_.end()) return false;
+
+    // Shared outside of this object, see shareRepresentation
+    const long owners = lastValidRepresentation_ == it->second ? 2 : 1;
+    if (it->second.use_count() > owners) return false;
+
+    bool inserted = false;
+    if (replacement) {
+        const auto type = replacement->getTypeIndex();
+        if (type == it->first) return false;
+        // Never overwrite an existing representation, it might be the only one we can reload
+        if (representations_.find(type) == representations_.end()) {
+            addRepresentationInternal(replacement);
+            inserted = true;
+            // The insertion might have rehashed the map
+            it = std::find_if(representations_.begin(), representations_.end(),
+                              [&](auto& elem) { return elem.second.get() == representation; });
+        }
+    }
+
+    auto release = [&](const std::shared_ptr<Repr>& source) {
+        if (lastValidRepresentation_ == it->second) lastValidRepresentation_ = source;
+        representations_.erase(it);
+        return true;
+    };
+
+    auto factory = RepresentationFactoryManager::getRepresentationConverterFactory<Repr>();
+    for (auto& elem : representations_) {
+        if (elem.second.get() == representation || !elem.second->isValid()) continue;
+        if (!representation->isValid() ||
+            factory->getRepresentationConverter(elem.first, it->first)) {
+            return release(elem.second);
+        }
+    }
+
+    if (inserted) representations_.erase(replacement->getTypeIndex());
+    return false;
+}
+
 template <typename Self, typename Repr>
 bool Data<Self, Repr>::hasRepresentations() const {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -32,6 +32,7 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/glm.h>
 
+#include <functional>
 #include <iterator>
 #include <vector>
 
@@ -76,8 +77,14 @@ protected:
 class IVW_CORE_API HistogramContainer {
 public:
     HistogramContainer() = default;
+    /**
+     * Calculate one histogram per component of the values in [begin, end). If \p stop is set it
+     * is called regularly and the calculation is aborted if it returns true, leaving the container
+     * empty.
+     */
     template <typename FirstIter, typename LastIter>
-    HistogramContainer(dvec2 range, size_t bins, FirstIter begin, LastIter end);
+    HistogramContainer(dvec2 range, size_t bins, FirstIter begin, LastIter end,
+                       const std::function<bool()>& stop = nullptr);
 
     const NormalizedHistogram& operator[](size_t i) const;
     const NormalizedHistogram& get(size_t i) const;
@@ -96,7 +103,7 @@ private:
 
 template <typename FirstIter, typename LastIter>
 HistogramContainer::HistogramContainer(dvec2 dataRange, size_t bins, FirstIter begin,
-                                       LastIter end) {
+                                       LastIter end, const std::function<bool()>& stop) {
     using T = typename std::iterator_traits<FirstIter>::value_type;
 
     // a double type with the same extent as T
@@ -126,6 +133,7 @@ HistogramContainer::HistogramContainer(dvec2 dataRange, size_t bins, FirstIter b
     const D rangeScaleFactor(static_cast<double>(bins - 1) / (dataRange.y - dataRange.x));
 
     for (; begin != end; ++begin) {
+        if (stop && (count & 0xFFFF) == 0 && stop()) return;
 
         const auto val = static_cast<D>(*begin);
 
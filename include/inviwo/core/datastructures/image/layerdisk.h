@@ -87,6 +87,11 @@ public:
     virtual void setWrapping(const Wrapping2D& wrapping) override;
     virtual Wrapping2D getWrapping() const override;
 
+    /**
+     * The data is not held in memory, hence 0.
+     */
+    virtual size_t getNumberOfBytes() const override;
+
 private:
     // clang-format off
     [[deprecated("does not work for DiskRepresentation (deprecated since 2019-06-27)")]]
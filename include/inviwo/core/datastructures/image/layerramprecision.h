@@ -30,6 +30,9 @@
 #pragma once
 
 #include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/storagepool.h>
+
+#include <inviwo/tracy/tracymemory.h>
 
 #include <algorithm>
 
@@ -48,6 +51,15 @@ public:
                                const SwizzleMask& swizzleMask = swizzlemasks::rgba,
                                InterpolationType interpolation = InterpolationType::Linear,
                                const Wrapping2D& wrap = wrapping2d::clampAll);
+    /**
+     * Create a layer allocated from the StoragePool. Use StorageInit::Uninitialized to avoid
+     * clearing the data when all of it will be overwritten anyway. Otherwise depth layers are
+     * cleared to 1 and other layers to 0.
+     */
+    LayerRAMPrecision(size2_t dimensions, StorageInit init, LayerType type = LayerType::Color,
+                      const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                      InterpolationType interpolation = InterpolationType::Linear,
+                      const Wrapping2D& wrap = wrapping2d::clampAll);
     LayerRAMPrecision(T* data, size2_t dimensions, LayerType type = LayerType::Color,
                       const SwizzleMask& swizzleMask = swizzlemasks::rgba,
                       InterpolationType interpolation = InterpolationType::Linear,
@@ -55,7 +67,7 @@ public:
     LayerRAMPrecision(const LayerRAMPrecision<T>& rhs);
     LayerRAMPrecision<T>& operator=(const LayerRAMPrecision<T>& that);
     virtual LayerRAMPrecision<T>* clone() const override;
-    virtual ~LayerRAMPrecision() = default;
+    virtual ~LayerRAMPrecision();
 
     T* getDataTyped();
     const T* getDataTyped() const;
@@ -102,7 +114,7 @@ public:
 
 private:
     size2_t dimensions_;
-    std::unique_ptr<T[]> data_;
+    util::StoragePtr<T> data_;
     SwizzleMask swizzleMask_;
     InterpolationType interpolation_;
     Wrapping2D wrapping_;
@@ -132,24 +144,45 @@ LayerRAMPrecision<T>::LayerRAMPrecision(size2_t dimensions, LayerType type,
                                         InterpolationType interpolation, const Wrapping2D& wrapping)
     : LayerRAM(type, DataFormat<T>::get())
     , dimensions_(dimensions)
-    , data_(new T[dimensions_.x * dimensions_.y]())
+    , data_(util::allocateStorage<T>(dimensions_.x * dimensions_.y, StorageInit::Uninitialized))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
+    TRACY_REPR_ALLOC(data_.get(), glm::compMul(dimensions_) * sizeof(T));
     std::fill(data_.get(), data_.get() + glm::compMul(dimensions_),
               (type == LayerType::Depth) ? T{1} : T{0});
 }
 
+template <typename T>
+LayerRAMPrecision<T>::LayerRAMPrecision(size2_t dimensions, StorageInit init, LayerType type,
+                                        const SwizzleMask& swizzleMask,
+                                        InterpolationType interpolation, const Wrapping2D& wrapping)
+    : LayerRAM(type, DataFormat<T>::get())
+    , dimensions_(dimensions)
+    , data_(util::allocateStorage<T>(dimensions_.x * dimensions_.y, StorageInit::Uninitialized))
+    , swizzleMask_(swizzleMask)
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {
+    TRACY_REPR_ALLOC(data_.get(), glm::compMul(dimensions_) * sizeof(T));
+    if (init == StorageInit::Zero) {
+        std::fill(data_.get(), data_.get() + glm::compMul(dimensions_),
+                  (type == LayerType::Depth) ? T{1} : T{0});
+    }
+}
+
 template <typename T>
 LayerRAMPrecision<T>::LayerRAMPrecision(T* data, size2_t dimensions, LayerType type,
                                         const SwizzleMask& swizzleMask,
                                         InterpolationType interpolation, const Wrapping2D& wrapping)
     : LayerRAM(type, DataFormat<T>::get())
     , dimensions_(dimensions)
-    , data_(data ? data : new T[dimensions_.x * dimensions_.y]())
+    , data_(data ? util::adoptStorage(data)
+                 : util::allocateStorage<T>(dimensions_.x * dimensions_.y,
+                                            StorageInit::Uninitialized))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
+    TRACY_REPR_ALLOC(data_.get(), glm::compMul(dimensions_) * sizeof(T));
     if (!data) {
         std::fill(data_.get(), data_.get() + glm::compMul(dimensions_),
                   (type == LayerType::Depth) ? T{1} : T{0});
@@ -160,10 +193,11 @@ template <typename T>
 LayerRAMPrecision<T>::LayerRAMPrecision(const LayerRAMPrecision<T>& rhs)
     : LayerRAM(rhs)
     , dimensions_(rhs.dimensions_)
-    , data_(new T[dimensions_.x * dimensions_.y])
+    , data_(util::allocateStorage<T>(dimensions_.x * dimensions_.y, StorageInit::Uninitialized))
     , swizzleMask_(rhs.swizzleMask_)
     , interpolation_{rhs.interpolation_}
     , wrapping_{rhs.wrapping_} {
+    TRACY_REPR_ALLOC(data_.get(), glm::compMul(dimensions_) * sizeof(T));
     std::memcpy(data_.get(), rhs.data_.get(), dimensions_.x * dimensions_.y * sizeof(T));
 }
 
@@ -173,8 +207,10 @@ LayerRAMPrecision<T>& LayerRAMPrecision<T>::operator=(const LayerRAMPrecision<T>
         LayerRAM::operator=(that);
 
         const auto dim = that.dimensions_;
-        auto data = std::make_unique<T[]>(dim.x * dim.y);
+        auto data = util::allocateStorage<T>(dim.x * dim.y, StorageInit::Uninitialized);
         std::memcpy(data.get(), that.data_.get(), dim.x * dim.y * sizeof(T));
+        TRACY_REPR_FREE(data_.get());
+        TRACY_REPR_ALLOC(data.get(), glm::compMul(dim) * sizeof(T));
         data_.swap(data);
 
         dimensions_ = that.dimensions_;
@@ -185,6 +221,11 @@ LayerRAMPrecision<T>& LayerRAMPrecision<T>::operator=(const LayerRAMPrecision<T>
     return *this;
 }
 
+template <typename T>
+LayerRAMPrecision<T>::~LayerRAMPrecision() {
+    TRACY_REPR_FREE(data_.get());
+}
+
 template <typename T>
 LayerRAMPrecision<T>* LayerRAMPrecision<T>::clone() const {
     return new LayerRAMPrecision<T>(*this);
@@ -211,15 +252,19 @@ const void* LayerRAMPrecision<T>::getData() const {
 
 template <typename T>
 void inviwo::LayerRAMPrecision<T>::setData(void* d, size2_t dimensions) {
-    std::unique_ptr<T[]> data(static_cast<T*>(d));
+    TRACY_REPR_FREE(data_.get());
+    auto data = util::adoptStorage(static_cast<T*>(d));
     data_.swap(data);
     std::swap(dimensions_, dimensions);
+    TRACY_REPR_ALLOC(data_.get(), glm::compMul(dimensions_) * sizeof(T));
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setDimensions(size2_t dimensions) {
     if (dimensions != dimensions_) {
-        auto data = std::make_unique<T[]>(dimensions.x * dimensions.y);
+        auto data = util::allocateStorage<T>(dimensions.x * dimensions.y);
+        TRACY_REPR_FREE(data_.get());
+        TRACY_REPR_ALLOC(data.get(), glm::compMul(dimensions) * sizeof(T));
         data_.swap(data);
         std::swap(dimensions, dimensions_);
     }
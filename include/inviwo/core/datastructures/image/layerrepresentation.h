@@ -85,6 +85,13 @@ public:
      */
     virtual bool copyRepresentationsTo(LayerRepresentation*) const = 0;
 
+    /**
+     * The number of bytes of layer data held by the representation. By default the product of
+     * the dimensions and the size of the data format. Representations that do not hold any data
+     * in memory, like LayerDisk, return 0.
+     */
+    virtual size_t getNumberOfBytes() const;
+
     LayerType getLayerType() const;
 
 protected:
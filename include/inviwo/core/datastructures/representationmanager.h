@@ -0,0 +1,108 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <memory>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * \brief Application wide budget for the memory held by RAM representations
+ *
+ * When a budget is set, all representations added to Volume, Layer, and Buffer objects are
+ * tracked. Calling enforceBudget will then, if the RAM representations (VolumeRAM, LayerRAM, and
+ * BufferRAM) use more memory than the budget, release RAM representations in the order they where
+ * created until the usage is within the budget:
+ *   1. RAM representations that are invalid or can be recreated from another valid representation,
+ *      like a VolumeDisk or a VolumeGL, are removed.
+ *   2. If spilling is enabled, the data of VolumeRAM and LayerRAM representations that can not be
+ *      recreated is written to a temporary file, and the RAM representation is replaced by a disk
+ *      representation reading that file.
+ *
+ * In both cases the RAM representation is transparently recreated by the converters on the next
+ * call to getRepresentation.
+ *
+ * Since any raw pointers to a released representation will be dangling, enforceBudget must only
+ * be called when no one holds on to a representation pointer. Representations that are kept for
+ * longer, like the ones used by the volume and image samplers, should be retrieved with
+ * Data::getSharedRepresentation, shared representations are never released. The
+ * InviwoApplication calls enforceBudget after each network evaluation when no background jobs are
+ * running, and the budget is set from the system settings.
+ * All functions are thread safe.
+ * @see Data::releaseRepresentation
+ */
+class IVW_CORE_API RepresentationManager {
+public:
+    struct Result {
+        size_t released = 0;  ///< Number of bytes in removed RAM representations
+        size_t spilled = 0;   ///< Number of bytes written to disk
+    };
+
+    /**
+     * Set the budget in bytes, 0 turns of tracking and releasing of representations.
+     */
+    static void setBudget(size_t bytes);
+    static size_t getBudget();
+    static bool isEnabled();
+
+    static void setSpillToDisk(bool spill);
+    static bool getSpillToDisk();
+
+    /**
+     * Track a representation, called by Data when a representation is added.
+     */
+    template <typename Repr>
+    static void track(const std::shared_ptr<Repr>& representation);
+
+    /**
+     * The number of bytes held by the tracked representations for each type of representation.
+     */
+    static std::vector<std::pair<std::type_index, size_t>> getUsage();
+
+    /**
+     * The number of bytes held by all tracked RAM representations
+     */
+    static size_t getRAMUsage();
+
+    /**
+     * Release RAM representations until the usage is within the budget.
+     * @note Only call this when no representation pointers are held.
+     */
+    static Result enforceBudget();
+};
+
+}  // namespace inviwo
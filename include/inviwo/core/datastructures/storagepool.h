@@ -0,0 +1,144 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * Initialization of newly allocated storage.
+ */
+enum class StorageInit {
+    Zero,          ///< Fill the storage with zeros
+    Uninitialized  ///< Leave the storage uninitialized, use when all the data is overwritten
+};
+
+/**
+ * \ingroup datastructures
+ * \brief A pool of memory for the storage of RAM representations
+ *
+ * Allocations are grouped into size classes, powers of two with four steps in between rounded up
+ * to whole pages, hence at most a fourth of allocations larger than four pages is wasted. Large
+ * allocations are aligned to the huge page size (2 MB). Allocations smaller than a page are not
+ * pooled and not included in the statistics. Memory that is deallocated is kept in the pool, up
+ * to the max cached size, and reused by the next allocation in the same size class. This avoids
+ * repeatedly asking the operating system for memory, and having it zeroed, when for example a
+ * processor creates a new output of the same size in each evaluation.
+ *
+ * VolumeRAMPrecision and LayerRAMPrecision allocate their data from the pool. The max cached size
+ * is set from the system settings, by default nothing is cached outside of an InviwoApplication.
+ * All functions are thread safe.
+ * @see util::allocateStorage
+ */
+class IVW_CORE_API StoragePool {
+public:
+    struct Statistics {
+        size_t allocations = 0;    ///< Number of allocations
+        size_t reused = 0;         ///< Number of allocations served from the pool
+        size_t deallocations = 0;  ///< Number of deallocations
+        size_t liveBytes = 0;      ///< Bytes currently allocated and in use
+        size_t cachedBytes = 0;    ///< Bytes kept in the pool for reuse
+    };
+
+    /**
+     * Allocate at least bytes number of bytes. The memory has to be returned using deallocate,
+     * with the same number of bytes.
+     */
+    static void* allocate(size_t bytes);
+    static void deallocate(void* ptr, size_t bytes);
+
+    /**
+     * Set the maximum number of bytes kept in the pool for reuse, 0 disables the pooling.
+     */
+    static void setMaxCachedBytes(size_t bytes);
+    static size_t getMaxCachedBytes();
+
+    /**
+     * Release all cached memory.
+     */
+    static void clear();
+
+    static Statistics getStatistics();
+    static void resetStatistics();
+};
+
+namespace util {
+
+/**
+ * Deleter for arrays allocated using util::allocateStorage, or using new[] if not pooled.
+ */
+template <typename T>
+struct StorageDeleter {
+    size_t bytes = 0;
+    bool pooled = false;
+
+    void operator()(T* ptr) const {
+        if (pooled) {
+            StoragePool::deallocate(ptr, bytes);
+        } else {
+            delete[] ptr;
+        }
+    }
+};
+
+template <typename T>
+using StoragePtr = std::unique_ptr<T[], StorageDeleter<T>>;
+
+/**
+ * Allocate storage for size elements of T from the StoragePool.
+ */
+template <typename T>
+StoragePtr<T> allocateStorage(size_t size, StorageInit init = StorageInit::Zero) {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "Pooled storage is only supported for trivial types");
+    const auto bytes = size * sizeof(T);
+    auto ptr = static_cast<T*>(StoragePool::allocate(bytes));
+    if (init == StorageInit::Zero) std::memset(ptr, 0, bytes);
+    return StoragePtr<T>(ptr, StorageDeleter<T>{bytes, true});
+}
+
+/**
+ * Take ownership of an array allocated using new[].
+ */
+template <typename T>
+StoragePtr<T> adoptStorage(T* data) {
+    return StoragePtr<T>(data, StorageDeleter<T>{});
+}
+
+}  // namespace util
+
+}  // namespace inviwo
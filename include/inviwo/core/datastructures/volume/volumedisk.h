@@ -76,6 +76,11 @@ public:
     virtual void setWrapping(const Wrapping3D& wrapping) override;
     virtual Wrapping3D getWrapping() const override;
 
+    /**
+     * The data is not held in memory, hence 0.
+     */
+    virtual size_t getNumberOfBytes() const override;
+
 private:
     size3_t dimensions_;
     SwizzleMask swizzleMask_;
@@ -32,6 +32,9 @@
 #include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/util/glm.h>
 #include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/datastructures/storagepool.h>
+
+#include <inviwo/tracy/tracymemory.h>
 
 namespace inviwo {
 
@@ -47,6 +50,14 @@ public:
                                 const SwizzleMask& swizzleMask = swizzlemasks::rgba,
                                 InterpolationType interpolation = InterpolationType::Linear,
                                 const Wrapping3D& wrapping = wrapping3d::clampAll);
+    /**
+     * Create a volume allocated from the StoragePool. Use StorageInit::Uninitialized to avoid
+     * clearing the data when all of it will be overwritten anyway.
+     */
+    VolumeRAMPrecision(size3_t dimensions, StorageInit init,
+                       const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                       InterpolationType interpolation = InterpolationType::Linear,
+                       const Wrapping3D& wrapping = wrapping3d::clampAll);
     VolumeRAMPrecision(T* data, size3_t dimensions,
                        const SwizzleMask& swizzleMask = swizzlemasks::rgba,
                        InterpolationType interpolation = InterpolationType::Linear,
@@ -111,7 +122,7 @@ public:
 private:
     size3_t dimensions_;
     bool ownsDataPtr_;
-    std::unique_ptr<T[]> data_;
+    util::StoragePtr<T> data_;
     SwizzleMask swizzleMask_;
     InterpolationType interpolation_;
     Wrapping3D wrapping_;
@@ -142,10 +153,27 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(size3_t dimensions, const SwizzleMask&
     : VolumeRAM(DataFormat<T>::get())
     , dimensions_(dimensions)
     , ownsDataPtr_(true)
-    , data_(new T[dimensions_.x * dimensions_.y * dimensions_.z]())
+    , data_(util::allocateStorage<T>(dimensions_.x * dimensions_.y * dimensions_.z))
+    , swizzleMask_(swizzleMask)
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {
+    TRACY_REPR_ALLOC(data_.get(), getNumberOfBytes());
+}
+
+template <typename T>
+VolumeRAMPrecision<T>::VolumeRAMPrecision(size3_t dimensions, StorageInit init,
+                                          const SwizzleMask& swizzleMask,
+                                          InterpolationType interpolation,
+                                          const Wrapping3D& wrapping)
+    : VolumeRAM(DataFormat<T>::get())
+    , dimensions_(dimensions)
+    , ownsDataPtr_(true)
+    , data_(util::allocateStorage<T>(dimensions_.x * dimensions_.y * dimensions_.z, init))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
-    , wrapping_{wrapping} {}
+    , wrapping_{wrapping} {
+    TRACY_REPR_ALLOC(data_.get(), getNumberOfBytes());
+}
 
 template <typename T>
 VolumeRAMPrecision<T>::VolumeRAMPrecision(T* data, size3_t dimensions,
@@ -155,20 +183,25 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(T* data, size3_t dimensions,
     : VolumeRAM(DataFormat<T>::get())
     , dimensions_(dimensions)
     , ownsDataPtr_(true)
-    , data_(data ? data : new T[dimensions_.x * dimensions_.y * dimensions_.z]())
+    , data_(data ? util::adoptStorage(data)
+                 : util::allocateStorage<T>(dimensions_.x * dimensions_.y * dimensions_.z))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
-    , wrapping_{wrapping} {}
+    , wrapping_{wrapping} {
+    TRACY_REPR_ALLOC(data_.get(), getNumberOfBytes());
+}
 
 template <typename T>
 VolumeRAMPrecision<T>::VolumeRAMPrecision(const VolumeRAMPrecision<T>& rhs)
     : VolumeRAM(rhs)
     , dimensions_(rhs.dimensions_)
     , ownsDataPtr_(true)
-    , data_(new T[dimensions_.x * dimensions_.y * dimensions_.z])
+    , data_(util::allocateStorage<T>(dimensions_.x * dimensions_.y * dimensions_.z,
+                                     StorageInit::Uninitialized))
     , swizzleMask_(rhs.swizzleMask_)
     , interpolation_{rhs.interpolation_}
     , wrapping_{rhs.wrapping_} {
+    TRACY_REPR_ALLOC(data_.get(), getNumberOfBytes());
     std::memcpy(data_.get(), rhs.data_.get(),
                 dimensions_.x * dimensions_.y * dimensions_.z * sizeof(T));
 }
@@ -178,8 +211,12 @@ VolumeRAMPrecision<T>& VolumeRAMPrecision<T>::operator=(const VolumeRAMPrecision
     if (this != &that) {
         VolumeRAM::operator=(that);
         auto dim = that.dimensions_;
-        auto data = std::make_unique<T[]>(dim.x * dim.y * dim.z);
+        auto data = util::allocateStorage<T>(dim.x * dim.y * dim.z, StorageInit::Uninitialized);
         std::memcpy(data.get(), that.data_.get(), dim.x * dim.y * dim.z * sizeof(T));
+        TRACY_REPR_ALLOC(data.get(), dim.x * dim.y * dim.z * sizeof(T));
+        if (ownsDataPtr_) {
+            TRACY_REPR_FREE(data_.get());
+        }
         data_.swap(data);
         std::swap(dim, dimensions_);
         ownsDataPtr_ = true;
@@ -192,7 +229,11 @@ VolumeRAMPrecision<T>& VolumeRAMPrecision<T>::operator=(const VolumeRAMPrecision
 
 template <typename T>
 VolumeRAMPrecision<T>::~VolumeRAMPrecision() {
-    if (!ownsDataPtr_) data_.release();
+    if (!ownsDataPtr_) {
+        data_.release();
+    } else {
+        TRACY_REPR_FREE(data_.get());
+    }
 }
 
 template <typename T>
@@ -231,9 +272,13 @@ const void* VolumeRAMPrecision<T>::getData(size_t pos) const {
 
 template <typename T>
 void VolumeRAMPrecision<T>::setData(void* d, size3_t dimensions) {
-    std::unique_ptr<T[]> data(static_cast<T*>(d));
+    if (ownsDataPtr_) {
+        TRACY_REPR_FREE(data_.get());
+    }
+    auto data = util::adoptStorage(static_cast<T*>(d));
     data_.swap(data);
     std::swap(dimensions_, dimensions);
+    TRACY_REPR_ALLOC(data_.get(), getNumberOfBytes());
 
     if (!ownsDataPtr_) data.release();
     ownsDataPtr_ = true;
@@ -241,6 +286,9 @@ void VolumeRAMPrecision<T>::setData(void* d, size3_t dimensions) {
 
 template <typename T>
 void VolumeRAMPrecision<T>::removeDataOwnership() {
+    if (ownsDataPtr_) {
+        TRACY_REPR_FREE(data_.get());
+    }
     ownsDataPtr_ = false;
 }
 
@@ -257,9 +305,13 @@ size_t VolumeRAMPrecision<T>::getNumberOfBytes() const {
 template <typename T>
 void VolumeRAMPrecision<T>::setDimensions(size3_t dimensions) {
     if (dimensions_ != dimensions) {
-        auto data = std::make_unique<T[]>(dimensions.x * dimensions.y * dimensions.z);
+        auto data = util::allocateStorage<T>(dimensions.x * dimensions.y * dimensions.z);
+        if (ownsDataPtr_) {
+            TRACY_REPR_FREE(data_.get());
+        }
         data_.swap(data);
         dimensions_ = dimensions;
+        TRACY_REPR_ALLOC(data_.get(), getNumberOfBytes());
         if (!ownsDataPtr_) data.release();
         ownsDataPtr_ = true;
     }
@@ -65,6 +65,13 @@ public:
     virtual void setWrapping(const Wrapping3D& wrapping) = 0;
     virtual Wrapping3D getWrapping() const = 0;
 
+    /**
+     * The number of bytes of volume data held by the representation. By default the product of
+     * the dimensions and the size of the data format. Representations that do not hold any data
+     * in memory, like VolumeDisk, return 0.
+     */
+    virtual size_t getNumberOfBytes() const;
+
 protected:
     VolumeRepresentation() = default;
     VolumeRepresentation(const DataFormatBase* format);
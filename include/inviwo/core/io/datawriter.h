@@ -34,6 +34,7 @@
 #include <inviwo/core/util/fileextension.h>
 #include <inviwo/core/util/exception.h>
 
+#include <type_traits>
 #include <vector>
 
 namespace inviwo {
@@ -65,10 +66,22 @@ private:
 /**
  * \ingroup dataio
  */
+namespace detail {
+// Data types without representations, like DataFrame, get void as representation type
+template <typename T, typename = void>
+struct DataWriterRepr {
+    using type = void;
+};
+template <typename T>
+struct DataWriterRepr<T, std::void_t<typename T::repr>> {
+    using type = typename T::repr;
+};
+}  // namespace detail
+
 template <typename T>
 class DataWriterType : public DataWriter {
 public:
-    using repr = typename T::repr;
+    using repr = typename detail::DataWriterRepr<T>::type;
 
     DataWriterType() = default;
     DataWriterType(const DataWriterType& rhs) = default;
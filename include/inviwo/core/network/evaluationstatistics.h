@@ -0,0 +1,189 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/network/processornetworkevaluationobserver.h>
+#include <inviwo/core/datastructures/conversionstatistics.h>
+
+#include <chrono>
+#include <deque>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+class InviwoApplication;
+class Processor;
+
+/**
+ * \brief Rolling statistics over the last N values added.
+ * The count is the total number of values added, min, mean, and p95 (the 95th percentile)
+ * are computed over the values in the current window.
+ */
+class IVW_CORE_API RollingStatistics {
+public:
+    explicit RollingStatistics(size_t window = 100);
+
+    void add(double value);
+    void clear();
+
+    size_t count() const;
+    double last() const;
+    double min() const;
+    double max() const;
+    double mean() const;
+    double p95() const;
+
+private:
+    std::vector<double> values_;
+    size_t window_;
+    size_t next_;
+    size_t count_;
+};
+
+/**
+ * \brief Collects timing statistics for processor network evaluations
+ *
+ * The EvaluationStatistics observes the ProcessorNetworkEvaluator of the application and records
+ * the time spent in initializeResources, the inport onChange callbacks, and process for each
+ * processor, the time of the whole network evaluation, and the size of the thread pool queue and
+ * the number of representation conversions (see ConversionStatistics) after each evaluation.
+ * Timings are in milliseconds. All events can be exported in the Chrome trace event format to be
+ * inspected in for example chrome://tracing or https://ui.perfetto.dev.
+ *
+ * \code{.cpp}
+ * EvaluationStatistics stats{app};
+ * // load and evaluate a workspace...
+ * for (auto&& [id, processorStats] : stats.getProcessorStatistics()) {
+ *     LogInfo(id << " process mean: " << processorStats.process.mean() << " ms");
+ * }
+ * stats.exportChromeTrace("trace.json");
+ * \endcode
+ * The statistics are only collected while the EvaluationStatistics exists.
+ */
+class IVW_CORE_API EvaluationStatistics : public ProcessorNetworkEvaluationObserver {
+public:
+    using clock = std::chrono::steady_clock;
+
+    struct ProcessorStatistics {
+        explicit ProcessorStatistics(size_t window)
+            : initializeResources{window}, onChange{window}, process{window} {}
+        RollingStatistics initializeResources;
+        RollingStatistics onChange;
+        RollingStatistics process;
+    };
+
+    struct TraceEvent {
+        std::string name;
+        const char* category;  ///< "network", "initializeResources", "onChange", "process", or
+                               ///< "doIfNotReady"
+        clock::duration start;
+        clock::duration duration;
+    };
+
+    struct CounterEvent {
+        clock::duration time;
+        size_t poolQueueSize;
+        size_t conversions;
+        size_t conversionBytes;
+    };
+
+    /**
+     * @param app the application to observe
+     * @param window the number of values used for the rolling statistics
+     * @param maxEvents the maximum number of trace events to keep, the oldest events are discarded
+     * first.
+     */
+    EvaluationStatistics(InviwoApplication* app, size_t window = 100, size_t maxEvents = 100000);
+    EvaluationStatistics(const EvaluationStatistics&) = delete;
+    EvaluationStatistics& operator=(const EvaluationStatistics&) = delete;
+    virtual ~EvaluationStatistics();
+
+    /**
+     * Statistics per processor, keyed by processor identifier.
+     */
+    const std::map<std::string, ProcessorStatistics>& getProcessorStatistics() const;
+    /**
+     * Duration of the whole network evaluations.
+     */
+    const RollingStatistics& getNetworkStatistics() const;
+    /**
+     * Size of the thread pool queue, sampled after each network evaluation.
+     */
+    const RollingStatistics& getPoolQueueStatistics() const;
+    /**
+     * The representation conversions recorded by ConversionStatistics. Note that the
+     * ConversionStatistics are global, and will also include conversions made outside of the
+     * network evaluation. Recording is enabled while the EvaluationStatistics exists.
+     * \see ConversionStatistics
+     */
+    std::vector<ConversionStatistics::Entry> getConversions() const;
+
+    const std::deque<TraceEvent>& getTraceEvents() const;
+    const std::deque<CounterEvent>& getCounterEvents() const;
+
+    /**
+     * Clear all statistics and events, including the global ConversionStatistics.
+     */
+    void reset();
+
+    /**
+     * Write all recorded events in the Chrome trace event JSON format.
+     */
+    void exportChromeTrace(std::ostream& os) const;
+    void exportChromeTrace(const std::string& filename) const;
+
+private:
+    virtual void onProcessorNetworkEvaluationBegin() override;
+    virtual void onProcessorNetworkEvaluationEnd() override;
+    virtual void onProcessorEvaluationBegin(Processor*, EvaluationType) override;
+    virtual void onProcessorEvaluationEnd(Processor*, EvaluationType) override;
+
+    void addEvent(TraceEvent event);
+
+    InviwoApplication* app_;
+    size_t window_;
+    size_t maxEvents_;
+    bool conversionsWereEnabled_;
+    clock::time_point epoch_;
+    clock::time_point networkStart_;
+    std::vector<clock::time_point> processorStart_;
+
+    std::map<std::string, ProcessorStatistics> processors_;
+    RollingStatistics network_;
+    RollingStatistics poolQueue_;
+    std::deque<TraceEvent> events_;
+    std::deque<CounterEvent> counters_;
+};
+
+}  // namespace inviwo
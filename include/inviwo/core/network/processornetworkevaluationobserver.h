@@ -31,9 +31,11 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/observer.h>
+#include <inviwo/core/network/evaluationerrorhandler.h>
 
 namespace inviwo {
 
+class Processor;
 class ProcessorNetworkEvaluationObservable;
 
 /**
@@ -43,6 +45,16 @@ class IVW_CORE_API ProcessorNetworkEvaluationObserver : public Observer {
 public:
     virtual void onProcessorNetworkEvaluationBegin(){};
     virtual void onProcessorNetworkEvaluationEnd(){};
+
+    /**
+     * Called before the evaluator initializes resources, calls the inport onChange callbacks,
+     * processes, or calls doIfNotReady on a processor. The type tells which of them.
+     */
+    virtual void onProcessorEvaluationBegin(Processor*, EvaluationType){};
+    /**
+     * Called after the corresponding onProcessorEvaluationBegin, also when the evaluation threw.
+     */
+    virtual void onProcessorEvaluationEnd(Processor*, EvaluationType){};
 };
 
 class IVW_CORE_API ProcessorNetworkEvaluationObservable
@@ -50,6 +62,8 @@ class IVW_CORE_API ProcessorNetworkEvaluationObservable
 protected:
     virtual void notifyObserversProcessorNetworkEvaluationBegin();
     virtual void notifyObserversProcessorNetworkEvaluationEnd();
+    void notifyObserversProcessorEvaluationBegin(Processor* p, EvaluationType type);
+    void notifyObserversProcessorEvaluationEnd(Processor* p, EvaluationType type);
 };
 
 }  // namespace inviwo
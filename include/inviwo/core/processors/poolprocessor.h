@@ -40,8 +40,13 @@
 #include <inviwo/core/util/rendercontext.h>
 #include <inviwo/core/network/processornetwork.h>
 
+#include <inviwo/tracy/tracy.h>
+
 #include <atomic>
 #include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
 
 namespace inviwo {
 
@@ -55,6 +60,8 @@ struct Wrapper;
 struct State;
 template <typename Result, typename Done>
 struct StateTemplate;
+template <typename Result>
+struct Channel;
 
 }  // namespace detail
 
@@ -75,6 +82,11 @@ struct StateTemplate;
 class IVW_CORE_API Stop {
 public:
     operator bool() const noexcept { return stop_.load(); }
+    /**
+     * Makes it possible to pass a Stop directly to algorithms taking a
+     * `std::function<bool()>` stop callback, like util::marchingCubesOpt.
+     */
+    bool operator()() const noexcept { return stop_.load(); }
 
 private:
     friend detail::State;
@@ -111,6 +123,39 @@ private:
     const size_t id_;
 };
 
+/**
+ * A class to publish intermediate results of a background calculation, for example a coarse
+ * version of the final result. Intermediate results are passed to the 'done' functor on the main
+ * thread, just like the final result, but at most once per publish interval
+ * (PoolProcessor::setPublishInterval). Each publish replaces the previous intermediate result of
+ * the job, and a delivery passes on the latest result at the time it runs on the main thread.
+ * A publish only schedules a delivery if none is pending and the interval has passed since the
+ * last one. Hence a result published within the interval after a delivery is only delivered if
+ * the job publishes again later, i.e. the last results published before the final one may be
+ * dropped. Nothing is delivered once the final result is available.
+ * ```{.cpp}
+ * auto calc = [volume](pool::Stop stop, pool::Progress progress,
+ *                      pool::Publish<std::shared_ptr<Mesh>> publish) -> std::shared_ptr<Mesh> {
+ *     publish(extractSurface(coarseVersionOf(volume)));
+ *     if (stop) return nullptr;
+ *     return extractSurface(volume);
+ * };
+ * ```
+ * \see PoolProcessor::dispatchOneProgressive
+ */
+template <typename Result>
+class Publish {
+public:
+    void operator()(Result result) const;
+
+private:
+    friend PoolProcessor;
+    Publish(std::shared_ptr<detail::Channel<Result>> channel, size_t id)
+        : channel_{std::move(channel)}, id_{id} {}
+    std::shared_ptr<detail::Channel<Result>> channel_;
+    size_t id_;
+};
+
 /** @enum pool::Option
  * Settings for the PoolProcessor
  * \see PoolProcessor
@@ -228,6 +273,50 @@ public:
     template <typename Job, typename Done>
     void dispatchMany(std::vector<Job> jobs, Done&& done);
 
+    /**
+     * Dispatch a single background job that can publish intermediate results. Works like
+     * dispatchOne, but the job has to take a pool::Stop, a pool::Progress, and a
+     * pool::Publish<Result> and return a Result. Each published result is passed to 'done' on the
+     * main thread, rate limited by the publish interval, and the final result replaces them.
+     * Intermediate results are only delivered for the most recently dispatched job.
+     *
+     * \code{.cpp}
+     * using Result = std::shared_ptr<const Image>;
+     * const auto calc = [image = inport_.getData()](pool::Stop stop, pool::Progress progress,
+     *                                               pool::Publish<Result> publish) -> Result {
+     *     publish(quickPreview(image));
+     *     if (stop) return nullptr;
+     *     return fullComputation(image, progress);
+     * };
+     *
+     * dispatchOneProgressive<Result>(calc, [this](Result result) {
+     *     outport_.setData(result);
+     *     newResults();
+     * });
+     * \endcode
+     * \see pool::Publish
+     */
+    template <typename Result, typename Job, typename Done>
+    void dispatchOneProgressive(Job&& job, Done&& done);
+
+    /**
+     * Dispatch a vector of background jobs that can publish intermediate results. Works like
+     * dispatchMany, but each job has to take a pool::Stop, a pool::Progress, and a
+     * pool::Publish<Result> and return a Result. Whenever a job publishes a result 'done' is
+     * called, rate limited by the publish interval, with the latest result of each job. Jobs that
+     * have not yet published anything are represented by a default constructed Result.
+     * \see dispatchOneProgressive
+     */
+    template <typename Result, typename Job, typename Done>
+    void dispatchManyProgressive(std::vector<Job> jobs, Done&& done);
+
+    /**
+     * Set the minimum time between two deliveries of intermediate results, see pool::Publish.
+     * Applies to jobs dispatched after the call. Defaults to 100 ms.
+     */
+    void setPublishInterval(std::chrono::milliseconds interval) { publishInterval_ = interval; }
+    std::chrono::milliseconds getPublishInterval() const { return publishInterval_; }
+
     /**
      * handleError is called on the main thread whenever there has be an error in a background
      * calculation this will by default just log the error message, and clear any outports. Deriving
@@ -288,6 +377,7 @@ private:
     };
 
     void submit(Submission& job);
+    void enqueue(Submission&& job);
 
     template <typename Job>
     void setupProgress();
@@ -307,6 +397,13 @@ private:
     static void callDone(InviwoApplication* app,
                          std::shared_ptr<pool::detail::StateTemplate<Result, Done>> state);
 
+    template <typename Result, typename Job, typename Done>
+    void dispatchProgressive(std::vector<Job> jobs, Done&& done);
+
+    template <typename Result, typename Done>
+    static void callPublished(std::shared_ptr<pool::detail::StateTemplate<Result, Done>> state,
+                              std::shared_ptr<pool::detail::Channel<Result>> channel);
+
     pool::Options options_;
     std::vector<std::shared_ptr<pool::detail::State>> states_;
     util::OnScopeExit notifyRemainingJobsFinish_;
@@ -314,6 +411,7 @@ private:
     std::vector<Submission> queue_;
     Delay delay_;
     util::OnScopeExit delayBackgoundJobReset_;
+    std::chrono::milliseconds publishInterval_{100};
 };
 
 namespace pool::detail {
@@ -352,6 +450,47 @@ struct StateTemplate : State {
     Done done;
 };
 
+/**
+ * Holds the latest published result of each job of a progressive dispatch
+ */
+template <typename Result>
+struct Channel {
+    Channel(size_t count, std::chrono::milliseconds interval)
+        : results(count), interval{interval} {}
+
+    /**
+     * Store a published result, returns true if a delivery should be scheduled
+     */
+    bool publish(size_t id, Result result) {
+        std::scoped_lock lock{mutex};
+        results[id] = std::move(result);
+        const auto now = std::chrono::steady_clock::now();
+        if (pending || now - last < interval) return false;
+        pending = true;
+        last = now;
+        return true;
+    }
+    /**
+     * Store the final result of a job, used for the other jobs' deliveries
+     */
+    void store(size_t id, Result result) {
+        std::scoped_lock lock{mutex};
+        results[id] = std::move(result);
+    }
+    std::vector<std::optional<Result>> take() {
+        std::scoped_lock lock{mutex};
+        pending = false;
+        return results;
+    }
+
+    std::mutex mutex;
+    std::vector<std::optional<Result>> results;
+    bool pending = false;
+    std::chrono::steady_clock::time_point last{};
+    std::chrono::milliseconds interval;
+    std::function<void()> schedule;  ///< dispatches a delivery to the main thread
+};
+
 template <typename Job>
 struct JobTraits {
     static_assert(std::is_invocable_v<Job> || std::is_invocable_v<Job, pool::Stop> ||
@@ -373,10 +512,17 @@ struct JobTraits {
 
 }  // namespace pool::detail
 
+template <typename Result>
+void pool::Publish<Result>::operator()(Result result) const {
+    if (channel_->publish(id_, std::move(result))) channel_->schedule();
+}
+
 template <typename Result, typename Done>
 inline void PoolProcessor::callDone(
     InviwoApplication* app, std::shared_ptr<pool::detail::StateTemplate<Result, Done>> state) {
     static const auto done = [](PoolProcessor& p, auto state) {
+        TRACY_ZONE_SCOPED_NC("Pool Processor Done", 0x006666);
+        TRACY_ZONE_TEXT(p.getIdentifier().c_str(), p.getIdentifier().size());
         // This code will run in the main thread, make sure the default context is active
         RenderContext::getPtr()->activateDefaultRenderContext();
         try {
@@ -450,6 +596,7 @@ void PoolProcessor::dispatchMany(std::vector<Job> jobs, Done&& done) {
         state->futures.push_back(task->get_future());
         sub.tasks.emplace_back([state, task, app]() {
             if (!state->stop) {
+                TRACY_ZONE_SCOPED_NC("Pool Processor Job", 0x006666);
                 // This code will run in a background thread, make sure the local context is active
                 RenderContext::getPtr()->activateLocalRenderContext();
                 (*task)();
@@ -458,24 +605,7 @@ void PoolProcessor::dispatchMany(std::vector<Job> jobs, Done&& done) {
         });
     }
 
-    if (delayDispatch()) {
-        queue_.clear();
-        queue_.push_back(std::move(sub));
-
-        if (!delayBackgoundJobReset_) {
-            notifyObserversStartBackgroundWork(this, 1);
-            delayBackgoundJobReset_.setAction(
-                [this]() { notifyObserversFinishBackgroundWork(this, 1); });
-        }
-        delay_.start();
-
-    } else if (queuedDispatch() && !states_.empty()) {
-        queue_.clear();
-        queue_.push_back(std::move(sub));
-
-    } else {
-        submit(sub);
-    }
+    enqueue(std::move(sub));
 }
 
 template <typename Job, typename Done>
@@ -499,6 +629,7 @@ void PoolProcessor::dispatchOne(Job&& job, Done&& done) {
     Submission sub{state,
                    {[state, task, app]() {
                        if (!state->stop) {
+                           TRACY_ZONE_SCOPED_NC("Pool Processor Job", 0x006666);
                            RenderContext::getPtr()->activateLocalRenderContext();
                            (*task)();
                        }
@@ -506,22 +637,107 @@ void PoolProcessor::dispatchOne(Job&& job, Done&& done) {
                    }},
                    [this]() { setupProgress<Job>(); }};
 
-    if (delayDispatch()) {
-        queue_.clear();
-        queue_.push_back(std::move(sub));
-        if (!delayBackgoundJobReset_) {
-            notifyObserversStartBackgroundWork(this, 1);
-            delayBackgoundJobReset_.setAction(
-                [this]() { notifyObserversFinishBackgroundWork(this, 1); });
-        }
-        delay_.start();
+    enqueue(std::move(sub));
+}
+
+template <typename Result, typename Job, typename Done>
+void PoolProcessor::dispatchOneProgressive(Job&& job, Done&& done) {
+    static_assert(std::is_invocable_r_v<Result, Job, pool::Stop, pool::Progress,
+                                        pool::Publish<Result>>,
+                  "The 'Job' functor should take a pool::Stop, a pool::Progress, and a "
+                  "pool::Publish<Result> as arguments and return a Result");
+    static_assert(std::is_invocable_v<Done, Result>,
+                  "The 'Done' functor should take the result of the 'Job' functor as argument");
+
+    std::vector<std::decay_t<Job>> jobs;
+    jobs.push_back(std::forward<Job>(job));
+    dispatchProgressive<Result>(std::move(jobs), std::forward<Done>(done));
+}
 
-    } else if (queuedDispatch() && !states_.empty()) {
-        queue_.clear();
-        queue_.push_back(std::move(sub));
+template <typename Result, typename Job, typename Done>
+void PoolProcessor::dispatchManyProgressive(std::vector<Job> jobs, Done&& done) {
+    static_assert(std::is_invocable_r_v<Result, Job, pool::Stop, pool::Progress,
+                                        pool::Publish<Result>>,
+                  "The 'Job' functor should take a pool::Stop, a pool::Progress, and a "
+                  "pool::Publish<Result> as arguments and return a Result");
+    static_assert(std::is_invocable_v<Done, std::vector<Result>>,
+                  "The 'Done' functor should take a std::vector of the result of the 'Job' "
+                  "functor as argument");
+
+    dispatchProgressive<Result>(std::move(jobs), std::forward<Done>(done));
+}
 
-    } else {
-        submit(sub);
+template <typename Result, typename Job, typename Done>
+void PoolProcessor::dispatchProgressive(std::vector<Job> jobs, Done&& done) {
+    if (!keepOldJobs()) stopJobs();
+
+    auto state = makeState<Result, Done>(jobs.size(), std::forward<Done>(done));
+    auto channel = std::make_shared<pool::detail::Channel<Result>>(jobs.size(), publishInterval_);
+    auto app = getNetwork()->getApplication();
+    channel->schedule = [app, weakState = std::weak_ptr{state},
+                         weakChannel = std::weak_ptr{channel}]() {
+        app->dispatchFrontAndForget([weakState, weakChannel]() {
+            auto s = weakState.lock();
+            auto c = weakChannel.lock();
+            if (s && c) callPublished(s, c);
+        });
+    };
+
+    Submission sub{state, {}, [this]() {
+                       updateProgress(0.0f);
+                       getProgressBar().setActive(true);
+                       getProgressBar().show();
+                   }};
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+            [job = std::move(jobs[i]), stop = state->getStop(), progress = state->getProgress(i),
+             publish = pool::Publish<Result>{channel, i}, channel, i]() {
+                auto result = job(stop, progress, publish);
+                channel->store(i, result);
+                return result;
+            });
+        state->futures.push_back(task->get_future());
+        sub.tasks.emplace_back([state, task, app]() {
+            if (!state->stop) {
+                TRACY_ZONE_SCOPED_NC("Pool Processor Job", 0x006666);
+                RenderContext::getPtr()->activateLocalRenderContext();
+                (*task)();
+            }
+            callDone(app, state);
+        });
+    }
+
+    enqueue(std::move(sub));
+}
+
+template <typename Result, typename Done>
+void PoolProcessor::callPublished(std::shared_ptr<pool::detail::StateTemplate<Result, Done>> state,
+                                  std::shared_ptr<pool::detail::Channel<Result>> channel) {
+    auto results = channel->take();
+
+    auto wrapper = state->processor.lock();
+    // Nothing to show if the jobs were stopped or the final results are already on their way
+    if (!wrapper || state->stop || state->count == 0) return;
+    auto& p = wrapper->processor;
+    // Only show intermediate results of the latest submission
+    if (p.states_.empty() || p.states_.back() != state) return;
+
+    TRACY_ZONE_SCOPED_NC("Pool Processor Publish", 0x006666);
+    TRACY_ZONE_TEXT(p.getIdentifier().c_str(), p.getIdentifier().size());
+    RenderContext::getPtr()->activateDefaultRenderContext();
+    try {
+        if constexpr (std::is_invocable_v<Done, Result>) {
+            if (results.front()) state->done(std::move(*results.front()));
+        } else {
+            std::vector<Result> partial;
+            for (auto& result : results) {
+                partial.push_back(result ? std::move(*result) : Result{});
+            }
+            state->done(partial);
+        }
+    } catch (...) {
+        p.handleError();
     }
 }
 
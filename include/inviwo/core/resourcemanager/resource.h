@@ -32,9 +32,55 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/document.h>
 #include <inviwo/core/datastructures/datatraits.h>
+#include <inviwo/core/util/formatconversion.h>
+
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace inviwo {
 
+class Volume;
+class Layer;
+class Image;
+class BufferBase;
+class Mesh;
+
+namespace util {
+
+IVW_CORE_API size_t resourceSizeInBytes(const Volume& volume);
+IVW_CORE_API size_t resourceSizeInBytes(const Layer& layer);
+IVW_CORE_API size_t resourceSizeInBytes(const Image& image);
+IVW_CORE_API size_t resourceSizeInBytes(const BufferBase& buffer);
+IVW_CORE_API size_t resourceSizeInBytes(const Mesh& mesh);
+
+/**
+ * Number of bytes used by all the representations of data, used by the ResourceManager for
+ * accounting against the memory budget. Volume, Layer, Image, BufferBase, and Mesh, and
+ * vectors of them (like VolumeSequence), are supported, other types report 0 bytes.
+ */
+template <typename T>
+size_t resourceSizeInBytes(const T& data) {
+    if constexpr (std::is_base_of_v<BufferBase, T>) {
+        return resourceSizeInBytes(static_cast<const BufferBase&>(data));
+    } else if constexpr (std::is_base_of_v<Mesh, T>) {
+        return resourceSizeInBytes(static_cast<const Mesh&>(data));
+    } else {
+        return 0;
+    }
+}
+
+template <typename T>
+size_t resourceSizeInBytes(const std::vector<std::shared_ptr<T>>& data) {
+    size_t size = 0;
+    for (const auto& elem : data) {
+        if (elem) size += resourceSizeInBytes(*elem);
+    }
+    return size;
+}
+
+}  // namespace util
+
 /**
  * \class Resource
  * \brief Base class for resources.
@@ -55,6 +101,18 @@ public:
     virtual std::string typeDisplayName() = 0;
     virtual Document info() = 0;
 
+    /**
+     * The number of bytes used by the representations of the resource.
+     * @see util::resourceSizeInBytes
+     */
+    virtual size_t sizeInBytes() = 0;
+
+    /**
+     * Returns true if the resource is used outside of the ResourceManager. Only unreferenced
+     * resources can be evicted to free memory.
+     */
+    virtual bool isReferenced() = 0;
+
     std::string key() const { return key_; }
 
 private:
@@ -77,6 +135,10 @@ public:
 
     virtual std::string typeDisplayName() override { return DataTraits<T>::dataName(); }
 
+    virtual size_t sizeInBytes() override { return util::resourceSizeInBytes(*resource_); }
+
+    virtual bool isReferenced() override { return resource_.use_count() > 1; }
+
     virtual Document info() override {
         using P = Document::PathComponent;
         using H = utildoc::TableBuilder::Header;
@@ -87,6 +149,7 @@ public:
         if (typeName != "") {
             tb(H("Type"), htmlEncode(typeName));
         }
+        tb(H("Size"), formatBytesToString(sizeInBytes()));
         std::string dataInfo = DataTraits<T>::info(*resource_);
         if (dataInfo != "") {
             doc.append("", "<hr />");
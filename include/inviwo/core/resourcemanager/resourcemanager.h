@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/datatraits.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 
+#include <list>
 #include <typeindex>
 #include <unordered_map>
 
@@ -48,6 +49,14 @@ namespace inviwo {
  * type and key. Key should uniquely describe the dataset, for example, when loading a file from
  * disk the filename could be used.
  *
+ * A memory budget can be set with setMemoryBudget. The size of each resource is derived from the
+ * representations of the data (see util::resourceSizeInBytes). When the total size exceeds the
+ * budget, resources that are not referenced outside of the manager are evicted, least recently
+ * used first. Observers are notified by ResourceManagerObserver::onResourceEvicted followed by
+ * ResourceManagerObserver::onResourceRemoved. The budget is enforced when adding resources and
+ * when changing the budget, call enforceMemoryBudget to enforce it at other times, for example
+ * after releasing references to resources.
+ *
  * Example Usage:
  * \code{.cpp}
  * std::shared_ptr<T> loadData(std::string filename){
@@ -146,7 +155,37 @@ public:
      */
     size_t numberOfResources() const;
 
+    /**
+     * \brief Set the memory budget in bytes, 0 means unlimited.
+     * Evicts unreferenced resources if the new budget is exceeded.
+     */
+    void setMemoryBudget(size_t bytes);
+    size_t getMemoryBudget() const;
+
+    /**
+     * \brief The sum of the sizes of all resources in bytes
+     * The size is computed from the current representations of the resources.
+     * @see Resource::sizeInBytes
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * \brief Evict unreferenced resources, least recently used first, until the memory usage is
+     * within the budget.
+     * @return the number of bytes released
+     */
+    size_t enforceMemoryBudget();
+
 private:
+    using Key = std::pair<std::string, std::type_index>;
+    struct Entry {
+        std::shared_ptr<Resource> resource;
+        std::list<Key>::iterator lru;
+    };
+
+    void touch(Entry& entry);
+    size_t evictUnreferenced();
+
     /**
      * \brief Convenience function to create a std::pair for uses in resources_ map.
      *
@@ -155,10 +194,11 @@ private:
     template <typename T>
     static std::pair<std::string, std::type_index> keyTypePair(const std::string& key);
 
-    std::unordered_map<std::pair<std::string, std::type_index>, std::shared_ptr<Resource>>
-        resources_;
+    std::unordered_map<Key, Entry> resources_;
+    std::list<Key> lru_;  ///< least recently used first
 
     bool enabled_{true};
+    size_t budget_{0};
 };
 
 template <typename T>
@@ -168,7 +208,8 @@ std::shared_ptr<T> ResourceManager::getResource(const std::string& key) {
     if (it == resources_.end()) {
         throw inviwo::ResourceException("No resource with " + key + " registered", IVW_CONTEXT);
     }
-    return static_cast<TypedResource<T>*>(it->second.get())->getData();
+    touch(it->second);
+    return static_cast<TypedResource<T>*>(it->second.resource.get())->getData();
 }
 
 template <typename T>
@@ -188,8 +229,11 @@ void ResourceManager::addResource(const std::string& key, std::shared_ptr<T> res
         }
     }
     auto typedResource = std::make_shared<TypedResource<T>>(resource, key);
-    resources_[tk] = typedResource;
+    auto lruIt = lru_.insert(lru_.end(), tk);
+    resources_.emplace(tk, Entry{typedResource, lruIt});
     notifyResourceAdded(key, tk.second, typedResource.get());
+    evictUnreferenced();
+    notifyMemoryUsageChanged(getMemoryUsage(), budget_);
 }
 
 template <typename T>
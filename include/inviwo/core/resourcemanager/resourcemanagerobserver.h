@@ -47,6 +47,13 @@ public:
     virtual void onResourceRemoved(const std::string& /*key*/, const std::type_index& /*type*/,
                                    Resource* /*resource*/){};
     virtual void onResourceManagerEnableStateChanged(){};
+    /**
+     * Called when a resource is evicted to keep the memory usage within the budget, before the
+     * resource is removed.
+     */
+    virtual void onResourceEvicted(const std::string& /*key*/, const std::type_index& /*type*/,
+                                   Resource* /*resource*/){};
+    virtual void onResourceMemoryUsageChanged(size_t /*usage*/, size_t /*budget*/){};
 };
 
 class IVW_CORE_API ResourceManagerObservable : public Observable<ResourceManagerObserver> {
@@ -56,6 +63,9 @@ protected:
     void notifyResourceRemoved(const std::string& key, const std::type_index& type,
                                Resource* resource);
     void notifyEnableChanged();
+    void notifyResourceEvicted(const std::string& key, const std::type_index& type,
+                               Resource* resource);
+    void notifyMemoryUsageChanged(size_t usage, size_t budget);
 };
 
 }  // namespace inviwo
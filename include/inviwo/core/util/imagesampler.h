@@ -67,7 +67,8 @@ public:
         : SpatialSampler<2, DataDims, T>(*ram->getOwner())
         , layer_(ram)
         , dims_(layer_->getDimensions())
-        , sharedImage_(nullptr) {}
+        , sharedImage_(nullptr)
+        , sharedLayer_(ram->getOwner()->shareRepresentation(ram)) {}
 
     /**
      * Creates a ImageSpatialSampler for the given Layer, does not take ownership of ram.
@@ -146,6 +147,8 @@ private:
     size2_t dims_;
 
     std::shared_ptr<const Image> sharedImage_;
+    // Keeps the representation from being released, see Data::releaseRepresentation
+    std::shared_ptr<const LayerRepresentation> sharedLayer_;
 };
 
 using ImageSampler = ImageSpatialSampler<4, double>;  // For backwards compatibility
@@ -192,6 +195,7 @@ private:
     util::IndexMapper2D ic_;
 
     std::shared_ptr<const Image> sharedImage_;
+    std::shared_ptr<const LayerRepresentation> sharedLayer_;
 };
 
 template <typename T, typename P>
@@ -199,7 +203,8 @@ TemplateImageSampler<T, P>::TemplateImageSampler(const LayerRAM* ram)
     : data_(static_cast<const T*>(ram->getData()))
     , dims_(ram->getDimensions())
     , ic_(dims_)
-    , sharedImage_(nullptr) {
+    , sharedImage_(nullptr)
+    , sharedLayer_(ram->getOwner()->shareRepresentation(ram)) {
     if (ram->getDataFormat() != DataFormat<T>::get()) {
         std::ostringstream oss;
         oss << "Type mismatch when trying to initialize TemplateImageSampler. Image is "
@@ -59,6 +59,10 @@ public:
     BoolProperty logStackTraceProperty_;
     BoolProperty runtimeModuleReloading_;
     BoolProperty enableResourceManager_;
+    IntSizeTProperty resourceManagerBudget_;  ///< In megabytes, 0 means unlimited
+    IntSizeTProperty representationBudget_;   ///< In megabytes, 0 means unlimited
+    BoolProperty spillRepresentationsToDisk_;
+    IntSizeTProperty storagePoolSize_;  ///< In megabytes
     TemplateOptionProperty<MessageBreakLevel> breakOnMessage_;
     BoolProperty breakOnException_;
     BoolProperty stackTraceInException_;
@@ -98,6 +98,11 @@ public:
 
     size_t getQueueSize();
 
+    /**
+     * True if no task is queued or running on any of the worker threads
+     */
+    bool isIdle();
+
 private:
     enum class State {
         Free,     //< Worker is waiting for tasks.
@@ -123,6 +128,8 @@ private:
 
     // the task queue
     std::queue<std::function<void()>> tasks;
+    // number of tasks taken from the queue that have not finished yet, guarded by queue_mutex
+    size_t running = 0;
 
     // synchronization
     std::mutex queue_mutex;
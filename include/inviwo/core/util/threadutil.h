@@ -30,6 +30,8 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <thread>
 
@@ -37,4 +39,35 @@ namespace inviwo::util {
 
 IVW_CORE_API void setThreadDescription(std::thread& thread, const std::string& desc);
 
+/**
+ * Call \p task for each index in [0, count) using the calling thread and up to \p maxThreads
+ * threads of the Inviwo thread pool (the whole pool if 0). Indices are handed out one at a time,
+ * hence at most one task per participating thread is in flight. The caller only waits for tasks
+ * that have been started, which makes it safe to call from within a pool job even when the rest of
+ * the pool is busy. If a task throws no more tasks are started, and the first exception is
+ * rethrown once the running tasks have finished.
+ */
+IVW_CORE_API void parallelFor(size_t count, std::function<void(size_t)> task,
+                              size_t maxThreads = 0);
+
+/**
+ * Split [0, count) into consecutive ranges of \p grain elements, the last one possibly shorter,
+ * and call \p task(begin, end) for each range using parallelFor. Range i starts at i * grain.
+ * @see rangeCount
+ */
+IVW_CORE_API void parallelFor(size_t count, size_t grain,
+                              std::function<void(size_t begin, size_t end)> task,
+                              size_t maxThreads = 0);
+
+/**
+ * The number of ranges parallelFor(count, grain, task) calls \p task for
+ */
+constexpr size_t rangeCount(size_t count, size_t grain) { return (count + grain - 1) / grain; }
+
+/**
+ * The number of threads parallelFor can run tasks on, i.e. the calling thread plus the threads of
+ * the Inviwo thread pool. Returns 1 if there is no InviwoApplication.
+ */
+IVW_CORE_API size_t parallelForThreads();
+
 }  // namespace inviwo::util
@@ -32,39 +32,35 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/util/spatial4dsampler.h>
-#include <inviwo/core/util/volumesampler.h>
 
-namespace inviwo {
-
-class IVW_CORE_API VolumeSequenceSampler : public Spatial4DSampler<3, double> {
-    struct Wrapper {
-        std::weak_ptr<Wrapper> next_;
-        double duration_;
-        double timestamp_;
-        std::shared_ptr<Volume> volume_;
-        VolumeDoubleSampler<4> sampler_;
+#include <memory>
+#include <vector>
 
-        Wrapper(std::shared_ptr<Volume> volume)
-            : next_()
-            , duration_(std::numeric_limits<double>::infinity())
-            , timestamp_(std::numeric_limits<double>::infinity())
-            , volume_(volume)
-            , sampler_(volume) {
-            if (volume_->hasMetaData<DoubleMetaData>("timestamp")) {
-                timestamp_ = volume_->getMetaData<DoubleMetaData>("timestamp")->get();
-            }
-            if (volume_->hasMetaData<DoubleMetaData>("duration")) {
-                duration_ = volume_->getMetaData<DoubleMetaData>("duration")->get();
-            }
-        }
+namespace inviwo {
 
-        bool operator<(const Wrapper& w) const { return timestamp_ < w.timestamp_; }
-    };
+namespace detail {
+struct SequenceSamplerBracket;
+struct SequenceSamplerResident;
+struct SequenceSamplerState;
+}  // namespace detail
 
+/**
+ * \brief Samples a sequence of volumes, interpolating linearly in time
+ *
+ * The time steps are converted to VolumeRAM on demand, when first sampled, rather than up front.
+ * Steps that already have a VolumeRAM representation share it, steps that only have a disk
+ * representation are read into a VolumeRAM owned by the sampler, leaving the volume untouched.
+ * At most `maxResidentSteps` steps are kept in memory, the least recently used ones are dropped
+ * again unless a thread is sampling them, so more steps are only kept while more threads sample
+ * different time intervals. Each thread keeps the pair of steps bracketing the last sampled time
+ * in a bracket owned by the sampler, so sampling within the same time interval does not need any
+ * synchronization, and nothing is kept alive after the sampler is destroyed.
+ */
+class IVW_CORE_API VolumeSequenceSampler : public Spatial4DSampler<3, double> {
 public:
     VolumeSequenceSampler(
         std::shared_ptr<const std::vector<std::shared_ptr<Volume>>> volumeSequence,
-        bool allowLooping = true);
+        bool allowLooping = true, size_t maxResidentSteps = 8);
     virtual ~VolumeSequenceSampler();
 
     void setAllowedLooping(bool allowed = true) { allowLooping_ = allowed; }
@@ -74,7 +70,18 @@ protected:
     virtual bool withinBoundsDataSpace(const dvec4& pos) const;
 
 private:
-    std::vector<std::shared_ptr<Wrapper>> wrappers_;
+    struct Step {
+        std::shared_ptr<Volume> volume;
+        double timestamp;
+        double duration;
+    };
+
+    detail::SequenceSamplerBracket& bracket() const;
+    std::shared_ptr<const detail::SequenceSamplerResident> acquire(size_t step) const;
+
+    std::vector<Step> steps_;
+    std::shared_ptr<detail::SequenceSamplerState> state_;
+    size_t id_;
 
     bool allowLooping_;
     dvec2 timeRange_;
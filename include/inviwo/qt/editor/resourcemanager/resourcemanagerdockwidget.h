@@ -38,6 +38,7 @@
 
 class QTableView;
 class QCheckBox;
+class QLabel;
 
 namespace inviwo {
 class Resource;
@@ -61,6 +62,7 @@ public:
                                    Resource* resource) override;
 
     virtual void onResourceManagerEnableStateChanged() override;
+    virtual void onResourceMemoryUsageChanged(size_t usage, size_t budget) override;
 
 private:
     ResourceManager& manager_;
@@ -68,6 +70,7 @@ private:
     ResourceManagerItemModel* model_;
     QTableView* tableView_;
     QCheckBox* disabledCheckBox_;
+    QLabel* memoryLabel_;
 };
 
 }  // namespace inviwo
@@ -111,7 +111,8 @@ std::shared_ptr<LayerRAMPrecision<U>> extractLayerSubSet(const LayerRAMPrecision
     const ivec2 dstDim = clampBorderOutsideImage ? copyExtent : ivec2(extent);
 
     // allocate space
-    auto newLayer = std::make_shared<LayerRAMPrecision<U>>(dstDim);
+    auto newLayer =
+        std::make_shared<LayerRAMPrecision<U>>(size2_t(dstDim), StorageInit::Uninitialized);
 
     const auto src = inLayer->getDataTyped();
     auto dst = newLayer->getDataTyped();
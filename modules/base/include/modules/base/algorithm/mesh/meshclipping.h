@@ -67,9 +67,18 @@ IVW_MODULE_BASE_API std::optional<glm::u32vec2> sutherlandHodgman(
     glm::u32vec3 triangle, const Plane& plane, const std::vector<vec3>& positions,
     std::vector<std::uint32_t>& indices, const InterpolateFunctor& addInterpolatedVertex);
 
+/**
+ * Remove degenerate and duplicated edges, where end points within \p eps of each other are
+ * considered equal. Matching end points are found using a hash grid, so the cost is linear in the
+ * number of edges plus the sorting of the remaining edges.
+ */
 IVW_MODULE_BASE_API void removeDuplicateEdges(std::vector<glm::u32vec2>& cuts,
                                               const std::vector<vec3>& positions, float eps);
 
+/**
+ * Connect \p edges into closed loops of vertex indices, where end points within \p eps of each
+ * other are considered equal. All edges are consumed.
+ */
 IVW_MODULE_BASE_API std::vector<std::vector<std::uint32_t>> gatherLoops(
     std::vector<glm::u32vec2>& edges, const std::vector<vec3>& positions, float eps);
 
@@ -80,6 +89,8 @@ IVW_MODULE_BASE_API std::vector<std::vector<std::uint32_t>> gatherLoops(
  * If holes should be closed, the input mesh must be manifold.
  * Vertex attributes are interpolated. Floating types use linear interpolation, integer types use
  * nearest. Connectivity types loop and fan are not handled.
+ * Triangles are clipped in parallel using the thread pool, with the same result as a sequential
+ * clipping.
  * @param mesh to clip
  * @param worldSpacePlane in world space coordinate system
  * @param capClippedHoles: replaces removed parts with triangles aligned with the plane
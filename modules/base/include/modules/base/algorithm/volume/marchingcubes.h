@@ -59,12 +59,15 @@ namespace util {
  * interval [0,1], usefull for progressbars
  * @param maskingCallback optional callback to test whether current cell should be evaluated or not
  * (return true to include current cell)
+ * @param stopCallback if set, will be called once per slice, return true to abort the extraction
+ * @return the extracted mesh, or nullptr if aborted by the stopCallback
  */
 
 IVW_MODULE_BASE_API std::shared_ptr<Mesh> marchingcubes(
     std::shared_ptr<const Volume> volume, double iso, const vec4& color, bool invert, bool enclose,
     std::function<void(float)> progressCallback = std::function<void(float)>(),
-    std::function<bool(const size3_t&)> maskingCallback = [](const size3_t&) { return true; });
+    std::function<bool(const size3_t&)> maskingCallback = [](const size3_t&) { return true; },
+    std::function<bool()> stopCallback = nullptr);
 }  // namespace util
 
 }  // namespace inviwo
@@ -72,12 +72,15 @@ namespace util {
  * interval [0,1], usefull for progressbars
  * @param maskingCallback optional callback to test whether current cell should be evaluated or not
  * (return true to include current cell)
+ * @param stopCallback if set, will be called once per slice, return true to abort the extraction
+ * @return the extracted mesh, or nullptr if aborted by the stopCallback
  */
 std::shared_ptr<Mesh> marchingtetrahedron(
     std::shared_ptr<const Volume> volume, double iso, const vec4& color = vec4(1.0f),
     bool invert = false, bool enclose = true,
     std::function<void(float)> progressCallback = std::function<void(float)>(),
-    std::function<bool(const size3_t&)> maskingCallback = [](const size3_t&) { return true; });
+    std::function<bool(const size3_t&)> maskingCallback = [](const size3_t&) { return true; },
+    std::function<bool()> stopCallback = nullptr);
 }  // namespace util
 
 }  // namespace inviwo
@@ -34,6 +34,9 @@
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 
+#include <atomic>
+#include <functional>
+
 #ifdef IVW_USE_OPENMP
 #include <omp.h>
 #endif
@@ -56,13 +59,17 @@ namespace util {
  *       squared distance values at the end of the calculation.
  *     * ProcessCallback is a function of type (double progress) -> void that is called with a value
  *       from 0 to 1 to indicate the progress of the calculation.
+ *     * stop is an optional function that is called regularly, possibly from several threads at
+ *       once. If it returns true the calculation is aborted and the content of outDistanceField
+ *       is undefined.
  */
 template <typename T, typename U, typename Predicate, typename ValueTransform,
           typename ProgressCallback>
 void volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                                 VolumeRAMPrecision<U>* outDistanceField, const Matrix<3, U> basis,
                                 const size3_t upsample, Predicate predicate,
-                                ValueTransform valueTransform, ProgressCallback callback);
+                                ValueTransform valueTransform, ProgressCallback callback,
+                                std::function<bool()> stop = nullptr);
 
 template <typename T, typename U>
 void volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
@@ -72,12 +79,14 @@ void volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
 template <typename U, typename Predicate, typename ValueTransform, typename ProgressCallback>
 void volumeDistanceTransform(const Volume* inVolume, VolumeRAMPrecision<U>* outDistanceField,
                              const size3_t upsample, Predicate predicate,
-                             ValueTransform valueTransform, ProgressCallback callback);
+                             ValueTransform valueTransform, ProgressCallback callback,
+                             std::function<bool()> stop = nullptr);
 
 template <typename U, typename ProgressCallback>
 void volumeDistanceTransform(const Volume* inVolume, VolumeRAMPrecision<U>* outDistanceField,
                              const size3_t upsample, double threshold, bool normalize, bool flip,
-                             bool square, double scale, ProgressCallback callback);
+                             bool square, double scale, ProgressCallback callback,
+                             std::function<bool()> stop = nullptr);
 
 template <typename U>
 void volumeDistanceTransform(const Volume* inVolume, VolumeRAMPrecision<U>* outDistanceField,
@@ -92,7 +101,7 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                                       VolumeRAMPrecision<U>* outDistanceField,
                                       const Matrix<3, U> basis, const size3_t upsample,
                                       Predicate predicate, ValueTransform valueTransform,
-                                      ProgressCallback callback) {
+                                      ProgressCallback callback, std::function<bool()> stop) {
 
 #ifdef IVW_USE_OPENMP
     omp_set_num_threads(std::thread::hardware_concurrency());
@@ -147,6 +156,15 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
     util::IndexMapper<3, int64> srcInd(srcDim);
     util::IndexMapper<3, int64> dstInd(dstDim);
 
+    // Checked once per slice or row, OpenMP loops can not be exited early so remaining
+    // iterations are skipped instead
+    std::atomic<bool> aborted{false};
+    const auto shouldStop = [&]() {
+        if (aborted.load(std::memory_order_relaxed)) return true;
+        if (stop && stop()) aborted.store(true, std::memory_order_relaxed);
+        return aborted.load(std::memory_order_relaxed);
+    };
+
     auto is_feature = [&](const int64 x, const int64 y, const int64 z) {
         return predicate(src[srcInd(x / sm.x, y / sm.y, z / sm.z)]);
     };
@@ -157,6 +175,7 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
 #pragma omp parallel for
 #endif
     for (int64 z = 0; z < dstDim.z; ++z) {
+        if (shouldStop()) continue;
         for (int64 y = 0; y < dstDim.y; ++y) {
             // forward
             U dist = static_cast<U>(dstDim.x);
@@ -186,6 +205,7 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
     // second pass, scan y direction
     // for each voxel v(x,y,z) find min_i(data(x,i,z) + (y - i)^2), 0 <= i < dimY
     // result: min distance in x and y direction
+    if (shouldStop()) return;
     callback(0.3);
 #ifdef IVW_USE_OPENMP
 #pragma omp parallel
@@ -197,6 +217,7 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
 #pragma omp for
 #endif
         for (int64 z = 0; z < dstDim.z; ++z) {
+            if (shouldStop()) continue;
             for (int64 x = 0; x < dstDim.x; ++x) {
 
                 // cache column data into temporary buffer
@@ -225,6 +246,7 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
     // third pass, scan z direction
     // for each voxel v(x,y,z) find min_i(data(x,y,i) + (z - i)^2), 0 <= i < dimZ
     // result: min distance in x and y direction
+    if (shouldStop()) return;
     callback(0.6);
 #ifdef IVW_USE_OPENMP
 #pragma omp parallel
@@ -236,6 +258,7 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
 #pragma omp for
 #endif
         for (int64 y = 0; y < dstDim.y; ++y) {
+            if (shouldStop()) continue;
             for (int64 x = 0; x < dstDim.x; ++x) {
 
                 // cache column data into temporary buffer
@@ -262,6 +285,7 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
     }
 
     // scale data
+    if (shouldStop()) return;
     callback(0.9);
     const int64 volSize = dstDim.x * dstDim.y * dstDim.z;
 #ifdef IVW_USE_OPENMP
@@ -290,12 +314,13 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
 template <typename U, typename Predicate, typename ValueTransform, typename ProgressCallback>
 void util::volumeDistanceTransform(const Volume* inVolume, VolumeRAMPrecision<U>* outDistanceField,
                                    const size3_t upsample, Predicate predicate,
-                                   ValueTransform valueTransform, ProgressCallback callback) {
+                                   ValueTransform valueTransform, ProgressCallback callback,
+                                   std::function<bool()> stop) {
 
     const auto inputVolumeRep = inVolume->getRepresentation<VolumeRAM>();
     inputVolumeRep->dispatch<void, dispatching::filter::Scalars>([&](const auto vrprecision) {
         volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(), upsample,
-                                   predicate, valueTransform, callback);
+                                   predicate, valueTransform, callback, stop);
     });
 }
 
@@ -303,7 +328,7 @@ template <typename U, typename ProgressCallback>
 void util::volumeDistanceTransform(const Volume* inVolume, VolumeRAMPrecision<U>* outDistanceField,
                                    const size3_t upsample, double threshold, bool normalize,
                                    bool flip, bool square, double scale,
-                                   ProgressCallback progress) {
+                                   ProgressCallback progress, std::function<bool()> stop) {
 
     const auto inputVolumeRep = inVolume->getRepresentation<VolumeRAM>();
     inputVolumeRep->dispatch<void, dispatching::filter::Scalars>([&](const auto vrprecision) {
@@ -328,28 +353,36 @@ void util::volumeDistanceTransform(const Volume* inVolume, VolumeRAMPrecision<U>
 
         if (normalize && square && flip) {
             util::volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(),
-                                             upsample, normPredicateIn, valTransIdent, progress);
+                                             upsample, normPredicateIn, valTransIdent, progress,
+                                             stop);
         } else if (normalize && square && !flip) {
             util::volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(),
-                                             upsample, normPredicateOut, valTransIdent, progress);
+                                             upsample, normPredicateOut, valTransIdent, progress,
+                                             stop);
         } else if (normalize && !square && flip) {
             util::volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(),
-                                             upsample, normPredicateIn, valTransSqrt, progress);
+                                             upsample, normPredicateIn, valTransSqrt, progress,
+                                             stop);
         } else if (normalize && !square && !flip) {
             util::volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(),
-                                             upsample, normPredicateOut, valTransSqrt, progress);
+                                             upsample, normPredicateOut, valTransSqrt, progress,
+                                             stop);
         } else if (!normalize && square && flip) {
             util::volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(),
-                                             upsample, predicateIn, valTransIdent, progress);
+                                             upsample, predicateIn, valTransIdent, progress,
+                                             stop);
         } else if (!normalize && square && !flip) {
             util::volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(),
-                                             upsample, predicateOut, valTransIdent, progress);
+                                             upsample, predicateOut, valTransIdent, progress,
+                                             stop);
         } else if (!normalize && !square && flip) {
             util::volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(),
-                                             upsample, predicateIn, valTransSqrt, progress);
+                                             upsample, predicateIn, valTransSqrt, progress,
+                                             stop);
         } else if (!normalize && !square && !flip) {
             util::volumeRAMDistanceTransform(vrprecision, outDistanceField, inVolume->getBasis(),
-                                             upsample, predicateOut, valTransSqrt, progress);
+                                             upsample, predicateOut, valTransSqrt, progress,
+                                             stop);
         }
     });
 }
@@ -32,16 +32,45 @@
 
 #include <modules/base/basemoduledefine.h>
 #include <inviwo/core/util/glm.h>
+#include <functional>
 #include <memory>
 
 namespace inviwo {
 
 class VolumeRAM;
+class Volume;
 
 namespace util {
 
-IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeSubSample(const VolumeRAM* in,
-                                                               size3_t factors);
+enum class SubsampleMode {
+    Average,  ///< Average all voxels of each block
+    Nearest   ///< Pick the center voxel of each block, much faster but aliases
+};
+
+/**
+ * Subsample a volume representation by the given factors. If \p stop is set it is called once
+ * per slice, possibly from several threads at once, and the function returns nullptr as soon as it
+ * returns true.
+ */
+IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeSubSample(
+    const VolumeRAM* in, size3_t factors, SubsampleMode mode = SubsampleMode::Average,
+    std::function<bool()> stop = nullptr);
+
+/**
+ * Subsample a volume by the given factors, metadata, data map, and model and world matrices are
+ * copied from the input volume. Returns nullptr if aborted by \p stop.
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Volume> volumeSubSample(
+    const Volume& volume, size3_t factors, SubsampleMode mode = SubsampleMode::Average,
+    std::function<bool()> stop = nullptr);
+
+/**
+ * Create a coarse preview of a volume with at most about \p maxVoxels voxels using nearest
+ * sampling. Suitable for publishing intermediate results of expensive volume operations.
+ * Returns nullptr if the volume is already small enough that a preview would not save much time.
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Volume> volumePreview(const Volume& volume,
+                                                          size_t maxVoxels = size_t{1} << 18);
 
 }  // namespace util
 
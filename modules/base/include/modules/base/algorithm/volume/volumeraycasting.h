@@ -0,0 +1,160 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>
+#include <inviwo/core/datastructures/image/image.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/properties/raycastingproperty.h>
+#include <inviwo/core/properties/simplelightingproperty.h>
+#include <inviwo/core/util/glm.h>
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+namespace util {
+
+/**
+ * One channel of a volume prepared for raycasting on the CPU. The voxel values are mapped to
+ * normalized floats using the data range of the volume, like the GL raycasters do, and the
+ * value range of each brick of brickSize^3 voxels is stored to be able to skip empty space.
+ * The range of a brick includes the next voxel along each axis, hence it covers all trilinear
+ * samples taken within the brick.
+ */
+class IVW_MODULE_BASE_API RaycastingVolume {
+public:
+    static constexpr size_t brickSize = 8;
+
+    RaycastingVolume(const Volume& volume, size_t channel);
+
+    /**
+     * Trilinear sample at \p pos in data space, [0,1]^3, with voxel values at the voxel centers.
+     * Positions outside of the volume are clamped to the border.
+     */
+    float sample(const vec3& pos) const;
+
+    /**
+     * World space gradient at \p pos in data space, computed with finite differences of one
+     * voxel. Precomputed gradients are not supported, they fall back to central differences.
+     */
+    vec3 gradient(const vec3& pos, float value,
+                  RaycastingProperty::GradientComputation computation) const;
+
+    /**
+     * Index of the brick containing the trilinear sample at \p pos in data space
+     */
+    size_t brick(const vec3& pos) const;
+
+    /**
+     * Data space bounds of the brick containing \p pos. The first and last bricks along each
+     * axis are extended to include the clamped border region.
+     */
+    std::pair<vec3, vec3> brickBounds(const vec3& pos) const;
+
+    size3_t getDimensions() const { return dims_; }
+    size3_t getBrickDimensions() const { return bricks_; }
+    const std::vector<vec2>& getBrickRanges() const { return brickRanges_; }
+    const mat4& getDataToWorld() const { return dataToWorld_; }
+    const mat4& getWorldToData() const { return worldToData_; }
+
+private:
+    vec3 continuousIndex(const vec3& pos) const;
+
+    size3_t dims_;
+    size3_t bricks_;
+    std::vector<float> data_;
+    std::vector<vec2> brickRanges_;
+    mat4 dataToWorld_;
+    mat4 worldToData_;
+    mat3 dataToWorldNormal_;
+};
+
+/**
+ * The parameters of util::raycastVolume, corresponding to the properties of the GL raycasters.
+ */
+struct IVW_MODULE_BASE_API RaycastingSettings {
+    RaycastingProperty::RenderingType renderingType = RaycastingProperty::RenderingType::Dvr;
+    RaycastingProperty::Classification classification = RaycastingProperty::Classification::TF;
+    RaycastingProperty::CompositingType compositing = RaycastingProperty::CompositingType::Dvr;
+    RaycastingProperty::GradientComputation gradient =
+        RaycastingProperty::GradientComputation::Central;
+    float samplingRate = 2.0f;
+    /**
+     * Skip bricks that can not contribute to the image, disabling it does not change the result
+     */
+    bool emptySpaceSkipping = true;
+
+    /**
+     * Transfer function sampled at equally spaced positions in [0,1], the first entry at 0 and
+     * the last at 1. Values in between are interpolated linearly.
+     */
+    std::vector<vec4> transferFunction;
+    /**
+     * Isovalues and their colors, sorted by isovalue
+     */
+    std::vector<std::pair<float, vec4>> isovalues;
+
+    ShadingMode::Modes shading = ShadingMode::None;
+    vec3 lightPosition{0.0f};  ///< In world space
+    vec3 ambientColor{0.15f};
+    vec3 diffuseColor{0.6f};
+    vec3 specularColor{0.4f};
+    float specularExponent = 60.0f;
+
+    mat4 viewMatrix{1.0f};
+    mat4 projectionMatrix{1.0f};
+};
+
+/**
+ * Render \p volume into a new image of size \p dimensions by casting one ray per pixel through
+ * the volume. The result matches the output of the GL VolumeRaycaster using entry and exit points
+ * of the volume's bounding box and no background, i.e. a color layer and a depth layer with the
+ * depth of the first non-transparent sample, or 1 where nothing was hit.
+ *
+ * The image is rendered in tiles in parallel using the thread pool. Bricks that can not
+ * contribute to the image are skipped unless RaycastingSettings::emptySpaceSkipping is false, and
+ * a ray is terminated once it is opaque.
+ *
+ * @param volume prepared channel of the volume to render
+ * @param settings rendering parameters
+ * @param dimensions size of the output image
+ * @param progress optional callback called with the progress in [0,1] after each tile, possibly
+ *        from several threads at once.
+ * @param stop optional callback, if it returns true rendering is aborted and nullptr is returned.
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Image> raycastVolume(
+    const RaycastingVolume& volume, const RaycastingSettings& settings, size2_t dimensions,
+    std::function<void(float)> progress = nullptr, std::function<bool()> stop = nullptr);
+
+}  // namespace util
+}  // namespace inviwo
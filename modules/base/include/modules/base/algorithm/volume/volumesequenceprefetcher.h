@@ -0,0 +1,119 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+
+#include <future>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace inviwo {
+
+class VolumeRAM;
+
+/**
+ * \brief Loads the upcoming time steps of a volume sequence in the background
+ *
+ * Volume sequences from readers like the DatVolumeSequenceReader only have a disk representation
+ * for each time step, and the first access to a step blocks on reading the whole volume. Given
+ * the step that is currently accessed and the playback direction, the prefetcher converts the
+ * following steps to VolumeRAM on the thread pool, as many as fit within the memory budget.
+ * Steps loaded by the prefetcher that are no longer needed have their RAM representations
+ * released, provided they can be recreated, for example from disk.
+ *
+ * Steps that have been accessed are kept as long as they fit within the memory budget together
+ * with the steps loaded ahead. Beyond that, the least recently accessed ones are released once
+ * nothing but the sequence refers to their volume, i.e. no processor or background job
+ * downstream holds on to them.
+ *
+ * The prefetcher is not thread safe, it is meant to be used from the processor owning it.
+ */
+class IVW_MODULE_BASE_API VolumeSequencePrefetcher {
+public:
+    enum class Direction { Forward, Backward };
+
+    struct Statistics {
+        size_t hits = 0;        ///< Accessed steps that were already loaded
+        size_t pending = 0;     ///< Accessed steps that were still being loaded
+        size_t misses = 0;      ///< Accessed steps that were not prefetched
+        size_t prefetched = 0;  ///< Steps that have been scheduled for loading
+        size_t dropped = 0;     ///< Steps that have had their RAM representation released
+    };
+
+    /**
+     * @param steps the number of steps to load ahead of the accessed step
+     * @param memoryBudget the number of bytes used by the loaded steps, the steps ahead of the
+     *        accessed step are never more than this, accessed steps are released to stay within it
+     */
+    VolumeSequencePrefetcher(size_t steps = 4, size_t memoryBudget = size_t{1} << 30);
+    VolumeSequencePrefetcher(const VolumeSequencePrefetcher&) = delete;
+    VolumeSequencePrefetcher& operator=(const VolumeSequencePrefetcher&) = delete;
+    ~VolumeSequencePrefetcher() = default;
+
+    void setSequence(std::shared_ptr<const VolumeSequence> sequence);
+    void setSteps(size_t steps);
+    void setMemoryBudget(size_t bytes);
+
+    /**
+     * Record an access to the step at \p index, release the loaded steps that are no longer
+     * needed, and start loading the steps following \p index in \p direction. The sequence is
+     * treated as a loop. Accessed steps that are no longer referenced downstream are released,
+     * least recently accessed first, while the loaded steps exceed the memory budget.
+     */
+    void access(size_t index, Direction direction);
+
+    const Statistics& getStatistics() const;
+    void resetStatistics();
+
+private:
+    struct Load {
+        std::shared_future<const VolumeRAM*> ram;  ///< Not valid if loaded downstream
+        size_t accessed = 0;  ///< The number of the last access to the step, 0 if never accessed
+    };
+    /// Release a loaded step that is ready and not in the window, returns true if it is done
+    bool release(std::map<size_t, Load>::iterator it);
+    /// Release the least recently accessed steps until the loaded steps fit within the budget
+    void evict();
+
+    std::shared_ptr<const VolumeSequence> sequence_;
+    size_t steps_;
+    size_t memoryBudget_;
+    /// Steps loaded by the prefetcher, and accessed steps loaded downstream
+    std::map<size_t, Load> loaded_;
+    size_t accesses_;
+    /// The last accessed step and the steps loaded ahead of it
+    std::vector<size_t> window_;
+    Statistics stats_;
+};
+
+}  // namespace inviwo
@@ -39,6 +39,7 @@
 #include <vector>
 #include <optional>
 #include <memory>
+#include <functional>
 
 namespace inviwo {
 namespace util {
@@ -58,12 +59,18 @@ namespace util {
  *     * wrapping the wrapping mode of the volume, @see Wrapping3D.
  *     * weigths is an optional vector containing the weights for each seed point. If set the
  *       weighted version of voronoi should be used.
+ *     * progress is an optional callback that is called with the progress in [0,1].
+ *     * stop is an optional callback, if it returns true the segmentation is aborted and nullptr
+ *       is returned.
+ *
+ * The callbacks are called once per slice, possibly from several threads at once.
  */
 
 IVW_MODULE_BASE_API std::shared_ptr<Volume> voronoiSegmentation(
     const size3_t volumeDimensions, const mat4& indexToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices, const Wrapping3D& wrapping,
-    const std::optional<std::vector<float>>& weights);
+    const std::optional<std::vector<float>>& weights,
+    std::function<void(float)> progress = nullptr, std::function<bool()> stop = nullptr);
 
 }  // namespace util
 }  // namespace inviwo
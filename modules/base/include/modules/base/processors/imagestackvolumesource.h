@@ -32,7 +32,8 @@
 #include <modules/base/basemoduledefine.h>
 #include <inviwo/core/common/inviwo.h>
 
-#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/io/datareader.h>
 #include <inviwo/core/ports/volumeport.h>
 #include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/buttonproperty.h>
@@ -45,6 +46,7 @@
 namespace inviwo {
 
 class FileExtension;
+class Layer;
 class Volume;
 class InviwoApplication;
 class DataReaderFactory;
@@ -61,6 +63,9 @@ class DataReaderFactory;
  * Single channels, i.e. red, green, blue, alpha, and grayscale, will result in a scalar volume
  * whereas rgb and rgba will yield a vec3 or vec4 volume, respectively.
  *
+ * The images are loaded in the background, several slices in parallel, and are copied directly into
+ * the volume. The number of images in memory at once is limited by the thread pool size.
+ *
  * ### Outports
  *   * __volume__ Volume generated from a stack of input images.
  *
@@ -74,7 +79,7 @@ class DataReaderFactory;
  *   * __Data Information__       Metadata of the generated volume data set.
  *
  */
-class IVW_MODULE_BASE_API ImageStackVolumeSource : public Processor {
+class IVW_MODULE_BASE_API ImageStackVolumeSource : public PoolProcessor {
 public:
     ImageStackVolumeSource(InviwoApplication* app);
     void addFileNameFilters();
@@ -86,7 +91,14 @@ public:
     static const ProcessorInfo processorInfo_;
 
 protected:
-    std::shared_ptr<Volume> load();
+    using Slices = std::vector<std::pair<std::string, std::shared_ptr<DataReaderType<Layer>>>>;
+    /**
+     * Find a reader for each matching file, readers are nullptr for unsupported files unless they
+     * are skipped.
+     */
+    Slices getSlices();
+    static std::shared_ptr<Volume> load(const Slices& slices, pool::Stop stop,
+                                        pool::Progress progress);
     bool isValidImageFile(std::string);
 
     virtual void deserialize(Deserializer& d) override;
@@ -78,13 +78,30 @@ public:
 
     virtual void process() override;
 
+    /**
+     * The mesh of one volume, or the mesh of a coarse preview of it while the mesh of the full
+     * volume is being extracted
+     */
+    struct Surface {
+        std::shared_ptr<Mesh> mesh;
+        bool preview = false;
+    };
+
+    enum class Update { Keep, ChangeColor, Extract };
+    /**
+     * How to update the \p surface of a volume. Only a mesh of the full volume is kept or
+     * recolored, a missing mesh or a preview is always extracted again.
+     */
+    static Update update(const Surface& surface, bool volumeChanged, bool colorChanged);
+
 protected:
     void updateColors();
     vec4 getColor(size_t i) const;
+    void updateOutport();
 
     DataInport<Volume, 0, true> volume_;
     DataOutport<std::vector<std::shared_ptr<Mesh>>> outport_;
-    std::vector<std::shared_ptr<Mesh>> meshes_;
+    std::vector<Surface> meshes_;
 
     TemplateOptionProperty<Method> method_;
     FloatProperty isoValue_;
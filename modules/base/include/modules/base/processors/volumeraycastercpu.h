@@ -0,0 +1,98 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>
+#include <modules/base/algorithm/volume/volumeraycasting.h>
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/ports/imageport.h>
+#include <inviwo/core/ports/volumeport.h>
+#include <inviwo/core/properties/cameraproperty.h>
+#include <inviwo/core/properties/isotfproperty.h>
+#include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/raycastingproperty.h>
+#include <inviwo/core/properties/simplelightingproperty.h>
+
+#include <memory>
+
+namespace inviwo {
+
+/** \docpage{org.inviwo.VolumeRaycasterCPU, Volume Raycaster CPU}
+ * ![](org.inviwo.VolumeRaycasterCPU.png?classIdentifier=org.inviwo.VolumeRaycasterCPU)
+ * Volume raycasting on the CPU, for rendering without an OpenGL context, for example on
+ * headless render nodes. The rays are generated from the camera and the bounding box of the
+ * volume, hence no entry and exit points are needed. The output matches the Volume Raycaster
+ * without a background image, but the position indicator is not supported. The image is
+ * rendered in the background using the thread pool.
+ *
+ * ### Inports
+ *   * __volume__ input volume
+ *
+ * ### Outports
+ *   * __outport__ output image with the volume rendering in the color layer and the depth of
+ *     the first non-transparent sample in the depth layer
+ *
+ * ### Properties
+ *   * __Render Channel__    selects which channel of the input volume is rendered
+ *   * __Raycasting__        raycasting parameters including rendering type (DVR / isosurfaces),
+ *                           compositing, sampling rate, etc. Precomputed gradients are not
+ *                           supported and fall back to central differences.
+ *   * __Transfer function__ property for both transfer function and isovalues
+ *   * __Camera__            camera properties
+ *   * __Lighting__          lighting properties
+ */
+class IVW_MODULE_BASE_API VolumeRaycasterCPU : public PoolProcessor {
+public:
+    VolumeRaycasterCPU();
+    virtual ~VolumeRaycasterCPU() = default;
+
+    virtual void process() override;
+
+    virtual const ProcessorInfo getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+private:
+    util::RaycastingSettings getSettings() const;
+
+    VolumeInport volumePort_;
+    ImageOutport outport_;
+
+    OptionPropertyInt channel_;
+    RaycastingProperty raycasting_;
+    IsoTFProperty isotfComposite_;
+
+    CameraProperty camera_;
+    SimpleLightingProperty lighting_;
+
+    // The volume converted for raycasting, reused until the volume or channel changes
+    std::shared_ptr<const util::RaycastingVolume> prepared_;
+};
+
+}  // namespace inviwo
@@ -34,7 +34,11 @@
 #include <inviwo/core/common/inviwo.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/ports/volumeport.h>
+#include <inviwo/core/properties/boolcompositeproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
 #include <modules/base/processors/vectorelementselectorprocessor.h>
+#include <modules/base/algorithm/volume/volumesequenceprefetcher.h>
 
 namespace inviwo {
 
@@ -50,6 +54,11 @@ namespace inviwo {
  *
  * ### Properties
  *   * __Step__ The volume sequence index to extract
+ *   * __Prefetch__ Load the upcoming time steps in the background while playing the sequence
+ *   * __Steps Ahead__ The number of time steps to load ahead
+ *   * __Memory Budget__ The maximum amount of memory (MB) used by the time steps loaded ahead
+ *   * __Statistics__ The number of accessed time steps that were already loaded (hits), still
+ *     loading (pending), or not loaded (misses)
  */
 class IVW_MODULE_BASE_API VolumeSequenceElementSelectorProcessor
     : public VectorElementSelectorProcessor<Volume> {
@@ -57,8 +66,19 @@ public:
     VolumeSequenceElementSelectorProcessor();
     virtual ~VolumeSequenceElementSelectorProcessor() = default;
 
+    virtual void process() override;
+
     virtual const ProcessorInfo getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
+
+private:
+    BoolCompositeProperty prefetch_;
+    IntSizeTProperty prefetchSteps_;
+    IntSizeTProperty memoryBudget_;
+    StringProperty statistics_;
+
+    VolumeSequencePrefetcher prefetcher_;
+    size_t lastIndex_;
 };
 
 }  // namespace inviwo
@@ -44,7 +44,8 @@ namespace inviwo {
 /** \docpage{org.inviwo.VolumeSubsample, Volume Subsample}
  * ![](org.inviwo.VolumeSubsample.png?classIdentifier=org.inviwo.VolumeSubsample)
  *
- * ...
+ * Reduces the resolution of a volume by averaging blocks of voxels. The calculation runs in
+ * the background, for large volumes a coarse preview is shown while it is running.
  *
  * ### Inports
  *   * __volume.inport__ ...
@@ -68,8 +69,6 @@ public:
 protected:
     virtual void process() override;
 
-    static std::shared_ptr<Volume> subsample(std::shared_ptr<const Volume> volume, size3_t f);
-
 private:
     VolumeInport inport_;
     VolumeOutport outport_;
@@ -32,7 +32,13 @@
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>
 
+#include <inviwo/core/util/threadutil.h>
+
 #include <algorithm>
+#include <array>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
 
 namespace inviwo {
 
@@ -40,6 +46,302 @@ namespace meshutil {
 
 namespace detail {
 
+namespace {
+
+/**
+ * Maps positions that are equal within eps to the same id, the index of the first such position
+ * that was looked up. Positions are stored in a hash grid with a cell size of eps, hence only the
+ * neighboring cells have to be searched.
+ */
+class PositionIndex {
+public:
+    PositionIndex(const std::vector<vec3>& positions, float eps)
+        : positions_{positions}, eps_{eps}, cellSize_{eps > 0.0f ? eps : 1.0f} {}
+
+    std::uint32_t operator()(std::uint32_t index) {
+        if (const auto it = ids_.find(index); it != ids_.end()) return it->second;
+
+        const auto& pos = positions_[index];
+        const glm::i64vec3 cell{glm::floor(dvec3{pos} / static_cast<double>(cellSize_))};
+        const auto id = [&]() {
+            for (std::int64_t z = -1; z <= 1; ++z) {
+                for (std::int64_t y = -1; y <= 1; ++y) {
+                    for (std::int64_t x = -1; x <= 1; ++x) {
+                        const auto it = grid_.find(cell + glm::i64vec3{x, y, z});
+                        if (it == grid_.end()) continue;
+                        for (auto candidate : it->second) {
+                            if (glm::all(glm::equal(positions_[candidate], pos, eps_))) {
+                                return candidate;
+                            }
+                        }
+                    }
+                }
+            }
+            grid_[cell].push_back(index);
+            return index;
+        }();
+        ids_.emplace(index, id);
+        return id;
+    }
+
+private:
+    const std::vector<vec3>& positions_;
+    float eps_;
+    float cellSize_;
+    std::unordered_map<glm::i64vec3, std::vector<std::uint32_t>> grid_;
+    std::unordered_map<std::uint32_t, std::uint32_t> ids_;
+};
+
+/**
+ * Keeps track of the vertices created while clipping, as weighted sums of existing vertices.
+ * Positions are needed during the clipping and are computed directly, all other attributes are
+ * interpolated afterwards with one typed pass per buffer, see interpolate.
+ */
+class NewVertices {
+public:
+    explicit NewVertices(std::vector<vec3>& positions)
+        : positions_{positions}, first_{static_cast<std::uint32_t>(positions.size())} {}
+
+    /**
+     * Reserve \p count vertices interpolated between two vertices, to be defined using set.
+     * @return the index of the first vertex
+     */
+    std::uint32_t allocate(size_t count) {
+        const auto first = static_cast<std::uint32_t>(positions_.size());
+        positions_.resize(positions_.size() + count);
+        for (size_t i = 0; i < count; ++i) offsets_.push_back(offsets_.back() + 2);
+        sources_.resize(offsets_.back());
+        weights_.resize(offsets_.back());
+        normals_.resize(normals_.size() + count);
+        return first;
+    }
+
+    /**
+     * Define the allocated vertex \p index as (1 - weight) * a + weight * b. Different vertices
+     * can be set concurrently.
+     */
+    void set(std::uint32_t index, std::uint32_t a, std::uint32_t b, float weight) {
+        const auto offset = offsets_[index - first_];
+        sources_[offset] = a;
+        sources_[offset + 1] = b;
+        weights_[offset] = 1.0f - weight;
+        weights_[offset + 1] = weight;
+        positions_[index] = positions_[a] * (1.0f - weight) + positions_[b] * weight;
+    }
+
+    std::uint32_t add(std::uint32_t a, std::uint32_t b, float weight) {
+        const auto index = allocate(1);
+        set(index, a, b, weight);
+        return index;
+    }
+
+    /**
+     * Add a vertex as a weighted sum of \p indices. If a \p normal is given it is used instead of
+     * the interpolated normal.
+     */
+    std::uint32_t add(const std::vector<std::uint32_t>& indices, const std::vector<float>& weights,
+                      std::optional<vec3> normal) {
+        const auto index = static_cast<std::uint32_t>(positions_.size());
+        const auto pos =
+            std::inner_product(indices.begin(), indices.end(), weights.begin(), vec3{0.0f},
+                               std::plus<>{}, [&](std::uint32_t i, float w) {
+                                   return positions_[i] * w;
+                               });
+        positions_.push_back(pos);
+        sources_.insert(sources_.end(), indices.begin(), indices.end());
+        weights_.insert(weights_.end(), weights.begin(), weights.end());
+        offsets_.push_back(static_cast<std::uint32_t>(sources_.size()));
+        normals_.push_back(normal);
+        return index;
+    }
+
+    /**
+     * Append the values of all new vertices to \p buffer. Floating point values are interpolated,
+     * integer values are taken from the source vertex with the largest weight.
+     */
+    template <typename ValueType, BufferTarget Target>
+    void interpolate(BufferRAMPrecision<ValueType, Target>& buffer, bool isNormal) const {
+        using T = typename util::same_extent<ValueType, float>::type;
+        auto& data = buffer.getDataContainer();
+        data.reserve(data.size() + normals_.size());
+
+        for (size_t i = 0; i < normals_.size(); ++i) {
+            const auto begin = offsets_[i];
+            const auto end = offsets_[i + 1];
+            if constexpr (std::is_same_v<ValueType, vec3>) {
+                if (isNormal && normals_[i]) {
+                    data.push_back(*normals_[i]);
+                    continue;
+                }
+            }
+            if constexpr (DataFormat<ValueType>::numtype == NumericType::Float) {
+                T value{0};
+                for (auto j = begin; j < end; ++j) {
+                    value = value + static_cast<T>(data[sources_[j]]) * weights_[j];
+                }
+                data.push_back(static_cast<ValueType>(value));
+            } else {  // Only interpolate floating point buffers
+                const auto it = std::max_element(weights_.begin() + begin, weights_.begin() + end);
+                const ValueType value = data[sources_[std::distance(weights_.begin(), it)]];
+                data.push_back(value);
+            }
+        }
+    }
+
+private:
+    std::vector<vec3>& positions_;
+    std::uint32_t first_;
+    std::vector<std::uint32_t> offsets_{0};  ///< range of sources and weights for each vertex
+    std::vector<std::uint32_t> sources_;
+    std::vector<float> weights_;
+    std::vector<std::optional<vec3>> normals_;
+};
+
+struct ClippedTriangle {
+    std::array<std::uint32_t, 6> indices;
+    size_t size = 0;
+    std::optional<glm::u32vec2> edge;
+};
+
+/**
+ * Sutherland-Hodgman clipping of one triangle, see sutherlandHodgman. \p inside tells if a vertex
+ * is inside the plane and \p addVertex(a, b, weight) creates a vertex on the edge between a and b.
+ */
+template <typename Inside, typename AddVertex>
+ClippedTriangle clipTriangle(glm::u32vec3 triangle, const Plane& plane,
+                             const std::vector<vec3>& positions, Inside&& inside,
+                             AddVertex&& addVertex) {
+    std::array<std::uint32_t, 4> newIndices;
+    size_t nIndices = 0;
+    std::array<std::uint32_t, 2> newEdge;
+    size_t nEdge = 0;
+
+    for (size_t i = 0; i < 3; ++i) {
+        const auto i1 = triangle[i];
+        const auto i2 = triangle[(i + 1) % 3];
+
+        if (inside(i1)) {
+            if (inside(i2)) {  // Case 1
+                newIndices[nIndices++] = i2;
+            } else {  // Case 2
+                const auto weight = *plane.getIntersectionWeight(positions[i1], positions[i2]);
+                const auto newIndex = addVertex(i1, i2, weight);
+                newIndices[nIndices++] = newIndex;
+                newEdge[nEdge++] = newIndex;
+            }
+        } else if (inside(i2)) {  // Case 3
+            const auto weight = *plane.getIntersectionWeight(positions[i1], positions[i2]);
+            const auto newIndex = addVertex(i1, i2, weight);
+            newIndices[nIndices++] = newIndex;
+            newEdge[nEdge++] = newIndex;
+            newIndices[nIndices++] = i2;
+        }
+    }
+
+    ClippedTriangle res;
+    if (nIndices == 3) {
+        res.indices = {newIndices[0], newIndices[1], newIndices[2]};
+        res.size = 3;
+    } else if (nIndices == 4) {
+        res.indices = {newIndices[0], newIndices[1], newIndices[2],
+                       newIndices[0], newIndices[2], newIndices[3]};
+        res.size = 6;
+    }
+    if (nEdge == 2) {
+        res.edge = glm::u32vec2{newEdge[0], newEdge[1]};
+    }
+    return res;
+}
+
+constexpr size_t chunkSize = 1 << 14;
+
+/**
+ * Classify the vertices against the plane in parallel, 1 if inside and 0 otherwise
+ */
+std::vector<char> classify(const std::vector<vec3>& positions, const Plane& plane) {
+    std::vector<char> inside(positions.size());
+    util::parallelFor(positions.size(), chunkSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            inside[i] = plane.isInside(positions[i]) ? 1 : 0;
+        }
+    });
+    return inside;
+}
+
+/**
+ * Clip \p count triangles given by \p getTriangle in parallel. The triangles are first counted
+ * per chunk to find where the output of each chunk goes, and then clipped directly into place,
+ * giving the same result as clipping them in order.
+ */
+template <typename GetTriangle>
+std::vector<glm::u32vec2> clipTriangles(size_t count, GetTriangle getTriangle, const Plane& plane,
+                                        const std::vector<char>& inside, NewVertices& vertices,
+                                        const std::vector<vec3>& positions,
+                                        std::vector<std::uint32_t>& outIndices) {
+    struct Offsets {
+        size_t indices = 0;
+        size_t vertices = 0;
+        size_t edges = 0;
+    };
+    std::vector<Offsets> offsets(util::rangeCount(count, chunkSize) + 1);
+
+    util::parallelFor(count, chunkSize, [&](size_t begin, size_t end) {
+        auto& size = offsets[begin / chunkSize + 1];
+        for (size_t t = begin; t < end; ++t) {
+            const auto triangle = getTriangle(t);
+            switch (inside[triangle[0]] + inside[triangle[1]] + inside[triangle[2]]) {
+                case 1:
+                    size.indices += 3;
+                    size.vertices += 2;
+                    size.edges += 1;
+                    break;
+                case 2:
+                    size.indices += 6;
+                    size.vertices += 2;
+                    size.edges += 1;
+                    break;
+                case 3:
+                    size.indices += 3;
+                    break;
+                default:
+                    break;
+            }
+        }
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin(), [](Offsets a, Offsets b) {
+        return Offsets{a.indices + b.indices, a.vertices + b.vertices, a.edges + b.edges};
+    });
+
+    const auto indexBegin = outIndices.size();
+    outIndices.resize(indexBegin + offsets.back().indices);
+    const auto vertexBegin = vertices.allocate(offsets.back().vertices);
+    std::vector<glm::u32vec2> newEdges(offsets.back().edges);
+
+    util::parallelFor(count, chunkSize, [&](size_t begin, size_t end) {
+        const auto& offset = offsets[begin / chunkSize];
+        auto index = indexBegin + offset.indices;
+        auto vertex = static_cast<std::uint32_t>(vertexBegin + offset.vertices);
+        auto edge = offset.edges;
+
+        for (size_t t = begin; t < end; ++t) {
+            const auto clipped = clipTriangle(
+                getTriangle(t), plane, positions, [&](std::uint32_t i) { return inside[i] != 0; },
+                [&](std::uint32_t a, std::uint32_t b, float weight) {
+                    vertices.set(vertex, a, b, weight);
+                    return vertex++;
+                });
+            std::copy(clipped.indices.begin(), clipped.indices.begin() + clipped.size,
+                      outIndices.begin() + index);
+            index += clipped.size;
+            if (clipped.edge) newEdges[edge++] = *clipped.edge;
+        }
+    });
+
+    return newEdges;
+}
+
+}  // namespace
+
 /* Sutherland-Hodgman Clipping
  *  1) Traverse each edge of each triangle
  *  2) For each edge with vertices [v1, v2]
@@ -57,142 +359,104 @@ std::optional<glm::u32vec2> sutherlandHodgman(glm::u32vec3 triangle, const Plane
                                               const std::vector<vec3>& positions,
                                               std::vector<std::uint32_t>& indices,
                                               const InterpolateFunctor& addInterpolatedVertex) {
-
-    std::vector<std::uint32_t> newIndices;
-    std::vector<std::uint32_t> newEdge;
-
-    for (size_t i = 0; i < 3; ++i) {
-        const auto i1 = triangle[i];
-        const auto i2 = triangle[(i + 1) % 3];
-        const auto v1 = positions[i1];
-        const auto v2 = positions[i2];
-
-        if (plane.isInside(v1)) {
-            if (plane.isInside(v2)) {  // Case 1
-                newIndices.push_back(i2);
-            } else {  // Case 2
-                const auto weight = *plane.getIntersectionWeight(v1, v2);
-                const auto newIndex =
-                    addInterpolatedVertex({i1, i2}, {1.0f - weight, weight}, std::nullopt);
-                newIndices.push_back(newIndex);
-                newEdge.push_back(newIndex);
-            }
-        } else if (plane.isInside(v2)) {  // Case 3
-            const auto weight = *plane.getIntersectionWeight(v1, v2);
-            const auto newIndex =
-                addInterpolatedVertex({i1, i2}, {1.0f - weight, weight}, std::nullopt);
-            newIndices.push_back(newIndex);
-            newEdge.push_back(newIndex);
-            newIndices.push_back(i2);
-        }
-    }
-    if (newIndices.size() == 3) {
-        indices.push_back(newIndices[0]);
-        indices.push_back(newIndices[1]);
-        indices.push_back(newIndices[2]);
-    } else if (newIndices.size() == 4) {
-        indices.push_back(newIndices[0]);
-        indices.push_back(newIndices[1]);
-        indices.push_back(newIndices[2]);
-
-        indices.push_back(newIndices[0]);
-        indices.push_back(newIndices[2]);
-        indices.push_back(newIndices[3]);
-    }
-    if (newEdge.size() == 2) {
-        return glm::u32vec2{newEdge[0], newEdge[1]};
-    } else {
-        return std::nullopt;
-    }
+    const auto clipped = clipTriangle(
+        triangle, plane, positions,
+        [&](std::uint32_t i) { return plane.isInside(positions[i]); },
+        [&](std::uint32_t a, std::uint32_t b, float weight) {
+            return addInterpolatedVertex({a, b}, {1.0f - weight, weight}, std::nullopt);
+        });
+    indices.insert(indices.end(), clipped.indices.begin(),
+                   clipped.indices.begin() + clipped.size);
+    return clipped.edge;
 }
 
 void removeDuplicateEdges(std::vector<glm::u32vec2>& cuts, const std::vector<vec3>& positions,
                           float eps) {
-
-    cuts.erase(
-        std::remove_if(cuts.begin(), cuts.end(),
-                       [&](glm::u32vec2 edge) {
-                           return glm::all(glm::equal(positions[edge[0]], positions[edge[1]], eps));
-                       }),
-        cuts.end());
-
-    std::transform(cuts.begin(), cuts.end(), cuts.begin(), [&](glm::u32vec2 edge) {
-        const auto pa = glm::value_ptr(positions[edge[0]]);
-        const auto pb = glm::value_ptr(positions[edge[1]]);
-        return std::lexicographical_compare(pa, pa + 3, pb, pb + 3)
-                   ? edge
-                   : glm::u32vec2{edge[1], edge[0]};
-    });
-
-    std::sort(cuts.begin(), cuts.end(), [&](glm::u32vec2 a, glm::u32vec2 b) {
-        const auto pa0 = glm::value_ptr(positions[a[0]]);
-        const auto pb0 = glm::value_ptr(positions[b[0]]);
-        if (std::lexicographical_compare(pa0, pa0 + 3, pb0, pb0 + 3)) {
-            return true;
-        } else if (std::lexicographical_compare(pb0, pb0 + 3, pa0, pa0 + 3)) {
-            return false;
+    PositionIndex index{positions, eps};
+
+    // Identify each edge by the ids of its end points, with the smallest id first
+    std::vector<std::pair<glm::u32vec2, glm::u32vec2>> keyed;
+    keyed.reserve(cuts.size());
+    for (auto edge : cuts) {
+        const glm::u32vec2 key{index(edge[0]), index(edge[1])};
+        if (key[0] == key[1]) continue;
+        if (key[0] < key[1]) {
+            keyed.emplace_back(key, edge);
         } else {
-            const auto pa1 = glm::value_ptr(positions[a[1]]);
-            const auto pb1 = glm::value_ptr(positions[b[1]]);
-            return std::lexicographical_compare(pa1, pa1 + 3, pb1, pb1 + 3);
+            keyed.emplace_back(glm::u32vec2{key[1], key[0]}, glm::u32vec2{edge[1], edge[0]});
         }
-    });
-    cuts.erase(std::unique(cuts.begin(), cuts.end(),
-                           [&](glm::u32vec2 a, glm::u32vec2 b) {
-                               return glm::all(glm::equal(positions[a[0]], positions[b[0]], eps)) &&
-                                      glm::all(glm::equal(positions[a[1]], positions[b[1]], eps));
-                           }),
-               cuts.end());
+    }
+
+    const auto lessKey = [](const auto& a, const auto& b) {
+        return std::tie(a.first[0], a.first[1]) < std::tie(b.first[0], b.first[1]);
+    };
+    std::sort(keyed.begin(), keyed.end(), lessKey);
+    keyed.erase(std::unique(keyed.begin(), keyed.end(),
+                            [](const auto& a, const auto& b) { return a.first == b.first; }),
+                keyed.end());
+
+    cuts.resize(keyed.size());
+    std::transform(keyed.begin(), keyed.end(), cuts.begin(),
+                   [](const auto& item) { return item.second; });
 }
 
 std::vector<std::vector<std::uint32_t>> gatherLoops(std::vector<glm::u32vec2>& edges,
                                                     const std::vector<vec3>& positions, float eps) {
-    std::vector<std::vector<std::uint32_t>> loops;
-
-    auto findMatch = [eps, &positions](std::vector<glm::u32vec2>& edges, std::uint32_t index) {
-        const auto it1 = std::find_if(edges.begin(), edges.end(), [&](glm::u32vec2 edge) {
-            return glm::all(glm::equal(positions[edge[0]], positions[index], eps));
-        });
+    PositionIndex index{positions, eps};
+
+    // The edges connected to each end point id
+    std::vector<glm::u32vec2> ids(edges.size());
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> connected;
+    for (std::uint32_t e = 0; e < edges.size(); ++e) {
+        ids[e] = glm::u32vec2{index(edges[e][0]), index(edges[e][1])};
+        connected[ids[e][0]].push_back(e);
+        connected[ids[e][1]].push_back(e);
+    }
 
-        if (it1 != edges.end()) {
-            return std::make_tuple(it1, (*it1)[1]);
-        }
-        const auto it2 = std::find_if(edges.begin(), edges.end(), [&](glm::u32vec2 edge) {
-            return glm::all(glm::equal(positions[edge[1]], positions[index], eps));
-        });
+    std::vector<bool> used(edges.size(), false);
+    size_t remaining = edges.size();
 
-        if (it2 != edges.end()) {
-            return std::make_tuple(it2, (*it2)[0]);
+    // Find an unused edge connected to id, returns the edge and the index at its other end
+    const auto findMatch =
+        [&](std::uint32_t id) -> std::optional<std::pair<std::uint32_t, std::uint32_t>> {
+        for (auto e : connected[id]) {
+            if (used[e]) continue;
+            return std::make_pair(e, ids[e][0] == id ? edges[e][1] : edges[e][0]);
         }
-
-        return std::make_tuple(edges.end(), uint32_t{0});
+        return std::nullopt;
     };
 
-    while (!edges.empty()) {
+    std::vector<std::vector<std::uint32_t>> loops;
+    for (auto start = edges.size(); start-- > 0;) {
+        if (used[start]) continue;
+        used[start] = true;
+        --remaining;
+
         auto& loop = loops.emplace_back();
-        loop.push_back(edges.back()[0]);
-        loop.push_back(edges.back()[1]);
-        edges.pop_back();
-
-        while (!edges.empty()) {
-            const auto [it, index] = findMatch(edges, loop.back());
-            if (it != edges.end()) {
-                if (glm::all(glm::equal(positions[index], positions[loop.front()], eps))) {
-                    edges.erase(it);
-                    break;
-                } else {
-                    loop.push_back(index);
-                    edges.erase(it);
-                }
-            } else {
+        loop.push_back(edges[start][0]);
+        loop.push_back(edges[start][1]);
+        const auto front = ids[start][0];
+        auto current = ids[start][1];
+
+        while (remaining > 0) {
+            const auto match = findMatch(current);
+            if (!match) {
                 LogWarnCustom(
                     "MeshClipping",
                     "Found edge, that is not connected to any other edge. This could mean, the "
                     "clipped mesh was not manifold.");
                 break;
             }
+            const auto [edge, next] = *match;
+            used[edge] = true;
+            --remaining;
+
+            current = index(next);
+            if (current == front) break;
+            loop.push_back(next);
         }
     }
+    edges.clear();
     return loops;
 }
 
@@ -250,9 +514,11 @@ vec2 polygonCentroid(const std::vector<vec2>& polygon) {
     return center;
 }
 
+namespace {
+
 void capHoles(std::vector<glm::u32vec2>& edges, const Plane& plane,
               const std::vector<vec3>& positions, std::vector<std::uint32_t>& indices,
-              const InterpolateFunctor& addInterpolatedVertex) {
+              NewVertices& vertices) {
 
     constexpr float relError = 0.000001f;
     const auto eps =
@@ -291,14 +557,14 @@ void capHoles(std::vector<glm::u32vec2>& edges, const Plane& plane,
             glm::cross(positions[loop[0]] - center, positions[loop[1]] - center);
         const auto dir = glm::dot(plane.getNormal(), orientation);
 
-        const auto centerIndex = addInterpolatedVertex(loop, weights, -plane.getNormal());
+        const auto centerIndex = vertices.add(loop, weights, -plane.getNormal());
         for (size_t i = 0; i < loop.size(); ++i) {
             const auto j = (i + 1) % loop.size();
             indices.push_back(centerIndex);
             indices.push_back(
-                addInterpolatedVertex({loop[dir < 0 ? i : j]}, {1.0f}, -plane.getNormal()));
+                vertices.add({loop[dir < 0 ? i : j]}, {1.0f}, -plane.getNormal()));
             indices.push_back(
-                addInterpolatedVertex({loop[dir < 0 ? j : i]}, {1.0f}, -plane.getNormal()));
+                vertices.add({loop[dir < 0 ? j : i]}, {1.0f}, -plane.getNormal()));
         }
     }
 }
@@ -307,14 +573,14 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
                                       std::shared_ptr<Mesh>& clippedMesh,
                                       const std::vector<uint32_t>& indices, const Plane& plane,
                                       const std::vector<vec3>& positions,
-                                      const InterpolateFunctor& addInterpolatedVertex) {
+                                      const std::vector<char>& inside, NewVertices& vertices) {
 
     std::vector<glm::u32vec2> newEdges;
 
     if (meshInfo.dt == DrawType::Points) {
         auto outIndices = clippedMesh->addIndexBuffer(DrawType::Points, meshInfo.ct);
         for (auto i : indices) {
-            if (plane.isInside(positions[i])) {
+            if (inside[i]) {
                 outIndices->add(i);
             }
         }
@@ -327,8 +593,8 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
                 const auto i1 = indices[l];
                 const auto i2 = indices[l + 1];
 
-                const auto in1 = plane.isInside(positions[i1]);
-                const auto in2 = plane.isInside(positions[i2]);
+                const bool in1 = inside[i1];
+                const bool in2 = inside[i2];
 
                 if (in1 && in2) {
                     outIndices->add(i1);
@@ -336,12 +602,10 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
                 } else if (in1) {
                     const auto weight = *plane.getIntersectionWeight(positions[i1], positions[i2]);
                     outIndices->add(i1);
-                    outIndices->add(
-                        addInterpolatedVertex({i1, i2}, {1.0f - weight, weight}, std::nullopt));
+                    outIndices->add(vertices.add(i1, i2, weight));
                 } else if (in2) {
                     const auto weight = *plane.getIntersectionWeight(positions[i1], positions[i2]);
-                    outIndices->add(
-                        addInterpolatedVertex({i1, i2}, {1.0f - weight, weight}, std::nullopt));
+                    outIndices->add(vertices.add(i1, i2, weight));
                     outIndices->add(i2);
                 }
             }
@@ -368,14 +632,12 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
                     const auto weight = *plane.getIntersectionWeight(positions[i2], positions[i3]);
                     outIndices->add(i1);
                     outIndices->add(i2);
-                    outIndices->add(
-                        addInterpolatedVertex({i2, i3}, {1.0f - weight, weight}, std::nullopt));
+                    outIndices->add(vertices.add(i2, i3, weight));
                     outIndices->add(i3);
                 } else if (in2) {
                     const auto weight = *plane.getIntersectionWeight(positions[i2], positions[i3]);
                     outIndices->add(i2);
-                    outIndices->add(
-                        addInterpolatedVertex({i2, i3}, {1.0f - weight, weight}, std::nullopt));
+                    outIndices->add(vertices.add(i2, i3, weight));
                     outIndices->add(i3);
                     outIndices->add(i4);
                 }
@@ -432,22 +694,20 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
         auto outIndices = clippedMesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
 
         if (meshInfo.ct == ConnectivityType::Strip) {
-            for (unsigned int t = 0; t < indices.size() - 2; ++t) {
-                const glm::u32vec3 triangle{indices[t], indices[t & 1 ? t + 2 : t + 1],
-                                            indices[t & 1 ? t + 1 : t + 2]};
-                auto newEdge = detail::sutherlandHodgman(triangle, plane, positions,
-                                                         outIndices->getDataContainer(),
-                                                         addInterpolatedVertex);
-                if (newEdge) newEdges.push_back(*newEdge);
-            }
+            newEdges = clipTriangles(
+                indices.size() - 2,
+                [&](size_t t) {
+                    return glm::u32vec3{indices[t], indices[t & 1 ? t + 2 : t + 1],
+                                        indices[t & 1 ? t + 1 : t + 2]};
+                },
+                plane, inside, vertices, positions, outIndices->getDataContainer());
         } else if (meshInfo.ct == ConnectivityType::None) {
-            for (unsigned int t = 0; t < indices.size() - 2; t += 3) {
-                const glm::u32vec3 triangle{indices[t], indices[t + 1], indices[t + 2]};
-                auto newEdge = detail::sutherlandHodgman(triangle, plane, positions,
-                                                         outIndices->getDataContainer(),
-                                                         addInterpolatedVertex);
-                if (newEdge) newEdges.push_back(*newEdge);
-            }
+            newEdges = clipTriangles(
+                indices.size() / 3,
+                [&](size_t t) {
+                    return glm::u32vec3{indices[3 * t], indices[3 * t + 1], indices[3 * t + 2]};
+                },
+                plane, inside, vertices, positions, outIndices->getDataContainer());
         } else {
             throw Exception("Cannot clip, need triangle connectivity Strip or None",
                             IVW_CONTEXT_CUSTOM("MeshClipping"));
@@ -456,6 +716,8 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
     return newEdges;
 }
 
+}  // namespace
+
 }  // namespace detail
 
 std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldSpacePlane,
@@ -469,29 +731,17 @@ std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldS
     clippedMesh->setWorldMatrix(mesh.getWorldMatrix());
     clippedMesh->copyMetaDataFrom(mesh);
 
-    std::vector<detail::InterpolateFunctor> interpolateFunctors;
+    std::vector<std::pair<Mesh::BufferInfo, std::shared_ptr<BufferRAM>>> outBuffers;
     std::shared_ptr<BufferRAMPrecision<vec3, BufferTarget::Data>> posBuffer;
 
     for (const auto& item : mesh.getBuffers()) {
         const auto& bufferType = item.first;
         const auto& inBuffer = item.second;
-        auto functor =
-            inBuffer->getRepresentation<BufferRAM>()->dispatch<detail::InterpolateFunctor>(
-                [&clippedMesh, bufferType, &posBuffer](auto inRam) -> detail::InterpolateFunctor {
+        auto outRam =
+            inBuffer->getRepresentation<BufferRAM>()->dispatch<std::shared_ptr<BufferRAM>>(
+                [&clippedMesh, bufferType, &posBuffer](auto inRam) -> std::shared_ptr<BufferRAM> {
                     using PB = util::PrecisionType<decltype(inRam)>;
                     using ValueType = util::PrecisionValueType<decltype(inRam)>;
-                    using T = typename util::same_extent<ValueType, float>::type;
-
-                    static const auto mix = [](const PB& buffer,
-                                               const std::vector<uint32_t>& indices,
-                                               const std::vector<float>& weights) {
-                        return static_cast<ValueType>(std::inner_product(
-                            indices.begin(), indices.end(), weights.begin(), T{0}, std::plus<>{},
-                            [&](uint32_t index, float weight) {
-                                return static_cast<T>(buffer[index]) * weight;
-                            }));
-                    };
-                    (void)mix;
 
                     auto outRam =
                         std::make_shared<BufferRAMPrecision<ValueType, PB::target>>(*inRam);
@@ -500,53 +750,23 @@ std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldS
 
                     if constexpr (std::is_same_v<ValueType, vec3> &&
                                   PB::target == BufferTarget::Data) {
-                        if (bufferType == BufferType::NormalAttrib) {
-                            return [outRam](const std::vector<uint32_t>& indices,
-                                            const std::vector<float>& weights,
-                                            std::optional<vec3> normal) {
-                                outRam->add(normal ? *normal : mix(*outRam, indices, weights));
-                                return static_cast<uint32_t>(outRam->getSize() - 1);
-                            };
-                        } else if (bufferType == BufferType::PositionAttrib) {
+                        if (bufferType == BufferType::PositionAttrib) {
                             posBuffer = outRam;
                         }
                     }
-
-                    if constexpr (DataFormat<ValueType>::numtype == NumericType::Float) {
-                        return [outRam](const std::vector<uint32_t>& indices,
-                                        const std::vector<float>& weights, std::optional<vec3>) {
-                            outRam->add(mix(*outRam, indices, weights));
-                            return static_cast<uint32_t>(outRam->getSize() - 1);
-                        };
-                    } else {  // Only interpolate floating point buffers;
-                        return [outRam](const std::vector<uint32_t>& indices,
-                                        const std::vector<float>& weights, std::optional<vec3>) {
-                            const auto it = std::max_element(weights.begin(), weights.end());
-                            const auto index = std::distance(weights.begin(), it);
-
-                            outRam->add(static_cast<ValueType>((*outRam)[indices[index]]));
-                            return static_cast<uint32_t>(outRam->getSize() - 1);
-                        };
-                    }
+                    return outRam;
                 });
-        interpolateFunctors.push_back(functor);
+        outBuffers.emplace_back(bufferType, outRam);
     }
 
-    const detail::InterpolateFunctor addInterpolatedVertex =
-        [&interpolateFunctors](const std::vector<uint32_t>& indices,
-                               const std::vector<float>& weights,
-                               std::optional<vec3> normal) -> uint32_t {
-        uint32_t res = 0;
-        for (auto& fun : interpolateFunctors) res = fun(indices, weights, normal);
-        return res;
-    };
-
     if (!posBuffer) {
         throw Exception("Unsupported mesh type, vec3 position buffer not found",
                         IVW_CONTEXT_CUSTOM("MeshClipping"));
     }
 
-    const auto& positions = posBuffer->getDataContainer();
+    auto& positions = posBuffer->getDataContainer();
+    const auto inside = detail::classify(positions, plane);
+    detail::NewVertices vertices{positions};
     std::vector<glm::u32vec2> newEdges;
 
     for (const auto& item : mesh.getIndexBuffers()) {
@@ -554,23 +774,32 @@ std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldS
         const auto indexBuffer = item.second;
         const auto& indices = indexBuffer->getRAMRepresentation()->getDataContainer();
 
-        auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions,
-                                         addInterpolatedVertex);
+        auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions, inside,
+                                         vertices);
         newEdges.insert(newEdges.end(), edges.begin(), edges.end());
     }
     if (mesh.getIndexBuffers().empty()) {
         const auto meshInfo = mesh.getDefaultMeshInfo();
         std::vector<uint32_t> indices(mesh.getBuffer(0)->getSize());
         std::iota(indices.begin(), indices.end(), 0);
-        auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions,
-                                         addInterpolatedVertex);
+        auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions, inside,
+                                         vertices);
         newEdges.insert(newEdges.end(), edges.begin(), edges.end());
     }
 
     if (capClippedHoles && !newEdges.empty()) {
         auto outIndices = clippedMesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
-        detail::capHoles(newEdges, plane, positions, outIndices->getDataContainer(),
-                         addInterpolatedVertex);
+        detail::capHoles(newEdges, plane, positions, outIndices->getDataContainer(), vertices);
+    }
+
+    // Interpolate all other vertex attributes for the new vertices
+    for (const auto& item : outBuffers) {
+        if (item.second == posBuffer) continue;
+        const bool isNormal = item.first == BufferType::NormalAttrib;
+        item.second->dispatch<void>([&](auto outRam) {
+            using PB = util::PrecisionType<decltype(outRam)>;
+            vertices.interpolate(*outRam, isNormal && PB::target == BufferTarget::Data);
+        });
     }
 
     return clippedMesh;
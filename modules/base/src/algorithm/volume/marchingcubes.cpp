@@ -574,7 +574,8 @@ namespace util {
 std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double iso,
                                     const vec4& color, bool invert, bool enclose,
                                     std::function<void(float)> progressCallback,
-                                    std::function<bool(const size3_t&)> maskingCallback) {
+                                    std::function<bool(const size3_t&)> maskingCallback,
+                                    std::function<bool()> stopCallback) {
 
     return volume->getRepresentation<VolumeRAM>()->dispatch<std::shared_ptr<Mesh>>([&](auto ram) {
         using T = util::PrecisionValueType<decltype(ram)>;
@@ -632,6 +633,7 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
             if (progressCallback) {
                 progressCallback(static_cast<float>(k + 1) / static_cast<float>(dim.z - 1));
             }
+            if (stopCallback && stopCallback()) return std::shared_ptr<BasicMesh>{};
         }
 
         if (enclose) {
@@ -435,7 +435,8 @@ namespace util {
 std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, double iso,
                                        const vec4& color, bool invert, bool enclose,
                                        std::function<void(float)> progressCallback,
-                                       std::function<bool(const size3_t&)> maskingCallback) {
+                                       std::function<bool(const size3_t&)> maskingCallback,
+                                       std::function<bool()> stopCallback) {
 
     auto indexBuffer = std::make_shared<IndexBuffer>();
     auto vertexBuffer = std::make_shared<Buffer<vec3>>();
@@ -452,6 +453,7 @@ std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, dou
 
     if (progressCallback) progressCallback(0.0f);
 
+    bool stopped = false;
     const auto mc = [&](auto ram, auto isoTest, auto mapValue) {
         using T = util::PrecisionValueType<decltype(ram)>;
         static const marching::Config cube{};
@@ -533,6 +535,10 @@ std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, dou
             if (progressCallback) {
                 progressCallback(static_cast<float>(ind.z + 1) / static_cast<float>(dim.z - 1));
             }
+            if (stopCallback && stopCallback()) {
+                stopped = true;
+                return;
+            }
         }
 
         if (enclose) {
@@ -560,6 +566,8 @@ std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, dou
             });
     }
 
+    if (stopped) return nullptr;
+
     ivwAssert(positions.size() == normals.size(), "positions and normals must be equal size");
 
     std::transform(normals.begin(), normals.end(), normals.begin(),
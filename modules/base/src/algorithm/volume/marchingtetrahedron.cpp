@@ -157,7 +157,8 @@ namespace util {
 std::shared_ptr<Mesh> marchingtetrahedron(std::shared_ptr<const Volume> volume, double iso,
                                           const vec4& color, bool invert, bool enclose,
                                           std::function<void(float)> progressCallback,
-                                          std::function<bool(const size3_t&)> maskingCallback) {
+                                          std::function<bool(const size3_t&)> maskingCallback,
+                                          std::function<bool()> stopCallback) {
 
     return volume->getRepresentation<VolumeRAM>()->dispatch<std::shared_ptr<Mesh>>([&](auto ram) {
         using T = util::PrecisionValueType<decltype(ram)>;
@@ -220,6 +221,7 @@ std::shared_ptr<Mesh> marchingtetrahedron(std::shared_ptr<const Volume> volume,
             if (progressCallback) {
                 progressCallback(static_cast<float>(k + 1) / static_cast<float>(dim.z - 1));
             }
+            if (stopCallback && stopCallback()) return std::shared_ptr<BasicMesh>{};
         }
 
         if (enclose) {
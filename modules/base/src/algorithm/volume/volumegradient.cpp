@@ -33,13 +33,16 @@
 #include <inviwo/core/util/indexmapper.h>
 #include <inviwo/core/util/volumesampler.h>
 #include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
 
 namespace inviwo {
 namespace util {
 
 std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume, int channel) {
 
-    auto newVolume = std::make_shared<Volume>(volume->getDimensions(), DataVec3Float32::get());
+    auto newRepr = std::make_shared<VolumeRAMPrecision<vec3>>(volume->getDimensions(),
+                                                             StorageInit::Uninitialized);
+    auto newVolume = std::make_shared<Volume>(newRepr);
     newVolume->setModelMatrix(volume->getModelMatrix());
     newVolume->setWorldMatrix(volume->getWorldMatrix());
 
@@ -57,7 +60,7 @@ std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume, int
     const auto worldSpace = VolumeDoubleSampler<3>::Space::World;
 
     util::IndexMapper3D index(volume->getDimensions());
-    auto data = static_cast<vec3*>(newVolume->getEditableRepresentation<VolumeRAM>()->getData());
+    auto data = newRepr->getDataTyped();
 
     auto func = [&](const size3_t& pos) {
         const vec3 world{m * vec4(vec3(pos) / vec3(volume->getDimensions() - size3_t(1)), 1)};
@@ -28,19 +28,32 @@
  *********************************************************************************/
 
 #include <modules/base/algorithm/volume/volumeramsubsample.h>
+#include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/indexmapper.h>
 
+#include <algorithm>
+#include <atomic>
+
 #ifdef IVW_USE_OPENMP
 #include <omp.h>
 #endif
 
 namespace inviwo {
 
-std::shared_ptr<VolumeRAM> util::volumeSubSample(const VolumeRAM* volume, size3_t f) {
-    return volume->dispatch<std::shared_ptr<VolumeRAM>>(
-        [&f](auto srcVol) -> std::shared_ptr<VolumeRAM> {
+std::shared_ptr<VolumeRAM> util::volumeSubSample(const VolumeRAM* volume, size3_t f,
+                                                 SubsampleMode mode, std::function<bool()> stop) {
+    // OpenMP loops can not be exited early, remaining slices are skipped instead
+    std::atomic<bool> aborted{false};
+    const auto shouldStop = [&]() {
+        if (aborted.load(std::memory_order_relaxed)) return true;
+        if (stop && stop()) aborted.store(true, std::memory_order_relaxed);
+        return aborted.load(std::memory_order_relaxed);
+    };
+
+    auto result = volume->dispatch<std::shared_ptr<VolumeRAM>>(
+        [&f, mode, &shouldStop](auto srcVol) -> std::shared_ptr<VolumeRAM> {
             using ValueType = util::PrecisionValueType<decltype(srcVol)>;
 
             // use a double type to perform the summation
@@ -51,7 +64,8 @@ std::shared_ptr<VolumeRAM> util::volumeSubSample(const VolumeRAM* volume, size3_
             const size3_t destDims{srcDims / f};
 
             // allocate space
-            auto destVol = std::make_shared<VolumeRAMPrecision<ValueType>>(destDims);
+            auto destVol = std::make_shared<VolumeRAMPrecision<ValueType>>(
+                destDims, StorageInit::Uninitialized);
 
             // get data pointers
             const auto src = srcVol->getDataTyped();
@@ -60,6 +74,24 @@ std::shared_ptr<VolumeRAM> util::volumeSubSample(const VolumeRAM* volume, size3_
             util::IndexMapper3D o(srcDims);
             util::IndexMapper3D n(destDims);
 
+            if (mode == SubsampleMode::Nearest) {
+                const size3_t offset{f / size_t{2}};
+#ifdef IVW_USE_OPENMP
+#pragma omp parallel for
+#endif
+                for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
+                    const size_t z = static_cast<size_t>(z_);  // OpenMP need signed integral type.
+                    if (shouldStop()) continue;
+                    for (size_t y = 0; y < destDims.y; ++y) {
+                        for (size_t x = 0; x < destDims.x; ++x) {
+                            dst[n(x, y, z)] = src[o(x * f.x + offset.x, y * f.y + offset.y,
+                                                    z * f.z + offset.z)];
+                        }
+                    }
+                }
+                return destVol;
+            }
+
             const double samplesInv = 1.0 / (f.x * f.y * f.z);
 
 #ifdef IVW_USE_OPENMP
@@ -67,6 +99,7 @@ std::shared_ptr<VolumeRAM> util::volumeSubSample(const VolumeRAM* volume, size3_
 #endif
             for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
                 const size_t z = static_cast<size_t>(z_);  // OpenMP need signed integral type.
+                if (shouldStop()) continue;
                 for (size_t y = 0; y < destDims.y; ++y) {
                     for (size_t x = 0; x < destDims.x; ++x) {
                         const size_t px{x * f.x};
@@ -92,6 +125,31 @@ std::shared_ptr<VolumeRAM> util::volumeSubSample(const VolumeRAM* volume, size3_
 
             return destVol;
         });
+
+    if (aborted) return nullptr;
+    return result;
+}
+
+std::shared_ptr<Volume> util::volumeSubSample(const Volume& volume, size3_t f,
+                                              SubsampleMode mode, std::function<bool()> stop) {
+    auto ram = volumeSubSample(volume.getRepresentation<VolumeRAM>(), f, mode, std::move(stop));
+    if (!ram) return nullptr;
+
+    auto sample = std::make_shared<Volume>(ram);
+    sample->copyMetaDataFrom(volume);
+    sample->dataMap_ = volume.dataMap_;
+    sample->setModelMatrix(volume.getModelMatrix());
+    sample->setWorldMatrix(volume.getWorldMatrix());
+    return sample;
+}
+
+std::shared_ptr<Volume> util::volumePreview(const Volume& volume, size_t maxVoxels) {
+    const auto dims = volume.getDimensions();
+    size_t factor = 1;
+    while (glm::compMul(dims / factor) > std::max(maxVoxels, size_t{1})) ++factor;
+    // Below a factor of 4 the preview costs too large a fraction of the full computation
+    if (factor < 4) return nullptr;
+    return volumeSubSample(volume, glm::min(size3_t{factor}, dims), SubsampleMode::Nearest);
 }
 
 }  // namespace inviwo
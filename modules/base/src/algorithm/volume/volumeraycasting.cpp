@@ -0,0 +1,568 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/volume/volumeraycasting.h>
+
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+namespace inviwo {
+namespace util {
+
+RaycastingVolume::RaycastingVolume(const Volume& volume, size_t channel)
+    : dims_{volume.getDimensions()}
+    , bricks_{(dims_ + size3_t{brickSize - 1}) / size3_t{brickSize}}
+    , data_(glm::compMul(dims_))
+    , brickRanges_(glm::compMul(bricks_))
+    , dataToWorld_{volume.getCoordinateTransformer().getDataToWorldMatrix()}
+    , worldToData_{volume.getCoordinateTransformer().getWorldToDataMatrix()}
+    , dataToWorldNormal_{glm::transpose(glm::inverse(mat3(dataToWorld_)))} {
+
+    if (channel >= volume.getDataFormat()->getComponents()) {
+        throw Exception("Channel " + std::to_string(channel) + " is out of range for volume with " +
+                            std::to_string(volume.getDataFormat()->getComponents()) +
+                            " channels",
+                        IVW_CONTEXT);
+    }
+
+    // Map to normalized values, [0,1] within the data range
+    const dvec2 range = volume.dataMap_.dataRange;
+    const double scale = range.y > range.x ? 1.0 / (range.y - range.x) : 1.0;
+    const size_t sliceSize = dims_.x * dims_.y;
+    volume.getRepresentation<VolumeRAM>()->dispatch<void>([&](auto vrprecision) {
+        const auto src = vrprecision->getDataTyped();
+        util::parallelFor(dims_.z, [&](size_t z) {
+            for (size_t i = z * sliceSize; i < (z + 1) * sliceSize; ++i) {
+                const auto value = static_cast<double>(util::glmcomp(src[i], channel));
+                data_[i] = static_cast<float>((value - range.x) * scale);
+            }
+        });
+    });
+
+    util::parallelFor(bricks_.z, [&](size_t bz) {
+        for (size_t by = 0; by < bricks_.y; ++by) {
+            for (size_t bx = 0; bx < bricks_.x; ++bx) {
+                const size3_t begin = size3_t{bx, by, bz} * brickSize;
+                // inclusive, the next voxel is needed for trilinear samples within the brick
+                const size3_t last = glm::min(begin + size3_t{brickSize}, dims_ - size3_t{1});
+
+                vec2 brickRange{std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::lowest()};
+                for (size_t z = begin.z; z <= last.z; ++z) {
+                    for (size_t y = begin.y; y <= last.y; ++y) {
+                        const auto row = dims_.x * (y + dims_.y * z);
+                        for (size_t x = begin.x; x <= last.x; ++x) {
+                            brickRange.x = std::min(brickRange.x, data_[row + x]);
+                            brickRange.y = std::max(brickRange.y, data_[row + x]);
+                        }
+                    }
+                }
+                brickRanges_[bx + bricks_.x * (by + bricks_.y * bz)] = brickRange;
+            }
+        }
+    });
+}
+
+vec3 RaycastingVolume::continuousIndex(const vec3& pos) const {
+    return glm::clamp(pos * vec3(dims_) - 0.5f, vec3(0.0f), vec3(dims_ - size3_t{1}));
+}
+
+float RaycastingVolume::sample(const vec3& pos) const {
+    const auto p = continuousIndex(pos);
+    const size3_t i0{p};
+    const size3_t i1 = glm::min(i0 + size3_t{1}, dims_ - size3_t{1});
+    const vec3 f = p - vec3(i0);
+
+    const auto at = [&](size_t x, size_t y, size_t z) {
+        return data_[x + dims_.x * (y + dims_.y * z)];
+    };
+    const auto c00 = glm::mix(at(i0.x, i0.y, i0.z), at(i1.x, i0.y, i0.z), f.x);
+    const auto c10 = glm::mix(at(i0.x, i1.y, i0.z), at(i1.x, i1.y, i0.z), f.x);
+    const auto c01 = glm::mix(at(i0.x, i0.y, i1.z), at(i1.x, i0.y, i1.z), f.x);
+    const auto c11 = glm::mix(at(i0.x, i1.y, i1.z), at(i1.x, i1.y, i1.z), f.x);
+    return glm::mix(glm::mix(c00, c10, f.y), glm::mix(c01, c11, f.y), f.z);
+}
+
+vec3 RaycastingVolume::gradient(const vec3& pos, float value,
+                                RaycastingProperty::GradientComputation computation) const {
+    using GC = RaycastingProperty::GradientComputation;
+    const vec3 h = 1.0f / vec3(dims_);
+    const auto at = [&](float offset) {
+        return vec3{sample(pos + vec3{offset * h.x, 0.0f, 0.0f}),
+                    sample(pos + vec3{0.0f, offset * h.y, 0.0f}),
+                    sample(pos + vec3{0.0f, 0.0f, offset * h.z})};
+    };
+
+    // derivatives with respect to the data coordinates
+    vec3 g;
+    switch (computation) {
+        case GC::None:
+            return vec3{0.0f};
+        case GC::Forward:
+            g = (at(1.0f) - value) * vec3(dims_);
+            break;
+        case GC::Backward:
+            g = (value - at(-1.0f)) * vec3(dims_);
+            break;
+        case GC::CentralHigherOrder:
+            g = (at(-2.0f) - 8.0f * at(-1.0f) + 8.0f * at(1.0f) - at(2.0f)) / 12.0f *
+                vec3(dims_);
+            break;
+        case GC::Central:
+        default:
+            g = (at(1.0f) - at(-1.0f)) * 0.5f * vec3(dims_);
+            break;
+    }
+    return dataToWorldNormal_ * g;
+}
+
+size_t RaycastingVolume::brick(const vec3& pos) const {
+    const auto b = glm::min(size3_t{continuousIndex(pos)} / size3_t{brickSize},
+                            bricks_ - size3_t{1});
+    return b.x + bricks_.x * (b.y + bricks_.y * b.z);
+}
+
+std::pair<vec3, vec3> RaycastingVolume::brickBounds(const vec3& pos) const {
+    const auto b = glm::min(size3_t{continuousIndex(pos)} / size3_t{brickSize},
+                            bricks_ - size3_t{1});
+    vec3 lower = (vec3(b * brickSize) + 0.5f) / vec3(dims_);
+    vec3 upper = (vec3((b + size3_t{1}) * brickSize) + 0.5f) / vec3(dims_);
+    for (int i = 0; i < 3; ++i) {
+        if (b[i] == 0) lower[i] = -std::numeric_limits<float>::infinity();
+        if (b[i] + 1 == bricks_[i]) upper[i] = std::numeric_limits<float>::infinity();
+    }
+    return {lower, upper};
+}
+
+namespace {
+
+constexpr float ertThreshold = 0.99f;          // threshold for early ray termination
+constexpr float refSamplingInterval = 150.0f;  // reference sampling interval for opacity correction
+constexpr size_t tileSize = 16;
+
+vec3 safeNormalize(const vec3& v) {
+    const auto l = glm::length(v);
+    return l > 0.0f ? v / l : v;
+}
+
+/**
+ * CPU port of the ray traversal in raycasting.frag, with empty space skipping
+ */
+class Raycaster {
+public:
+    Raycaster(const RaycastingVolume& volume, const RaycastingSettings& settings);
+
+    /**
+     * Cast the ray through \p ndc, returns the color and depth
+     */
+    std::pair<vec4, float> castRay(const vec2& ndc) const;
+
+private:
+    using Compositing = RaycastingProperty::CompositingType;
+
+    vec4 classify(float value) const;
+    bool visible(const vec2& range) const;
+    vec3 world(const vec3& pos) const { return vec3(volume_.getDataToWorld() * vec4(pos, 1.0f)); }
+    vec3 shade(const vec3& color, const vec3& position, const vec3& normal,
+               const vec3& toCameraDir) const;
+    vec4 composite(const vec4& result, vec4 color, const vec3& samplePos, const vec3& gradient,
+                   float t, float& tDepth, float tIncr) const;
+    vec4 drawIsosurface(vec4 result, float isovalue, vec4 isoColor, float voxel,
+                        float previousVoxel, const vec3& samplePos, const vec3& rayDirection,
+                        const vec3& toCameraDir, float t, float raySegmentLen, float& tIncr,
+                        float& tDepth) const;
+
+    const RaycastingVolume& volume_;
+    const RaycastingSettings& settings_;
+    bool dvr_;
+    bool isosurfaces_;
+    bool shading_;
+    bool needsGradient_;
+    mat4 clipToWorld_;
+    mat4 worldToClip_;
+    // number of transfer function entries with non-zero alpha before each entry
+    std::vector<size_t> visibleCount_;
+    std::vector<char> activeBricks_;
+};
+
+Raycaster::Raycaster(const RaycastingVolume& volume, const RaycastingSettings& settings)
+    : volume_{volume}
+    , settings_{settings}
+    , dvr_{settings.renderingType != RaycastingProperty::RenderingType::Isosurface}
+    , isosurfaces_{settings.renderingType != RaycastingProperty::RenderingType::Dvr &&
+                   !settings.isovalues.empty()}
+    , shading_{settings.shading != ShadingMode::None}
+    , needsGradient_{shading_ || settings.compositing == Compositing::FirstHitNormals ||
+                     settings.compositing == Compositing::FirstHistNormalsView}
+    , clipToWorld_{glm::inverse(settings.projectionMatrix * settings.viewMatrix)}
+    , worldToClip_{settings.projectionMatrix * settings.viewMatrix}
+    , visibleCount_(settings.transferFunction.size() + 1, 0) {
+
+    for (size_t i = 0; i < settings.transferFunction.size(); ++i) {
+        visibleCount_[i + 1] = visibleCount_[i] + (settings.transferFunction[i].a > 0.0f ? 1 : 0);
+    }
+
+    const auto& ranges = volume_.getBrickRanges();
+    activeBricks_.resize(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        const auto& range = ranges[i];
+        const bool iso = isosurfaces_ &&
+                         std::any_of(settings.isovalues.begin(), settings.isovalues.end(),
+                                     [&](const auto& item) {
+                                         return item.first >= range.x && item.first <= range.y;
+                                     });
+        activeBricks_[i] = iso || (dvr_ && visible(range)) ? 1 : 0;
+    }
+}
+
+vec4 Raycaster::classify(float value) const {
+    if (settings_.classification != RaycastingProperty::Classification::TF) {
+        return vec4{value};
+    }
+    const auto& tf = settings_.transferFunction;
+    if (tf.empty()) return vec4{0.0f};
+
+    const auto x = glm::clamp(value, 0.0f, 1.0f) * static_cast<float>(tf.size() - 1);
+    const auto i0 = static_cast<size_t>(x);
+    const auto i1 = std::min(i0 + 1, tf.size() - 1);
+    return glm::mix(tf[i0], tf[i1], x - static_cast<float>(i0));
+}
+
+bool Raycaster::visible(const vec2& range) const {
+    if (settings_.classification != RaycastingProperty::Classification::TF) {
+        return range.y > 0.0f;
+    }
+    const auto& tf = settings_.transferFunction;
+    if (tf.empty()) return false;
+
+    const auto n = static_cast<float>(tf.size() - 1);
+    const auto first = static_cast<size_t>(std::floor(glm::clamp(range.x, 0.0f, 1.0f) * n));
+    const auto last = static_cast<size_t>(std::ceil(glm::clamp(range.y, 0.0f, 1.0f) * n));
+    return visibleCount_[last + 1] > visibleCount_[first];
+}
+
+vec3 Raycaster::shade(const vec3& color, const vec3& position, const vec3& normal,
+                      const vec3& toCameraDir) const {
+    const auto& s = settings_;
+    const vec3 toLightDir = glm::normalize(s.lightPosition - position);
+
+    const auto ambient = [&]() { return color * s.ambientColor; };
+    const auto diffuse = [&]() {
+        return color * s.diffuseColor * std::max(glm::dot(normal, toLightDir), 0.0f);
+    };
+    const auto phong = [&]() {
+        if (glm::dot(toLightDir, normal) < 0.0f) return vec3{0.0f};
+        const vec3 r = glm::reflect(-toLightDir, normal);
+        return s.specularColor *
+               std::pow(std::max(glm::dot(r, toCameraDir), 0.0f), s.specularExponent * 0.25f);
+    };
+    const auto blinnPhong = [&]() {
+        const vec3 halfway = toCameraDir + toLightDir;
+        if (glm::dot(halfway, halfway) < 1.0e-6f) return vec3{0.0f};
+        return s.specularColor * std::pow(std::max(glm::dot(normal, glm::normalize(halfway)), 0.0f),
+                                          s.specularExponent);
+    };
+
+    switch (s.shading) {
+        case ShadingMode::Ambient:
+            return ambient();
+        case ShadingMode::Diffuse:
+            return diffuse();
+        case ShadingMode::Specular:
+            return phong();
+        case ShadingMode::BlinnPhong:
+            return ambient() + diffuse() + blinnPhong();
+        case ShadingMode::Phong:
+            return ambient() + diffuse() + phong();
+        case ShadingMode::None:
+        default:
+            return color;
+    }
+}
+
+vec4 Raycaster::composite(const vec4& result, vec4 color, const vec3& samplePos,
+                          const vec3& gradient, float t, float& tDepth, float tIncr) const {
+    const auto firstHit = [&](const vec4& value) {
+        if (result == vec4{0.0f} && color.a > 0.0f) {
+            tDepth = t;
+            return value;
+        }
+        return result;
+    };
+
+    switch (settings_.compositing) {
+        case Compositing::Dvr: {
+            if (tDepth == -1.0f && color.a > 0.0f) tDepth = t;
+            color.a = 1.0f - std::pow(1.0f - color.a, tIncr * refSamplingInterval);
+            vec4 res = result;
+            res.r += (1.0f - res.a) * color.a * color.r;
+            res.g += (1.0f - res.a) * color.a * color.g;
+            res.b += (1.0f - res.a) * color.a * color.b;
+            res.a += (1.0f - res.a) * color.a;
+            return res;
+        }
+        case Compositing::MaximumIntensity:
+            if (color.a > result.a) {
+                tDepth = t;
+                return color;
+            }
+            return result;
+        case Compositing::FirstHitPoints:
+            return firstHit(vec4{samplePos, 1.0f});
+        case Compositing::FirstHitNormals:
+            // the normal points towards lower intensity, opposite of the gradient
+            return firstHit(vec4{safeNormalize(-gradient) * 0.5f + 0.5f, 1.0f});
+        case Compositing::FirstHistNormalsView: {
+            const vec3 normal =
+                glm::transpose(mat3(settings_.viewMatrix)) * safeNormalize(-gradient);
+            return firstHit(vec4{safeNormalize(normal) * 0.5f + 0.5f, 1.0f});
+        }
+        case Compositing::FirstHitDepth:
+            return firstHit(vec4{t, t, t, 1.0f});
+        default:
+            return result;
+    }
+}
+
+vec4 Raycaster::drawIsosurface(vec4 result, float isovalue, vec4 isoColor, float voxel,
+                               float previousVoxel, const vec3& samplePos,
+                               const vec3& rayDirection, const vec3& toCameraDir, float t,
+                               float raySegmentLen, float& tIncr, float& tDepth) const {
+    // found isosurface if differences between current/prev sample and isovalue have different signs
+    if ((isovalue - voxel) * (isovalue - previousVoxel) > 0.0f) return result;
+
+    const float sampleDelta = voxel - previousVoxel;
+    const float a = sampleDelta != 0.0f ? (voxel - isovalue) / sampleDelta : 0.0f;
+    // if a == 1, isosurface was already computed for previous sampling position
+    if (a >= 1.0f) return result;
+
+    // adjust length of remaining ray segment
+    tIncr = a * raySegmentLen;
+    const vec3 isoPos = samplePos - raySegmentLen * a * rayDirection;
+
+    vec3 gradient{0.0f};
+    if (needsGradient_) {
+        gradient = safeNormalize(volume_.gradient(isoPos, isovalue, settings_.gradient));
+        // two-sided lighting
+        if (glm::dot(gradient, -toCameraDir) <= 0.0f) gradient = -gradient;
+    }
+    if (shading_) {
+        isoColor = vec4{shade(vec3{isoColor}, world(isoPos), -gradient, toCameraDir), isoColor.a};
+    }
+
+    if (dvr_) {
+        // apply compositing of volumetric media from last sampling position up till isosurface
+        vec4 voxelColor = classify(isovalue);
+        if (voxelColor.a > 0.0f) {
+            if (shading_) {
+                voxelColor = vec4{shade(vec3{voxelColor}, world(isoPos), -gradient, toCameraDir),
+                                  voxelColor.a};
+            }
+            result = composite(result, voxelColor, isoPos, gradient, t - tIncr, tDepth,
+                               raySegmentLen - tIncr);
+        }
+    }
+
+    if (tDepth < 0.0f) tDepth = t - tIncr;
+    // blend the pre-multiplied isosurface color with the result accumulated so far
+    isoColor = vec4{vec3{isoColor} * isoColor.a, isoColor.a};
+    return result + (1.0f - result.a) * isoColor;
+}
+
+std::pair<vec4, float> Raycaster::castRay(const vec2& ndc) const {
+    const std::pair<vec4, float> miss{vec4{0.0f}, 1.0f};
+
+    const auto unproject = [&](float z) {
+        const vec4 p = clipToWorld_ * vec4{ndc, z, 1.0f};
+        return vec3(volume_.getWorldToData() * vec4{vec3{p} / p.w, 1.0f});
+    };
+    const vec3 near = unproject(-1.0f);
+    const vec3 far = unproject(1.0f);
+
+    // clip the ray against the unit cube of the data space
+    const vec3 d = far - near;
+    float s0 = 0.0f;
+    float s1 = 1.0f;
+    for (int i = 0; i < 3; ++i) {
+        if (d[i] == 0.0f) {
+            if (near[i] < 0.0f || near[i] > 1.0f) return miss;
+            continue;
+        }
+        auto a = (0.0f - near[i]) / d[i];
+        auto b = (1.0f - near[i]) / d[i];
+        if (a > b) std::swap(a, b);
+        s0 = std::max(s0, a);
+        s1 = std::min(s1, b);
+    }
+    if (s0 >= s1) return miss;
+
+    const vec3 entryPoint = near + s0 * d;
+    const vec3 exitPoint = near + s1 * d;
+
+    vec3 rayDirection = exitPoint - entryPoint;
+    const float tEnd = glm::length(rayDirection);
+    if (tEnd <= 0.0f) return miss;
+    const float samples = std::ceil(
+        tEnd / std::min(tEnd, tEnd / (settings_.samplingRate *
+                                      glm::length(rayDirection * vec3(volume_.getDimensions())))));
+    const float tStep = tEnd / samples;
+    float tIncr = tStep;
+    float t = 0.5f * tStep;
+    rayDirection = glm::normalize(rayDirection);
+    float tDepth = -1.0f;
+    const vec3 toCameraDir = glm::normalize(world(entryPoint) - world(exitPoint));
+
+    vec4 result{0.0f};
+    // used for isosurface computation
+    float voxel = volume_.sample(entryPoint + t * rayDirection);
+
+    while (t < tEnd) {
+        vec3 samplePos = entryPoint + t * rayDirection;
+
+        const float previousVoxel = voxel;
+        voxel = volume_.sample(samplePos);
+        tIncr = tStep;
+
+        if (isosurfaces_) {
+            const auto& isovalues = settings_.isovalues;
+            // multiple isosurfaces, need to determine order of traversal
+            if (voxel - previousVoxel > 0.0f) {
+                for (auto it = isovalues.begin(); it != isovalues.end(); ++it) {
+                    result = drawIsosurface(result, it->first, it->second, voxel, previousVoxel,
+                                            samplePos, rayDirection, toCameraDir, t, tStep, tIncr,
+                                            tDepth);
+                }
+            } else {
+                for (auto it = isovalues.rbegin(); it != isovalues.rend(); ++it) {
+                    result = drawIsosurface(result, it->first, it->second, voxel, previousVoxel,
+                                            samplePos, rayDirection, toCameraDir, t, tStep, tIncr,
+                                            tDepth);
+                }
+            }
+        }
+
+        if (dvr_) {
+            vec4 color = classify(voxel);
+            if (color.a > 0.0f) {
+                vec3 gradient{0.0f};
+                if (needsGradient_) {
+                    gradient =
+                        safeNormalize(volume_.gradient(samplePos, voxel, settings_.gradient));
+                }
+                // Note that the gradient is reversed since we define the normal of a surface as
+                // the direction towards a lower intensity medium
+                if (shading_) {
+                    color = vec4{shade(vec3{color}, world(samplePos), -gradient, toCameraDir),
+                                 color.a};
+                }
+                result = composite(result, color, samplePos, gradient, t, tDepth, tIncr);
+            }
+        }
+
+        // early ray termination
+        if (result.a > ertThreshold) break;
+
+        // skip to the first sample after the brick if it does not contribute. The isosurfaces
+        // between the previous sample and this one, outside of the brick, are tested above.
+        if (settings_.emptySpaceSkipping && !activeBricks_[volume_.brick(samplePos)]) {
+            const auto [lower, upper] = volume_.brickBounds(samplePos);
+            float tExit = std::numeric_limits<float>::infinity();
+            for (int i = 0; i < 3; ++i) {
+                if (rayDirection[i] > 0.0f) {
+                    tExit = std::min(tExit, (upper[i] - entryPoint[i]) / rayDirection[i]);
+                } else if (rayDirection[i] < 0.0f) {
+                    tExit = std::min(tExit, (lower[i] - entryPoint[i]) / rayDirection[i]);
+                }
+            }
+            if (tExit >= tEnd) break;
+            const float steps = std::max(1.0f, std::ceil((tExit - t) / tStep));
+            t += steps * tStep;
+            // the sample before the next one is needed to find isosurfaces
+            if (steps > 1.0f) voxel = volume_.sample(entryPoint + (t - tStep) * rayDirection);
+        } else {
+            t += tStep;
+        }
+    }
+
+    if (tDepth < 0.0f) return {result, 1.0f};
+
+    const vec4 clip = worldToClip_ * vec4{world(entryPoint + tDepth * rayDirection), 1.0f};
+    return {result, glm::clamp(clip.z / clip.w * 0.5f + 0.5f, 0.0f, 1.0f)};
+}
+
+}  // namespace
+
+std::shared_ptr<Image> raycastVolume(const RaycastingVolume& volume,
+                                     const RaycastingSettings& settings, size2_t dimensions,
+                                     std::function<void(float)> progress,
+                                     std::function<bool()> stop) {
+    const Raycaster raycaster{volume, settings};
+
+    auto colorRAM = std::make_shared<LayerRAMPrecision<glm::u8vec4>>(dimensions, LayerType::Color);
+    auto depthRAM = std::make_shared<LayerRAMPrecision<float>>(dimensions, LayerType::Depth);
+    auto color = colorRAM->getDataTyped();
+    auto depth = depthRAM->getDataTyped();
+
+    const size2_t tiles = (dimensions + size2_t{tileSize - 1}) / size2_t{tileSize};
+    const size_t nTiles = tiles.x * tiles.y;
+    std::atomic<size_t> finished{0};
+
+    util::parallelFor(nTiles, [&](size_t tile) {
+        if (stop && stop()) return;
+
+        const size2_t begin = size2_t{tile % tiles.x, tile / tiles.x} * tileSize;
+        const size2_t end = glm::min(begin + size2_t{tileSize}, dimensions);
+        for (size_t y = begin.y; y < end.y; ++y) {
+            for (size_t x = begin.x; x < end.x; ++x) {
+                const vec2 ndc = (vec2{x, y} + 0.5f) / vec2{dimensions} * 2.0f - 1.0f;
+                const auto [rgba, z] = raycaster.castRay(ndc);
+                const auto i = x + y * dimensions.x;
+                color[i] = glm::u8vec4{glm::round(glm::clamp(rgba, 0.0f, 1.0f) * 255.0f)};
+                depth[i] = z;
+            }
+        }
+        if (progress) progress(static_cast<float>(++finished) / static_cast<float>(nTiles));
+    });
+
+    if (stop && stop()) return nullptr;
+
+    return std::make_shared<Image>(std::vector<std::shared_ptr<Layer>>{
+        std::make_shared<Layer>(colorRAM), std::make_shared<Layer>(depthRAM)});
+}
+
+}  // namespace util
+}  // namespace inviwo
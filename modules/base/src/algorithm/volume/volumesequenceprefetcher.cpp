@@ -0,0 +1,197 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/volume/volumesequenceprefetcher.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/stdextensions.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+bool isReady(const std::shared_future<const VolumeRAM*>& future) {
+    return future.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+}
+
+size_t numberOfBytes(const Volume& volume) {
+    return glm::compMul(volume.getDimensions()) * volume.getDataFormat()->getSize();
+}
+
+std::shared_future<const VolumeRAM*> load(std::shared_ptr<const Volume> volume) {
+    auto job = [volume]() -> const VolumeRAM* {
+        try {
+            return volume->getRepresentation<VolumeRAM>();
+        } catch (const Exception& e) {
+            util::log(e.getContext(), "Failed to prefetch volume: " + e.getMessage(),
+                      LogLevel::Warn);
+            return nullptr;
+        }
+    };
+    if (InviwoApplication::isInitialized()) {
+        return dispatchPool(std::move(job)).share();
+    } else {
+        std::promise<const VolumeRAM*> promise;
+        promise.set_value(job());
+        return promise.get_future().share();
+    }
+}
+
+}  // namespace
+
+VolumeSequencePrefetcher::VolumeSequencePrefetcher(size_t steps, size_t memoryBudget)
+    : sequence_{}
+    , steps_{steps}
+    , memoryBudget_{memoryBudget}
+    , loaded_{}
+    , accesses_{0}
+    , window_{}
+    , stats_{} {}
+
+void VolumeSequencePrefetcher::setSequence(std::shared_ptr<const VolumeSequence> sequence) {
+    if (sequence == sequence_) return;
+    // Running jobs keep their volume alive, so there is no need to wait for them
+    loaded_.clear();
+    window_.clear();
+    sequence_ = std::move(sequence);
+}
+
+void VolumeSequencePrefetcher::setSteps(size_t steps) { steps_ = steps; }
+
+void VolumeSequencePrefetcher::setMemoryBudget(size_t bytes) { memoryBudget_ = bytes; }
+
+void VolumeSequencePrefetcher::access(size_t index, Direction direction) {
+    if (!sequence_ || index >= sequence_->size()) return;
+    const auto& sequence = *sequence_;
+    const auto size = sequence.size();
+
+    ++accesses_;
+    if (auto it = loaded_.find(index); it != loaded_.end()) {
+        auto& entry = it->second;
+        if (entry.ram.valid() && !isReady(entry.ram)) {
+            ++stats_.pending;
+        } else if (entry.ram.valid() || sequence[index]->hasRepresentation<VolumeRAM>()) {
+            ++stats_.hits;
+        } else {
+            ++stats_.misses;
+        }
+        entry.accessed = accesses_;
+    } else if (sequence[index]->hasRepresentation<VolumeRAM>()) {
+        ++stats_.hits;
+    } else {
+        ++stats_.misses;
+        // Loaded downstream, track it to keep it within the budget
+        loaded_.emplace(index, Load{{}, accesses_});
+    }
+
+    window_.clear();
+    window_.push_back(index);
+    size_t bytes = 0;
+    for (size_t i = 1; i <= std::min(steps_, size - 1); ++i) {
+        const auto step =
+            direction == Direction::Forward ? (index + i) % size : (index + size - i) % size;
+        const auto stepBytes = numberOfBytes(*sequence[step]);
+        if (bytes + stepBytes > memoryBudget_) break;
+        bytes += stepBytes;
+        window_.push_back(step);
+    }
+
+    // Drop the steps behind the accessed one that were never handed out, jobs that are still
+    // running are dropped later
+    for (auto it = loaded_.begin(); it != loaded_.end();) {
+        it = it->second.accessed == 0 && release(it) ? loaded_.erase(it) : std::next(it);
+    }
+
+    // The accessed step is loaded downstream, only load the ones ahead of it
+    for (auto step : util::as_range(std::next(window_.begin()), window_.end())) {
+        if (loaded_.count(step) != 0 || sequence[step]->hasRepresentation<VolumeRAM>()) continue;
+        loaded_.emplace(step, Load{load(sequence[step])});
+        ++stats_.prefetched;
+    }
+
+    evict();
+}
+
+void VolumeSequencePrefetcher::evict() {
+    size_t bytes = 0;
+    std::vector<std::map<size_t, Load>::iterator> accessed;
+    for (auto it = loaded_.begin(); it != loaded_.end(); ++it) {
+        bytes += numberOfBytes(*(*sequence_)[it->first]);
+        if (it->second.accessed != 0) accessed.push_back(it);
+    }
+    std::sort(accessed.begin(), accessed.end(),
+              [](auto& a, auto& b) { return a->second.accessed < b->second.accessed; });
+
+    for (auto it : accessed) {
+        if (bytes <= memoryBudget_) break;
+        if (release(it)) {
+            bytes -= numberOfBytes(*(*sequence_)[it->first]);
+            loaded_.erase(it);
+        }
+    }
+}
+
+bool VolumeSequencePrefetcher::release(std::map<size_t, Load>::iterator it) {
+    const auto& [step, entry] = *it;
+    if ((entry.ram.valid() && !isReady(entry.ram)) ||
+        std::find(window_.begin(), window_.end(), step) != window_.end()) {
+        return false;
+    }
+    const auto& volume = (*sequence_)[step];
+    // An accessed step might be used by processors or background jobs downstream, they hold a
+    // reference to the volume while they use it
+    if (entry.accessed != 0 && volume.use_count() > 1) return false;
+
+    const VolumeRAM* ram = nullptr;
+    if (entry.ram.valid()) {
+        ram = entry.ram.get();
+    } else if (volume->hasRepresentation<VolumeRAM>()) {
+        ram = volume->getRepresentation<VolumeRAM>();
+    }
+    // Fails if the representation can not be recreated or is shared, in both cases it is kept
+    if (ram && volume->releaseRepresentation(ram)) {
+        ++stats_.dropped;
+    }
+    return true;
+}
+
+auto VolumeSequencePrefetcher::getStatistics() const -> const Statistics& { return stats_; }
+
+void VolumeSequencePrefetcher::resetStatistics() { stats_ = Statistics{}; }
+
+}  // namespace inviwo
@@ -30,6 +30,7 @@
 #include <modules/base/algorithm/volume/volumevoronoi.h>
 
 #include <array>
+#include <atomic>
 
 namespace inviwo {
 namespace util {
@@ -69,12 +70,37 @@ constexpr auto build_array(Functor&& func) noexcept {
                                    std::make_integer_sequence<Index, N>());
 }
 
+struct Control {
+    Control(std::function<void(float)> progress, std::function<bool()> stop, size_t slices)
+        : progress{std::move(progress)}, stop{std::move(stop)}, slices{slices} {}
+
+    /**
+     * Reports progress and checks for cancellation at the start of each slice. Returns true if
+     * the voxel should be skipped since the calculation has been aborted.
+     */
+    bool skip(const size3_t& voxelPos) {
+        if (aborted.load(std::memory_order_relaxed)) return true;
+        if (voxelPos.x == 0 && voxelPos.y == 0) {
+            if (progress) progress(static_cast<float>(done++) / static_cast<float>(slices));
+            if (stop && stop()) aborted.store(true, std::memory_order_relaxed);
+        }
+        return aborted.load(std::memory_order_relaxed);
+    }
+
+    std::function<void(float)> progress;
+    std::function<bool()> stop;
+    size_t slices;
+    std::atomic<size_t> done{0};
+    std::atomic<bool> aborted{false};
+};
+
 }  // namespace detail
 
 template <Wrapping X, Wrapping Y, Wrapping Z>
 void voronoiSegmentationImpl(const size3_t volumeDimensions, const mat4& indexToModelMatrix,
                              const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices,
-                             VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
+                             VolumeRAMPrecision<unsigned short>& voronoiVolumeRep,
+                             detail::Control& control) {
 
     auto volumeIndices = voronoiVolumeRep.getDataTyped();
     util::IndexMapper3D index(volumeDimensions);
@@ -83,6 +109,7 @@ void voronoiSegmentationImpl(const size3_t volumeDimensions, const mat4& indexTo
                       vec3{indexToModelMatrix * vec4{0.0f, 0.0f, 0.0f, 1.0f}};
 
     util::forEachVoxelParallel(volumeDimensions, [&](const size3_t& voxelPos) {
+        if (control.skip(voxelPos)) return;
         const auto transformedVoxelPos = vec3{indexToModelMatrix * vec4{voxelPos, 1.0f}};
         auto it = std::min_element(
             seedPointsWithIndices.cbegin(), seedPointsWithIndices.cend(),
@@ -98,7 +125,8 @@ template <Wrapping X, Wrapping Y, Wrapping Z>
 void weightedVoronoiSegmentationImpl(
     const size3_t volumeDimensions, const mat4& indexToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices,
-    const std::vector<float>& weights, VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
+    const std::vector<float>& weights, VolumeRAMPrecision<unsigned short>& voronoiVolumeRep,
+    detail::Control& control) {
 
     auto volumeIndices = voronoiVolumeRep.getDataTyped();
     util::IndexMapper3D index(volumeDimensions);
@@ -107,6 +135,7 @@ void weightedVoronoiSegmentationImpl(
                       vec3{indexToModelMatrix * vec4{0.0f, 0.0f, 0.0f, 1.0f}};
 
     util::forEachVoxelParallel(volumeDimensions, [&](const size3_t& voxelPos) {
+        if (control.skip(voxelPos)) return;
         const auto transformedVoxelPos = vec3{indexToModelMatrix * vec4{voxelPos, 1.0f}};
         auto zipped = util::zip(seedPointsWithIndices, weights);
 
@@ -124,7 +153,8 @@ void weightedVoronoiSegmentationImpl(
 std::shared_ptr<Volume> voronoiSegmentation(
     const size3_t volumeDimensions, const mat4& indexToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices, const Wrapping3D& wrapping,
-    const std::optional<std::vector<float>>& weights) {
+    const std::optional<std::vector<float>>& weights, std::function<void(float)> progress,
+    std::function<bool()> stop) {
 
     if (seedPointsWithIndices.size() == 0) {
         throw Exception("No seed points, cannot create volume voronoi segmentation",
@@ -150,10 +180,13 @@ std::shared_ptr<Volume> voronoiSegmentation(
     voronoiVolume->dataMap_.dataRange = dvec2{0.0, static_cast<double>(imax->first)};
     voronoiVolume->dataMap_.valueRange = voronoiVolume->dataMap_.dataRange;
 
+    detail::Control control{std::move(progress), std::move(stop), volumeDimensions.z};
+
     if (weights.has_value()) {
         using Functor =
             void (*)(const size3_t, const mat4&, const std::vector<std::pair<uint32_t, vec3>>&,
-                     const std::vector<float>&, VolumeRAMPrecision<unsigned short>&);
+                     const std::vector<float>&, VolumeRAMPrecision<unsigned short>&,
+                     detail::Control&);
 
         constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
             using XT = decltype(x);
@@ -164,11 +197,13 @@ std::shared_ptr<Volume> voronoiSegmentation(
                     return [](const size3_t dim, const mat4& matrix,
                               const std::vector<std::pair<uint32_t, vec3>>& sp,
                               const std::vector<float>& w,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
+                              VolumeRAMPrecision<unsigned short>& volRep,
+                              detail::Control& control) {
                         constexpr auto X = static_cast<Wrapping>(XT::value);
                         constexpr auto Y = static_cast<Wrapping>(YT::value);
                         constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        weightedVoronoiSegmentationImpl<X, Y, Z>(dim, matrix, sp, w, volRep);
+                        weightedVoronoiSegmentationImpl<X, Y, Z>(dim, matrix, sp, w, volRep,
+                                                                 control);
                     };
                 });
             });
@@ -176,12 +211,13 @@ std::shared_ptr<Volume> voronoiSegmentation(
 
         table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
              [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToModelMatrix,
-                                                seedPointsWithIndices, *weights, *voronoiVolumeRep);
+                                                seedPointsWithIndices, *weights, *voronoiVolumeRep,
+                                                control);
 
     } else {
         using Functor =
             void (*)(const size3_t, const mat4&, const std::vector<std::pair<uint32_t, vec3>>&,
-                     VolumeRAMPrecision<unsigned short>&);
+                     VolumeRAMPrecision<unsigned short>&, detail::Control&);
 
         constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
             using XT = decltype(x);
@@ -191,11 +227,12 @@ std::shared_ptr<Volume> voronoiSegmentation(
                     using ZT = decltype(z);
                     return [](const size3_t dim, const mat4& matrix,
                               const std::vector<std::pair<uint32_t, vec3>>& sp,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
+                              VolumeRAMPrecision<unsigned short>& volRep,
+                              detail::Control& control) {
                         constexpr auto X = static_cast<Wrapping>(XT::value);
                         constexpr auto Y = static_cast<Wrapping>(YT::value);
                         constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        voronoiSegmentationImpl<X, Y, Z>(dim, matrix, sp, volRep);
+                        voronoiSegmentationImpl<X, Y, Z>(dim, matrix, sp, volRep, control);
                     };
                 });
             });
@@ -203,9 +240,11 @@ std::shared_ptr<Volume> voronoiSegmentation(
 
         table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
              [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToModelMatrix,
-                                                seedPointsWithIndices, *voronoiVolumeRep);
+                                                seedPointsWithIndices, *voronoiVolumeRep, control);
     }
 
+    if (control.aborted) return nullptr;
+    if (control.progress) control.progress(1.0f);
     return voronoiVolume;
 }
 
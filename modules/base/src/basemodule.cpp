@@ -90,6 +90,7 @@
 #include <modules/base/processors/volumedivergencecpuprocessor.h>
 #include <modules/base/processors/volumegradientcpuprocessor.h>
 #include <modules/base/processors/volumelaplacianprocessor.h>
+#include <modules/base/processors/volumeraycastercpu.h>
 #include <modules/base/processors/volumesequencetospatial4dsampler.h>
 #include <modules/base/processors/worldtransformdeprecated.h>
 #include <modules/base/processors/camerafrustum.h>
@@ -194,6 +195,7 @@ BaseModule::BaseModule(InviwoApplication* app) : InviwoModule(app, "Base") {
     registerProcessor<VolumeCurlCPUProcessor>();
     registerProcessor<VolumeDivergenceCPUProcessor>();
     registerProcessor<VolumeLaplacianProcessor>();
+    registerProcessor<VolumeRaycasterCPU>();
     registerProcessor<MeshExport>();
     registerProcessor<RandomMeshGenerator>();
     registerProcessor<RandomSphereGenerator>();
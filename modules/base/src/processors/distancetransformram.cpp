@@ -30,6 +30,7 @@
 #include <modules/base/processors/distancetransformram.h>
 #include <modules/base/algorithm/dataminmax.h>
 #include <modules/base/algorithm/volume/volumeramdistancetransform.h>
+#include <modules/base/algorithm/volume/volumeramsubsample.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 
 namespace inviwo {
@@ -88,56 +89,73 @@ DistanceTransformRAM::DistanceTransformRAM()
 DistanceTransformRAM::~DistanceTransformRAM() = default;
 
 void DistanceTransformRAM::process() {
+    using Result = std::shared_ptr<Volume>;
     auto calc = [upsample = uniformUpsampling_.get() ? size3_t(upsampleFactorUniform_.get())
                                                      : upsampleFactorVec3_.get(),
                  threshold = threshold_.get(), normalize = normalize_.get(), flip = flip_.get(),
                  square = resultSquaredDist_.get(), scale = resultDistScale_.get(),
                  dataRangeMode = dataRangeMode_.get(), customDataRange = customDataRange_.get(),
-                 volume =
-                     volumePort_.getData()](pool::Progress fprogress) -> std::shared_ptr<Volume> {
-        auto volDim = glm::max(volume->getDimensions(), size3_t(1u));
-        auto dstRepr = std::make_shared<VolumeRAMPrecision<float>>(upsample * volDim);
-
-        const auto progress = [&](double f) { fprogress(static_cast<float>(f)); };
-        util::volumeDistanceTransform(volume.get(), dstRepr.get(), upsample, threshold, normalize,
-                                      flip, square, scale, progress);
-
-        auto dstVol = std::make_shared<Volume>(dstRepr);
-        // pass meta data on
-        dstVol->setModelMatrix(volume->getModelMatrix());
-        dstVol->setWorldMatrix(volume->getWorldMatrix());
-        dstVol->copyMetaDataFrom(*volume);
-
-        switch (dataRangeMode) {
-            case DistanceTransformRAM::DataRangeMode::Diagonal: {
-                const auto basis = volume->getBasis();
-                const auto diagonal = basis[0] + basis[1] + basis[2];
-                const auto maxDist = square ? glm::length2(diagonal) : glm::length(diagonal);
-                dstVol->dataMap_.dataRange = dvec2(0.0, maxDist);
-                dstVol->dataMap_.valueRange = dvec2(0.0, maxDist);
-                break;
-            }
-            case DistanceTransformRAM::DataRangeMode::MinMax: {
-                auto minmax = util::dataMinMax(dstRepr->getDataTyped(),
-                                               glm::compMul(dstRepr->getDimensions()));
-
-                dstVol->dataMap_.dataRange = dvec2(minmax.first[0], minmax.second[0]);
-                dstVol->dataMap_.valueRange = dvec2(minmax.first[0], minmax.second[0]);
-                break;
+                 volume = volumePort_.getData()](pool::Stop stop, pool::Progress fprogress,
+                                                 pool::Publish<Result> publish) -> Result {
+        const auto transform = [&](const Volume& input, size3_t factors, auto&& progress) {
+            auto volDim = glm::max(input.getDimensions(), size3_t(1u));
+            auto dstRepr = std::make_shared<VolumeRAMPrecision<float>>(factors * volDim);
+
+            util::volumeDistanceTransform(&input, dstRepr.get(), factors, threshold, normalize,
+                                          flip, square, scale, progress, stop);
+            if (stop) return Result{};
+
+            auto dstVol = std::make_shared<Volume>(dstRepr);
+            // pass meta data on
+            dstVol->setModelMatrix(input.getModelMatrix());
+            dstVol->setWorldMatrix(input.getWorldMatrix());
+            dstVol->copyMetaDataFrom(input);
+
+            switch (dataRangeMode) {
+                case DistanceTransformRAM::DataRangeMode::Diagonal: {
+                    const auto basis = input.getBasis();
+                    const auto diagonal = basis[0] + basis[1] + basis[2];
+                    const auto maxDist = square ? glm::length2(diagonal) : glm::length(diagonal);
+                    dstVol->dataMap_.dataRange = dvec2(0.0, maxDist);
+                    dstVol->dataMap_.valueRange = dvec2(0.0, maxDist);
+                    break;
+                }
+                case DistanceTransformRAM::DataRangeMode::MinMax: {
+                    auto minmax = util::dataMinMax(dstRepr->getDataTyped(),
+                                                   glm::compMul(dstRepr->getDimensions()));
+
+                    dstVol->dataMap_.dataRange = dvec2(minmax.first[0], minmax.second[0]);
+                    dstVol->dataMap_.valueRange = dvec2(minmax.first[0], minmax.second[0]);
+                    break;
+                }
+                case DistanceTransformRAM::DataRangeMode::Custom: {
+                    dstVol->dataMap_.dataRange = customDataRange;
+                    dstVol->dataMap_.valueRange = customDataRange;
+                    break;
+                }
+                default:
+                    break;
             }
-            case DistanceTransformRAM::DataRangeMode::Custom: {
-                dstVol->dataMap_.dataRange = customDataRange;
-                dstVol->dataMap_.valueRange = customDataRange;
-                break;
-            }
-            default:
-                break;
+            return dstVol;
+        };
+
+        // Publish a coarse transform first, either of a preview of the input or, for small
+        // inputs, without upsampling.
+        const auto noProgress = [](double) {};
+        if (auto preview = util::volumePreview(*volume)) {
+            if (auto result = transform(*preview, upsample, noProgress)) publish(result);
+        } else if (upsample != size3_t{1}) {
+            if (auto result = transform(*volume, size3_t{1}, noProgress)) publish(result);
         }
-        return dstVol;
+        if (stop) return nullptr;
+
+        const auto progress = [&](double f) { fprogress(static_cast<float>(f)); };
+        return transform(*volume, upsample, progress);
     };
 
     outport_.setData(nullptr);
-    dispatchOne(calc, [this](std::shared_ptr<Volume> result) {
+    dispatchOneProgressive<Result>(calc, [this](Result result) {
+        if (!result) return;
         outport_.setData(result);
         newResults();
     });
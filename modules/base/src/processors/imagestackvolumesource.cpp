@@ -43,9 +43,11 @@
 #include <inviwo/core/util/vectoroperations.h>
 #include <inviwo/core/util/zip.h>
 #include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/io/datareaderexception.h>
 
 #include <algorithm>
+#include <mutex>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -72,7 +74,7 @@ const ProcessorInfo ImageStackVolumeSource::processorInfo_{
 const ProcessorInfo ImageStackVolumeSource::getProcessorInfo() const { return processorInfo_; }
 
 ImageStackVolumeSource::ImageStackVolumeSource(InviwoApplication* app)
-    : Processor()
+    : PoolProcessor()
     , outport_("volume")
     , filePattern_("filePattern", "File Pattern", "####.jpeg", "")
     , reload_("reload", "Reload data")
@@ -102,15 +104,26 @@ void ImageStackVolumeSource::addFileNameFilters() {
 }
 
 void ImageStackVolumeSource::process() {
-    util::OnScopeExit guard{[&]() { outport_.setData(nullptr); }};
-
     if (filePattern_.isModified() || reload_.isModified() || skipUnsupportedFiles_.isModified()) {
-        volume_ = load();
-        if (volume_) {
-            basis_.updateForNewEntity(*volume_, deserialized_);
-            information_.updateForNewVolume(*volume_, deserialized_);
-        }
-        deserialized_ = false;
+        volume_.reset();
+        outport_.clear();
+        dispatchOne(
+            [slices = getSlices()](pool::Stop stop, pool::Progress progress) {
+                return load(slices, stop, progress);
+            },
+            [this](std::shared_ptr<Volume> result) {
+                volume_ = result;
+                if (volume_) {
+                    basis_.updateForNewEntity(*volume_, deserialized_);
+                    information_.updateForNewVolume(*volume_, deserialized_);
+                    basis_.updateEntity(*volume_);
+                    information_.updateVolume(*volume_);
+                }
+                deserialized_ = false;
+                outport_.setData(volume_);
+                newResults();
+            });
+        return;
     }
 
     if (volume_) {
@@ -118,7 +131,6 @@ void ImageStackVolumeSource::process() {
         information_.updateVolume(*volume_);
     }
     outport_.setData(volume_);
-    guard.release();
 }
 
 bool ImageStackVolumeSource::isValidImageFile(std::string fileName) {
@@ -126,33 +138,27 @@ bool ImageStackVolumeSource::isValidImageFile(std::string fileName) {
         filesystem::getFileExtension(fileName));
 }
 
-std::shared_ptr<Volume> ImageStackVolumeSource::load() {
+auto ImageStackVolumeSource::getSlices() -> Slices {
     const auto files = filePattern_.getFileList();
-    if (files.empty()) {
-        return nullptr;
-    }
-
-    using ReaderMap = std::map<std::string, std::unique_ptr<DataReaderType<Layer>>>;
-    ReaderMap readerMap;
 
+    std::map<std::string, std::shared_ptr<DataReaderType<Layer>>> readerMap;
     const auto getReader = [&](const std::string& filename) {
         const auto fext = toLower(filesystem::getFileExtension(filename));
         const auto it = readerMap.find(fext);
         if (it != readerMap.end()) {
-            return it->second.get();
+            return it->second;
         }
         const auto sext = filePattern_.getSelectedExtension();
-        auto reader = readerFactory_->getReaderForTypeAndExtension<Layer>(sext, fext);
-        auto ptr = reader.get();
-        readerMap.emplace(fext, std::move(reader));
-        return ptr;
+        std::shared_ptr<DataReaderType<Layer>> reader =
+            readerFactory_->getReaderForTypeAndExtension<Layer>(sext, fext);
+        readerMap.emplace(fext, reader);
+        return reader;
     };
 
-    std::vector<std::pair<std::string, DataReaderType<Layer>*>> slices;
+    Slices slices;
     slices.reserve(files.size());
-
     std::transform(files.begin(), files.end(), std::back_inserter(slices),
-                   [&](const auto& file) -> std::pair<std::string, DataReaderType<Layer>*> {
+                   [&](const auto& file) -> Slices::value_type {
                        return {file, getReader(file)};
                    });
     if (skipUnsupportedFiles_) {
@@ -161,14 +167,22 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
                      slices.end());
     }
 
-    // identify first slice with a reader
-    const auto first = std::find_if(slices.begin(), slices.end(),
-                                    [](auto& item) { return item.second != nullptr; });
-    if (first == slices.end()) {  // could not find any suitable data reader for the images
+    if (std::none_of(slices.begin(), slices.end(),
+                     [](auto& item) { return item.second != nullptr; })) {
+        // could not find any suitable data reader for the images
         throw Exception(
             fmt::format("No supported images found in '{}'", filePattern_.getFilePatternPath()),
             IVW_CONTEXT);
     }
+    return slices;
+}
+
+std::shared_ptr<Volume> ImageStackVolumeSource::load(const Slices& slices, pool::Stop stop,
+                                                     pool::Progress progress) {
+    // identify first slice with a reader
+    const auto first = std::find_if(slices.begin(), slices.end(),
+                                    [](auto& item) { return item.second != nullptr; });
+    const auto firstIndex = static_cast<size_t>(std::distance(slices.begin(), first));
 
     const auto referenceLayer = first->second->readData(first->first);
 
@@ -179,18 +193,18 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
     if (glm::compMul(referenceRAM->getDimensions()) == 0) {
         throw Exception(
             fmt::format("Could not extract valid image dimensions from '{}'", first->first),
-            IVW_CONTEXT);
+            IVW_CONTEXT_CUSTOM("ImageStackVolumeSource"));
     }
 
     const auto refFormat = referenceRAM->getDataFormat();
     if ((refFormat->getNumericType() != NumericType::Float) && (refFormat->getPrecision() > 32)) {
         throw DataReaderException(
             fmt::format("Unsupported integer bit depth ({})", refFormat->getPrecision()),
-            IVW_CONTEXT);
+            IVW_CONTEXT_CUSTOM("ImageStackVolumeSource"));
     }
 
     return referenceRAM->dispatch<std::shared_ptr<Volume>, FloatOrIntMax32>(
-        [&](auto reflayerprecision) {
+        [&](auto reflayerprecision) -> std::shared_ptr<Volume> {
             using ValueType = util::PrecisionValueType<decltype(reflayerprecision)>;
             using PrimitiveType = typename DataFormat<ValueType>::primitive;
 
@@ -206,55 +220,61 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
                 std::fill(volData + s * sliceOffset, volData + (s + 1) * sliceOffset, ValueType{0});
             };
 
-            const auto read = [&](const auto& file, auto reader) -> std::shared_ptr<Layer> {
+            const auto warn = [](const std::string& message) {
+                LogWarnCustom("ImageStackVolumeSource", message);
+            };
+
+            const auto read = [&](size_t slice) -> std::shared_ptr<Layer> {
+                const auto& [file, reader] = slices[slice];
+                if (!reader) return nullptr;
+                if (slice == firstIndex) return referenceLayer;
                 try {
-                    return reader->readData(file);
+                    // readers are not thread safe, use a separate copy for each slice
+                    std::unique_ptr<DataReaderType<Layer>> copy{reader->clone()};
+                    return copy->readData(file);
                 } catch (DataReaderException const& e) {
-                    LogProcessorWarn(
-                        fmt::format("Could not load image: {}, {}", file, e.getMessage()));
+                    warn(fmt::format("Could not load image: {}, {}", file, e.getMessage()));
                     return nullptr;
                 }
             };
 
-            for (auto&& elem : util::enumerate(slices)) {
-                const auto slice = elem.first();
-                const auto file = elem.second().first;
-                const auto reader = elem.second().second;
-                if (!reader) {
-                    fill(slice);
-                    continue;
-                }
+            std::mutex progressMutex;
+            size_t loaded = 0;
 
-                const auto layer = read(file, reader);
-                if (!layer) {
-                    fill(slice);
-                    continue;
-                }
-                const auto layerRAM = layer->template getRepresentation<LayerRAM>();
+            // Each pool thread reads one image at a time and copies it directly into the volume
+            util::parallelFor(slices.size(), [&](size_t slice) {
+                if (stop) return;
+                const auto& file = slices[slice].first;
 
-                const auto format = layerRAM->getDataFormat();
-                if ((format->getNumericType() != NumericType::Float) &&
-                    (format->getPrecision() > 32)) {
-                    LogProcessorWarn(fmt::format("Unsupported integer bit depth: {}, for image: {}",
-                                                 format->getPrecision(), file));
+                const auto layer = read(slice);
+                const auto layerRAM =
+                    layer ? layer->template getRepresentation<LayerRAM>() : nullptr;
+                if (!layerRAM) {
                     fill(slice);
-                    continue;
-                }
-
-                if (layerRAM->getDimensions() != layerDims) {
-                    LogProcessorWarn(
-                        fmt::format("Unexpected dimensions: {} , expected: {}, for image: {}",
-                                    layer->getDimensions(), layerDims, file));
+                } else if (const auto format = layerRAM->getDataFormat();
+                           (format->getNumericType() != NumericType::Float) &&
+                           (format->getPrecision() > 32)) {
+                    warn(fmt::format("Unsupported integer bit depth: {}, for image: {}",
+                                     format->getPrecision(), file));
+                    fill(slice);
+                } else if (layerRAM->getDimensions() != layerDims) {
+                    warn(fmt::format("Unexpected dimensions: {} , expected: {}, for image: {}",
+                                     layer->getDimensions(), layerDims, file));
                     fill(slice);
-                    continue;
+                } else {
+                    layerRAM->template dispatch<void, FloatOrIntMax32>([&](auto layerpr) {
+                        const auto data = layerpr->getDataTyped();
+                        std::transform(data, data + sliceOffset, volData + slice * sliceOffset,
+                                       [](auto value) {
+                                           return util::glm_convert_normalized<ValueType>(value);
+                                       });
+                    });
                 }
-                layerRAM->template dispatch<void, FloatOrIntMax32>([&](auto layerpr) {
-                    const auto data = layerpr->getDataTyped();
-                    std::transform(
-                        data, data + sliceOffset, volData + slice * sliceOffset,
-                        [](auto value) { return util::glm_convert_normalized<ValueType>(value); });
-                });
-            }
+
+                std::scoped_lock lock{progressMutex};
+                progress(++loaded, slices.size());
+            });
+            if (stop) return nullptr;
 
             auto volume = std::make_shared<Volume>(volumeRAM);
             volume->dataMap_.dataRange =
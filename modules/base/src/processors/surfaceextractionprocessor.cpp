@@ -33,11 +33,14 @@
 #include <modules/base/algorithm/volume/marchingtetrahedron.h>
 #include <modules/base/algorithm/volume/marchingcubes.h>
 #include <modules/base/algorithm/volume/marchingcubesopt.h>
+#include <modules/base/algorithm/volume/volumeramsubsample.h>
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/zip.h>
+#include <algorithm>
+#include <iterator>
 #include <numeric>
 
 #include <inviwo/core/util/rendercontext.h>
@@ -97,28 +100,50 @@ SurfaceExtraction::SurfaceExtraction()
 
 SurfaceExtraction::~SurfaceExtraction() = default;
 
+SurfaceExtraction::Update SurfaceExtraction::update(const Surface& surface, bool volumeChanged,
+                                                    bool colorChanged) {
+    if (volumeChanged || !surface.mesh || surface.preview) return Update::Extract;
+    return colorChanged ? Update::ChangeColor : Update::Keep;
+}
+
 void SurfaceExtraction::process() {
+    using Result = Surface;
+    using Job = std::function<Result(pool::Stop, pool::Progress, pool::Publish<Result>)>;
 
-    const auto computeSurface = [this](vec4 color, std::shared_ptr<const Volume> vol) {
+    const auto computeSurface = [this](vec4 color, std::shared_ptr<const Volume> vol) -> Job {
         return [vol, color, method = method_.get(), iso = isoValue_.get(),
-                invert = invertIso_.get(),
-                enclose = encloseSurface_.get()](pool::Progress progress) -> std::shared_ptr<Mesh> {
+                invert = invertIso_.get(), enclose = encloseSurface_.get()](
+                   pool::Stop stop, pool::Progress progress, pool::Publish<Result> publish) {
             RenderContext::getPtr()->activateLocalRenderContext();
 
-            switch (method) {
-                case Method::MarchingCubes:
-                    return util::marchingcubes(vol, iso, color, invert, enclose, progress);
-                case Method::MarchingCubesOpt:
-                    return util::marchingCubesOpt(vol, iso, color, invert, enclose, progress);
-                case Method::MarchingTetrahedron:
-                default:
-                    return util::marchingtetrahedron(vol, iso, color, invert, enclose, progress);
+            const auto extract = [&](std::shared_ptr<const Volume> v,
+                                     std::function<void(float)> callback) -> std::shared_ptr<Mesh> {
+                const auto all = [](const size3_t&) { return true; };
+                switch (method) {
+                    case Method::MarchingCubes:
+                        return util::marchingcubes(v, iso, color, invert, enclose, callback, all,
+                                                   stop);
+                    case Method::MarchingCubesOpt:
+                        return util::marchingCubesOpt(v, iso, color, invert, enclose, callback,
+                                                      nullptr, stop);
+                    case Method::MarchingTetrahedron:
+                    default:
+                        return util::marchingtetrahedron(v, iso, color, invert, enclose,
+                                                         callback, all, stop);
+                }
+            };
+
+            // Show the surface of a coarse version of the volume while the full one is extracted
+            if (auto preview = util::volumePreview(*vol)) {
+                publish(Result{extract(preview, nullptr), true});
             }
+            if (stop) return Result{};
+            return Result{extract(vol, progress), false};
         };
     };
 
-    const auto changeColor = [](vec4 color, std::shared_ptr<const Mesh> oldmesh) {
-        return [oldmesh, color](pool::Progress) -> std::shared_ptr<Mesh> {
+    const auto changeColor = [](vec4 color, std::shared_ptr<const Mesh> oldmesh) -> Job {
+        return [oldmesh, color](pool::Stop, pool::Progress, pool::Publish<Result>) -> Result {
             RenderContext::getPtr()->activateLocalRenderContext();
 
             auto mesh = std::make_shared<Mesh>(oldmesh->getDefaultMeshInfo());
@@ -144,7 +169,7 @@ void SurfaceExtraction::process() {
                 }
             }
 
-            return mesh;
+            return Result{mesh, false};
         };
     };
 
@@ -155,42 +180,55 @@ void SurfaceExtraction::process() {
                              invertIso_.isModified() || encloseSurface_.isModified();
 
     if (stateChange || size != meshes_.size()) {  // Need to recompute all...
-        std::vector<decltype(computeSurface(vec4{}, std::shared_ptr<const Volume>{}))> jobs;
+        std::vector<Job> jobs;
         for (auto [i, vol] : util::enumerate(volume_)) {
             jobs.push_back(computeSurface(getColor(i), vol));
         }
-        dispatchMany(jobs, [this](std::vector<std::shared_ptr<Mesh>> result) {
+        dispatchManyProgressive<Result>(jobs, [this](std::vector<Result> result) {
             meshes_ = result;
-            outport_.setData(std::make_shared<std::vector<std::shared_ptr<Mesh>>>(meshes_));
-            newResults();
+            updateOutport();
         });
     } else {  // Only update the modified ones
-        std::vector<std::function<std::shared_ptr<Mesh>(pool::Progress progress)>> jobs;
+        std::vector<Job> jobs;
         std::vector<size_t> inds;
         for (auto [i, item] : util::enumerate(volume_.changedAndData())) {
             const auto portChanged = item.first;
             const auto data = item.second;
 
-            if (portChanged) {
-                jobs.push_back(computeSurface(getColor(i), data));
-                inds.push_back(i);
-            } else if (colors_[i]->isModified()) {
-                jobs.push_back(changeColor(getColor(i), meshes_[i]));
-                inds.push_back(i);
+            switch (update(meshes_[i], portChanged, colors_[i]->isModified())) {
+                case Update::Extract:
+                    jobs.push_back(computeSurface(getColor(i), data));
+                    inds.push_back(i);
+                    break;
+                case Update::ChangeColor:
+                    jobs.push_back(changeColor(getColor(i), meshes_[i].mesh));
+                    inds.push_back(i);
+                    break;
+                case Update::Keep:
+                    break;
             }
         }
         if (!jobs.empty()) {
-            dispatchMany(jobs, [this, inds](std::vector<std::shared_ptr<Mesh>> results) {
+            dispatchManyProgressive<Result>(jobs, [this, inds](std::vector<Result> results) {
                 for (auto [i, result] : util::zip(inds, results)) {
-                    meshes_[i] = result;
+                    // Keep the previous mesh until a new one has been published
+                    if (result.mesh) meshes_[i] = result;
                 }
-                outport_.setData(std::make_shared<std::vector<std::shared_ptr<Mesh>>>(meshes_));
-                newResults();
+                updateOutport();
             });
         }
     }
 }
 
+void SurfaceExtraction::updateOutport() {
+    auto meshes = std::make_shared<std::vector<std::shared_ptr<Mesh>>>();
+    for (const auto& surface : meshes_) {
+        if (surface.mesh) meshes->push_back(surface.mesh);
+    }
+    outport_.setData(meshes);
+    newResults();
+}
+
 void SurfaceExtraction::updateColors() {
     const static vec4 defaultColor[11] = {vec4(1.0f),
                                           vec4(0x1f, 0x77, 0xb4, 255) / vec4(255),
@@ -0,0 +1,152 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/processors/volumeraycastercpu.h>
+#include <inviwo/core/algorithm/boundingbox.h>
+
+#include <algorithm>
+#include <mutex>
+
+namespace inviwo {
+
+const ProcessorInfo VolumeRaycasterCPU::processorInfo_{
+    "org.inviwo.VolumeRaycasterCPU",  // Class identifier
+    "Volume Raycaster CPU",           // Display name
+    "Volume Rendering",               // Category
+    CodeState::Experimental,          // Code state
+    Tags::CPU,                        // Tags
+};
+const ProcessorInfo VolumeRaycasterCPU::getProcessorInfo() const { return processorInfo_; }
+
+VolumeRaycasterCPU::VolumeRaycasterCPU()
+    : PoolProcessor()
+    , volumePort_("volume")
+    , outport_("outport")
+    , channel_("channel", "Render Channel", {{"Channel 1", "Channel 1", 0}}, 0)
+    , raycasting_("raycaster", "Raycasting")
+    , isotfComposite_("isotfComposite", "TF & Isovalues", &volumePort_,
+                      InvalidationLevel::InvalidOutput)
+    , camera_("camera", "Camera", util::boundingBox(volumePort_))
+    , lighting_("lighting", "Lighting", &camera_) {
+
+    addPort(volumePort_);
+    addPort(outport_);
+
+    channel_.setSerializationMode(PropertySerializationMode::All);
+
+    volumePort_.onChange([this]() {
+        if (volumePort_.hasData()) {
+            size_t channels = volumePort_.getData()->getDataFormat()->getComponents();
+
+            if (channels == channel_.size()) return;
+
+            std::vector<OptionPropertyIntOption> channelOptions;
+            for (size_t i = 0; i < channels; i++) {
+                channelOptions.emplace_back("Channel " + toString(i + 1),
+                                            "Channel " + toString(i + 1), static_cast<int>(i));
+            }
+            channel_.replaceOptions(channelOptions);
+            channel_.setCurrentStateAsDefault();
+        }
+    });
+    channel_.onChange([this]() { prepared_.reset(); });
+
+    addProperties(channel_, raycasting_, isotfComposite_, camera_, lighting_);
+}
+
+void VolumeRaycasterCPU::process() {
+    if (volumePort_.isChanged()) prepared_.reset();
+
+    using Result = std::pair<std::shared_ptr<const util::RaycastingVolume>, std::shared_ptr<Image>>;
+    const auto render = [volume = volumePort_.getData(), channel = channel_.get(),
+                         prepared = prepared_, settings = getSettings(),
+                         dimensions = outport_.getDimensions()](pool::Stop stop,
+                                                                pool::Progress progress) -> Result {
+        auto vol = prepared;
+        if (!vol) {
+            vol = std::make_shared<util::RaycastingVolume>(*volume, static_cast<size_t>(channel));
+        }
+        if (stop) return {vol, nullptr};
+
+        // pool::Progress is not thread safe
+        std::mutex mutex;
+        auto image = util::raycastVolume(
+            *vol, settings, dimensions,
+            [&](float f) {
+                std::scoped_lock lock{mutex};
+                progress(f);
+            },
+            stop);
+        return {vol, image};
+    };
+
+    dispatchOne(render, [this](Result result) {
+        prepared_ = result.first;
+        if (!result.second) return;
+        outport_.setData(result.second);
+        newResults();
+    });
+}
+
+util::RaycastingSettings VolumeRaycasterCPU::getSettings() const {
+    util::RaycastingSettings settings;
+    settings.renderingType = raycasting_.renderingType_.get();
+    settings.classification = raycasting_.classification_.get();
+    settings.compositing = raycasting_.compositing_.get();
+    settings.gradient = raycasting_.gradientComputation_.get();
+    settings.samplingRate = raycasting_.samplingRate_.get();
+
+    const auto& tf = isotfComposite_.tf_.get();
+    const auto size = std::max<size_t>(2, tf.getTextureSize());
+    settings.transferFunction.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+        const auto pos = static_cast<double>(i) / static_cast<double>(size - 1);
+        auto& color = settings.transferFunction[i];
+        color = tf.sample(pos);
+        if (pos < tf.getMaskMin() || pos > tf.getMaskMax()) color.a = 0.0f;
+    }
+
+    const auto [values, colors] = isotfComposite_.isovalues_.get().getVectorsf();
+    for (size_t i = 0; i < values.size(); ++i) {
+        settings.isovalues.emplace_back(values[i], colors[i]);
+    }
+
+    settings.shading = static_cast<ShadingMode::Modes>(lighting_.shadingMode_.get());
+    settings.lightPosition = lighting_.getTransformedPosition();
+    settings.ambientColor = lighting_.ambientColor_.get();
+    settings.diffuseColor = lighting_.diffuseColor_.get();
+    settings.specularColor = lighting_.specularColor_.get();
+    settings.specularExponent = lighting_.specularExponent_.get();
+
+    settings.viewMatrix = camera_.viewMatrix();
+    settings.projectionMatrix = camera_.projectionMatrix();
+    return settings;
+}
+
+}  // namespace inviwo
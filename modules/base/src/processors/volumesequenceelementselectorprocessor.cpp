@@ -29,6 +29,10 @@
 
 #include <modules/base/processors/volumesequenceelementselectorprocessor.h>
 
+#include <fmt/format.h>
+
+#include <limits>
+
 namespace inviwo {
 
 const ProcessorInfo VolumeSequenceElementSelectorProcessor::processorInfo_{
@@ -42,9 +46,57 @@ const ProcessorInfo VolumeSequenceElementSelectorProcessor::getProcessorInfo() c
     return processorInfo_;
 }
 VolumeSequenceElementSelectorProcessor::VolumeSequenceElementSelectorProcessor()
-    : VectorElementSelectorProcessor<Volume>() {
+    : VectorElementSelectorProcessor<Volume>()
+    , prefetch_("prefetch", "Prefetch", false, InvalidationLevel::Valid)
+    , prefetchSteps_("prefetchSteps", "Steps Ahead", 4, 1, 32, 1, InvalidationLevel::Valid)
+    , memoryBudget_("memoryBudget", "Memory Budget (MB)", 1024, 1, 65536, 1,
+                    InvalidationLevel::Valid)
+    , statistics_("statistics", "Statistics", "", InvalidationLevel::Valid)
+    , prefetcher_(prefetchSteps_.get(), memoryBudget_.get() << 20)
+    , lastIndex_(std::numeric_limits<size_t>::max()) {
     timeStep_.index_.autoLinkToProperty<VolumeSequenceElementSelectorProcessor>(
         "timeStep.selectedSequenceIndex");
+
+    statistics_.setReadOnly(true);
+    statistics_.setSerializationMode(PropertySerializationMode::None);
+    prefetch_.addProperties(prefetchSteps_, memoryBudget_, statistics_);
+    addProperty(prefetch_);
+
+    prefetch_.getBoolProperty()->onChange([this]() {
+        prefetcher_.setSequence(prefetch_.isChecked() ? inport_.getData() : nullptr);
+        prefetcher_.resetStatistics();
+        lastIndex_ = std::numeric_limits<size_t>::max();
+    });
+    prefetchSteps_.onChange([this]() { prefetcher_.setSteps(prefetchSteps_.get()); });
+    memoryBudget_.onChange([this]() { prefetcher_.setMemoryBudget(memoryBudget_.get() << 20); });
+    inport_.onChange([this]() {
+        prefetcher_.setSequence(prefetch_.isChecked() ? inport_.getData() : nullptr);
+        lastIndex_ = std::numeric_limits<size_t>::max();
+    });
+}
+
+void VolumeSequenceElementSelectorProcessor::process() {
+    VectorElementSelectorProcessor<Volume>::process();
+
+    if (!prefetch_.isChecked()) return;
+    const auto data = inport_.getData();
+    if (!data || data->empty()) return;
+
+    const auto size = data->size();
+    const auto index = std::min(size - 1, static_cast<size_t>(timeStep_.index_.get() - 1));
+    // Only a single step backwards, including wrapping around, counts as playing backwards.
+    // Anything else, like jumping to a step, is assumed to continue forwards.
+    const auto direction = lastIndex_ < size && (lastIndex_ + size - 1) % size == index
+                               ? VolumeSequencePrefetcher::Direction::Backward
+                               : VolumeSequencePrefetcher::Direction::Forward;
+    lastIndex_ = index;
+
+    prefetcher_.access(index, direction);
+
+    const auto& stats = prefetcher_.getStatistics();
+    statistics_.set(fmt::format("hits: {}, pending: {}, misses: {}, prefetched: {}, dropped: {}",
+                                stats.hits, stats.pending, stats.misses, stats.prefetched,
+                                stats.dropped));
 }
 
 }  // namespace inviwo
@@ -64,26 +64,30 @@ void VolumeSubsample::process() {
 
     if (enabled_ && factors != size3_t(1, 1, 1)) {
         outport_.clear();
-        dispatchOne([volume = inport_.getData(),
-                     f = subSampleFactors_.get()]() { return subsample(volume, f); },
-                    [this](std::shared_ptr<Volume> result) {
-                        outport_.setData(result);
-                        newResults();
-                    });
+        using Result = std::shared_ptr<Volume>;
+        dispatchOneProgressive<Result>(
+            [volume = inport_.getData(), factors](pool::Stop stop, pool::Progress progress,
+                                                  pool::Publish<Result> publish) -> Result {
+                // Show a coarse nearest-sampled version while the average is computed
+                if (auto preview = util::volumePreview(*volume)) {
+                    if (glm::all(glm::lessThanEqual(preview->getDimensions(),
+                                                    volume->getDimensions() / factors))) {
+                        publish(preview);
+                        progress(0.5f);
+                    }
+                }
+                if (stop) return nullptr;
+                return util::volumeSubSample(*volume, factors, util::SubsampleMode::Average,
+                                             stop);
+            },
+            [this](Result result) {
+                if (!result) return;
+                outport_.setData(result);
+                newResults();
+            });
     } else {
         outport_.setData(inport_.getData());
     }
 }
 
-std::shared_ptr<Volume> VolumeSubsample::subsample(std::shared_ptr<const Volume> volume,
-                                                   size3_t f) {
-    auto vol = volume->getRepresentation<VolumeRAM>();
-    auto sample = std::make_shared<Volume>(util::volumeSubSample(vol, f));
-    sample->copyMetaDataFrom(*volume);
-    sample->dataMap_ = volume->dataMap_;
-    sample->setModelMatrix(volume->getModelMatrix());
-    sample->setWorldMatrix(volume->getWorldMatrix());
-    return sample;
-}
-
 }  // namespace inviwo
@@ -86,6 +86,22 @@ TEST(Marchingcubes, full) {
     EXPECT_EQ(ind.size(), 0);
 }
 
+TEST(Marchingcubes, stop) {
+    auto vol = std::shared_ptr<Volume>(util::generateVolume(
+        size3_t{8}, mat3(1.0f), [&](const size3_t& p) { return p.x < 4 ? 0.0f : 1.0f; }));
+    size_t calls = 0;
+    const auto stop = [&]() { return ++calls > 2; };
+    EXPECT_EQ(util::marchingCubesOpt(vol, 0.5, vec4{1.0f}, false, false, nullptr, nullptr, stop),
+              nullptr);
+    EXPECT_EQ(calls, 3);
+
+    const auto all = [](const size3_t&) { return true; };
+    calls = 0;
+    EXPECT_EQ(util::marchingcubes(vol, 0.5, vec4{1.0f}, false, false, nullptr, all, stop),
+              nullptr);
+    EXPECT_EQ(calls, 3);
+}
+
 TEST(Marchingcubes, one) {
     const std::array<size3_t, 8> voxels = {
         {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}}};
@@ -127,6 +127,53 @@ TEST(MeshCutting, GatherLoops) {
     ASSERT_EQ(loops[0].size(), 3);
 }
 
+TEST(MeshCutting, RemoveDuplicateEdges) {
+    const float eps = 0.0001f;
+    const std::vector<vec3> positions{vec3{0, 0, 0}, vec3{1, 0, 0}, vec3{0.00001f, 0, 0},
+                                      vec3{1, 0.00001f, 0}, vec3{0, 1, 0}};
+    // {0, 1} and {3, 2} are the same edge, {0, 2} is degenerate
+    std::vector<glm::u32vec2> edges{{0, 1}, {3, 2}, {0, 2}, {1, 4}, {4, 2}};
+
+    meshutil::detail::removeDuplicateEdges(edges, positions, eps);
+
+    ASSERT_EQ(edges.size(), 3);
+    const auto loops = meshutil::detail::gatherLoops(edges, positions, eps);
+    ASSERT_EQ(loops.size(), 1);
+    EXPECT_EQ(loops[0].size(), 3);
+}
+
+TEST(MeshCutting, ClipCube) {
+    const auto cube = meshutil::cube(mat4{1.0f});
+    const Plane plane{vec3{0.0f, 0.0f, 0.25f}, vec3{0.0f, 0.0f, 1.0f}};
+
+    const auto clipped = meshutil::clipMeshAgainstPlane(*cube, plane, true);
+
+    // one index buffer for the clipped triangles and one for the cap
+    ASSERT_EQ(clipped->getNumberOfIndicies(), cube->getNumberOfIndicies() + 1);
+    ASSERT_EQ(clipped->getNumberOfBuffers(), cube->getNumberOfBuffers());
+
+    const auto positions = static_cast<const BufferRAMPrecision<vec3>*>(
+        clipped->getBuffer(BufferType::PositionAttrib)->getRepresentation<BufferRAM>());
+    const auto size = positions->getSize();
+    for (size_t i = 0; i < clipped->getNumberOfBuffers(); ++i) {
+        EXPECT_EQ(clipped->getBuffer(i)->getSize(), size);
+    }
+
+    for (const auto& item : clipped->getIndexBuffers()) {
+        for (auto index : item.second->getRAMRepresentation()->getDataContainer()) {
+            ASSERT_LT(index, size);
+            EXPECT_GE(positions->get(index).z, 0.25f - 0.00001f);
+        }
+    }
+
+    // the cap should be a flat square at the plane
+    const auto cap = clipped->getIndexBuffers().back().second->getRAMRepresentation();
+    ASSERT_FALSE(cap->getDataContainer().empty());
+    for (auto index : cap->getDataContainer()) {
+        EXPECT_FLOAT_EQ(positions->get(index).z, 0.25f);
+    }
+}
+
 TEST(MeshCutting, PolygonCentroid) {
 
     const auto expected = vec2{0.5f, 0.5f};
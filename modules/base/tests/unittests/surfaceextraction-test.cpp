@@ -0,0 +1,63 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/processors/surfaceextractionprocessor.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+
+namespace inviwo {
+
+using Update = SurfaceExtraction::Update;
+
+TEST(SurfaceExtraction, UpdateFinalMesh) {
+    const SurfaceExtraction::Surface surface{std::make_shared<Mesh>(), false};
+    EXPECT_EQ(Update::Keep, SurfaceExtraction::update(surface, false, false));
+    EXPECT_EQ(Update::ChangeColor, SurfaceExtraction::update(surface, false, true));
+    EXPECT_EQ(Update::Extract, SurfaceExtraction::update(surface, true, false));
+    EXPECT_EQ(Update::Extract, SurfaceExtraction::update(surface, true, true));
+}
+
+TEST(SurfaceExtraction, ColorChangeAfterPreview) {
+    // The extraction was stopped after the preview had been published
+    const SurfaceExtraction::Surface preview{std::make_shared<Mesh>(), true};
+    EXPECT_EQ(Update::Extract, SurfaceExtraction::update(preview, false, true))
+        << "a preview must not be recolored and kept as the final mesh";
+    EXPECT_EQ(Update::Extract, SurfaceExtraction::update(preview, false, false));
+}
+
+TEST(SurfaceExtraction, UpdateMissingMesh) {
+    const SurfaceExtraction::Surface missing{};
+    EXPECT_EQ(Update::Extract, SurfaceExtraction::update(missing, false, false));
+    EXPECT_EQ(Update::Extract, SurfaceExtraction::update(missing, false, true));
+}
+
+}  // namespace inviwo
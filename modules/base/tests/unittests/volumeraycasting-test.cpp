@@ -0,0 +1,147 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/algorithm/volume/volumeraycasting.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+
+namespace inviwo {
+
+namespace {
+
+struct Rendering {
+    std::vector<glm::u8vec4> color;
+    std::vector<float> depth;
+};
+
+// Render a spherical density, seen from the front and covering the center of the image
+Rendering render(util::RaycastingSettings settings, size2_t dims = size2_t{32}) {
+    const auto volume = util::makeSphericalVolume(size3_t{32});
+    const util::RaycastingVolume prepared{*volume, 0};
+
+    const auto toWorld = volume->getCoordinateTransformer().getDataToWorldMatrix();
+    const vec3 center{toWorld * vec4{0.5f, 0.5f, 0.5f, 1.0f}};
+    const auto extent = glm::length(vec3{toWorld * vec4{1.0f, 1.0f, 1.0f, 1.0f}} - center);
+    settings.viewMatrix =
+        glm::lookAt(center + vec3{0.0f, 0.0f, 4.0f * extent}, center, vec3{0.0f, 1.0f, 0.0f});
+    settings.projectionMatrix =
+        glm::perspective(glm::radians(30.0f), 1.0f, 0.1f * extent, 10.0f * extent);
+
+    const auto image = util::raycastVolume(prepared, settings, dims);
+    const auto color = static_cast<const LayerRAMPrecision<glm::u8vec4>*>(
+        image->getColorLayer()->getRepresentation<LayerRAM>());
+    const auto depth = static_cast<const LayerRAMPrecision<float>*>(
+        image->getDepthLayer()->getRepresentation<LayerRAM>());
+    const auto size = glm::compMul(dims);
+    return {{color->getDataTyped(), color->getDataTyped() + size},
+            {depth->getDataTyped(), depth->getDataTyped() + size}};
+}
+
+}  // namespace
+
+TEST(VolumeRaycasting, TransparentTF) {
+    util::RaycastingSettings settings;
+    settings.transferFunction = {vec4{1.0f, 0.0f, 0.0f, 0.0f}, vec4{1.0f, 0.0f, 0.0f, 0.0f}};
+
+    const auto res = render(settings);
+    for (size_t i = 0; i < res.color.size(); ++i) {
+        EXPECT_EQ(res.color[i], glm::u8vec4(0));
+        EXPECT_EQ(res.depth[i], 1.0f);
+    }
+}
+
+TEST(VolumeRaycasting, OpaqueTF) {
+    util::RaycastingSettings settings;
+    settings.transferFunction = {vec4{1.0f, 0.0f, 0.0f, 1.0f}, vec4{1.0f, 0.0f, 0.0f, 1.0f}};
+
+    const auto res = render(settings);
+    const auto center = 16 + 16 * 32;
+    EXPECT_EQ(res.color[center], glm::u8vec4(255, 0, 0, 255));
+    EXPECT_LT(res.depth[center], 1.0f);
+
+    // the corners are outside of the volume
+    EXPECT_EQ(res.color[0], glm::u8vec4(0));
+    EXPECT_EQ(res.depth[0], 1.0f);
+}
+
+TEST(VolumeRaycasting, Isosurface) {
+    util::RaycastingSettings settings;
+    settings.renderingType = RaycastingProperty::RenderingType::Isosurface;
+    settings.isovalues = {{0.9f, vec4{0.0f, 1.0f, 0.0f, 1.0f}}};
+
+    const auto res = render(settings);
+    const auto center = 16 + 16 * 32;
+    EXPECT_EQ(res.color[center], glm::u8vec4(0, 255, 0, 255));
+
+    // the isosurface is a sphere inside of the volume, behind its front face
+    settings.renderingType = RaycastingProperty::RenderingType::Dvr;
+    settings.transferFunction = {vec4{1.0f}, vec4{1.0f}};
+    const auto front = render(settings);
+    EXPECT_GT(res.depth[center], front.depth[center]);
+    EXPECT_LT(res.depth[center], 1.0f);
+}
+
+TEST(VolumeRaycasting, EmptySpaceSkipping) {
+    const auto compare = [](util::RaycastingSettings settings) {
+        settings.emptySpaceSkipping = true;
+        const auto skipped = render(settings, size2_t{64});
+        settings.emptySpaceSkipping = false;
+        const auto full = render(settings, size2_t{64});
+        for (size_t i = 0; i < full.color.size(); ++i) {
+            EXPECT_EQ(skipped.color[i], full.color[i]) << "pixel " << i;
+            EXPECT_EQ(skipped.depth[i], full.depth[i]) << "pixel " << i;
+        }
+    };
+
+    // isosurfaces crossing brick boundaries, the bricks on both sides of a crossing need not
+    // contain the isovalue
+    util::RaycastingSettings settings;
+    settings.renderingType = RaycastingProperty::RenderingType::Isosurface;
+    settings.shading = ShadingMode::Phong;
+    for (const float isovalue : {0.1f, 0.25f, 0.5f, 0.75f, 0.9f}) {
+        settings.isovalues = {{isovalue, vec4{0.0f, 1.0f, 0.0f, 0.5f}}};
+        compare(settings);
+    }
+
+    // a narrow band of the transfer function is visible
+    settings.renderingType = RaycastingProperty::RenderingType::Dvr;
+    settings.transferFunction.assign(16, vec4{0.0f});
+    settings.transferFunction[11] = vec4{1.0f, 0.0f, 0.0f, 0.8f};
+    compare(settings);
+
+    settings.renderingType = RaycastingProperty::RenderingType::DvrIsosurface;
+    settings.isovalues = {{0.3f, vec4{0.0f, 1.0f, 0.0f, 0.5f}}};
+    compare(settings);
+}
+
+}  // namespace inviwo
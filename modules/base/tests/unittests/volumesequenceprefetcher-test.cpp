@@ -0,0 +1,133 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/algorithm/volume/volumesequenceprefetcher.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{8, 8, 8};
+constexpr size_t stepBytes = 8 * 8 * 8;
+
+class TestLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    virtual TestLoader* clone() const override { return new TestLoader(*this); }
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        return std::make_shared<VolumeRAMPrecision<unsigned char>>(src.getDimensions());
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {}
+};
+
+// A sequence where each step only has a disk representation, like the ones from file readers
+std::shared_ptr<VolumeSequence> makeSequence(size_t size) {
+    auto sequence = std::make_shared<VolumeSequence>();
+    for (size_t i = 0; i < size; ++i) {
+        auto disk = std::make_shared<VolumeDisk>(dims, DataUInt8::get());
+        disk->setLoader(new TestLoader());
+        sequence->push_back(std::make_shared<Volume>(disk));
+    }
+    return sequence;
+}
+
+std::vector<size_t> loadedSteps(const VolumeSequence& sequence) {
+    std::vector<size_t> steps;
+    for (size_t i = 0; i < sequence.size(); ++i) {
+        if (sequence[i]->hasRepresentation<VolumeRAM>()) steps.push_back(i);
+    }
+    return steps;
+}
+
+}  // namespace
+
+TEST(VolumeSequencePrefetcher, Window) {
+    const auto sequence = makeSequence(8);
+    VolumeSequencePrefetcher prefetcher{3, 100 * stepBytes};
+    prefetcher.setSequence(sequence);
+
+    prefetcher.access(0, VolumeSequencePrefetcher::Direction::Forward);
+    EXPECT_EQ(loadedSteps(*sequence), (std::vector<size_t>{1, 2, 3}));
+    EXPECT_EQ(prefetcher.getStatistics().misses, size_t{1});
+    EXPECT_EQ(prefetcher.getStatistics().prefetched, size_t{3});
+
+    // the steps behind the accessed one are dropped, the loop wraps around
+    prefetcher.access(7, VolumeSequencePrefetcher::Direction::Backward);
+    EXPECT_EQ(loadedSteps(*sequence), (std::vector<size_t>{4, 5, 6}));
+    EXPECT_EQ(prefetcher.getStatistics().dropped, size_t{3});
+
+    prefetcher.access(6, VolumeSequencePrefetcher::Direction::Backward);
+    EXPECT_EQ(loadedSteps(*sequence), (std::vector<size_t>{3, 4, 5, 6}));
+    EXPECT_EQ(prefetcher.getStatistics().hits, size_t{1});
+}
+
+TEST(VolumeSequencePrefetcher, Budget) {
+    const auto sequence = makeSequence(8);
+    VolumeSequencePrefetcher prefetcher{4, 2 * stepBytes};
+    prefetcher.setSequence(sequence);
+
+    prefetcher.access(2, VolumeSequencePrefetcher::Direction::Forward);
+    EXPECT_EQ(loadedSteps(*sequence), (std::vector<size_t>{3, 4}));
+}
+
+TEST(VolumeSequencePrefetcher, Eviction) {
+    const auto sequence = makeSequence(8);
+    VolumeSequencePrefetcher prefetcher{1, 3 * stepBytes};
+    prefetcher.setSequence(sequence);
+
+    // play the sequence, the accessed step is loaded downstream
+    for (size_t i = 0; i < 6; ++i) {
+        prefetcher.access(i, VolumeSequencePrefetcher::Direction::Forward);
+        (*sequence)[i]->getRepresentation<VolumeRAM>();
+    }
+    // the least recently accessed steps are released to stay within the budget
+    EXPECT_EQ(loadedSteps(*sequence), (std::vector<size_t>{4, 5, 6}));
+
+    // a step referenced downstream is kept
+    auto used = (*sequence)[5];
+    for (size_t i = 6; i < 8; ++i) {
+        prefetcher.access(i, VolumeSequencePrefetcher::Direction::Forward);
+        (*sequence)[i]->getRepresentation<VolumeRAM>();
+    }
+    EXPECT_EQ(loadedSteps(*sequence), (std::vector<size_t>{0, 5, 7}));
+
+    used.reset();
+    prefetcher.access(0, VolumeSequencePrefetcher::Direction::Forward);
+    EXPECT_EQ(loadedSteps(*sequence), (std::vector<size_t>{0, 1, 7}));
+}
+
+}  // namespace inviwo
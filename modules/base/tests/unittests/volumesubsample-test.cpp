@@ -0,0 +1,106 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/algorithm/volume/volumeramsubsample.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<VolumeRAMPrecision<float>> makeRamp(size3_t dims) {
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    util::IndexMapper3D im(dims);
+    auto data = ram->getDataTyped();
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                data[im(x, y, z)] = static_cast<float>(im(x, y, z));
+            }
+        }
+    }
+    return ram;
+}
+
+}  // namespace
+
+TEST(VolumeSubsample, Average) {
+    const size3_t dims{4, 4, 4};
+    auto ram = makeRamp(dims);
+    auto res = util::volumeSubSample(ram.get(), size3_t{2}, util::SubsampleMode::Average);
+    ASSERT_EQ(res->getDimensions(), size3_t(2, 2, 2));
+
+    util::IndexMapper3D im(dims);
+    // average of the 2x2x2 block starting at the origin
+    const double expected = (im(0, 0, 0) + im(1, 0, 0) + im(0, 1, 0) + im(1, 1, 0) +
+                             im(0, 0, 1) + im(1, 0, 1) + im(0, 1, 1) + im(1, 1, 1)) /
+                            8.0;
+    EXPECT_DOUBLE_EQ(res->getAsDouble(size3_t{0}), expected);
+}
+
+TEST(VolumeSubsample, Nearest) {
+    const size3_t dims{9, 6, 3};
+    auto ram = makeRamp(dims);
+    auto res = util::volumeSubSample(ram.get(), size3_t{3}, util::SubsampleMode::Nearest);
+    ASSERT_EQ(res->getDimensions(), size3_t(3, 2, 1));
+
+    util::IndexMapper3D im(dims);
+    EXPECT_DOUBLE_EQ(res->getAsDouble(size3_t(0, 0, 0)), im(1, 1, 1));
+    EXPECT_DOUBLE_EQ(res->getAsDouble(size3_t(2, 1, 0)), im(7, 4, 1));
+}
+
+TEST(VolumeSubsample, Preview) {
+    auto small = std::make_shared<Volume>(makeRamp(size3_t{8}));
+    EXPECT_EQ(util::volumePreview(*small, 64), nullptr);
+
+    auto large = std::make_shared<Volume>(makeRamp(size3_t{32}));
+    large->setBasis(mat3(2.0f));
+    auto preview = util::volumePreview(*large, 64);
+    ASSERT_NE(preview, nullptr);
+    EXPECT_EQ(preview->getDimensions(), size3_t{4});
+    EXPECT_EQ(preview->getModelMatrix(), large->getModelMatrix());
+}
+
+TEST(VolumeSubsample, Stop) {
+    auto ram = makeRamp(size3_t{8});
+    EXPECT_EQ(util::volumeSubSample(ram.get(), size3_t{2}, util::SubsampleMode::Average,
+                                    []() { return true; }),
+              nullptr);
+    EXPECT_NE(util::volumeSubSample(ram.get(), size3_t{2}, util::SubsampleMode::Average,
+                                    []() { return false; }),
+              nullptr);
+}
+
+}  // namespace inviwo
@@ -206,4 +206,15 @@ TEST(VolumeVoronoi, Voronoi_ThreeSeedPoints_PartitionsVolumeInThree) {
     }
 }
 
+TEST(VolumeVoronoi, Voronoi_Stop_ReturnsNull) {
+    const std::vector<std::pair<uint32_t, vec3>> seedPoints = {{1, vec3{1, 1, 1}}};
+    float lastProgress = -1.0f;
+    auto volumeVoronoi = util::voronoiSegmentation(
+        size3_t{3, 3, 3}, /*indexToModelMatrix*/ mat4(1.0f), seedPoints, /*wrapping*/ clamp3D,
+        /*weights*/ std::nullopt, [&](float p) { lastProgress = p; }, []() { return true; });
+
+    EXPECT_EQ(volumeVoronoi, nullptr);
+    EXPECT_LT(lastProgress, 1.0f);
+}
+
 }  // namespace inviwo
@@ -36,6 +36,8 @@
 #include <inviwo/core/datastructures/image/layer.h>
 #include <inviwo/core/datastructures/image/layerram.h>
 
+#include <functional>
+
 namespace inviwo {
 
 class DataFormatBase;
@@ -102,11 +104,20 @@ void* loadTIFFLayerData(void* dst, const std::string& filePath, TIFFHeader heade
                         bool rescaleToDim = false);
 
 /**
- * Load TIFF stack as volume.
+ * Load TIFF stack as volume. The slices are decoded in parallel using the thread pool and written
+ * directly into \p dst, which is allocated if nullptr. Each job decodes a contiguous range of
+ * slices with its own file handle.
+ * @param dst         destination of the volume data, or nullptr
+ * @param filePath    path of the TIFF stack
+ * @param header      header of the TIFF stack, as returned by getTIFFHeader
+ * @param progress    optional callback called with the number of loaded slices and the total
+ *                    number of slices. Calls are serialized but might come from any thread.
  * \see TIFFStackVolumeRAMLoader
  * \see getTIFFHeader
  */
-void* loadTIFFVolumeData(void* dst, const std::string& filePath, TIFFHeader header);
+IVW_MODULE_CIMG_API void* loadTIFFVolumeData(
+    void* dst, const std::string& filePath, TIFFHeader header,
+    const std::function<void(size_t, size_t)>& progress = nullptr);
 
 /**
  * \brief Rescales Layer of given image data
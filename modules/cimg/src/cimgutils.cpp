@@ -32,10 +32,14 @@
 #include <inviwo/core/datastructures/image/layerramprecision.h>
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/io/datawriterexception.h>
 #include <inviwo/core/io/datareaderexception.h>
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 
 #include <inviwo/core/util/glm.h>
 
@@ -436,6 +440,106 @@ struct CImgLoadVolumeDispatcher {
     }
 };
 
+struct CImgAllocateDispatcher {
+    using type = std::unique_ptr<void, void (*)(void*)>;
+    template <typename Result, typename DF>
+    Result operator()(size_t size) {
+        using P = typename DF::primitive;
+        return Result{new P[size * DF::comp], [](void* data) { delete[] static_cast<P*>(data); }};
+    }
+};
+
+#ifdef cimg_use_tiff
+/**
+ * Read the current directory of \p tif into \p dst, flipped along y, if it is stored in strips
+ * with \p comp samples of type P per pixel. Returns false if it is stored in any other way.
+ */
+template <typename P>
+bool readTIFFStrips(TIFF* tif, const std::string& filePath, const TIFFHeader& header,
+                    size_t comp, P* dst) {
+    uint16 bitsPerSample = 8, samplesPerPixel = 1, sampleFormat = SAMPLEFORMAT_UINT;
+    uint16 photometric = PHOTOMETRIC_MINISBLACK, planarConfig = PLANARCONFIG_CONTIG;
+    uint32 width = 0, height = 0;
+    TIFFGetFieldDefaulted(tif, TIFFTAG_BITSPERSAMPLE, &bitsPerSample);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLESPERPIXEL, &samplesPerPixel);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLEFORMAT, &sampleFormat);
+    TIFFGetField(tif, TIFFTAG_PHOTOMETRIC, &photometric);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_PLANARCONFIG, &planarConfig);
+    TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &width);
+    TIFFGetField(tif, TIFFTAG_IMAGELENGTH, &height);
+
+    const uint16 expectedFormat = std::is_floating_point_v<P> ? SAMPLEFORMAT_IEEEFP
+                                  : std::is_signed_v<P>       ? SAMPLEFORMAT_INT
+                                                              : SAMPLEFORMAT_UINT;
+    if (TIFFIsTiled(tif) || photometric >= PHOTOMETRIC_PALETTE ||
+        bitsPerSample != 8 * sizeof(P) || sampleFormat != expectedFormat ||
+        samplesPerPixel != comp || width != header.dimensions.x ||
+        height != header.dimensions.y) {
+        return false;
+    }
+
+    const auto readError = [&]() {
+        return DataReaderException("Error reading " + filePath,
+                                   IVW_CONTEXT_CUSTOM("cimgutil::loadTIFFVolumeData()"));
+    };
+    // Image is up-side-down
+    const size_t rowSize = width * comp;
+    if (planarConfig == PLANARCONFIG_CONTIG) {
+        for (uint32 y = 0; y < height; ++y) {
+            if (TIFFReadScanline(tif, dst + (height - 1 - y) * rowSize, y, 0) < 0) {
+                throw readError();
+            }
+        }
+    } else {
+        std::vector<P> row(width);
+        for (uint16 c = 0; c < samplesPerPixel; ++c) {
+            for (uint32 y = 0; y < height; ++y) {
+                if (TIFFReadScanline(tif, row.data(), y, c) < 0) throw readError();
+                P* out = dst + (height - 1 - y) * rowSize + c;
+                for (uint32 x = 0; x < width; ++x) {
+                    out[x * comp] = row[x];
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Load slice \p z, the current directory of \p tif, into its place in \p dst
+ */
+struct CImgLoadTIFFSliceDispatcher {
+    using type = void;
+    template <typename Result, typename DF>
+    void operator()(void* dst, TIFF* tif, const std::string& filePath, const TIFFHeader& header,
+                    size_t z) {
+        using P = typename DF::primitive;
+        const size_t sliceSize = header.dimensions.x * header.dimensions.y * DF::comp;
+        P* sliceDst = static_cast<P*>(dst) + z * sliceSize;
+        if (readTIFFStrips<P>(tif, filePath, header, DF::comp, sliceDst)) return;
+
+        // Tiled, palette and bilevel images are decoded by CImg, which looks up the directory by
+        // walking all directories before it
+        cimg_library::CImg<P> slice;
+        slice._load_tiff(tif, static_cast<unsigned int>(z), nullptr, nullptr);
+        if (static_cast<size_t>(slice.width()) != header.dimensions.x ||
+            static_cast<size_t>(slice.height()) != header.dimensions.y || slice.depth() != 1 ||
+            static_cast<size_t>(slice.spectrum()) != DF::comp) {
+            throw DataReaderException(
+                "Unexpected dimensions of slice " + std::to_string(z) + " in " + filePath,
+                IVW_CONTEXT);
+        }
+
+        // Image is up-side-down
+        slice.mirror('y');
+        if (slice.spectrum() > 1) {
+            slice.permute_axes("cxyz");
+        }
+        std::copy(slice.begin(), slice.end(), sliceDst);
+    }
+};
+#endif
+
 ////////////////////// CImgUtils ///////////////////////////////////////////////////
 
 void* loadLayerData(void* dst, const std::string& filePath, uvec2& dimensions,
@@ -475,12 +579,70 @@ void* loadTIFFLayerData(void* dst, const std::string& filePath, TIFFHeader heade
                                                                   dims, formatId, rescaleToDim);
 }
 
-void* loadTIFFVolumeData(void* dst, const std::string& filePath, TIFFHeader header) {
-    CImgLoadVolumeDispatcher disp;
-    DataFormatId formatId = header.format->getId();
-    size3_t dims{header.dimensions};
-    return dispatching::dispatch<void*, dispatching::filter::All>(formatId, disp, dst, filePath,
-                                                                  dims, formatId);
+void* loadTIFFVolumeData(void* dst, const std::string& filePath, TIFFHeader header,
+                         const std::function<void(size_t, size_t)>& progress) {
+#ifdef cimg_use_tiff
+    const auto formatId = header.format->getId();
+    const auto depth = header.dimensions.z;
+
+    const auto open = [&]() {
+        TIFF* tif = TIFFOpen(filePath.c_str(), "r");
+        if (!tif) {
+            throw DataReaderException("Error could not open input file: " + filePath,
+                                      IVW_CONTEXT_CUSTOM("cimgutil::loadTIFFVolumeData()"));
+        }
+        return std::unique_ptr<TIFF, void (*)(TIFF*)>{tif, &TIFFClose};
+    };
+
+    // Find the offsets of all directories in one pass, setting the directory by index walks all
+    // directories before it
+    std::vector<uint64> offsets;
+    {
+        const auto tif = open();
+        do {
+            offsets.push_back(TIFFCurrentDirOffset(tif.get()));
+        } while (TIFFReadDirectory(tif.get()));
+    }
+    if (offsets.size() != depth) {
+        throw DataReaderException("Expected " + std::to_string(depth) + " slices in " + filePath +
+                                      ", found " + std::to_string(offsets.size()),
+                                  IVW_CONTEXT_CUSTOM("cimgutil::loadTIFFVolumeData()"));
+    }
+
+    // only owns the data if it is allocated here, until it is returned
+    std::unique_ptr<void, void (*)(void*)> allocated{nullptr, [](void*) {}};
+    if (!dst) {
+        allocated = dispatching::dispatch<std::unique_ptr<void, void (*)(void*)>,
+                                          dispatching::filter::All>(
+            formatId, CImgAllocateDispatcher{}, glm::compMul(header.dimensions));
+        dst = allocated.get();
+    }
+
+    // Each job reads a contiguous range of slices with its own file handle
+    const size_t slicesPerJob = util::rangeCount(depth, 4 * util::parallelForThreads());
+    std::mutex mutex;
+    size_t loaded = 0;
+    util::parallelFor(depth, std::max(slicesPerJob, size_t{1}), [&](size_t begin, size_t end) {
+        const auto tif = open();
+        for (size_t z = begin; z < end; ++z) {
+            if (!TIFFSetSubDirectory(tif.get(), offsets[z])) {
+                throw DataReaderException(
+                    "Error reading slice " + std::to_string(z) + " in " + filePath,
+                    IVW_CONTEXT_CUSTOM("cimgutil::loadTIFFVolumeData()"));
+            }
+            dispatching::dispatch<void, dispatching::filter::All>(
+                formatId, CImgLoadTIFFSliceDispatcher{}, dst, tif.get(), filePath, header, z);
+            if (progress) {
+                std::scoped_lock lock{mutex};
+                progress(++loaded, depth);
+            }
+        }
+    });
+    allocated.release();
+    return dst;
+#else
+    throw Exception("TIFF not available", IVW_CONTEXT_CUSTOM("cimgutil::loadTIFFVolumeData()"));
+#endif
 }
 
 void saveLayer(const std::string& filePath, const Layer* inputLayer) {
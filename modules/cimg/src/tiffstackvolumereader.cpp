@@ -101,11 +101,12 @@ std::shared_ptr<VolumeRepresentation> TIFFStackVolumeRAMLoader::createRepresenta
     cimgutil::TIFFHeader header;
     header.format = src.getDataFormat();
     header.dimensions = src.getDimensions();
-    auto data = cimgutil::loadTIFFVolumeData(nullptr, fileName, header);
 
+    // Let the volume allocate its own memory, the slices are then decoded straight into it
     auto volumeRAM =
-        createVolumeRAM(src.getDimensions(), src.getDataFormat(), data, src.getSwizzleMask(),
+        createVolumeRAM(src.getDimensions(), src.getDataFormat(), nullptr, src.getSwizzleMask(),
                         src.getInterpolation(), src.getWrapping());
+    cimgutil::loadTIFFVolumeData(volumeRAM->getData(), fileName, header);
 
     return volumeRAM;
 }
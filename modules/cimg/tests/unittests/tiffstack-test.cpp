@@ -0,0 +1,147 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <modules/cimg/cimgutils.h>
+#include <modules/cimg/tifflayerreader.h>
+#include <modules/cimg/tiffstackvolumereader.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <tiffio.h>
+#include <warn/pop>
+
+#include <cstring>
+#include <filesystem>
+
+namespace inviwo {
+
+TEST(TIFFStack, matchesLayer) {
+    const auto filename = filesystem::getPath(PathType::Tests, "/images/swirl.tif");
+
+    TIFFLayerReader layerReader;
+    const auto layer = layerReader.readData(filename);
+    const auto layerRAM = layer->getRepresentation<LayerRAM>();
+
+    TIFFStackVolumeReader volumeReader;
+    const auto volume = volumeReader.readData(filename);
+    const auto volumeRAM = volume->getRepresentation<VolumeRAM>();
+
+    ASSERT_EQ(volumeRAM->getDimensions(), size3_t(layerRAM->getDimensions(), 1));
+    ASSERT_EQ(volumeRAM->getDataFormat(), layerRAM->getDataFormat());
+    const auto bytes =
+        glm::compMul(layerRAM->getDimensions()) * layerRAM->getDataFormat()->getSize();
+    EXPECT_EQ(std::memcmp(volumeRAM->getData(), layerRAM->getData(), bytes), 0);
+}
+
+TEST(TIFFStack, progress) {
+    const auto filename = filesystem::getPath(PathType::Tests, "/images/swirl.tif");
+    const auto header = cimgutil::getTIFFHeader(filename);
+
+    std::vector<unsigned char> data(glm::compMul(header.dimensions) * header.format->getSize());
+    size_t calls = 0;
+    size_t last = 0;
+    cimgutil::loadTIFFVolumeData(data.data(), filename, header, [&](size_t loaded, size_t total) {
+        ++calls;
+        last = loaded;
+        EXPECT_EQ(total, header.dimensions.z);
+    });
+    EXPECT_EQ(calls, header.dimensions.z);
+    EXPECT_EQ(last, header.dimensions.z);
+}
+
+TEST(TIFFStack, multiPage) {
+    const auto filename =
+        (std::filesystem::temp_directory_path() / "inviwo-tiffstack-test.tif").string();
+    const uint32 width = 7, height = 5, depth = 6;
+    const uint16 channels = 2;
+    const auto value = [](uint32 x, uint32 y, uint32 z, uint16 c) {
+        return static_cast<uint16>(x + 10 * y + 100 * z + 1000 * c);
+    };
+
+    // alternate between interleaved channels and one plane per channel
+    TIFF* tif = TIFFOpen(filename.c_str(), "w");
+    ASSERT_NE(tif, nullptr);
+    for (uint32 z = 0; z < depth; ++z) {
+        const uint16 config = z % 2 == 0 ? PLANARCONFIG_CONTIG : PLANARCONFIG_SEPARATE;
+        TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, width);
+        TIFFSetField(tif, TIFFTAG_IMAGELENGTH, height);
+        TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, uint16{16});
+        TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, channels);
+        TIFFSetField(tif, TIFFTAG_SAMPLEFORMAT, uint16{SAMPLEFORMAT_UINT});
+        TIFFSetField(tif, TIFFTAG_PHOTOMETRIC, uint16{PHOTOMETRIC_MINISBLACK});
+        TIFFSetField(tif, TIFFTAG_PLANARCONFIG, config);
+        TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, uint32{2});
+        std::vector<uint16> row(width * channels);
+        if (config == PLANARCONFIG_CONTIG) {
+            for (uint32 y = 0; y < height; ++y) {
+                for (uint32 x = 0; x < width; ++x) {
+                    for (uint16 c = 0; c < channels; ++c) row[x * channels + c] = value(x, y, z, c);
+                }
+                ASSERT_GE(TIFFWriteScanline(tif, row.data(), y, 0), 0);
+            }
+        } else {
+            for (uint16 c = 0; c < channels; ++c) {
+                for (uint32 y = 0; y < height; ++y) {
+                    for (uint32 x = 0; x < width; ++x) row[x] = value(x, y, z, c);
+                    ASSERT_GE(TIFFWriteScanline(tif, row.data(), y, c), 0);
+                }
+            }
+        }
+        ASSERT_TRUE(TIFFWriteDirectory(tif));
+    }
+    TIFFClose(tif);
+
+    const auto header = cimgutil::getTIFFHeader(filename);
+    ASSERT_EQ(header.dimensions, size3_t(width, height, depth));
+    ASSERT_EQ(header.format, DataFormat<glm::u16vec2>::get());
+
+    std::vector<glm::u16vec2> data(glm::compMul(header.dimensions));
+    cimgutil::loadTIFFVolumeData(data.data(), filename, header);
+    std::filesystem::remove(filename);
+
+    // the slices are flipped along y
+    for (uint32 z = 0; z < depth; ++z) {
+        for (uint32 y = 0; y < height; ++y) {
+            for (uint32 x = 0; x < width; ++x) {
+                const auto& voxel = data[x + width * (height - 1 - y + height * z)];
+                EXPECT_EQ(voxel.x, value(x, y, z, 0)) << x << ", " << y << ", " << z;
+                EXPECT_EQ(voxel.y, value(x, y, z, 1)) << x << ", " << y << ", " << z;
+            }
+        }
+    }
+}
+
+}  // namespace inviwo
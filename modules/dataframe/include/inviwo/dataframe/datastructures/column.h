@@ -38,10 +38,16 @@
 
 #include <inviwo/dataframe/datastructures/datapoint.h>
 
+#include <charconv>
+#include <cstdlib>
+#include <string_view>
+#include <unordered_map>
+
 namespace inviwo {
 
 class DataPointBase;
 class BufferBase;
+class ColumnBuilder;
 
 class IVW_MODULE_DATAFRAME_API InvalidConversion : public Exception {
 public:
@@ -83,6 +89,13 @@ public:
     virtual std::string getAsString(size_t idx) const = 0;
     virtual std::shared_ptr<DataPointBase> get(size_t idx, bool getStringsAsStrings) const = 0;
 
+    /**
+     * \brief create a builder for bulk appending values to this column. The column must outlive
+     * the builder.
+     * \see ColumnBuilder
+     */
+    virtual std::unique_ptr<ColumnBuilder> createBuilder() = 0;
+
 protected:
     Column() = default;
 };
@@ -164,6 +177,8 @@ public:
 
     virtual size_t getSize() const override;
 
+    virtual std::unique_ptr<ColumnBuilder> createBuilder() override;
+
     auto begin() { return buffer_->getEditableRAMRepresentation()->getDataContainer().begin(); }
     auto end() { return buffer_->getEditableRAMRepresentation()->getDataContainer().end(); }
     auto begin() const { return buffer_->getRAMRepresentation()->getDataContainer().begin(); }
@@ -218,6 +233,8 @@ public:
 
     virtual void add(const std::string& value) override;
 
+    virtual std::unique_ptr<ColumnBuilder> createBuilder() override;
+
     /**
      * \brief \copybrief Column::append(const Column&) and builds a union of all
      * categorical values
@@ -257,6 +274,75 @@ private:
     virtual glm::uint32_t addOrGetID(const std::string& str);
 
     std::vector<std::string> lookUpTable_;
+    std::unordered_map<std::string, std::uint32_t> lookUpIndex_;
+};
+
+/**
+ * \class ColumnBuilder
+ * \brief Collects values for a Column in a plain vector and appends them to the column buffer
+ * in one go when calling commit(). Prefer this over repeated calls to Column::add() when
+ * ingesting many rows, i.e. in readers, since it avoids touching the buffer representation for
+ * every single value. Values which have not been committed are discarded when the builder is
+ * destroyed.
+ *
+ * \see Column::createBuilder()
+ */
+class IVW_MODULE_DATAFRAME_API ColumnBuilder {
+public:
+    virtual ~ColumnBuilder() = default;
+
+    /**
+     * \brief converts \p value to the column type and appends it to the builder
+     * @throws InvalidConversion if the value cannot be converted
+     */
+    virtual void add(std::string_view value) = 0;
+
+    virtual void reserve(size_t size) = 0;
+    /**
+     * \brief number of values added since the last commit
+     */
+    virtual size_t getSize() const = 0;
+    /**
+     * \brief append all values added since the last commit to the column
+     */
+    virtual void commit() = 0;
+
+protected:
+    ColumnBuilder() = default;
+};
+
+template <typename T>
+class TemplateColumnBuilder : public ColumnBuilder {
+public:
+    explicit TemplateColumnBuilder(TemplateColumn<T>& column) : column_{column} {}
+    virtual ~TemplateColumnBuilder() = default;
+
+    void add(const T& value) { data_.push_back(value); }
+    virtual void add(std::string_view value) override;
+
+    virtual void reserve(size_t size) override { data_.reserve(size); }
+    virtual size_t getSize() const override { return data_.size(); }
+    virtual void commit() override;
+
+protected:
+    TemplateColumn<T>& column_;
+    std::vector<T> data_;
+};
+
+/**
+ * \brief Builder for CategoricalColumn, strings are mapped to their category index while adding.
+ */
+class IVW_MODULE_DATAFRAME_API CategoricalColumnBuilder
+    : public TemplateColumnBuilder<std::uint32_t> {
+public:
+    explicit CategoricalColumnBuilder(CategoricalColumn& column);
+    virtual ~CategoricalColumnBuilder() = default;
+
+    virtual void add(std::string_view value) override;
+
+private:
+    CategoricalColumn& categorical_;
+    std::string key_;  // reused for the category lookup to avoid an allocation per value
 };
 
 template <typename T>
@@ -316,45 +402,78 @@ void TemplateColumn<T>::add(const T& value) {
 
 namespace detail {
 
-template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
-void add(Buffer<T>* buffer, const std::string& value) {
-    T result;
-    if (value.empty()) {
-        result = T{0};  // no special value indicating missing data for integral types
-    } else {
-        std::istringstream stream(value);
-        stream >> result;
-        if (stream.fail()) {
-            throw InvalidConversion("cannot convert \"" + value + "\" to target type");
-        }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+constexpr bool floatCharconv = true;
+#else
+constexpr bool floatCharconv = false;
+#endif
+
+// from_chars does neither skip leading whitespace nor accept a leading plus sign
+inline std::string_view trimNumber(std::string_view str) {
+    while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) {
+        str.remove_prefix(1);
     }
-    buffer->getEditableRAMRepresentation()->add(result);
-}
-// Specialization for float and double types, add NaN instead of throwing an error
-template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
-void add(Buffer<T>* buffer, const std::string& value) {
-    T result;
-    std::istringstream stream(value);
-    stream >> result;
-    if (stream.fail()) {
-        buffer->getEditableRAMRepresentation()->add(std::numeric_limits<T>::quiet_NaN());
-    } else {
-        buffer->getEditableRAMRepresentation()->add(result);
+    if (str.size() > 1 && str.front() == '+') {
+        str.remove_prefix(1);
     }
+    return str;
 }
 
-template <typename T,
-          typename std::enable_if<!std::is_integral<T>::value && !std::is_floating_point<T>::value,
-                                  int>::type = 0>
-void add(Buffer<T>* /*buffer*/, const std::string& value) {
-    throw InvalidConversion("conversion to target type not implemented (\"" + value + "\")");
+/**
+ * Converts \p value to T. Empty values are mapped to 0 for integral types, as there is no special
+ * value indicating missing data, and values which cannot be converted to NaN for floating point
+ * types. Trailing characters following a number are ignored.
+ * @throws InvalidConversion if the value cannot be converted to T
+ */
+template <typename T>
+T parseValue(std::string_view value) {
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        const auto str = trimNumber(value);
+        if (str.empty()) return T{0};
+        if (str == "true") return T{1};
+        if (str == "false") return T{0};
+
+        T result{0};
+        if (auto [p, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+            ec != std::errc()) {
+            throw InvalidConversion("cannot convert \"" + std::string{value} +
+                                    "\" to target type");
+        }
+        return result;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        const auto str = trimNumber(value);
+        T result{0};
+        if constexpr (floatCharconv) {
+            if (auto [p, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+                ec != std::errc()) {
+                return std::numeric_limits<T>::quiet_NaN();
+            }
+        } else {
+            const std::string tmp{str};  // strto* require null-terminated strings
+            char* end = nullptr;
+            if constexpr (std::is_same_v<T, float>) {
+                result = std::strtof(tmp.c_str(), &end);
+            } else if constexpr (std::is_same_v<T, double>) {
+                result = std::strtod(tmp.c_str(), &end);
+            } else {
+                result = std::strtold(tmp.c_str(), &end);
+            }
+            if (end == tmp.c_str()) {
+                return std::numeric_limits<T>::quiet_NaN();
+            }
+        }
+        return result;
+    } else {
+        throw InvalidConversion("conversion to target type not implemented (\"" +
+                                std::string{value} + "\")");
+    }
 }
 
 }  // namespace detail
 
 template <typename T>
 void TemplateColumn<T>::add(const std::string& value) {
-    detail::add<T>(buffer_.get(), value);
+    add(detail::parseValue<T>(value));
 }
 
 template <typename T>
@@ -449,4 +568,26 @@ size_t TemplateColumn<T>::getSize() const {
     return buffer_->getSize();
 }
 
+template <typename T>
+std::unique_ptr<ColumnBuilder> TemplateColumn<T>::createBuilder() {
+    return std::make_unique<TemplateColumnBuilder<T>>(*this);
+}
+
+template <typename T>
+void TemplateColumnBuilder<T>::add(std::string_view value) {
+    data_.push_back(detail::parseValue<T>(value));
+}
+
+template <typename T>
+void TemplateColumnBuilder<T>::commit() {
+    auto& container =
+        column_.getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer();
+    if (container.empty()) {
+        container.swap(data_);
+    } else {
+        container.insert(container.end(), data_.begin(), data_.end());
+    }
+    data_.clear();
+}
+
 }  // namespace inviwo
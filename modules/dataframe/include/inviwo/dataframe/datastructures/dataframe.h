@@ -148,7 +148,9 @@ public:
                                                             const std::vector<std::string>& values);
     /**
      * \brief add a new row given a vector of strings.
-     * updateIndexBuffer() needs to be called after the last row has been added.
+     * updateIndexBuffer() needs to be called after the last row has been added. The values are
+     * converted using ColumnBuilders, the row is only added if all values could be converted.
+     * Prefer addRows when adding many rows.
      *
      * @param data  data for each column
      * @throws NoColumns        if the data frame has no columns defined
@@ -157,6 +159,12 @@ public:
      * @throws DataTypeMismatch  if the data type of a column doesn't match with the input data
      */
     void addRow(const std::vector<std::string>& data);
+    /**
+     * \brief add several rows given as vectors of strings, see addRow.
+     * Either all rows are added or, if any row throws, none of them. New categories of
+     * categorical columns might be added in both cases.
+     */
+    void addRows(const std::vector<std::vector<std::string>>& rows);
 
     DataItem getDataItem(size_t index, bool getStringsAsStrings = false) const;
 
@@ -200,6 +208,8 @@ public:
     void updateIndexBuffer();
 
 private:
+    void addRows(const std::vector<std::string>* first, const std::vector<std::string>* last);
+
     std::vector<std::shared_ptr<Column>> columns_;
 };
 
@@ -0,0 +1,121 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+
+#include <inviwo/core/io/datareader.h>
+#include <inviwo/core/io/datawriter.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <iosfwd>
+#include <limits>
+
+namespace inviwo {
+
+/**
+ * \ingroup dataio
+ * \brief Writer for the binary columnar DataFrame format (.ivdf)
+ *
+ * The file starts with a small header followed by a directory holding header, data format,
+ * and byte range of each column. The data of each column is stored contiguously, aligned to
+ * 64 bytes, in native byte order. Categorical columns store their category indices as data
+ * together with the list of categories. The index column of the DataFrame is not stored.
+ * \see BinaryDataFrameReader
+ */
+class IVW_MODULE_DATAFRAME_API BinaryDataFrameWriter : public DataWriterType<DataFrame> {
+public:
+    BinaryDataFrameWriter();
+    BinaryDataFrameWriter(const BinaryDataFrameWriter&) = default;
+    BinaryDataFrameWriter& operator=(const BinaryDataFrameWriter&) = default;
+    virtual BinaryDataFrameWriter* clone() const override;
+    virtual ~BinaryDataFrameWriter() = default;
+
+    virtual void writeData(const DataFrame* data, const std::string filePath) const override;
+    virtual std::unique_ptr<std::vector<unsigned char>> writeDataToBuffer(
+        const DataFrame* data, const std::string& fileExtension) const override;
+
+    void writeData(const DataFrame* data, std::ostream& stream) const;
+};
+
+/**
+ * \ingroup dataio
+ * \brief Reader for the binary columnar DataFrame format (.ivdf)
+ *
+ * The file is memory mapped and only the selected columns and rows are copied into the
+ * column buffers, the remaining parts of the file are never read from disk. The selection is
+ * set either with setColumns() and setRowRange() or with the reader options
+ *   * __Columns__ `std::vector<std::string>` headers of the columns to load, empty for all
+ *   * __RowRange__ `std::pair<size_t, size_t>` rows [first, second) to load
+ *
+ * \see BinaryDataFrameWriter
+ */
+class IVW_MODULE_DATAFRAME_API BinaryDataFrameReader : public DataReaderType<DataFrame> {
+public:
+    BinaryDataFrameReader();
+    BinaryDataFrameReader(const BinaryDataFrameReader&) = default;
+    BinaryDataFrameReader(BinaryDataFrameReader&&) noexcept = default;
+    BinaryDataFrameReader& operator=(const BinaryDataFrameReader&) = default;
+    BinaryDataFrameReader& operator=(BinaryDataFrameReader&&) noexcept = default;
+    virtual BinaryDataFrameReader* clone() const override;
+    virtual ~BinaryDataFrameReader() = default;
+
+    /**
+     * \brief only load columns with matching headers, in the order of the file. An empty list
+     * loads all columns.
+     */
+    void setColumns(std::vector<std::string> columns);
+    const std::vector<std::string>& getColumns() const;
+
+    /**
+     * \brief only load rows [first, last), the range is clamped to the number of rows in the file
+     */
+    void setRowRange(size_t first, size_t last = std::numeric_limits<size_t>::max());
+    std::pair<size_t, size_t> getRowRange() const;
+
+    using DataReaderType<DataFrame>::readData;
+    /**
+     * @throws FileException if the file cannot be opened
+     * @throws DataReaderException if the file is not a valid binary DataFrame or a selected
+     * column does not exist
+     */
+    virtual std::shared_ptr<DataFrame> readData(const std::string& filePath) override;
+
+    virtual bool setOption(std::string_view key, std::any value) override;
+    virtual std::any getOption(std::string_view key) override;
+
+private:
+    std::vector<std::string> columns_;
+    std::pair<size_t, size_t> rowRange_{0, std::numeric_limits<size_t>::max()};
+};
+
+}  // namespace inviwo
@@ -0,0 +1,101 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+
+#include <inviwo/core/io/datawriter.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <iosfwd>
+
+namespace inviwo {
+
+/**
+ * \class CSVWriter
+ * \ingroup dataio
+ *
+ * \brief A writer for comma separated value (CSV) files with customizable delimiter.
+ * Blocks of rows are formatted in parallel on the thread pool and written to the output in order.
+ * Numbers are written with the shortest representation that reads back to the same value.
+ * If compression is enabled, or the file extension is `.gz`, the output is gzip compressed. Each
+ * block is then compressed separately into a gzip member, which gzip readers concatenate.
+ * \see CSVReader
+ */
+class IVW_MODULE_DATAFRAME_API CSVWriter : public DataWriterType<DataFrame> {
+public:
+    CSVWriter();
+    CSVWriter(const CSVWriter&) = default;
+    CSVWriter& operator=(const CSVWriter&) = default;
+    virtual CSVWriter* clone() const override;
+    virtual ~CSVWriter() = default;
+
+    void setDelimiter(const std::string& delimiter);
+    const std::string& getDelimiter() const;
+    /**
+     * \brief enclose categorical values and non-separated vector values in double quotes
+     */
+    void setQuoteStrings(bool quote);
+    bool getQuoteStrings() const;
+    void setExportIndexColumn(bool exportIndex);
+    bool getExportIndexColumn() const;
+    /**
+     * \brief write each component of a vector column into a separate column, the component is
+     * appended to the column header, e.g. "pos X", "pos Y", "pos Z"
+     */
+    void setSeparateVectorTypesIntoColumns(bool separate);
+    bool getSeparateVectorTypesIntoColumns() const;
+    void setCompression(bool compress);
+    bool getCompression() const;
+
+    /**
+     * @throws DataWriterException if the file exists and overwrite is not enabled, if the file
+     * cannot be opened, or if writing fails
+     */
+    virtual void writeData(const DataFrame* data, const std::string filePath) const override;
+    virtual std::unique_ptr<std::vector<unsigned char>> writeDataToBuffer(
+        const DataFrame* data, const std::string& fileExtension) const override;
+
+    /**
+     * \brief write \p data to \p stream, gzip compressed if \p compress is true
+     * @throws DataWriterException if writing fails
+     */
+    void writeData(const DataFrame* data, std::ostream& stream, bool compress) const;
+
+private:
+    std::string delimiter_ = ",";
+    bool quoteStrings_ = true;
+    bool exportIndexCol_ = false;
+    bool separateVectorTypesIntoColumns_ = true;
+    bool compress_ = false;
+};
+
+}  // namespace inviwo
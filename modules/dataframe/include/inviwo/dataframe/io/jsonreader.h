@@ -33,6 +33,8 @@
 #include <inviwo/core/io/datareader.h>
 #include <inviwo/dataframe/datastructures/dataframe.h>
 
+#include <functional>
+
 namespace inviwo {
 
 /**
@@ -76,10 +78,29 @@ public:
      *   {"Col1": val21, "Col2": val22 } ]
      * The example above contains two rows and two columns.
      *
+     * The stream is parsed without building a json object, see JSONDataFrameBuilder.
+     *
      * @param stream    input stream with the json data
      * @return a DataFrame containing the data
+     * @throws JSONConversionException if the stream is not valid JSON
      */
     std::shared_ptr<DataFrame> readData(std::istream& stream) const;
+
+    /**
+     * Set a callback that is called with the fraction of the input read, in [0, 1], while
+     * parsing. The fraction is only known for seekable streams, otherwise the callback is only
+     * called once done.
+     */
+    void setProgressCallback(std::function<void(float)> callback);
+
+    /**
+     * Number of rows used to infer the type of each column, defaults to 1000.
+     */
+    void setTypeInferenceRows(size_t rows);
+
+private:
+    std::function<void(float)> progress_;
+    size_t typeInferenceRows_ = 1000;
 };
 
 }  // namespace inviwo
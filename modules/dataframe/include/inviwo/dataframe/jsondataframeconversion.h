@@ -35,6 +35,13 @@
 
 #include <nlohmann/json.hpp>
 
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 using json = nlohmann::json;
 
 namespace inviwo {
@@ -81,4 +88,95 @@ IVW_MODULE_DATAFRAME_API void to_json(json& j, const DataFrame& df);
  */
 IVW_MODULE_DATAFRAME_API void from_json(const json& j, DataFrame& df);
 
+/**
+ * \class JSONDataFrameBuilder
+ * \brief Builds a DataFrame from a stream of JSON SAX events.
+ *
+ * Expects the same layout as from_json, an array of objects where each object is a row. The
+ * builder keeps the values of the first `sampleRows` rows to infer the type of each column:
+ * columns with any string become categorical, any floating point number gives a float column,
+ * any negative integer an int32 column, otherwise uint32. Integers that do not fit in 32 bits
+ * give a float column. Columns with only booleans are stored as uint8 and columns with only null
+ * values as float. Columns are ordered by header. After the sample, values are converted and
+ * appended directly to the column builders. Missing and null values become NaN in float
+ * columns, 0 in integer columns, and empty strings in categorical columns. Values after the
+ * sample that do not fit the inferred type, like fractions or negative numbers in an uint32
+ * column, are stored as missing values with a warning once per column. Keys that first appear
+ * after the sample are ignored with a warning.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * DataFrame df;
+ * JSONDataFrameBuilder builder(df);
+ * json::sax_parse(stream, &builder);
+ * builder.finish();
+ * \endcode
+ *
+ * @see JSONDataFrameReader
+ */
+class IVW_MODULE_DATAFRAME_API JSONDataFrameBuilder : public nlohmann::json_sax<json> {
+public:
+    /**
+     * @param dataFrame   target DataFrame, the parsed columns are added to it
+     * @param sampleRows  number of rows used to infer the column types
+     * @param progress    called with the number of parsed rows every `progressInterval` rows
+     */
+    explicit JSONDataFrameBuilder(DataFrame& dataFrame, size_t sampleRows = 1000,
+                                  std::function<void(size_t)> progress = nullptr);
+    JSONDataFrameBuilder(const JSONDataFrameBuilder&) = delete;
+    JSONDataFrameBuilder& operator=(const JSONDataFrameBuilder&) = delete;
+    virtual ~JSONDataFrameBuilder();
+
+    virtual bool null() override;
+    virtual bool boolean(bool val) override;
+    virtual bool number_integer(number_integer_t val) override;
+    virtual bool number_unsigned(number_unsigned_t val) override;
+    virtual bool number_float(number_float_t val, const string_t& s) override;
+    virtual bool string(string_t& val) override;
+    virtual bool binary(binary_t& val) override;
+    virtual bool start_object(std::size_t elements) override;
+    virtual bool key(string_t& val) override;
+    virtual bool end_object() override;
+    virtual bool start_array(std::size_t elements) override;
+    virtual bool end_array() override;
+    /**
+     * @throws JSONConversionException with the position and message of the parse error
+     */
+    virtual bool parse_error(std::size_t position, const std::string& last_token,
+                             const nlohmann::detail::exception& ex) override;
+
+    /**
+     * Creates the remaining columns, commits all values and updates the index buffer of the
+     * DataFrame. Call once after the last event.
+     */
+    void finish();
+
+    size_t getNumberOfRows() const;
+
+    static constexpr size_t progressInterval = 4096;
+
+private:
+    struct ColumnState;
+
+    ColumnState* currentColumn();
+    void unsupportedValue(const std::string& type);
+    void endRow();
+    void createColumns();
+
+    DataFrame& dataFrame_;
+    size_t sampleRows_;
+    std::function<void(size_t)> progress_;
+
+    std::vector<ColumnState> columns_;
+    std::unordered_map<std::string, size_t> lookup_;
+    std::unordered_set<std::string> ignored_;
+    bool sampling_ = true;
+
+    std::string key_;
+    size_t expected_ = 0;  // column of the previous key + 1, usually the column of the next key
+    size_t rows_ = 0;
+    int depth_ = 0;
+    int skip_ = 0;
+};
+
 }  // namespace inviwo
@@ -50,10 +50,11 @@ namespace inviwo {
 
 /** \docpage{org.inviwo.DataFrameExporter, DataFrame Exporter}
  * ![](org.inviwo.DataFrameExporter.png?classIdentifier=org.inviwo.DataFrameExporter)
- * This processor exports a DataFrame into a CSV or XML file.
+ * This processor exports a DataFrame into a CSV, gzip compressed CSV, XML, or binary DataFrame
+ * (ivdf) file.
  *
  * ### Inports
- *   * __<Inport>__ source DataFrame which is saved as CSV or XML file
+ *   * __<Inport>__ source DataFrame which is saved as CSV, XML, or binary DataFrame file
  *
  */
 
@@ -71,7 +72,7 @@ protected:
     void exportNow();
 
 private:
-    void exportAsCSV(bool separateVectorTypesIntoColumns = true);
+    void exportAsCSV(bool separateVectorTypesIntoColumns = true, bool compress = false);
     void exportAsXML();
 
     DataInport<DataFrame> dataFrame_;
@@ -85,7 +86,9 @@ private:
     StringProperty delimiter_;
 
     static FileExtension csvExtension_;
+    static FileExtension csvGzExtension_;
     static FileExtension xmlExtension_;
+    static FileExtension binaryExtension_;
 
     bool export_;
 };
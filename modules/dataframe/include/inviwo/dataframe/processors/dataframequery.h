@@ -0,0 +1,86 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
+
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/properties/dataframeproperty.h>
+#include <inviwo/dataframe/util/dataframequery.h>
+
+namespace inviwo {
+
+/** \docpage{org.inviwo.DataFrameQuery, DataFrame Query}
+ * ![](org.inviwo.DataFrameQuery.png?classIdentifier=org.inviwo.DataFrameQuery)
+ * Filters and sorts the rows of a DataFrame and optionally limits the number of rows.
+ *
+ * ### Inports
+ *   * __inport__  source DataFrame
+ *
+ * ### Outports
+ *   * __outport__  DataFrame holding the matching rows in sorted order
+ *
+ * ### Properties
+ *   * __Filter Column__  rows are filtered by the values of this column, if any
+ *   * __Comparison__     comparison between column values and the filter value
+ *   * __Value__          filter value for numerical columns
+ *   * __Category__       filter value for categorical columns (only equal and not equal)
+ *   * __Sort Column__    rows are sorted by this column, if any
+ *   * __Max Rows__       maximum number of rows in the result, 0 means no limit
+ */
+class IVW_MODULE_DATAFRAME_API DataFrameQuery : public Processor {
+public:
+    DataFrameQuery();
+    virtual ~DataFrameQuery() = default;
+
+    virtual void process() override;
+
+    virtual const ProcessorInfo getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+private:
+    DataFrameInport inport_;
+    DataFrameOutport outport_;
+
+    DataFrameColumnProperty filterColumn_;
+    TemplateOptionProperty<dataframe::CompareOp> filterOp_;
+    DoubleProperty filterValue_;
+    StringProperty filterCategory_;
+    DataFrameColumnProperty sortColumn_;
+    BoolProperty ascending_;
+    IntSizeTProperty maxRows_;
+};
+
+}  // namespace inviwo
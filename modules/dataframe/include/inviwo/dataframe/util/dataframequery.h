@@ -0,0 +1,231 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace inviwo {
+
+namespace dataframe {
+
+/**
+ * \brief Bitmap holding one bit per row of a DataFrame, the result of filter operations.
+ * Selections of the same size can be combined with `&`, `|`, and `~`.
+ */
+class IVW_MODULE_DATAFRAME_API RowSelection {
+public:
+    explicit RowSelection(size_t rows = 0, bool selected = false);
+
+    size_t size() const { return size_; }
+    bool test(size_t row) const { return ((words_[row / 64] >> (row % 64)) & 1u) != 0; }
+    void set(size_t row, bool selected = true);
+    /**
+     * \brief number of selected rows
+     */
+    size_t count() const;
+    /**
+     * \brief indices of all selected rows in increasing order
+     */
+    std::vector<std::uint32_t> rows() const;
+
+    /**
+     * @throws Exception if the sizes of the selections differ
+     */
+    RowSelection& operator&=(const RowSelection& rhs);
+    /**
+     * @throws Exception if the sizes of the selections differ
+     */
+    RowSelection& operator|=(const RowSelection& rhs);
+    RowSelection operator~() const;
+
+    /**
+     * \brief the bitmap, bit `i % 64` of word `i / 64` corresponds to row `i`. Bits beyond size()
+     * must be zero.
+     */
+    std::vector<std::uint64_t>& words() { return words_; }
+    const std::vector<std::uint64_t>& words() const { return words_; }
+
+private:
+    void clearPadding();
+
+    size_t size_;
+    std::vector<std::uint64_t> words_;
+};
+
+IVW_MODULE_DATAFRAME_API RowSelection operator&(RowSelection lhs, const RowSelection& rhs);
+IVW_MODULE_DATAFRAME_API RowSelection operator|(RowSelection lhs, const RowSelection& rhs);
+
+enum class CompareOp { Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual };
+
+///@{
+/**
+ * \brief select all rows of column \p col where `col[row] op value` is true. Values are compared
+ * in double precision, i.e. NaN only matches NotEqual. For categorical columns the category indices
+ * are compared, use the overload taking a string to match a category.
+ * The column is processed in chunks on the thread pool.
+ * @throws Exception if the column is not a scalar column
+ */
+IVW_MODULE_DATAFRAME_API RowSelection filter(const Column& col, CompareOp op, double value);
+/**
+ * \brief select all rows of a categorical column which are equal or not equal to category
+ * \p value
+ * @throws Exception if \p op is neither CompareOp::Equal nor CompareOp::NotEqual
+ */
+IVW_MODULE_DATAFRAME_API RowSelection filter(const CategoricalColumn& col, CompareOp op,
+                                             std::string_view value);
+///@}
+
+/**
+ * \brief select all rows of column \p col with \p min <= `col[row]` <= \p max
+ * @throws Exception if the column is not a scalar column
+ */
+IVW_MODULE_DATAFRAME_API RowSelection filterRange(const Column& col, double min, double max);
+
+struct IVW_MODULE_DATAFRAME_API SortKey {
+    std::string column;
+    bool ascending = true;
+};
+
+/**
+ * \brief stable sort of row indices \p rows by the columns given in \p keys, where the first key
+ * is the most significant one. Categorical columns are sorted alphabetically by category and NaN
+ * values are always placed last. Chunks are sorted in parallel on the thread pool and merged.
+ * @return sorted row indices
+ * @throws Exception if a key column does not exist
+ */
+IVW_MODULE_DATAFRAME_API std::vector<std::uint32_t> sortRows(const DataFrame& dataframe,
+                                                             std::vector<std::uint32_t> rows,
+                                                             const std::vector<SortKey>& keys);
+
+enum class Aggregate { Count, Sum, Mean, Min, Max };
+
+struct IVW_MODULE_DATAFRAME_API Aggregation {
+    std::string column;  ///< column to aggregate, ignored for Aggregate::Count
+    Aggregate op = Aggregate::Count;
+    std::string header = {};  ///< header of the result column, defaults to "op(column)"
+};
+
+/**
+ * \brief group the rows \p rows of \p dataframe by the values of the \p keys columns using a hash
+ * table, and compute the \p aggregations for each group. NaN values are ignored by all aggregates
+ * except Count.
+ *
+ * @return DataFrame with one row per group, in order of first appearance, holding the key columns
+ * followed by one column per aggregation. Counts are stored as uint32, all other aggregates as
+ * double.
+ * @throws Exception if a column does not exist, or a categorical column is used for an aggregate
+ * other than Count
+ */
+IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> groupBy(
+    const DataFrame& dataframe, const std::vector<std::uint32_t>& rows,
+    const std::vector<std::string>& keys, const std::vector<Aggregation>& aggregations);
+
+/**
+ * \brief create a new DataFrame holding the rows \p rows of \p dataframe in the given order.
+ * The index column is recreated.
+ * @param dataframe
+ * @param rows       row indices of \p dataframe
+ * @param columns    headers of the columns to include, all columns if empty
+ * @throws Exception if a column does not exist
+ */
+IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> selectRows(
+    const DataFrame& dataframe, const std::vector<std::uint32_t>& rows,
+    const std::vector<std::string>& columns = {});
+
+/**
+ * \class DataFrameView
+ * \brief A list of row indices into a DataFrame. Filtering and sorting a view only modifies the
+ * row indices, the data is not copied until materialize() is called.
+ *
+ * \code{.cpp}
+ * auto result = dataframe::DataFrameView{df}
+ *                   .filter("mass", CompareOp::Greater, 10.0)
+ *                   .filter("type", CompareOp::Equal, "star")
+ *                   .sort({{"mass", false}})
+ *                   .head(100)
+ *                   .materialize();
+ * \endcode
+ */
+class IVW_MODULE_DATAFRAME_API DataFrameView {
+public:
+    explicit DataFrameView(std::shared_ptr<const DataFrame> dataframe);
+    DataFrameView(std::shared_ptr<const DataFrame> dataframe, std::vector<std::uint32_t> rows);
+
+    const std::shared_ptr<const DataFrame>& getDataFrame() const { return dataframe_; }
+    const std::vector<std::uint32_t>& getRows() const { return rows_; }
+    size_t getNumberOfRows() const { return rows_.size(); }
+
+    /**
+     * \brief keep the rows which are selected in \p selection. The selection refers to the rows of
+     * the underlying DataFrame, not the rows of the view.
+     */
+    DataFrameView filter(const RowSelection& selection) const;
+    /**
+     * \copydoc dataframe::filter(const Column&, CompareOp, double)
+     */
+    DataFrameView filter(const std::string& column, CompareOp op, double value) const;
+    /**
+     * \copydoc dataframe::filter(const CategoricalColumn&, CompareOp, std::string_view)
+     */
+    DataFrameView filter(const std::string& column, CompareOp op, std::string_view value) const;
+    DataFrameView filterRange(const std::string& column, double min, double max) const;
+    /**
+     * \copydoc dataframe::sortRows
+     */
+    DataFrameView sort(const std::vector<SortKey>& keys) const;
+    /**
+     * \brief keep the first \p count rows
+     */
+    DataFrameView head(size_t count) const;
+
+    std::shared_ptr<DataFrame> groupBy(const std::vector<std::string>& keys,
+                                       const std::vector<Aggregation>& aggregations) const;
+    /**
+     * \brief copy the rows of the view into a new DataFrame
+     * @param columns    headers of the columns to include, all columns if empty
+     */
+    std::shared_ptr<DataFrame> materialize(const std::vector<std::string>& columns = {}) const;
+
+private:
+    std::shared_ptr<const Column> getColumn(const std::string& column) const;
+
+    std::shared_ptr<const DataFrame> dataframe_;
+    std::vector<std::uint32_t> rows_;
+};
+
+}  // namespace dataframe
+
+}  // namespace inviwo
@@ -31,7 +31,9 @@
 #include <inviwo/dataframe/io/json/dataframepropertyjsonconverter.h>
 #include <inviwo/dataframe/processors/csvsource.h>
 #include <inviwo/dataframe/processors/dataframefloat32converter.h>
+#include <inviwo/dataframe/processors/dataframegroupby.h>
 #include <inviwo/dataframe/processors/dataframejoin.h>
+#include <inviwo/dataframe/processors/dataframequery.h>
 #include <inviwo/dataframe/processors/dataframesource.h>
 #include <inviwo/dataframe/processors/dataframeexporter.h>
 #include <inviwo/dataframe/processors/imagetodataframe.h>
@@ -40,7 +42,9 @@
 #include <inviwo/dataframe/processors/volumesequencetodataframe.h>
 #include <inviwo/dataframe/properties/colormapproperty.h>
 
+#include <inviwo/dataframe/io/binarydataframe.h>
 #include <inviwo/dataframe/io/csvreader.h>
+#include <inviwo/dataframe/io/csvwriter.h>
 #include <inviwo/dataframe/io/jsonreader.h>
 
 #include <inviwo/core/properties/propertyconverter.h>
@@ -54,7 +58,9 @@ DataFrameModule::DataFrameModule(InviwoApplication* app) : InviwoModule(app, "Da
 
     // Processors
     registerProcessor<CSVSource>();
+    registerProcessor<DataFrameGroupBy>();
     registerProcessor<DataFrameJoin>();
+    registerProcessor<DataFrameQuery>();
     registerProcessor<DataFrameSource>();
     registerProcessor<DataFrameExporter>();
     registerProcessor<DataFrameFloat32Converter>();
@@ -71,6 +77,9 @@ DataFrameModule::DataFrameModule(InviwoApplication* app) : InviwoModule(app, "Da
     // Readers and writes
     registerDataReader(std::make_unique<CSVReader>());
     registerDataReader(std::make_unique<JSONDataFrameReader>());
+    registerDataReader(std::make_unique<BinaryDataFrameReader>());
+    registerDataWriter(std::make_unique<BinaryDataFrameWriter>());
+    registerDataWriter(std::make_unique<CSVWriter>());
 
     // Data converters
     registerPropertyConverter(std::make_unique<OptionToStringConverter<DataFrameColumnProperty>>());
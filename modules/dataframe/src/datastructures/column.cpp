@@ -72,43 +72,26 @@ void CategoricalColumn::add(const std::string& value) {
     getTypedBuffer()->getEditableRAMRepresentation()->add(id);
 }
 
-namespace detail {
-
-struct AppendHelper {
-    AppendHelper(CategoricalColumn* col, const std::vector<std::string>& lookupTable) : col{col} {
-        for (auto&& [idx, str] : util::enumerate(lookupTable)) {
-            dict[str] = static_cast<std::uint32_t>(idx);
-        }
-    }
-
-    void append(const std::string& value) {
-        auto it = dict.find(value);
-        if (it != dict.end()) {
-            data.push_back(it->second);
-        } else {
-            auto newIdx = col->addCategory(value);
-            dict[value] = newIdx;
-            data.push_back(newIdx);
-        }
-    }
-
-    CategoricalColumn* col;
-    std::unordered_map<std::string, std::uint32_t> dict;
-    std::vector<std::uint32_t> data;
-};
-
-}  // namespace detail
+std::unique_ptr<ColumnBuilder> CategoricalColumn::createBuilder() {
+    return std::make_unique<CategoricalColumnBuilder>(*this);
+}
 
 void CategoricalColumn::append(const Column& col) {
     if (col.getSize() == 0) return;
 
     if (auto srccol = dynamic_cast<const CategoricalColumn*>(&col)) {
-        detail::AppendHelper helper{this, lookUpTable_};
+        // map each category of the source column only once, on first use
+        constexpr auto unmapped = std::numeric_limits<std::uint32_t>::max();
+        std::vector<std::uint32_t> ids(srccol->lookUpTable_.size(), unmapped);
+        std::vector<std::uint32_t> data;
+        data.reserve(srccol->getSize());
         for (auto idx : srccol->getTypedBuffer()->getRAMRepresentation()->getDataContainer()) {
-            const auto& value = srccol->lookUpTable_[idx];
-            helper.append(value);
+            if (ids[idx] == unmapped) {
+                ids[idx] = addOrGetID(srccol->lookUpTable_[idx]);
+            }
+            data.push_back(ids[idx]);
         }
-        buffer_->getEditableRAMRepresentation()->append(helper.data);
+        buffer_->getEditableRAMRepresentation()->append(data);
     } else {
         throw Exception("data formats of columns do not match", IVW_CONTEXT);
     }
@@ -117,22 +100,27 @@ void CategoricalColumn::append(const Column& col) {
 void CategoricalColumn::append(const std::vector<std::string>& data) {
     if (data.empty()) return;
 
-    detail::AppendHelper helper{this, lookUpTable_};
-    for (auto& value : data) {
-        helper.append(value);
-    }
-    buffer_->getEditableRAMRepresentation()->append(helper.data);
+    auto ids = util::transform(data, [&](const std::string& str) { return addOrGetID(str); });
+    buffer_->getEditableRAMRepresentation()->append(ids);
 }
 
 std::uint32_t CategoricalColumn::addCategory(const std::string& cat) { return addOrGetID(cat); }
 
 glm::uint32_t CategoricalColumn::addOrGetID(const std::string& str) {
-    auto it = std::find(lookUpTable_.begin(), lookUpTable_.end(), str);
-    if (it != lookUpTable_.end()) {
-        return static_cast<glm::uint32_t>(std::distance(lookUpTable_.begin(), it));
+    auto [it, inserted] =
+        lookUpIndex_.try_emplace(str, static_cast<glm::uint32_t>(lookUpTable_.size()));
+    if (inserted) {
+        lookUpTable_.push_back(str);
     }
-    lookUpTable_.push_back(str);
-    return static_cast<glm::uint32_t>(lookUpTable_.size() - 1);
+    return it->second;
+}
+
+CategoricalColumnBuilder::CategoricalColumnBuilder(CategoricalColumn& column)
+    : TemplateColumnBuilder<std::uint32_t>(column), categorical_{column} {}
+
+void CategoricalColumnBuilder::add(std::string_view value) {
+    key_.assign(value.data(), value.size());
+    data_.push_back(categorical_.addCategory(key_));
 }
 
 }  // namespace inviwo
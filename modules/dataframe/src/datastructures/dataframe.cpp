@@ -119,36 +119,54 @@ std::shared_ptr<CategoricalColumn> DataFrame::addCategoricalColumn(
     return col;
 }
 
-void DataFrame::addRow(const std::vector<std::string>& data) {
+void DataFrame::addRow(const std::vector<std::string>& data) { addRows(&data, &data + 1); }
+
+void DataFrame::addRows(const std::vector<std::vector<std::string>>& rows) {
+    addRows(rows.data(), rows.data() + rows.size());
+}
+
+void DataFrame::addRows(const std::vector<std::string>* first,
+                        const std::vector<std::string>* last) {
     if (columns_.size() <= 1) {
         throw NoColumns("DataFrame: DataFrame has no columns", IVW_CONTEXT);
-    } else if (columns_.size() != data.size() + 1) {  // consider index column of DataFrame
-        std::ostringstream oss;
-        oss << "Data does not match column count, DataFrame has " << (columns_.size() - 1)
-            << " columns while input data has " << data.size();
-        oss << ". Input data is : " << joinString(data, " | ");
-        throw InvalidColCount(oss.str(), IVW_CONTEXT);
     }
-    // Try to match up input data with columns.
-    std::vector<size_t> columnIdForDataTypeErrors;
-    for (size_t i = 0; i < data.size(); ++i) {
-        try {
-            columns_[i + 1]->add(data[i]);
-        } catch (InvalidConversion&) {
-            columnIdForDataTypeErrors.push_back(i + 1);
+    // Values are collected in the builders and only committed once all rows are converted,
+    // hence all columns keep the same size if a row throws
+    std::vector<std::unique_ptr<ColumnBuilder>> builders;
+    for (size_t i = 1; i < columns_.size(); ++i) {
+        builders.push_back(columns_[i]->createBuilder());
+        builders.back()->reserve(static_cast<size_t>(last - first));
+    }
+    for (auto data = first; data != last; ++data) {
+        if (columns_.size() != data->size() + 1) {  // consider index column of DataFrame
+            std::ostringstream oss;
+            oss << "Data does not match column count, DataFrame has " << (columns_.size() - 1)
+                << " columns while input data has " << data->size();
+            oss << ". Input data is : " << joinString(*data, " | ");
+            throw InvalidColCount(oss.str(), IVW_CONTEXT);
+        }
+        // Try to match up input data with columns.
+        std::vector<size_t> columnIdForDataTypeErrors;
+        for (size_t i = 0; i < data->size(); ++i) {
+            try {
+                builders[i]->add((*data)[i]);
+            } catch (InvalidConversion&) {
+                columnIdForDataTypeErrors.push_back(i + 1);
+            }
+        }
+        if (!columnIdForDataTypeErrors.empty()) {
+            std::stringstream errStr;
+            errStr << "Data type mismatch for columns: (";
+            auto joiner = util::make_ostream_joiner(errStr, ", ");
+            std::copy(columnIdForDataTypeErrors.begin(), columnIdForDataTypeErrors.end(), joiner);
+            errStr << ") with values: (";
+            std::copy(data->begin(), data->end(), joiner);
+            errStr << "). No rows were added.";
+            throw DataTypeMismatch(errStr.str(), IVW_CONTEXT);
         }
     }
-    if (!columnIdForDataTypeErrors.empty()) {
-        std::stringstream errStr;
-        errStr << "Data type mismatch for columns: (";
-        auto joiner = util::make_ostream_joiner(errStr, ", ");
-        std::copy(columnIdForDataTypeErrors.begin(), columnIdForDataTypeErrors.end(), joiner);
-        errStr << ") with values: (";
-        std::copy(data.begin(), data.end(), joiner);
-        errStr << ")" << std::endl
-               << " DataFrame will be in an invalid state since since all columns must be of equal "
-                  "size.";
-        throw DataTypeMismatch(errStr.str(), IVW_CONTEXT);
+    for (auto& builder : builders) {
+        builder->commit();
     }
 }
 
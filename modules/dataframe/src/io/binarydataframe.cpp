@@ -0,0 +1,393 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/binarydataframe.h>
+
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/mappedfile.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/zip.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::array<char, 8> magic = {'I', 'V', 'W', 'D', 'F', 'B', 'I', 'N'};
+constexpr std::uint32_t formatVersion = 1;
+constexpr size_t columnAlignment = 64;
+// magic, version, column count, row count
+constexpr size_t fileHeaderSize = magic.size() + 2 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+
+enum class ColumnKind : std::uint32_t { Values = 0, Categorical = 1 };
+
+struct ColumnEntry {
+    ColumnKind kind = ColumnKind::Values;
+    DataFormatId format = DataFormatId::NotSpecialized;
+    std::string header;
+    std::uint64_t dataOffset = 0;
+    std::uint64_t dataSize = 0;
+    std::uint64_t categoriesOffset = 0;
+    std::uint64_t categoriesCount = 0;
+    std::uint64_t categoriesSize = 0;
+
+    // kind, format, header length, header, and five offsets/sizes
+    size_t directorySize() const {
+        return 3 * sizeof(std::uint32_t) + header.size() + 5 * sizeof(std::uint64_t);
+    }
+};
+
+size_t alignOffset(size_t offset) {
+    return (offset + columnAlignment - 1) / columnAlignment * columnAlignment;
+}
+
+template <typename T>
+void write(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeString(std::ostream& os, const std::string& str) {
+    write(os, static_cast<std::uint32_t>(str.size()));
+    os.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+// Bounds checked reading from the mapped file
+struct Cursor {
+    template <typename T>
+    T read() {
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    std::string readString() {
+        const auto length = read<std::uint32_t>();
+        require(length);
+        std::string str(reinterpret_cast<const char*>(data + pos), length);
+        pos += length;
+        return str;
+    }
+
+    void require(size_t bytes) const {
+        if (bytes > size - pos) {
+            throw DataReaderException("BinaryDataFrameReader: Unexpected end of file",
+                                      IVW_CONTEXT_CUSTOM("BinaryDataFrameReader"));
+        }
+    }
+
+    const std::byte* data;
+    size_t size;
+    size_t pos;
+};
+
+struct ColumnCreator {
+    template <typename Result, typename Format>
+    Result operator()(const ColumnEntry& entry, const std::byte* data, size_t first, size_t last) {
+        using T = typename Format::type;
+        std::vector<T> values(last - first);
+        std::memcpy(values.data(), data + entry.dataOffset + first * sizeof(T),
+                    values.size() * sizeof(T));
+        return std::make_shared<TemplateColumn<T>>(entry.header, std::move(values));
+    }
+};
+
+}  // namespace
+
+BinaryDataFrameWriter::BinaryDataFrameWriter() : DataWriterType<DataFrame>() {
+    addExtension(FileExtension("ivdf", "Inviwo Binary DataFrame"));
+}
+
+BinaryDataFrameWriter* BinaryDataFrameWriter::clone() const {
+    return new BinaryDataFrameWriter(*this);
+}
+
+void BinaryDataFrameWriter::writeData(const DataFrame* data, const std::string filePath) const {
+    if (filesystem::fileExists(filePath) && !getOverwrite()) {
+        throw DataWriterException("File already exists: " + filePath, IVW_CONTEXT);
+    }
+    auto f = filesystem::ofstream(filePath, std::ios_base::out | std::ios_base::binary);
+    if (!f.is_open()) {
+        throw DataWriterException("Could not open file: " + filePath, IVW_CONTEXT);
+    }
+    writeData(data, f);
+}
+
+std::unique_ptr<std::vector<unsigned char>> BinaryDataFrameWriter::writeDataToBuffer(
+    const DataFrame* data, const std::string& /*fileExtension*/) const {
+    std::stringstream ss(std::ios_base::out | std::ios_base::binary);
+    writeData(data, ss);
+    auto stringdata = ss.str();
+    return std::make_unique<std::vector<unsigned char>>(stringdata.begin(), stringdata.end());
+}
+
+void BinaryDataFrameWriter::writeData(const DataFrame* data, std::ostream& os) const {
+    const auto rows = data->getNumberOfRows();
+
+    // column 0 holds the row indices and is recreated when reading
+    std::vector<ColumnEntry> entries;
+    std::vector<std::shared_ptr<const Column>> columns;
+    for (size_t i = 1; i < data->getNumberOfColumns(); ++i) {
+        auto col = data->getColumn(i);
+        if (col->getSize() != rows) {
+            throw DataWriterException("Column \"" + col->getHeader() + "\" has " +
+                                          std::to_string(col->getSize()) + " rows, expected " +
+                                          std::to_string(rows),
+                                      IVW_CONTEXT);
+        }
+        if (col->getBuffer()->getDataFormat()->getComponents() != 1) {
+            throw DataWriterException("Column \"" + col->getHeader() +
+                                          "\" is not scalar, only scalar columns are supported",
+                                      IVW_CONTEXT);
+        }
+        ColumnEntry entry;
+        entry.header = col->getHeader();
+        entry.format = col->getBuffer()->getDataFormat()->getId();
+        entry.dataSize = rows * col->getBuffer()->getDataFormat()->getSize();
+        if (auto cat = dynamic_cast<const CategoricalColumn*>(col.get())) {
+            entry.kind = ColumnKind::Categorical;
+            entry.categoriesCount = cat->getCategories().size();
+            for (const auto& str : cat->getCategories()) {
+                entry.categoriesSize += sizeof(std::uint32_t) + str.size();
+            }
+        }
+        entries.push_back(std::move(entry));
+        columns.push_back(std::move(col));
+    }
+
+    size_t offset = fileHeaderSize;
+    for (const auto& entry : entries) {
+        offset += entry.directorySize();
+    }
+    for (auto& entry : entries) {
+        entry.dataOffset = alignOffset(offset);
+        entry.categoriesOffset = entry.dataOffset + entry.dataSize;
+        offset = entry.categoriesOffset + entry.categoriesSize;
+    }
+
+    os.write(magic.data(), magic.size());
+    write(os, formatVersion);
+    write(os, static_cast<std::uint32_t>(entries.size()));
+    write(os, static_cast<std::uint64_t>(rows));
+    for (const auto& entry : entries) {
+        write(os, entry.kind);
+        write(os, static_cast<std::uint32_t>(entry.format));
+        writeString(os, entry.header);
+        write(os, entry.dataOffset);
+        write(os, entry.dataSize);
+        write(os, entry.categoriesOffset);
+        write(os, entry.categoriesCount);
+        write(os, entry.categoriesSize);
+    }
+
+    offset = fileHeaderSize;
+    for (const auto& entry : entries) {
+        offset += entry.directorySize();
+    }
+    const std::array<char, columnAlignment> padding{};
+    for (auto&& [entry, col] : util::zip(entries, columns)) {
+        os.write(padding.data(), static_cast<std::streamsize>(entry.dataOffset - offset));
+        os.write(static_cast<const char*>(
+                     col->getBuffer()->getRepresentation<BufferRAM>()->getData()),
+                 static_cast<std::streamsize>(entry.dataSize));
+        if (auto cat = dynamic_cast<const CategoricalColumn*>(col.get())) {
+            for (const auto& str : cat->getCategories()) {
+                writeString(os, str);
+            }
+        }
+        offset = entry.categoriesOffset + entry.categoriesSize;
+    }
+    if (!os.good()) {
+        throw DataWriterException("Error writing DataFrame", IVW_CONTEXT);
+    }
+}
+
+BinaryDataFrameReader::BinaryDataFrameReader() : DataReaderType<DataFrame>() {
+    addExtension(FileExtension("ivdf", "Inviwo Binary DataFrame"));
+}
+
+BinaryDataFrameReader* BinaryDataFrameReader::clone() const {
+    return new BinaryDataFrameReader(*this);
+}
+
+void BinaryDataFrameReader::setColumns(std::vector<std::string> columns) {
+    columns_ = std::move(columns);
+}
+
+const std::vector<std::string>& BinaryDataFrameReader::getColumns() const { return columns_; }
+
+void BinaryDataFrameReader::setRowRange(size_t first, size_t last) { rowRange_ = {first, last}; }
+
+std::pair<size_t, size_t> BinaryDataFrameReader::getRowRange() const { return rowRange_; }
+
+std::shared_ptr<DataFrame> BinaryDataFrameReader::readData(const std::string& filePath) {
+    const util::MappedFile file(filePath);
+
+    auto error = [&](const std::string& message) {
+        return DataReaderException("BinaryDataFrameReader: " + message + " (" + filePath + ")",
+                                   IVW_CONTEXT);
+    };
+
+    Cursor cursor{file.data(), file.size(), 0};
+    if (file.size() < fileHeaderSize ||
+        !std::equal(magic.begin(), magic.end(), reinterpret_cast<const char*>(file.data()))) {
+        throw error("Not a binary DataFrame file");
+    }
+    cursor.pos = magic.size();
+    if (const auto version = cursor.read<std::uint32_t>(); version != formatVersion) {
+        throw error("Unsupported version " + std::to_string(version));
+    }
+    const auto columnCount = cursor.read<std::uint32_t>();
+    const auto rows = static_cast<size_t>(cursor.read<std::uint64_t>());
+
+    std::vector<ColumnEntry> entries(columnCount);
+    for (auto& entry : entries) {
+        entry.kind = cursor.read<ColumnKind>();
+        const auto format = cursor.read<std::uint32_t>();
+        entry.header = cursor.readString();
+        entry.dataOffset = cursor.read<std::uint64_t>();
+        entry.dataSize = cursor.read<std::uint64_t>();
+        entry.categoriesOffset = cursor.read<std::uint64_t>();
+        entry.categoriesCount = cursor.read<std::uint64_t>();
+        entry.categoriesSize = cursor.read<std::uint64_t>();
+
+        if (format == 0 || format >= static_cast<std::uint32_t>(DataFormatId::NumberOfFormats)) {
+            throw error("Invalid data format for column \"" + entry.header + "\"");
+        }
+        entry.format = static_cast<DataFormatId>(format);
+        if (DataFormatBase::get(entry.format)->getComponents() != 1) {
+            throw error("Unsupported data format for column \"" + entry.header + "\"");
+        }
+        if (entry.kind == ColumnKind::Categorical && entry.format != DataFormatId::UInt32) {
+            throw error("Invalid categorical column \"" + entry.header + "\"");
+        }
+        const auto elementSize = DataFormatBase::get(entry.format)->getSize();
+        if (rows > std::numeric_limits<std::uint64_t>::max() / elementSize ||
+            entry.dataSize != rows * elementSize || entry.dataOffset > file.size() ||
+            entry.dataSize > file.size() - entry.dataOffset ||
+            entry.categoriesOffset > file.size() ||
+            entry.categoriesSize > file.size() - entry.categoriesOffset) {
+            throw error("Invalid data range for column \"" + entry.header + "\"");
+        }
+    }
+
+    std::vector<const ColumnEntry*> selected;
+    if (columns_.empty()) {
+        for (const auto& entry : entries) selected.push_back(&entry);
+    } else {
+        for (const auto& name : columns_) {
+            if (std::none_of(entries.begin(), entries.end(),
+                             [&](const ColumnEntry& e) { return e.header == name; })) {
+                throw error("Column \"" + name + "\" not found");
+            }
+        }
+        for (const auto& entry : entries) {
+            if (util::contains(columns_, entry.header)) selected.push_back(&entry);
+        }
+    }
+
+    const auto first = std::min(rowRange_.first, rows);
+    const auto last = std::clamp(rowRange_.second, first, rows);
+
+    for (auto* entry : selected) {
+        const auto elementSize = DataFormatBase::get(entry->format)->getSize();
+        file.willNeed(entry->dataOffset + first * elementSize, (last - first) * elementSize);
+    }
+
+    auto dataframe = std::make_shared<DataFrame>();
+    for (auto* entry : selected) {
+        if (entry->kind == ColumnKind::Categorical) {
+            auto col = dataframe->addCategoricalColumn(entry->header);
+            Cursor categories{file.data(), entry->categoriesOffset + entry->categoriesSize,
+                              entry->categoriesOffset};
+            // Repeated categories in the file are merged, ids map from file to column categories
+            std::vector<std::uint32_t> idMap;
+            for (std::uint64_t i = 0; i < entry->categoriesCount; ++i) {
+                idMap.push_back(col->addCategory(categories.readString()));
+            }
+            auto& ids = col->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer();
+            ids.resize(last - first);
+            std::memcpy(ids.data(),
+                        file.data() + entry->dataOffset + first * sizeof(std::uint32_t),
+                        ids.size() * sizeof(std::uint32_t));
+            for (auto& id : ids) {
+                if (id >= idMap.size()) {
+                    throw error("Invalid category in column \"" + entry->header + "\"");
+                }
+                id = idMap[id];
+            }
+        } else {
+            try {
+                auto col =
+                    dispatching::dispatch<std::shared_ptr<Column>, dispatching::filter::Scalars>(
+                        entry->format, ColumnCreator{}, *entry, file.data(), first, last);
+                dataframe->addColumn(col);
+            } catch (const DispatchException&) {
+                throw error("Unsupported data format " +
+                            std::string{DataFormatBase::get(entry->format)->getString()} +
+                            " for column \"" + entry->header + "\"");
+            }
+        }
+    }
+    dataframe->updateIndexBuffer();
+    return dataframe;
+}
+
+bool BinaryDataFrameReader::setOption(std::string_view key, std::any value) {
+    if (auto* columns = std::any_cast<std::vector<std::string>>(&value);
+        columns && key == "Columns") {
+        setColumns(*columns);
+        return true;
+    } else if (auto* range = std::any_cast<std::pair<size_t, size_t>>(&value);
+               range && key == "RowRange") {
+        setRowRange(range->first, range->second);
+        return true;
+    }
+    return false;
+}
+
+std::any BinaryDataFrameReader::getOption(std::string_view key) {
+    if (key == "Columns") {
+        return getColumns();
+    } else if (key == "RowRange") {
+        return getRowRange();
+    }
+    return std::any{};
+}
+
+}  // namespace inviwo
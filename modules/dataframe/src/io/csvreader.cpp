@@ -241,18 +241,40 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
 
     auto dataFrame = createDataFrame(exampleRows, headers);
 
-    size_t rowIndex = firstRowHeader_ ? 1 : 0;
+    // collect the values of each column separately and fill the column buffers only once all
+    // rows have been parsed, the first column of the DataFrame holds the row indices
+    std::vector<std::unique_ptr<ColumnBuilder>> builders;
+    for (size_t i = 1; i < dataFrame->getNumberOfColumns(); ++i) {
+        builders.push_back(dataFrame->getColumn(i)->createBuilder());
+    }
+
+    size_t rowLine = lineNumber;
     auto row = extractRow(maxColCount);
     while (!row.second) {
         // Do not add empty rows, i.e. rows with only delimiters (,,,,) or newline
         if (std::any_of(std::begin(row.first), std::end(row.first),
                         [](const auto& a) { return !a.empty(); })) {
-            // May throw DataTypeMismatch, but do not catch it here since it indicates
-            // that the DataFrame is in an invalid state
-            dataFrame->addRow(row.first);
+            std::vector<size_t> columnIdForDataTypeErrors;
+            for (size_t i = 0; i < row.first.size(); ++i) {
+                try {
+                    builders[i]->add(row.first[i]);
+                } catch (InvalidConversion&) {
+                    columnIdForDataTypeErrors.push_back(i + 1);
+                }
+            }
+            if (!columnIdForDataTypeErrors.empty()) {
+                throw DataTypeMismatch("Data type mismatch for columns: (" +
+                                           joinString(columnIdForDataTypeErrors, ", ") +
+                                           ") with values: (" + joinString(row.first, ", ") +
+                                           ") in line " + std::to_string(rowLine),
+                                       IVW_CONTEXT);
+            }
         }
+        rowLine = lineNumber;
         row = extractRow(maxColCount);
-        ++rowIndex;
+    }
+    for (auto& builder : builders) {
+        builder->commit();
     }
     dataFrame->updateIndexBuffer();
     return dataFrame;
@@ -0,0 +1,304 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/csvwriter.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/stringconversion.h>
+#include <inviwo/dataframe/datastructures/column.h>
+
+#include <fmt/format.h>
+
+#include <zlib.h>
+
+#include <array>
+#include <charconv>
+#include <deque>
+#include <functional>
+#include <future>
+#include <sstream>
+
+namespace inviwo {
+
+namespace {
+
+// Number of rows formatted (and compressed) as one block
+constexpr size_t rowsPerBlock = 1 << 14;
+
+using CellFormatter = std::function<void(std::string&, size_t)>;
+
+template <typename T>
+void appendNumber(std::string& buf, T value) {
+    if constexpr (std::is_integral_v<T>) {
+        std::array<char, 24> tmp;
+        const auto res = std::to_chars(tmp.data(), tmp.data() + tmp.size(), value);
+        buf.append(tmp.data(), res.ptr);
+    } else if constexpr (std::is_floating_point_v<T> && detail::floatCharconv) {
+        std::array<char, 32> tmp;
+        const auto res = std::to_chars(tmp.data(), tmp.data() + tmp.size(), value);
+        buf.append(tmp.data(), res.ptr);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        fmt::format_to(std::back_inserter(buf), "{}", value);
+    } else {
+        // half precision
+        appendNumber(buf, static_cast<float>(value));
+    }
+}
+
+std::vector<CellFormatter> createFormatters(const DataFrame& dataFrame, bool exportIndexCol,
+                                            bool separateVectorTypes, const std::string& delimiter,
+                                            const std::string& citation) {
+    std::vector<CellFormatter> formatters;
+    for (const auto& col : dataFrame) {
+        if ((col == dataFrame.getIndexColumn()) && !exportIndexCol) {
+            continue;
+        }
+        const auto components = col->getBuffer()->getDataFormat()->getComponents();
+        auto bufferRAM = col->getBuffer()->getRepresentation<BufferRAM>();
+        if (auto cc = dynamic_cast<const CategoricalColumn*>(col.get())) {
+            const auto& categories = cc->getCategories();
+            const auto& indices =
+                static_cast<const BufferRAMPrecision<std::uint32_t>*>(bufferRAM)
+                    ->getDataContainer();
+            formatters.push_back([&categories, &indices, citation](std::string& buf, size_t row) {
+                buf += citation;
+                buf += categories[indices[row]];
+                buf += citation;
+            });
+        } else if (components == 1) {
+            bufferRAM->dispatch<void, dispatching::filter::Scalars>([&](auto br) {
+                formatters.push_back([&data = br->getDataContainer()](std::string& buf,
+                                                                      size_t row) {
+                    appendNumber(buf, data[row]);
+                });
+            });
+        } else if (separateVectorTypes) {
+            bufferRAM->dispatch<void, dispatching::filter::Vecs>([&](auto br) {
+                using ValueType = util::PrecisionValueType<decltype(br)>;
+                formatters.push_back([&data = br->getDataContainer(), delimiter](std::string& buf,
+                                                                                 size_t row) {
+                    for (size_t i = 0; i < util::flat_extent<ValueType>::value; ++i) {
+                        if (i != 0) buf += delimiter;
+                        appendNumber(buf, data[row][i]);
+                    }
+                });
+            });
+        } else {
+            bufferRAM->dispatch<void, dispatching::filter::Vecs>([&](auto br) {
+                formatters.push_back([&data = br->getDataContainer(), citation](std::string& buf,
+                                                                                size_t row) {
+                    thread_local std::ostringstream os;
+                    os.str("");
+                    os << citation << data[row] << citation;
+                    buf += os.str();
+                });
+            });
+        }
+    }
+    return formatters;
+}
+
+std::string createHeader(const DataFrame& dataFrame, bool exportIndexCol, bool separateVectorTypes,
+                         const std::string& delimiter, const std::string& citation) {
+    constexpr std::array<char, 4> componentNames = {'X', 'Y', 'Z', 'W'};
+
+    std::string header;
+    bool first = true;
+    auto append = [&](const std::string& str) {
+        if (!first) header += delimiter;
+        first = false;
+        header += str;
+    };
+    for (const auto& col : dataFrame) {
+        if ((col == dataFrame.getIndexColumn()) && !exportIndexCol) {
+            continue;
+        }
+        const auto components = col->getBuffer()->getDataFormat()->getComponents();
+        if (components > 1 && separateVectorTypes) {
+            for (size_t k = 0; k < components; k++) {
+                append(citation + col->getHeader() + ' ' + componentNames[k] + citation);
+            }
+        } else {
+            append(col->getHeader());
+        }
+    }
+    header += '\n';
+    return header;
+}
+
+std::string formatBlock(const std::vector<CellFormatter>& formatters, const std::string& delimiter,
+                        size_t begin, size_t end) {
+    std::string buf;
+    buf.reserve((end - begin) * formatters.size() * 8);
+    for (size_t row = begin; row < end; ++row) {
+        if (row != 0) buf += '\n';
+        bool first = true;
+        for (const auto& formatter : formatters) {
+            if (!first) buf += delimiter;
+            first = false;
+            formatter(buf, row);
+        }
+    }
+    return buf;
+}
+
+// Compress src into a complete gzip member
+std::string gzipCompress(const std::string& src) {
+    z_stream zs{};
+    if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw DataWriterException("Could not initialize gzip compression",
+                                  IVW_CONTEXT_CUSTOM("CSVWriter"));
+    }
+    std::string dst(deflateBound(&zs, static_cast<uLong>(src.size())), '\0');
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(src.data()));
+    zs.avail_in = static_cast<uInt>(src.size());
+    zs.next_out = reinterpret_cast<Bytef*>(dst.data());
+    zs.avail_out = static_cast<uInt>(dst.size());
+    const auto res = deflate(&zs, Z_FINISH);
+    dst.resize(zs.total_out);
+    deflateEnd(&zs);
+    if (res != Z_STREAM_END) {
+        throw DataWriterException("gzip compression failed", IVW_CONTEXT_CUSTOM("CSVWriter"));
+    }
+    return dst;
+}
+
+void write(std::ostream& os, const std::string& str) {
+    os.write(str.data(), static_cast<std::streamsize>(str.size()));
+    if (!os) {
+        throw DataWriterException("Error writing CSV data", IVW_CONTEXT_CUSTOM("CSVWriter"));
+    }
+}
+
+// Create all blocks on the thread pool, with a bounded number of blocks in flight, and write
+// them to the stream in order
+template <typename CreateBlock>
+void writeBlocks(std::ostream& os, size_t blocks, CreateBlock createBlock) {
+    const size_t poolSize =
+        InviwoApplication::isInitialized() ? InviwoApplication::getPtr()->getPoolSize() : 0;
+    if (blocks <= 1 || poolSize == 0) {
+        for (size_t block = 0; block < blocks; ++block) write(os, createBlock(block));
+        return;
+    }
+
+    const size_t maxInFlight = 2 * poolSize;
+    std::deque<std::future<std::string>> inFlight;
+    try {
+        size_t next = 0;
+        while (next < blocks || !inFlight.empty()) {
+            while (next < blocks && inFlight.size() < maxInFlight) {
+                inFlight.push_back(
+                    dispatchPool([&createBlock, block = next]() { return createBlock(block); }));
+                ++next;
+            }
+            auto str = inFlight.front().get();
+            inFlight.pop_front();
+            write(os, str);
+        }
+    } catch (...) {
+        // the pending jobs reference createBlock, let them finish before unwinding
+        for (auto& f : inFlight) f.wait();
+        throw;
+    }
+}
+
+}  // namespace
+
+CSVWriter::CSVWriter() : DataWriterType<DataFrame>() {
+    addExtension(FileExtension("csv", "Comma separated values"));
+    addExtension(FileExtension("gz", "Comma separated values (gzip compressed)"));
+}
+
+CSVWriter* CSVWriter::clone() const { return new CSVWriter(*this); }
+
+void CSVWriter::setDelimiter(const std::string& delimiter) { delimiter_ = delimiter; }
+const std::string& CSVWriter::getDelimiter() const { return delimiter_; }
+
+void CSVWriter::setQuoteStrings(bool quote) { quoteStrings_ = quote; }
+bool CSVWriter::getQuoteStrings() const { return quoteStrings_; }
+
+void CSVWriter::setExportIndexColumn(bool exportIndex) { exportIndexCol_ = exportIndex; }
+bool CSVWriter::getExportIndexColumn() const { return exportIndexCol_; }
+
+void CSVWriter::setSeparateVectorTypesIntoColumns(bool separate) {
+    separateVectorTypesIntoColumns_ = separate;
+}
+bool CSVWriter::getSeparateVectorTypesIntoColumns() const {
+    return separateVectorTypesIntoColumns_;
+}
+
+void CSVWriter::setCompression(bool compress) { compress_ = compress; }
+bool CSVWriter::getCompression() const { return compress_; }
+
+void CSVWriter::writeData(const DataFrame* data, const std::string filePath) const {
+    if (filesystem::fileExists(filePath) && !getOverwrite()) {
+        throw DataWriterException("File already exists: " + filePath, IVW_CONTEXT);
+    }
+    auto f = filesystem::ofstream(filePath, std::ios_base::out | std::ios_base::binary);
+    if (!f.is_open()) {
+        throw DataWriterException("Could not open file: " + filePath, IVW_CONTEXT);
+    }
+    const bool compress = compress_ || iCaseCmp(filesystem::getFileExtension(filePath), "gz");
+    writeData(data, f, compress);
+}
+
+std::unique_ptr<std::vector<unsigned char>> CSVWriter::writeDataToBuffer(
+    const DataFrame* data, const std::string& fileExtension) const {
+    std::stringstream ss(std::ios_base::out | std::ios_base::binary);
+    writeData(data, ss, compress_ || iCaseCmp(fileExtension, "gz"));
+    auto stringdata = ss.str();
+    return std::make_unique<std::vector<unsigned char>>(stringdata.begin(), stringdata.end());
+}
+
+void CSVWriter::writeData(const DataFrame* data, std::ostream& stream, bool compress) const {
+    const std::string citation = quoteStrings_ ? "\"" : "";
+    const auto formatters = createFormatters(*data, exportIndexCol_,
+                                             separateVectorTypesIntoColumns_, delimiter_, citation);
+    auto header = createHeader(*data, exportIndexCol_, separateVectorTypesIntoColumns_, delimiter_,
+                               citation);
+
+    const auto rows = data->getNumberOfRows();
+    const auto blocks = (rows + rowsPerBlock - 1) / rowsPerBlock;
+    auto createBlock = [&](size_t block) {
+        auto str = formatBlock(formatters, delimiter_, block * rowsPerBlock,
+                               std::min(rows, (block + 1) * rowsPerBlock));
+        return compress ? gzipCompress(str) : str;
+    };
+
+    write(stream, compress ? gzipCompress(header) : header);
+    writeBlocks(stream, blocks, createBlock);
+}
+
+}  // namespace inviwo
@@ -61,12 +61,37 @@ std::shared_ptr<DataFrame> JSONDataFrameReader::readData(const std::string& file
 }
 
 std::shared_ptr<DataFrame> JSONDataFrameReader::readData(std::istream& stream) const {
-    json j;
-    stream >> j;
+    std::function<void(size_t)> progress;
+    if (progress_) {
+        const auto start = stream.tellg();
+        if (start != std::streampos(-1)) {
+            stream.seekg(0, std::ios::end);
+            const auto size = stream.tellg() - start;
+            stream.seekg(start);
+            if (size > 0) {
+                progress = [&, start, size](size_t) {
+                    const auto pos = stream.tellg();
+                    if (pos != std::streampos(-1)) {
+                        progress_(static_cast<float>(pos - start) / static_cast<float>(size));
+                    }
+                };
+            }
+        }
+    }
+
     auto dataFrame = std::make_shared<DataFrame>();
-    *dataFrame = j;
+    JSONDataFrameBuilder builder(*dataFrame, typeInferenceRows_, progress);
+    json::sax_parse(stream, &builder);
+    builder.finish();
+    if (progress_) progress_(1.0f);
 
     return dataFrame;
 }
 
+void JSONDataFrameReader::setProgressCallback(std::function<void(float)> callback) {
+    progress_ = std::move(callback);
+}
+
+void JSONDataFrameReader::setTypeInferenceRows(size_t rows) { typeInferenceRows_ = rows; }
+
 }  // namespace inviwo
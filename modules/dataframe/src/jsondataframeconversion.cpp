@@ -27,146 +27,501 @@
  *
  *********************************************************************************/
 #include <inviwo/dataframe/jsondataframeconversion.h>
-#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
-#include <iterator>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/stdextensions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <string_view>
+#include <variant>
 #include <vector>
 
+#include <fmt/format.h>
+
 namespace inviwo {
 
 JSONConversionException::JSONConversionException(const std::string& message,
                                                  ExceptionContext context)
     : DataReaderException("JSONConversion: " + message, context) {}
 
-namespace detail {
+namespace {
+
+enum class ColumnType { Boolean, Signed, Unsigned, Float, Categorical };
+
+struct RawFloat {
+    double value;
+    std::string raw;  // the number as written in the source, used for categorical columns
+};
+
+using SampleValue =
+    std::variant<std::monostate, bool, std::int64_t, std::uint64_t, RawFloat, std::string>;
 
-// Helper for adding columns based on json item type
-void addDataFrameColumnHelper(json::value_t valueType, std::string header, DataFrame& df) {
-    switch (valueType) {
-        case json::value_t::null:  ///< null value
-            // need to check more rows to know type
+template <typename T>
+TemplateColumnBuilder<T>& typed(ColumnBuilder& builder) {
+    return static_cast<TemplateColumnBuilder<T>&>(builder);
+}
+
+// True if value can be stored in T without changing it
+template <typename T, typename V>
+bool fits(V value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return true;
+    } else if constexpr (std::is_floating_point_v<V>) {
+        return std::trunc(value) == value &&
+               value >= static_cast<V>(std::numeric_limits<T>::lowest()) &&
+               value <= static_cast<V>(std::numeric_limits<T>::max());
+    } else if constexpr (std::is_signed_v<V>) {
+        return value < 0 ? value >= static_cast<std::int64_t>(std::numeric_limits<T>::lowest())
+                         : static_cast<std::uint64_t>(value) <=
+                               static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+    } else {
+        return value <= static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+    }
+}
+
+constexpr std::string_view typeName(ColumnType type) {
+    switch (type) {
+        case ColumnType::Boolean:
+            return "boolean";
+        case ColumnType::Signed:
+            return "int32";
+        case ColumnType::Unsigned:
+            return "uint32";
+        case ColumnType::Float:
+            return "float";
+        case ColumnType::Categorical:
+        default:
+            return "categorical";
+    }
+}
+
+// Feeds a json DOM to the builder as if it was parsed
+void emitEvents(const json& j, JSONDataFrameBuilder& builder) {
+    switch (j.type()) {
+        case json::value_t::null:
+            builder.null();
             break;
-        case json::value_t::object:  ///< object (unordered set of name/value pairs)
-            // Not supported
-            throw JSONConversionException("Object (ordered collection of values) is unsupported");
+        case json::value_t::object: {
+            builder.start_object(j.size());
+            std::string key;
+            for (const auto& item : j.items()) {
+                key = item.key();
+                builder.key(key);
+                emitEvents(item.value(), builder);
+            }
+            builder.end_object();
             break;
-        case json::value_t::array:  ///< array (ordered collection of values)
-            // Not supported
-            throw JSONConversionException("Array (ordered collection of values) is unsupported");
+        }
+        case json::value_t::array:
+            builder.start_array(j.size());
+            for (const auto& item : j) {
+                emitEvents(item, builder);
+            }
+            builder.end_array();
             break;
-        case json::value_t::string:  ///< string value
-            df.addCategoricalColumn(header, 0u);
+        case json::value_t::string: {
+            auto str = j.get<std::string>();
+            builder.string(str);
             break;
-        case json::value_t::boolean:  ///< boolean value
-            // We do not support buffers<bool> (std::vector<bool>)  since they are packed bit
-            // arrays. Use unsigned char instead.
-            // df.addColumn<bool>(header, 0u);
-            df.addColumn<uint8_t>(header, 0u);
+        }
+        case json::value_t::boolean:
+            builder.boolean(j.get<bool>());
             break;
-        case json::value_t::number_integer:  ///< number value (signed integer)
-            df.addColumn<int32_t>(header, 0u);
+        case json::value_t::number_integer:
+            builder.number_integer(j.get<json::number_integer_t>());
             break;
-        case json::value_t::number_unsigned:  ///< number value (unsigned integer)
-            df.addColumn<uint32_t>(header, 0u);
+        case json::value_t::number_unsigned:
+            builder.number_unsigned(j.get<json::number_unsigned_t>());
             break;
-        case json::value_t::number_float:  ///< number value (floating-point)
-            df.addColumn<float>(header, 0u);
+        case json::value_t::number_float:
+            builder.number_float(j.get<json::number_float_t>(), "");
             break;
-        case json::value_t::discarded:  ///< discarded by the the parser callback function
-            throw JSONConversionException(
-                "Value was discarded by the the parser callback function");
+        case json::value_t::binary: {
+            json::binary_t binary = j.get_binary();
+            builder.binary(binary);
             break;
-        case json::value_t::binary:
-            // Not supported
-            throw JSONConversionException("Binary elements is unsupported");
+        }
+        case json::value_t::discarded:
             break;
     }
 }
 
-}  // namespace detail
+}  // namespace
 
-void to_json(json& j, const DataFrame& df) {
-    for (size_t row = 0; row < df.getNumberOfRows(); ++row) {
-        json node = json::object();
-        auto items = df.getDataItem(row, true);
-        // Row 0 in the dataframe contains the row indices, which is not needed in the json object.
-        int i = 1;
-        for (auto col = ++items.begin(); col != items.end(); ++col) {
-            node[df.getHeader(i++)] = (*col)->toString();
+struct JSONDataFrameBuilder::ColumnState {
+    explicit ColumnState(std::string_view name) : header{name} {}
+
+    ColumnType inferType() const {
+        if (hasString) return ColumnType::Categorical;
+        if (hasFloat) return ColumnType::Float;
+        if (hasSigned) {
+            return fits<std::int32_t>(minInteger) && fits<std::int32_t>(maxInteger)
+                       ? ColumnType::Signed
+                       : ColumnType::Float;
         }
-        j.emplace_back(node);
+        if (hasUnsigned) {
+            return fits<std::uint32_t>(maxInteger) ? ColumnType::Unsigned : ColumnType::Float;
+        }
+        if (hasBool) return ColumnType::Boolean;
+        return ColumnType::Float;
     }
-}
 
-void from_json(const json& j, DataFrame& df) {
-    // Extract header and column types
-    if (j.empty() || !j.front().is_object()) {
-        // Only support object types, i.e. [ {key: value} ]
-        return;
-    }
-    // Extract header names from first object
-    const auto& firstRow = j.at(0);
-    for (const auto& col : firstRow.items()) {
-        switch (col.value().type()) {
-            case json::value_t::null: {  ///< null value
-                // need to check more rows to know type
-                for (const auto& row : j) {
-                    auto item = row.find(col.key());
-                    if (item->type() != json::value_t::null) {
-                        try {
-                            detail::addDataFrameColumnHelper(item.value().type(), col.key(), df);
-                        } catch (JSONConversionException& e) {
-                            throw e;
-                        }
-                        // Stop searching when we found a non-null item
-                        break;
-                    }
-                }
+    void createColumn(DataFrame& df) {
+        type = inferType();
+        switch (type) {
+            case ColumnType::Boolean:
+                // std::vector<bool> is a packed bit array, use unsigned char instead
+                builder = df.addColumn<std::uint8_t>(header, 0u)->createBuilder();
                 break;
-            }
-            case json::value_t::object:  ///< object (unordered set of name/value pairs)
-                // Not supported
-                throw JSONConversionException(
-                    "Object (unordered set of name/value pairs) is unsupported");
+            case ColumnType::Signed:
+                builder = df.addColumn<std::int32_t>(header, 0u)->createBuilder();
+                break;
+            case ColumnType::Unsigned:
+                builder = df.addColumn<std::uint32_t>(header, 0u)->createBuilder();
+                break;
+            case ColumnType::Float:
+                builder = df.addColumn<float>(header, 0u)->createBuilder();
+                break;
+            case ColumnType::Categorical:
+                builder = df.addCategoricalColumn(header, 0u)->createBuilder();
+                break;
+        }
+
+        auto values = std::move(sample);
+        sample = {};
+        count = 0;
+        builder->reserve(values.size());
+        for (auto& value : values) {
+            std::visit(util::overloaded{[&](std::monostate) { addNull(); },
+                                        [&](bool arg) { addBool(arg); },
+                                        [&](std::int64_t arg) { addInteger(arg); },
+                                        [&](std::uint64_t arg) { addInteger(arg); },
+                                        [&](const RawFloat& arg) { addFloat(arg.value, arg.raw); },
+                                        [&](const std::string& arg) { addString(arg); }},
+                       value);
+        }
+    }
+
+    template <typename V>
+    void addNumber(V value) {
+        switch (type) {
+            case ColumnType::Boolean:
+                addChecked<std::uint8_t>(value, value == V{0} || value == V{1});
                 break;
-            case json::value_t::array:  ///< array (ordered collection of values)
-                // Not supported
-                throw JSONConversionException(
-                    "Array (ordered collection of values) is unsupported");
+            case ColumnType::Signed:
+                addChecked<std::int32_t>(value, fits<std::int32_t>(value));
                 break;
-            case json::value_t::string:           ///< string value
-            case json::value_t::boolean:          ///< boolean value
-            case json::value_t::number_integer:   ///< number value (signed integer)
-            case json::value_t::number_unsigned:  ///< number value (unsigned integer)
-            case json::value_t::number_float:     ///< number value (floating-point)
-                detail::addDataFrameColumnHelper(col.value().type(), col.key(), df);
+            case ColumnType::Unsigned:
+                addChecked<std::uint32_t>(value, fits<std::uint32_t>(value));
                 break;
-            case json::value_t::discarded:  ///< discarded by the the parser callback function
-                throw JSONConversionException(
-                    "Value was discarded by the the parser callback function");
+            case ColumnType::Float:
+                typed<float>(*builder).add(static_cast<float>(value));
                 break;
-            case json::value_t::binary:
-                // Not supported
-                throw JSONConversionException("Binary elements is unsupported");
+            case ColumnType::Categorical:
                 break;
         }
     }
-    // Extract values of each column
-    for (const auto& row : j) {
-        auto colIdx = 1u;  // 0 column is index column
-        for (const auto& col : row.items()) {
-            if (col.value().type() == json::value_t::object ||
-                col.value().type() == json::value_t::array ||
-                col.value().type() == json::value_t::discarded) {
-                // Skip unsupported types
-                continue;
+
+    // Values that do not fit the inferred type are stored as missing values, i.e. 0
+    template <typename T, typename V>
+    void addChecked(V value, bool valid) {
+        if (valid) {
+            typed<T>(*builder).add(static_cast<T>(value));
+            return;
+        }
+        if (!warnedInvalid) {
+            warnedInvalid = true;
+            LogWarnCustom("JSONDataFrameBuilder",
+                          "Value " << value << " in row " << count << " of column \"" << header
+                                   << "\" does not fit the inferred " << typeName(type)
+                                   << " type. It and later such values are stored as 0.");
+        }
+        typed<T>(*builder).add(T{0});
+    }
+
+    void addNull() {
+        if (!builder) {
+            sample.emplace_back();
+        } else if (type == ColumnType::Categorical) {
+            builder->add(std::string_view{});
+        } else if (type == ColumnType::Float) {
+            addNumber(std::numeric_limits<float>::quiet_NaN());
+        } else {
+            addNumber(0);
+        }
+        ++count;
+    }
+
+    void addBool(bool value) {
+        if (!builder) {
+            hasBool = true;
+            sample.emplace_back(value);
+        } else if (type == ColumnType::Categorical) {
+            builder->add(value ? std::string_view{"true"} : std::string_view{"false"});
+        } else {
+            addNumber(value ? 1 : 0);
+        }
+        ++count;
+    }
+
+    template <typename V>
+    void addInteger(V value) {
+        if (!builder) {
+            if constexpr (std::is_signed_v<V>) {
+                if (value < 0) {
+                    hasSigned = true;
+                    minInteger = std::min<std::int64_t>(minInteger, value);
+                } else {
+                    hasUnsigned = true;
+                    maxInteger = std::max(maxInteger, static_cast<std::uint64_t>(value));
+                }
+            } else {
+                hasUnsigned = true;
+                maxInteger = std::max(maxInteger, static_cast<std::uint64_t>(value));
+            }
+            sample.emplace_back(value);
+        } else if (type == ColumnType::Categorical) {
+            builder->add(fmt::format_int(value).str());
+        } else {
+            addNumber(value);
+        }
+        ++count;
+    }
+
+    void addFloat(double value, std::string_view raw) {
+        if (!builder) {
+            hasFloat = true;
+            sample.emplace_back(RawFloat{value, std::string{raw}});
+        } else if (type == ColumnType::Categorical) {
+            if (raw.empty()) {
+                builder->add(fmt::format("{}", value));
+            } else {
+                builder->add(raw);
+            }
+        } else {
+            addNumber(value);
+        }
+        ++count;
+    }
+
+    void addString(std::string_view value) {
+        if (!builder) {
+            hasString = true;
+            sample.emplace_back(std::string{value});
+            ++count;
+        } else if (type == ColumnType::Categorical) {
+            builder->add(value);
+            ++count;
+        } else {
+            try {
+                builder->add(value);
+                ++count;
+            } catch (const InvalidConversion&) {
+                addNull();
             }
-            std::stringstream ss;
-            ss << col.value();
-            df.getColumn(colIdx++)->add(ss.str());
         }
     }
+
+    std::string header;
+    ColumnType type = ColumnType::Float;
+    bool hasBool = false;
+    bool hasSigned = false;
+    bool hasUnsigned = false;
+    bool hasFloat = false;
+    bool hasString = false;
+    bool warnedInvalid = false;
+    std::int64_t minInteger = 0;   // of the sampled integers
+    std::uint64_t maxInteger = 0;  // of the sampled integers
+    std::vector<SampleValue> sample;          // values of the sampled rows
+    std::unique_ptr<ColumnBuilder> builder;  // created once the type is known
+    size_t count = 0;                        // number of values, including missing ones
+};
+
+JSONDataFrameBuilder::JSONDataFrameBuilder(DataFrame& dataFrame, size_t sampleRows,
+                                           std::function<void(size_t)> progress)
+    : dataFrame_{dataFrame}
+    , sampleRows_{std::max<size_t>(sampleRows, 1)}
+    , progress_{std::move(progress)} {}
+
+JSONDataFrameBuilder::~JSONDataFrameBuilder() = default;
+
+auto JSONDataFrameBuilder::currentColumn() -> ColumnState* {
+    if (skip_ > 0 || depth_ != 2) return nullptr;
+
+    ColumnState* col = nullptr;
+    if (expected_ < columns_.size() && columns_[expected_].header == key_) {
+        col = &columns_[expected_++];
+    } else if (auto it = lookup_.find(key_); it != lookup_.end()) {
+        expected_ = it->second + 1;
+        col = &columns_[it->second];
+    } else if (sampling_) {
+        col = &columns_.emplace_back(key_);
+        col->sample.resize(rows_);
+        col->count = rows_;
+        lookup_.emplace(key_, columns_.size() - 1);
+        expected_ = columns_.size();
+    } else {
+        if (ignored_.insert(key_).second) {
+            LogWarnCustom("JSONDataFrameBuilder",
+                          "Key \"" << key_ << "\" first appears in row " << rows_
+                                   << ", after the rows used to infer the columns. It is ignored.");
+        }
+        return nullptr;
+    }
+    // Keep the first value of duplicated keys
+    return col->count > rows_ ? nullptr : col;
+}
+
+void JSONDataFrameBuilder::unsupportedValue(const std::string& type) {
+    // Nested values are skipped, but without a single row we can not tell if the file is a table
+    if (rows_ == 0) throw JSONConversionException(type + " is unsupported", IVW_CONTEXT);
+}
+
+bool JSONDataFrameBuilder::null() {
+    if (auto col = currentColumn()) col->addNull();
+    return true;
+}
+
+bool JSONDataFrameBuilder::boolean(bool val) {
+    if (auto col = currentColumn()) col->addBool(val);
+    return true;
+}
+
+bool JSONDataFrameBuilder::number_integer(number_integer_t val) {
+    if (auto col = currentColumn()) col->addInteger(val);
+    return true;
+}
+
+bool JSONDataFrameBuilder::number_unsigned(number_unsigned_t val) {
+    if (auto col = currentColumn()) col->addInteger(val);
+    return true;
+}
+
+bool JSONDataFrameBuilder::number_float(number_float_t val, const string_t& s) {
+    if (auto col = currentColumn()) col->addFloat(val, s);
+    return true;
+}
+
+bool JSONDataFrameBuilder::string(string_t& val) {
+    if (auto col = currentColumn()) col->addString(val);
+    return true;
+}
+
+bool JSONDataFrameBuilder::binary(binary_t&) {
+    if (skip_ == 0 && depth_ == 2) unsupportedValue("Binary elements");
+    return true;
+}
+
+bool JSONDataFrameBuilder::start_object(std::size_t) {
+    if (skip_ > 0) {
+        ++skip_;
+    } else if (depth_ == 1) {
+        depth_ = 2;
+        expected_ = 0;
+    } else {
+        // Only support object types, i.e. [ {key: value} ]
+        if (depth_ == 2) unsupportedValue("Object (unordered set of name/value pairs)");
+        ++skip_;
+    }
+    return true;
+}
+
+bool JSONDataFrameBuilder::key(string_t& val) {
+    if (skip_ == 0 && depth_ == 2) key_.assign(val);
+    return true;
+}
+
+bool JSONDataFrameBuilder::end_object() {
+    if (skip_ > 0) {
+        --skip_;
+    } else if (depth_ == 2) {
+        depth_ = 1;
+        endRow();
+    }
+    return true;
+}
+
+bool JSONDataFrameBuilder::start_array(std::size_t) {
+    if (skip_ > 0) {
+        ++skip_;
+    } else if (depth_ == 0) {
+        depth_ = 1;
+    } else {
+        if (depth_ == 2) unsupportedValue("Array (ordered collection of values)");
+        ++skip_;
+    }
+    return true;
+}
+
+bool JSONDataFrameBuilder::end_array() {
+    if (skip_ > 0) {
+        --skip_;
+    } else if (depth_ == 1) {
+        depth_ = 0;
+    }
+    return true;
+}
+
+bool JSONDataFrameBuilder::parse_error(std::size_t position, const std::string&,
+                                       const nlohmann::detail::exception& ex) {
+    throw JSONConversionException(fmt::format("Parse error at byte {}: {}", position, ex.what()),
+                                  IVW_CONTEXT);
+}
+
+void JSONDataFrameBuilder::endRow() {
+    for (auto& col : columns_) {
+        if (col.count == rows_) col.addNull();
+    }
+    ++rows_;
+    if (sampling_ && rows_ >= sampleRows_) createColumns();
+    if (progress_ && rows_ % progressInterval == 0) progress_(rows_);
+}
+
+void JSONDataFrameBuilder::createColumns() {
+    sampling_ = false;
+    // Add the columns ordered by header, but keep columns_ in the order of the keys in the file
+    std::vector<size_t> order(columns_.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::sort(order.begin(), order.end(),
+              [&](size_t a, size_t b) { return columns_[a].header < columns_[b].header; });
+    for (auto i : order) {
+        columns_[i].createColumn(dataFrame_);
+    }
+}
+
+void JSONDataFrameBuilder::finish() {
+    if (sampling_) createColumns();
+    if (columns_.empty()) return;
+
+    for (auto& col : columns_) {
+        col.builder->commit();
+    }
     // Update index buffer when we are done
-    df.updateIndexBuffer();
+    dataFrame_.updateIndexBuffer();
+}
+
+size_t JSONDataFrameBuilder::getNumberOfRows() const { return rows_; }
+
+void to_json(json& j, const DataFrame& df) {
+    for (size_t row = 0; row < df.getNumberOfRows(); ++row) {
+        json node = json::object();
+        auto items = df.getDataItem(row, true);
+        // Row 0 in the dataframe contains the row indices, which is not needed in the json object.
+        int i = 1;
+        for (auto col = ++items.begin(); col != items.end(); ++col) {
+            node[df.getHeader(i++)] = (*col)->toString();
+        }
+        j.emplace_back(node);
+    }
+}
+
+void from_json(const json& j, DataFrame& df) {
+    JSONDataFrameBuilder builder(df);
+    emitEvents(j, builder);
+    builder.finish();
 }
 
 }  // namespace inviwo
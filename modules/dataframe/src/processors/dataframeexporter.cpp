@@ -28,9 +28,10 @@
  *********************************************************************************/
 
 #include <inviwo/dataframe/processors/dataframeexporter.h>
+#include <inviwo/dataframe/io/binarydataframe.h>
+#include <inviwo/dataframe/io/csvwriter.h>
 
 #include <inviwo/core/util/filesystem.h>
-#include <inviwo/core/util/ostreamjoiner.h>
 #include <inviwo/core/util/exception.h>
 #include <inviwo/core/io/serialization/serializer.h>
 
@@ -50,7 +51,10 @@ const ProcessorInfo DataFrameExporter::processorInfo_{
 const ProcessorInfo DataFrameExporter::getProcessorInfo() const { return processorInfo_; }
 
 FileExtension DataFrameExporter::csvExtension_ = FileExtension("csv", "CSV");
+FileExtension DataFrameExporter::csvGzExtension_ = FileExtension("gz", "CSV (gzip compressed)");
 FileExtension DataFrameExporter::xmlExtension_ = FileExtension("xml", "XML");
+FileExtension DataFrameExporter::binaryExtension_ =
+    FileExtension("ivdf", "Inviwo Binary DataFrame");
 
 DataFrameExporter::DataFrameExporter()
     : Processor()
@@ -67,7 +71,9 @@ DataFrameExporter::DataFrameExporter()
 
     exportFile_.clearNameFilters();
     exportFile_.addNameFilter(csvExtension_);
+    exportFile_.addNameFilter(csvGzExtension_);
     exportFile_.addNameFilter(xmlExtension_);
+    exportFile_.addNameFilter(binaryExtension_);
 
     addPort(dataFrame_);
     addProperty(exportFile_);
@@ -80,8 +86,9 @@ DataFrameExporter::DataFrameExporter()
 
     exportFile_.setAcceptMode(AcceptMode::Save);
     exportFile_.onChange([this]() {
-        separateVectorTypesIntoColumns_.setReadOnly(exportFile_.getSelectedExtension().extension_ ==
-                                                    xmlExtension_.extension_);
+        const auto& ext = exportFile_.getSelectedExtension().extension_;
+        separateVectorTypesIntoColumns_.setReadOnly(ext == xmlExtension_.extension_ ||
+                                                    ext == binaryExtension_.extension_);
     });
     exportButton_.onChange([&]() { export_ = true; });
 
@@ -102,6 +109,12 @@ void DataFrameExporter::exportNow() {
         exportAsXML();
     } else if (exportFile_.getSelectedExtension() == csvExtension_) {
         exportAsCSV(separateVectorTypesIntoColumns_);
+    } else if (exportFile_.getSelectedExtension() == csvGzExtension_) {
+        exportAsCSV(separateVectorTypesIntoColumns_, true);
+    } else if (exportFile_.getSelectedExtension() == binaryExtension_) {
+        BinaryDataFrameWriter writer;
+        writer.setOverwrite(overwrite_.get());
+        writer.writeData(dataFrame_.getData().get(), exportFile_.get());
     } else {
         // use CSV format as fallback
         LogWarn("Could not determine export format from extension '"
@@ -111,92 +124,16 @@ void DataFrameExporter::exportNow() {
     }
 }
 
-void DataFrameExporter::exportAsCSV(bool separateVectorTypesIntoColumns) {
-    auto file = filesystem::ofstream(exportFile_);
-    if (!file.is_open()) {
-        throw FileException(fmt::format("could not open file '{}'", exportFile_.get()),
-                            IVW_CONTEXT);
-    }
-
-    auto dataFrame = dataFrame_.getData();
-
-    const std::string delimiter = delimiter_.get();
-    std::string citation = "\"";
-    if (!quoteStrings_.get()) citation = "";
-    const char lineterminator = '\n';
-    const std::array<char, 4> componentNames = {'X', 'Y', 'Z', 'W'};
-
-    // headers
-    auto oj = util::make_ostream_joiner(file, delimiter);
-    for (const auto& col : *dataFrame) {
-        if ((col == dataFrame->getIndexColumn()) && !exportIndexCol_) {
-            continue;
-        }
-        const auto components = col->getBuffer()->getDataFormat()->getComponents();
-        if (components > 1 && separateVectorTypesIntoColumns) {
-            for (size_t k = 0; k < components; k++) {
-                oj = citation + col->getHeader() + ' ' + componentNames[k] + citation;
-            }
-        } else {
-            oj = col->getHeader();
-        }
-    }
-    file << lineterminator;
-
-    std::vector<std::function<void(std::ostream&, size_t)>> printers;
-    for (const auto& col : *dataFrame) {
-        if ((col == dataFrame->getIndexColumn()) && !exportIndexCol_) {
-            continue;
-        }
-        auto df = col->getBuffer()->getDataFormat();
-        if (auto cc = dynamic_cast<const CategoricalColumn*>(col.get())) {
-            printers.push_back([cc, citation](std::ostream& os, size_t index) {
-                os << citation << cc->getAsString(index) << citation;
-            });
-        } else if (df->getComponents() == 1) {
-            col->getBuffer()
-                ->getRepresentation<BufferRAM>()
-                ->dispatch<void, dispatching::filter::Scalars>([&printers](auto br) {
-                    printers.push_back([br](std::ostream& os, size_t index) {
-                        os << br->getDataContainer()[index];
-                    });
-                });
-        } else if (df->getComponents() > 1 && separateVectorTypesIntoColumns) {
-            col->getBuffer()
-                ->getRepresentation<BufferRAM>()
-                ->dispatch<void, dispatching::filter::Vecs>([&printers, delimiter](auto br) {
-                    using ValueType = util::PrecisionValueType<decltype(br)>;
-                    printers.push_back([br, delimiter](std::ostream& os, size_t index) {
-                        auto oj = util::make_ostream_joiner(os, delimiter);
-                        for (size_t i = 0; i < util::flat_extent<ValueType>::value; ++i) {
-                            oj = br->getDataContainer()[index][i];
-                        }
-                    });
-                });
-        } else {
-            col->getBuffer()
-                ->getRepresentation<BufferRAM>()
-                ->dispatch<void, dispatching::filter::Vecs>([&printers, citation](auto br) {
-                    printers.push_back([br, citation](std::ostream& os, size_t index) {
-                        os << citation << br->getDataContainer()[index] << citation;
-                    });
-                });
-        }
-    }
-
-    for (size_t j = 0; j < dataFrame->getNumberOfRows(); j++) {
-        if (j != 0) {
-            file << lineterminator;
-        }
-        bool firstCol = true;
-        for (auto& printer : printers) {
-            if (!firstCol) {
-                file << delimiter;
-            }
-            firstCol = false;
-            printer(file, j);
-        }
-    }
+void DataFrameExporter::exportAsCSV(bool separateVectorTypesIntoColumns, bool compress) {
+    CSVWriter writer;
+    // existing files have already been handled in exportNow()
+    writer.setOverwrite(true);
+    writer.setDelimiter(delimiter_.get());
+    writer.setQuoteStrings(quoteStrings_.get());
+    writer.setExportIndexColumn(exportIndexCol_.get());
+    writer.setSeparateVectorTypesIntoColumns(separateVectorTypesIntoColumns);
+    writer.setCompression(compress);
+    writer.writeData(dataFrame_.getData().get(), exportFile_.get());
 
     LogInfo("CSV file exported to " << exportFile_);
 }
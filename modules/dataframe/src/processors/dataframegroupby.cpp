@@ -0,0 +1,72 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/processors/dataframegroupby.h>
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo DataFrameGroupBy::processorInfo_{
+    "org.inviwo.DataFrameGroupBy",       // Class identifier
+    "DataFrame Group By",                // Display name
+    "DataFrame",                         // Category
+    CodeState::Experimental,             // Code state
+    "CPU, DataFrame, Group, Aggregate",  // Tags
+};
+const ProcessorInfo DataFrameGroupBy::getProcessorInfo() const { return processorInfo_; }
+
+DataFrameGroupBy::DataFrameGroupBy()
+    : Processor()
+    , inport_("inport")
+    , outport_("outport")
+    , key_("key", "Key Column", inport_, false, 1)
+    , aggregate_("aggregate", "Aggregate",
+                 {{"sum", "Sum", dataframe::Aggregate::Sum},
+                  {"mean", "Mean", dataframe::Aggregate::Mean},
+                  {"min", "Min", dataframe::Aggregate::Min},
+                  {"max", "Max", dataframe::Aggregate::Max}},
+                 1)
+    , value_("value", "Value Column", inport_, false, 2) {
+
+    addPort(inport_);
+    addPort(outport_);
+    addProperties(key_, aggregate_, value_);
+}
+
+void DataFrameGroupBy::process() {
+    const auto dataframe = inport_.getData();
+    const auto value = value_.getColumnHeader();
+    const std::vector<dataframe::Aggregation> aggregations = {
+        {value, dataframe::Aggregate::Count, "count"}, {value, aggregate_.get()}};
+
+    outport_.setData(dataframe::DataFrameView{dataframe}.groupBy({key_.getColumnHeader()},
+                                                                 aggregations));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,101 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/processors/dataframequery.h>
+
+#include <inviwo/dataframe/datastructures/column.h>
+
+#include <limits>
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo DataFrameQuery::processorInfo_{
+    "org.inviwo.DataFrameQuery",             // Class identifier
+    "DataFrame Query",                       // Display name
+    "DataFrame",                             // Category
+    CodeState::Experimental,                 // Code state
+    "CPU, DataFrame, Filter, Sort, Select",  // Tags
+};
+const ProcessorInfo DataFrameQuery::getProcessorInfo() const { return processorInfo_; }
+
+DataFrameQuery::DataFrameQuery()
+    : Processor()
+    , inport_("inport")
+    , outport_("outport")
+    , filterColumn_("filterColumn", "Filter Column", inport_, true)
+    , filterOp_("filterOp", "Comparison",
+                {{"equal", "==", dataframe::CompareOp::Equal},
+                 {"notEqual", "!=", dataframe::CompareOp::NotEqual},
+                 {"less", "<", dataframe::CompareOp::Less},
+                 {"lessEqual", "<=", dataframe::CompareOp::LessEqual},
+                 {"greater", ">", dataframe::CompareOp::Greater},
+                 {"greaterEqual", ">=", dataframe::CompareOp::GreaterEqual}},
+                0)
+    , filterValue_("filterValue", "Value", 0.0, std::numeric_limits<double>::lowest(),
+                   std::numeric_limits<double>::max())
+    , filterCategory_("filterCategory", "Category")
+    , sortColumn_("sortColumn", "Sort Column", inport_, true)
+    , ascending_("ascending", "Ascending", true)
+    , maxRows_("maxRows", "Max Rows", 0, 0, std::numeric_limits<size_t>::max()) {
+
+    addPort(inport_);
+    addPort(outport_);
+
+    auto hasFilter = [](const DataFrameColumnProperty& p) { return p.get() != -1; };
+    filterOp_.visibilityDependsOn(filterColumn_, hasFilter);
+    filterValue_.visibilityDependsOn(filterColumn_, hasFilter);
+    filterCategory_.visibilityDependsOn(filterColumn_, hasFilter);
+    ascending_.visibilityDependsOn(sortColumn_,
+                                   [](const DataFrameColumnProperty& p) { return p.get() != -1; });
+
+    addProperties(filterColumn_, filterOp_, filterValue_, filterCategory_, sortColumn_, ascending_,
+                  maxRows_);
+}
+
+void DataFrameQuery::process() {
+    auto view = dataframe::DataFrameView{inport_.getData()};
+
+    if (auto col = filterColumn_.getColumn()) {
+        if (dynamic_cast<const CategoricalColumn*>(col.get())) {
+            view = view.filter(col->getHeader(), filterOp_.get(), filterCategory_.get());
+        } else {
+            view = view.filter(col->getHeader(), filterOp_.get(), filterValue_.get());
+        }
+    }
+    if (auto col = sortColumn_.getColumn()) {
+        view = view.sort({{col->getHeader(), ascending_.get()}});
+    }
+    if (maxRows_.get() > 0) {
+        view = view.head(maxRows_.get());
+    }
+    outport_.setData(view.materialize());
+}
+
+}  // namespace inviwo
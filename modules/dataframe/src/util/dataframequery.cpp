@@ -0,0 +1,594 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/util/dataframequery.h>
+
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/zip.h>
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace inviwo {
+
+namespace dataframe {
+
+namespace {
+
+// Columns are processed in chunks of this many rows, a multiple of the RowSelection word size
+constexpr size_t minChunkSize = 1 << 16;
+
+std::shared_ptr<const Column> findColumn(const DataFrame& dataframe, const std::string& header,
+                                         std::string_view function) {
+    if (auto col = dataframe.getColumn(header)) return col;
+    throw Exception("Column \"" + header + "\" not found",
+                    IVW_CONTEXT_CUSTOM(std::string{"dataframe::"} + std::string{function}));
+}
+
+template <typename Result, typename Callable>
+Result dispatchScalars(const Column& col, Callable&& callable) {
+    return col.getBuffer()
+        ->getRepresentation<BufferRAM>()
+        ->dispatch<Result, dispatching::filter::Scalars>(
+            [&](auto ram) -> Result { return callable(ram->getDataContainer()); });
+}
+
+template <typename T, typename Pred>
+RowSelection selectWhere(const std::vector<T>& data, Pred pred) {
+    RowSelection selection(data.size());
+    auto& words = selection.words();
+    util::parallelFor(data.size(), minChunkSize, [&](size_t begin, size_t end) {
+        for (size_t first = begin; first < end; first += 64) {
+            const auto last = std::min(first + 64, end);
+            std::uint64_t bits = 0;
+            for (size_t i = first; i < last; ++i) {
+                bits |= static_cast<std::uint64_t>(pred(data[i])) << (i - first);
+            }
+            words[first / 64] = bits;
+        }
+    });
+    return selection;
+}
+
+template <typename T>
+RowSelection compare(const std::vector<T>& data, CompareOp op, double value) {
+    auto v = [](const T& x) { return static_cast<double>(x); };
+    switch (op) {
+        case CompareOp::Equal:
+            return selectWhere(data, [&](const T& x) { return v(x) == value; });
+        case CompareOp::NotEqual:
+            return selectWhere(data, [&](const T& x) { return v(x) != value; });
+        case CompareOp::Less:
+            return selectWhere(data, [&](const T& x) { return v(x) < value; });
+        case CompareOp::LessEqual:
+            return selectWhere(data, [&](const T& x) { return v(x) <= value; });
+        case CompareOp::Greater:
+            return selectWhere(data, [&](const T& x) { return v(x) > value; });
+        case CompareOp::GreaterEqual:
+            return selectWhere(data, [&](const T& x) { return v(x) >= value; });
+    }
+    return RowSelection(data.size());
+}
+
+// Strict weak ordering placing NaN last in both directions
+template <typename T>
+bool lessNaNLast(const T& a, const T& b) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(a)) return false;
+        if (std::isnan(b)) return true;
+    }
+    return a < b;
+}
+template <typename T>
+bool greaterNaNLast(const T& a, const T& b) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(a)) return false;
+        if (std::isnan(b)) return true;
+    }
+    return b < a;
+}
+
+// Sort chunks in parallel and merge neighboring chunks pairwise, all steps are stable
+template <typename Comp>
+void parallelStableSort(std::vector<std::uint32_t>& rows, Comp comp) {
+    const auto threads = util::parallelForThreads();
+    const auto jobs = std::min(4 * threads, rows.size() / minChunkSize);
+    if (threads <= 1 || jobs <= 1) {
+        std::stable_sort(rows.begin(), rows.end(), comp);
+        return;
+    }
+    std::vector<size_t> bounds(jobs + 1);
+    for (size_t i = 0; i <= jobs; ++i) bounds[i] = rows.size() * i / jobs;
+
+    const auto it = rows.begin();
+    util::parallelFor(jobs, [&](size_t i) {
+        std::stable_sort(it + bounds[i], it + bounds[i + 1], comp);
+    });
+    for (size_t width = 1; width < jobs; width *= 2) {
+        const auto merges = (jobs + 2 * width - 1) / (2 * width);
+        util::parallelFor(merges, [&](size_t m) {
+            const auto first = 2 * width * m;
+            const auto middle = first + width;
+            if (middle >= jobs) return;
+            const auto last = std::min(first + 2 * width, jobs);
+            std::inplace_merge(it + bounds[first], it + bounds[middle], it + bounds[last], comp);
+        });
+    }
+}
+
+template <typename Key>
+void sortByKey(std::vector<std::uint32_t>& rows, Key key, bool ascending) {
+    if (ascending) {
+        parallelStableSort(rows, [&](std::uint32_t a, std::uint32_t b) {
+            return lessNaNLast(key(a), key(b));
+        });
+    } else {
+        parallelStableSort(rows, [&](std::uint32_t a, std::uint32_t b) {
+            return greaterNaNLast(key(a), key(b));
+        });
+    }
+}
+
+// Map a value to a 64 bit code, equal values give equal codes
+template <typename T>
+std::uint64_t keyCode(const T& value) {
+    if constexpr (std::is_integral_v<T>) {
+        return static_cast<std::uint64_t>(value);
+    } else {
+        auto d = static_cast<double>(value);
+        if (d == 0.0) d = 0.0;  // -0.0 and 0.0 are the same key
+        if (std::isnan(d)) d = std::numeric_limits<double>::quiet_NaN();
+        std::uint64_t code;
+        std::memcpy(&code, &d, sizeof(code));
+        return code;
+    }
+}
+
+// Hash table mapping a tuple of key codes to a group id
+class GroupTable {
+public:
+    explicit GroupTable(size_t keyCount) : keyCount_{keyCount} {}
+
+    std::uint32_t findOrInsert(const std::uint64_t* key) {
+        std::uint64_t hash = 0;
+        for (size_t i = 0; i < keyCount_; ++i) {
+            hash ^= key[i] + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+        }
+        auto [it, inserted] = heads_.try_emplace(hash, none);
+        for (auto group = it->second; group != none; group = next_[group]) {
+            if (std::equal(key, key + keyCount_, keys_.begin() + group * keyCount_)) {
+                return group;
+            }
+        }
+        const auto group = static_cast<std::uint32_t>(next_.size());
+        keys_.insert(keys_.end(), key, key + keyCount_);
+        next_.push_back(it->second);
+        it->second = group;
+        return group;
+    }
+
+    size_t size() const { return next_.size(); }
+
+private:
+    static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+    size_t keyCount_;
+    std::vector<std::uint64_t> keys_;
+    std::vector<std::uint32_t> next_;
+    std::unordered_map<std::uint64_t, std::uint32_t> heads_;
+};
+
+std::string_view toString(Aggregate op) {
+    switch (op) {
+        case Aggregate::Count:
+            return "count";
+        case Aggregate::Sum:
+            return "sum";
+        case Aggregate::Mean:
+            return "mean";
+        case Aggregate::Min:
+            return "min";
+        case Aggregate::Max:
+            return "max";
+    }
+    return "";
+}
+
+std::shared_ptr<Column> gatherColumn(const Column& col, const std::vector<std::uint32_t>& rows) {
+    if (auto cat = dynamic_cast<const CategoricalColumn*>(&col)) {
+        auto result = std::make_shared<CategoricalColumn>(cat->getHeader());
+        for (const auto& category : cat->getCategories()) {
+            result->addCategory(category);
+        }
+        const auto& src = cat->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+        auto& dst = result->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer();
+        dst.resize(rows.size());
+        std::transform(rows.begin(), rows.end(), dst.begin(), [&](auto row) { return src[row]; });
+        return result;
+    }
+    return col.getBuffer()->getRepresentation<BufferRAM>()->dispatch<std::shared_ptr<Column>>(
+        [&](auto ram) -> std::shared_ptr<Column> {
+            using T = util::PrecisionValueType<decltype(ram)>;
+            const auto& src = ram->getDataContainer();
+            std::vector<T> dst(rows.size());
+            std::transform(rows.begin(), rows.end(), dst.begin(),
+                           [&](auto row) { return src[row]; });
+            return std::make_shared<TemplateColumn<T>>(col.getHeader(), std::move(dst));
+        });
+}
+
+std::vector<std::uint32_t> allRows(const DataFrame& dataframe) {
+    std::vector<std::uint32_t> rows(dataframe.getNumberOfRows());
+    std::iota(rows.begin(), rows.end(), 0u);
+    return rows;
+}
+
+}  // namespace
+
+RowSelection::RowSelection(size_t rows, bool selected)
+    : size_{rows}, words_((rows + 63) / 64, selected ? ~std::uint64_t{0} : std::uint64_t{0}) {
+    clearPadding();
+}
+
+void RowSelection::set(size_t row, bool selected) {
+    const auto mask = std::uint64_t{1} << (row % 64);
+    if (selected) {
+        words_[row / 64] |= mask;
+    } else {
+        words_[row / 64] &= ~mask;
+    }
+}
+
+size_t RowSelection::count() const {
+    size_t count = 0;
+    for (auto word : words_) {
+        count += std::bitset<64>(word).count();
+    }
+    return count;
+}
+
+std::vector<std::uint32_t> RowSelection::rows() const {
+    std::vector<std::uint32_t> rows;
+    rows.reserve(count());
+    for (size_t w = 0; w < words_.size(); ++w) {
+        for (auto word = words_[w]; word != 0; word &= word - 1) {
+            // index of the lowest set bit
+            std::uint32_t bit = 0;
+            while (((word >> bit) & 1u) == 0) ++bit;
+            rows.push_back(static_cast<std::uint32_t>(w * 64 + bit));
+        }
+    }
+    return rows;
+}
+
+RowSelection& RowSelection::operator&=(const RowSelection& rhs) {
+    if (size_ != rhs.size_) {
+        throw Exception("Row selections differ in size", IVW_CONTEXT);
+    }
+    for (size_t i = 0; i < words_.size(); ++i) words_[i] &= rhs.words_[i];
+    return *this;
+}
+
+RowSelection& RowSelection::operator|=(const RowSelection& rhs) {
+    if (size_ != rhs.size_) {
+        throw Exception("Row selections differ in size", IVW_CONTEXT);
+    }
+    for (size_t i = 0; i < words_.size(); ++i) words_[i] |= rhs.words_[i];
+    return *this;
+}
+
+RowSelection RowSelection::operator~() const {
+    RowSelection result{*this};
+    for (auto& word : result.words_) word = ~word;
+    result.clearPadding();
+    return result;
+}
+
+void RowSelection::clearPadding() {
+    if (const auto rest = size_ % 64; rest != 0) {
+        words_.back() &= (std::uint64_t{1} << rest) - 1;
+    }
+}
+
+RowSelection operator&(RowSelection lhs, const RowSelection& rhs) {
+    lhs &= rhs;
+    return lhs;
+}
+
+RowSelection operator|(RowSelection lhs, const RowSelection& rhs) {
+    lhs |= rhs;
+    return lhs;
+}
+
+RowSelection filter(const Column& col, CompareOp op, double value) {
+    return dispatchScalars<RowSelection>(
+        col, [&](const auto& data) { return compare(data, op, value); });
+}
+
+RowSelection filter(const CategoricalColumn& col, CompareOp op, std::string_view value) {
+    if (op != CompareOp::Equal && op != CompareOp::NotEqual) {
+        throw Exception("Categorical columns only support Equal and NotEqual",
+                        IVW_CONTEXT_CUSTOM("dataframe::filter"));
+    }
+    const auto& categories = col.getCategories();
+    const auto it = std::find(categories.begin(), categories.end(), value);
+    if (it == categories.end()) {
+        return RowSelection(col.getSize(), op == CompareOp::NotEqual);
+    }
+    const auto id = static_cast<std::uint32_t>(std::distance(categories.begin(), it));
+    const auto& data = col.getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+    if (op == CompareOp::Equal) {
+        return selectWhere(data, [id](std::uint32_t x) { return x == id; });
+    } else {
+        return selectWhere(data, [id](std::uint32_t x) { return x != id; });
+    }
+}
+
+RowSelection filterRange(const Column& col, double min, double max) {
+    return dispatchScalars<RowSelection>(col, [&](const auto& data) {
+        using T = typename std::decay_t<decltype(data)>::value_type;
+        return selectWhere(data, [&](const T& x) {
+            const auto v = static_cast<double>(x);
+            return v >= min && v <= max;
+        });
+    });
+}
+
+std::vector<std::uint32_t> sortRows(const DataFrame& dataframe, std::vector<std::uint32_t> rows,
+                                    const std::vector<SortKey>& keys) {
+    // sorting by the least significant key first keeps the order of the more significant keys
+    // since each pass is stable
+    for (auto key = keys.rbegin(); key != keys.rend(); ++key) {
+        auto col = findColumn(dataframe, key->column, "sortRows");
+        if (auto cat = dynamic_cast<const CategoricalColumn*>(col.get())) {
+            const auto& categories = cat->getCategories();
+            std::vector<std::uint32_t> order(categories.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::sort(order.begin(), order.end(),
+                      [&](auto a, auto b) { return categories[a] < categories[b]; });
+            std::vector<std::uint32_t> rank(categories.size());
+            for (size_t i = 0; i < order.size(); ++i) {
+                rank[order[i]] = static_cast<std::uint32_t>(i);
+            }
+            const auto& ids = cat->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+            sortByKey(
+                rows, [&](std::uint32_t row) { return rank[ids[row]]; }, key->ascending);
+        } else {
+            dispatchScalars<void>(*col, [&](const auto& data) {
+                sortByKey(
+                    rows, [&](std::uint32_t row) { return data[row]; }, key->ascending);
+            });
+        }
+    }
+    return rows;
+}
+
+std::shared_ptr<DataFrame> groupBy(const DataFrame& dataframe,
+                                   const std::vector<std::uint32_t>& rows,
+                                   const std::vector<std::string>& keys,
+                                   const std::vector<Aggregation>& aggregations) {
+    std::vector<std::shared_ptr<const Column>> keyColumns;
+    for (const auto& key : keys) {
+        keyColumns.push_back(findColumn(dataframe, key, "groupBy"));
+    }
+    std::vector<std::shared_ptr<const Column>> aggColumns;
+    for (const auto& agg : aggregations) {
+        if (agg.op == Aggregate::Count) {
+            aggColumns.push_back(nullptr);
+            continue;
+        }
+        auto col = findColumn(dataframe, agg.column, "groupBy");
+        if (dynamic_cast<const CategoricalColumn*>(col.get())) {
+            throw Exception("Categorical column \"" + agg.column + "\" can only be counted",
+                            IVW_CONTEXT_CUSTOM("dataframe::groupBy"));
+        }
+        aggColumns.push_back(std::move(col));
+    }
+
+    // key codes of all rows, row major
+    const auto keyCount = keyColumns.size();
+    std::vector<std::uint64_t> codes(rows.size() * keyCount);
+    util::parallelFor(keyCount, [&](size_t k) {
+        dispatchScalars<void>(*keyColumns[k], [&](const auto& data) {
+            for (size_t i = 0; i < rows.size(); ++i) {
+                codes[i * keyCount + k] = keyCode(data[rows[i]]);
+            }
+        });
+    });
+
+    GroupTable table{keyCount};
+    std::vector<std::uint32_t> groupOfRow(rows.size());
+    std::vector<std::uint32_t> firstRow;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const auto group = table.findOrInsert(codes.data() + i * keyCount);
+        if (group == firstRow.size()) firstRow.push_back(rows[i]);
+        groupOfRow[i] = group;
+    }
+    const auto groups = table.size();
+
+    std::vector<std::uint32_t> counts(groups, 0);
+    for (auto group : groupOfRow) ++counts[group];
+
+    std::vector<std::vector<double>> results(aggregations.size());
+    util::parallelFor(aggregations.size(), [&](size_t a) {
+        const auto op = aggregations[a].op;
+        if (op == Aggregate::Count) return;
+
+        auto& result = results[a];
+        const double init = op == Aggregate::Min   ? std::numeric_limits<double>::infinity()
+                            : op == Aggregate::Max ? -std::numeric_limits<double>::infinity()
+                                                   : 0.0;
+        result.assign(groups, init);
+        std::vector<std::uint32_t> valid(groups, 0);
+        dispatchScalars<void>(*aggColumns[a], [&](const auto& data) {
+            for (size_t i = 0; i < rows.size(); ++i) {
+                const auto v = static_cast<double>(data[rows[i]]);
+                if (std::isnan(v)) continue;
+                const auto group = groupOfRow[i];
+                ++valid[group];
+                switch (op) {
+                    case Aggregate::Sum:
+                    case Aggregate::Mean:
+                        result[group] += v;
+                        break;
+                    case Aggregate::Min:
+                        result[group] = std::min(result[group], v);
+                        break;
+                    case Aggregate::Max:
+                        result[group] = std::max(result[group], v);
+                        break;
+                    case Aggregate::Count:
+                        break;
+                }
+            }
+        });
+        for (size_t group = 0; group < groups; ++group) {
+            if (op == Aggregate::Mean) {
+                result[group] = valid[group] > 0 ? result[group] / valid[group]
+                                                 : std::numeric_limits<double>::quiet_NaN();
+            } else if (valid[group] == 0 && op != Aggregate::Sum) {
+                result[group] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+    });
+
+    auto result = std::make_shared<DataFrame>();
+    for (const auto& col : keyColumns) {
+        result->addColumn(gatherColumn(*col, firstRow));
+    }
+    for (auto&& [agg, values] : util::zip(aggregations, results)) {
+        auto header = agg.header;
+        if (header.empty()) {
+            header = agg.column.empty() && agg.op == Aggregate::Count
+                         ? std::string{toString(agg.op)}
+                         : std::string{toString(agg.op)} + "(" + agg.column + ")";
+        }
+        if (agg.op == Aggregate::Count) {
+            result->addColumn(header, counts);
+        } else {
+            result->addColumn(header, std::move(values));
+        }
+    }
+    result->updateIndexBuffer();
+    return result;
+}
+
+std::shared_ptr<DataFrame> selectRows(const DataFrame& dataframe,
+                                      const std::vector<std::uint32_t>& rows,
+                                      const std::vector<std::string>& columns) {
+    std::vector<std::shared_ptr<const Column>> srcColumns;
+    if (columns.empty()) {
+        // skip the index column, it is recreated
+        for (size_t i = 1; i < dataframe.getNumberOfColumns(); ++i) {
+            srcColumns.push_back(dataframe.getColumn(i));
+        }
+    } else {
+        for (const auto& header : columns) {
+            srcColumns.push_back(findColumn(dataframe, header, "selectRows"));
+        }
+    }
+
+    std::vector<std::shared_ptr<Column>> dstColumns(srcColumns.size());
+    util::parallelFor(srcColumns.size(),
+                      [&](size_t i) { dstColumns[i] = gatherColumn(*srcColumns[i], rows); });
+
+    auto result = std::make_shared<DataFrame>();
+    for (auto& col : dstColumns) {
+        result->addColumn(std::move(col));
+    }
+    result->updateIndexBuffer();
+    return result;
+}
+
+DataFrameView::DataFrameView(std::shared_ptr<const DataFrame> dataframe)
+    : dataframe_{std::move(dataframe)}, rows_{allRows(*dataframe_)} {}
+
+DataFrameView::DataFrameView(std::shared_ptr<const DataFrame> dataframe,
+                             std::vector<std::uint32_t> rows)
+    : dataframe_{std::move(dataframe)}, rows_{std::move(rows)} {}
+
+DataFrameView DataFrameView::filter(const RowSelection& selection) const {
+    std::vector<std::uint32_t> rows;
+    rows.reserve(rows_.size());
+    std::copy_if(rows_.begin(), rows_.end(), std::back_inserter(rows),
+                 [&](auto row) { return row < selection.size() && selection.test(row); });
+    return DataFrameView{dataframe_, std::move(rows)};
+}
+
+DataFrameView DataFrameView::filter(const std::string& column, CompareOp op, double value) const {
+    return filter(dataframe::filter(*getColumn(column), op, value));
+}
+
+DataFrameView DataFrameView::filter(const std::string& column, CompareOp op,
+                                    std::string_view value) const {
+    auto col = getColumn(column);
+    if (auto cat = dynamic_cast<const CategoricalColumn*>(col.get())) {
+        return filter(dataframe::filter(*cat, op, value));
+    }
+    throw Exception("Column \"" + column + "\" is not categorical", IVW_CONTEXT);
+}
+
+DataFrameView DataFrameView::filterRange(const std::string& column, double min, double max) const {
+    return filter(dataframe::filterRange(*getColumn(column), min, max));
+}
+
+DataFrameView DataFrameView::sort(const std::vector<SortKey>& keys) const {
+    return DataFrameView{dataframe_, sortRows(*dataframe_, rows_, keys)};
+}
+
+DataFrameView DataFrameView::head(size_t count) const {
+    const auto last = rows_.begin() + std::min(count, rows_.size());
+    return DataFrameView{dataframe_, std::vector<std::uint32_t>(rows_.begin(), last)};
+}
+
+std::shared_ptr<DataFrame> DataFrameView::groupBy(
+    const std::vector<std::string>& keys, const std::vector<Aggregation>& aggregations) const {
+    return dataframe::groupBy(*dataframe_, rows_, keys, aggregations);
+}
+
+std::shared_ptr<DataFrame> DataFrameView::materialize(
+    const std::vector<std::string>& columns) const {
+    return selectRows(*dataframe_, rows_, columns);
+}
+
+std::shared_ptr<const Column> DataFrameView::getColumn(const std::string& column) const {
+    return findColumn(*dataframe_, column, "DataFrameView");
+}
+
+}  // namespace dataframe
+
+}  // namespace inviwo
@@ -0,0 +1,175 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/io/csvreader.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <sstream>
+
+#include <warn/push>
+#include <warn/ignore/unused-function>
+
+using namespace inviwo;
+
+namespace {
+
+constexpr std::array<const char*, 5> categories = {"setosa", "versicolor", "virginica", "unknown",
+                                                   "hybrid"};
+
+// rows of an int, a float, and a categorical column
+std::vector<std::vector<std::string>> makeRows(size_t count) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> intDist(-100000, 100000);
+    std::uniform_real_distribution<float> floatDist(-1000.0f, 1000.0f);
+    std::uniform_int_distribution<size_t> catDist(0, categories.size() - 1);
+
+    std::vector<std::vector<std::string>> rows;
+    rows.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        rows.push_back({std::to_string(intDist(gen)), std::to_string(floatDist(gen)),
+                        categories[catDist(gen)]});
+    }
+    return rows;
+}
+
+std::string makeCSV(size_t count) {
+    std::ostringstream oss;
+    oss << "int,float,category\n";
+    for (auto& row : makeRows(count)) {
+        oss << row[0] << ',' << row[1] << ',' << row[2] << '\n';
+    }
+    return oss.str();
+}
+
+std::shared_ptr<DataFrame> makeDataFrame() {
+    auto df = std::make_shared<DataFrame>();
+    df->addColumn<int>("int");
+    df->addColumn<float>("float");
+    df->addCategoricalColumn("category");
+    return df;
+}
+
+void setRowRate(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["Rows"] = benchmark::Counter(static_cast<double>(state.range(0)),
+                                                benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+static void AddRow(benchmark::State& state) {
+    const auto rows = makeRows(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto df = makeDataFrame();
+        for (auto& row : rows) {
+            df->addRow(row);
+        }
+        df->updateIndexBuffer();
+        benchmark::DoNotOptimize(df);
+    }
+    setRowRate(state);
+}
+
+static void AddRows(benchmark::State& state) {
+    const auto rows = makeRows(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto df = makeDataFrame();
+        df->addRows(rows);
+        df->updateIndexBuffer();
+        benchmark::DoNotOptimize(df);
+    }
+    setRowRate(state);
+}
+
+static void ColumnBuilders(benchmark::State& state) {
+    const auto rows = makeRows(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto df = makeDataFrame();
+        std::vector<std::unique_ptr<ColumnBuilder>> builders;
+        for (size_t i = 1; i < df->getNumberOfColumns(); ++i) {
+            builders.push_back(df->getColumn(i)->createBuilder());
+            builders.back()->reserve(rows.size());
+        }
+        for (auto& row : rows) {
+            for (size_t i = 0; i < row.size(); ++i) {
+                builders[i]->add(row[i]);
+            }
+        }
+        for (auto& builder : builders) {
+            builder->commit();
+        }
+        df->updateIndexBuffer();
+        benchmark::DoNotOptimize(df);
+    }
+    setRowRate(state);
+}
+
+static void CSVRead(benchmark::State& state) {
+    const auto csv = makeCSV(static_cast<size_t>(state.range(0)));
+    CSVReader reader;
+
+    for (auto _ : state) {
+        std::istringstream in{csv};
+        auto df = reader.readData(in);
+        benchmark::DoNotOptimize(df);
+    }
+    setRowRate(state);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(csv.size()));
+}
+
+BENCHMARK(AddRow)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(AddRows)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(ColumnBuilders)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(CSVRead)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
+
+#include <warn/pop>
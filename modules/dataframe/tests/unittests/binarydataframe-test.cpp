@@ -0,0 +1,169 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/dataframe/io/binarydataframe.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace inviwo {
+
+namespace {
+
+DataFrame makeDataFrame() {
+    DataFrame df;
+    df.addColumn<int>("int", std::vector<int>{1, 2, 3, 4, 5});
+    df.addColumn<double>("double", std::vector<double>{0.5, 1.5, 2.5, 3.5, 4.5});
+    df.addCategoricalColumn("cat", {"a", "b", "a", "c", "b"});
+    df.updateIndexBuffer();
+    return df;
+}
+
+std::vector<unsigned char> toBytes(const DataFrame& df) {
+    BinaryDataFrameWriter writer;
+    return *writer.writeDataToBuffer(&df, "ivdf");
+}
+
+void writeBytes(util::TempFileHandle& file, const std::vector<unsigned char>& bytes) {
+    std::fwrite(bytes.data(), 1, bytes.size(), file.getHandle());
+    std::fflush(file.getHandle());
+}
+
+}  // namespace
+
+TEST(BinaryDataFrame, RoundTrip) {
+    util::TempFileHandle tmpFile("", ".ivdf");
+    const auto df = makeDataFrame();
+
+    BinaryDataFrameWriter writer;
+    writer.setOverwrite(true);
+    writer.writeData(&df, tmpFile.getFileName());
+
+    BinaryDataFrameReader reader;
+    auto result = reader.readData(tmpFile.getFileName());
+
+    ASSERT_EQ(df.getNumberOfColumns(), result->getNumberOfColumns());
+    ASSERT_EQ(df.getNumberOfRows(), result->getNumberOfRows());
+    for (size_t col = 0; col < df.getNumberOfColumns(); ++col) {
+        EXPECT_EQ(df.getHeader(col), result->getHeader(col));
+        EXPECT_EQ(df.getColumn(col)->getBuffer()->getDataFormat(),
+                  result->getColumn(col)->getBuffer()->getDataFormat());
+        for (size_t row = 0; row < df.getNumberOfRows(); ++row) {
+            EXPECT_EQ(df.getColumn(col)->getAsString(row),
+                      result->getColumn(col)->getAsString(row));
+        }
+    }
+    auto cat = std::dynamic_pointer_cast<CategoricalColumn>(result->getColumn("cat"));
+    ASSERT_TRUE(cat);
+    const std::vector<std::string> expected = {"a", "b", "c"};
+    EXPECT_EQ(expected, cat->getCategories());
+}
+
+TEST(BinaryDataFrame, ColumnsAndRows) {
+    util::TempFileHandle tmpFile("", ".ivdf");
+    const auto df = makeDataFrame();
+
+    BinaryDataFrameWriter writer;
+    writer.setOverwrite(true);
+    writer.writeData(&df, tmpFile.getFileName());
+
+    BinaryDataFrameReader reader;
+    EXPECT_TRUE(reader.setOption("Columns", std::vector<std::string>{"cat", "int"}));
+    EXPECT_TRUE(reader.setOption("RowRange", std::pair<size_t, size_t>{1, 3}));
+    auto result = reader.readData(tmpFile.getFileName());
+
+    // index column, int, and cat in file order
+    ASSERT_EQ(3, result->getNumberOfColumns());
+    ASSERT_EQ(2, result->getNumberOfRows());
+    EXPECT_EQ("int", result->getHeader(1));
+    EXPECT_EQ("cat", result->getHeader(2));
+    EXPECT_EQ("2", result->getColumn(1)->getAsString(0));
+    EXPECT_EQ("3", result->getColumn(1)->getAsString(1));
+    EXPECT_EQ("b", result->getColumn(2)->getAsString(0));
+    EXPECT_EQ("a", result->getColumn(2)->getAsString(1));
+
+    reader.setColumns({"missing"});
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+}
+
+TEST(BinaryDataFrame, InvalidFile) {
+    util::TempFileHandle tmpFile("", ".ivdf");
+    std::fputs("not a dataframe", tmpFile.getHandle());
+    std::fflush(tmpFile.getHandle());
+
+    BinaryDataFrameReader reader;
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+}
+
+TEST(BinaryDataFrame, RepeatedCategories) {
+    DataFrame df;
+    df.addCategoricalColumn("cat", {"a", "b", "a", "b"});
+    df.updateIndexBuffer();
+    auto bytes = toBytes(df);
+
+    // The categories are stored last, rename category "b" to "a"
+    ASSERT_EQ('b', bytes.back());
+    bytes.back() = 'a';
+    util::TempFileHandle tmpFile("", ".ivdf");
+    writeBytes(tmpFile, bytes);
+
+    BinaryDataFrameReader reader;
+    auto result = reader.readData(tmpFile.getFileName());
+    auto cat = std::dynamic_pointer_cast<CategoricalColumn>(result->getColumn("cat"));
+    ASSERT_TRUE(cat);
+    EXPECT_EQ(std::vector<std::string>{"a"}, cat->getCategories());
+    const auto& ids = cat->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+    EXPECT_EQ(std::vector<std::uint32_t>(4, 0), ids);
+}
+
+TEST(BinaryDataFrame, RowCountOverflow) {
+    DataFrame df;
+    df.addColumn<int>("int", std::vector<int>{1, 2, 3});
+    df.updateIndexBuffer();
+    auto bytes = toBytes(df);
+
+    // A row count where rows * sizeof(int) wraps around to the stored data size
+    const std::uint64_t rows = 3 + (std::uint64_t{1} << 62);
+    const size_t rowsOffset = 8 + 2 * sizeof(std::uint32_t);
+    std::memcpy(bytes.data() + rowsOffset, &rows, sizeof(rows));
+    util::TempFileHandle tmpFile("", ".ivdf");
+    writeBytes(tmpFile, bytes);
+
+    BinaryDataFrameReader reader;
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+}
+
+}  // namespace inviwo
@@ -42,6 +42,8 @@
 
 #include <fmt/format.h>
 
+#include <cmath>
+
 namespace inviwo {
 
 namespace {
@@ -187,4 +189,50 @@ TEST(ColumnAppend, TypeMismatch) {
     EXPECT_NO_THROW(intCol.append(intCol)) << "Cannot append rows of same column type";
 }
 
+TEST(ColumnBuilder, Integral) {
+    TemplateColumn<int> col("IntCol", std::vector<int>{7});
+    auto builder = col.createBuilder();
+    builder->add("1");
+    builder->add(" -2");
+    builder->add("+3");
+    builder->add("");
+    EXPECT_THROW(builder->add("abc"), InvalidConversion);
+
+    EXPECT_EQ(4, builder->getSize());
+    EXPECT_EQ(1, col.getSize()) << "Column changed before commit";
+
+    builder->commit();
+    EXPECT_EQ(0, builder->getSize());
+    const std::vector<int> expected = {7, 1, -2, 3, 0};
+    EXPECT_EQ(expected, col.getTypedBuffer()->getRAMRepresentation()->getDataContainer());
+}
+
+TEST(ColumnBuilder, FloatingPoint) {
+    TemplateColumn<double> col("DoubleCol");
+    auto builder = col.createBuilder();
+    builder->add("0.5");
+    builder->add("-1e3");
+    builder->add("invalid");
+    builder->commit();
+
+    ASSERT_EQ(3, col.getSize());
+    EXPECT_DOUBLE_EQ(0.5, col.get(0));
+    EXPECT_DOUBLE_EQ(-1000.0, col.get(1));
+    EXPECT_TRUE(std::isnan(col.get(2))) << "Invalid value not mapped to NaN";
+}
+
+TEST(ColumnBuilder, Categorical) {
+    CategoricalColumn col("Column", {"b"});
+    auto builder = col.createBuilder();
+    for (auto str : {"a", "b", "a", "c"}) {
+        builder->add(str);
+    }
+    builder->commit();
+
+    const std::vector<std::string> expectedCategories = {"b", "a", "c"};
+    const std::vector<std::string> expectedValues = {"b", "a", "b", "a", "c"};
+    EXPECT_EQ(expectedCategories, col.getCategories());
+    EXPECT_EQ(expectedValues, col.getValues());
+}
+
 }  // namespace inviwo
@@ -0,0 +1,186 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/io/csvreader.h>
+#include <inviwo/dataframe/io/csvwriter.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/glm.h>
+
+#include <zlib.h>
+
+#include <array>
+#include <sstream>
+
+namespace inviwo {
+
+namespace {
+
+std::string toCSV(const DataFrame& dataframe, const CSVWriter& writer, bool compress = false) {
+    std::ostringstream ss(std::ios_base::out | std::ios_base::binary);
+    writer.writeData(&dataframe, ss, compress);
+    return ss.str();
+}
+
+// Decompress all concatenated gzip members of src and count them
+std::string gunzip(const std::string& src, size_t& members) {
+    members = 0;
+    z_stream zs{};
+    if (inflateInit2(&zs, MAX_WBITS + 16) != Z_OK) {
+        ADD_FAILURE() << "could not initialize zlib";
+        return {};
+    }
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(src.data()));
+    zs.avail_in = static_cast<uInt>(src.size());
+
+    std::string dst;
+    std::array<char, 4096> buf;
+    for (;;) {
+        zs.next_out = reinterpret_cast<Bytef*>(buf.data());
+        zs.avail_out = static_cast<uInt>(buf.size());
+        const auto res = inflate(&zs, Z_NO_FLUSH);
+        dst.append(buf.data(), buf.size() - zs.avail_out);
+        if (res == Z_STREAM_END) {
+            ++members;
+            if (zs.avail_in == 0) break;
+            inflateReset(&zs);
+        } else if (res != Z_OK) {
+            ADD_FAILURE() << "invalid gzip data";
+            break;
+        }
+    }
+    inflateEnd(&zs);
+    return dst;
+}
+
+// Use a thread pool of the given size during the lifetime of the object
+struct ScopedPoolSize {
+    explicit ScopedPoolSize(size_t size) : oldSize{InviwoApplication::getPtr()->getPoolSize()} {
+        InviwoApplication::getPtr()->resizePool(size);
+    }
+    ~ScopedPoolSize() { InviwoApplication::getPtr()->resizePool(oldSize); }
+    size_t oldSize;
+};
+
+// More rows than fit in one block, the blocks are formatted on the thread pool
+constexpr size_t severalBlocks = 40000;
+
+}  // namespace
+
+TEST(CSVWriter, values) {
+    DataFrame dataframe;
+    dataframe.addColumn("int", std::vector<int>{-1, 20});
+    dataframe.addColumn("uint8", std::vector<std::uint8_t>{7, 255});
+    dataframe.addColumn("float", std::vector<float>{0.1f, 2.5f});
+    dataframe.addColumn("double", std::vector<double>{1.0 / 3.0, 1e20});
+    dataframe.addCategoricalColumn("cat", {"a", "b c"});
+    dataframe.updateIndexBuffer();
+
+    CSVWriter writer;
+    EXPECT_EQ(
+        "int,uint8,float,double,cat\n"
+        "-1,7,0.1,0.3333333333333333,\"a\"\n"
+        "20,255,2.5,1e+20,\"b c\"",
+        toCSV(dataframe, writer));
+
+    writer.setDelimiter(";");
+    writer.setQuoteStrings(false);
+    writer.setExportIndexColumn(true);
+    EXPECT_EQ(
+        "index;int;uint8;float;double;cat\n"
+        "0;-1;7;0.1;0.3333333333333333;a\n"
+        "1;20;255;2.5;1e+20;b c",
+        toCSV(dataframe, writer));
+}
+
+TEST(CSVWriter, vectors) {
+    DataFrame dataframe;
+    dataframe.addColumnFromBuffer("pos",
+                                  util::makeBuffer(std::vector<ivec2>{ivec2{1, 2}, ivec2{3, 4}}));
+    dataframe.updateIndexBuffer();
+
+    CSVWriter writer;
+    EXPECT_EQ("\"pos X\",\"pos Y\"\n1,2\n3,4", toCSV(dataframe, writer));
+}
+
+TEST(CSVWriter, roundTrip) {
+    const size_t rows = severalBlocks;
+    std::vector<int> ints(rows);
+    std::vector<float> floats(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        ints[i] = static_cast<int>(i) - 100;
+        floats[i] = static_cast<float>(i) * 0.25f + 0.5f;
+    }
+    DataFrame dataframe;
+    dataframe.addColumn("ints", ints);
+    dataframe.addColumn("floats", floats);
+    dataframe.updateIndexBuffer();
+
+    const ScopedPoolSize pool{4};
+    std::istringstream ss(toCSV(dataframe, CSVWriter{}));
+    auto result = CSVReader{}.readData(ss);
+
+    ASSERT_EQ(rows, result->getNumberOfRows());
+    auto intCol = std::dynamic_pointer_cast<const TemplateColumn<int>>(result->getColumn("ints"));
+    auto floatCol =
+        std::dynamic_pointer_cast<const TemplateColumn<float>>(result->getColumn("floats"));
+    ASSERT_TRUE(intCol);
+    ASSERT_TRUE(floatCol);
+    for (size_t i = 0; i < rows; i += 997) {
+        EXPECT_EQ(ints[i], intCol->get(i));
+        EXPECT_EQ(floats[i], floatCol->get(i));
+    }
+}
+
+TEST(CSVWriter, gzip) {
+    std::vector<int> ints(severalBlocks);
+    for (size_t i = 0; i < ints.size(); ++i) ints[i] = static_cast<int>(i);
+    DataFrame dataframe;
+    dataframe.addColumn("int", ints);
+    dataframe.updateIndexBuffer();
+
+    const ScopedPoolSize pool{4};
+    const auto compressed = toCSV(dataframe, CSVWriter{}, true);
+    ASSERT_GT(compressed.size(), 2);
+    EXPECT_EQ('\x1f', compressed[0]) << "gzip magic number expected";
+    EXPECT_EQ('\x8b', compressed[1]) << "gzip magic number expected";
+
+    size_t members = 0;
+    EXPECT_EQ(toCSV(dataframe, CSVWriter{}), gunzip(compressed, members));
+    EXPECT_LT(size_t{2}, members) << "header and several blocks are compressed separately";
+}
+
+}  // namespace inviwo
@@ -186,4 +186,26 @@ TEST(DataFrameTests, RowAccess) {
     }
 }
 
+TEST(DataFrameTests, AddRow) {
+    DataFrame dataframe;
+    dataframe.addColumn<int>("int");
+    dataframe.addColumn<float>("float");
+    dataframe.addCategoricalColumn("cat");
+
+    dataframe.addRow({"1", "0.5", "a"});
+    dataframe.addRows({{"2", "1.5", "b"}, {"3", "2.5", "a"}});
+    dataframe.updateIndexBuffer();
+    ASSERT_EQ(3, dataframe.getNumberOfRows());
+    EXPECT_EQ("3", dataframe.getColumn(1)->getAsString(2));
+    EXPECT_EQ(1.5, dataframe.getColumn(2)->getAsDouble(1));
+    EXPECT_EQ("b", dataframe.getColumn(3)->getAsString(1));
+
+    EXPECT_THROW(dataframe.addRow({"4", "3.5"}), InvalidColCount);
+    EXPECT_THROW(dataframe.addRow({"not a number", "3.5", "c"}), DataTypeMismatch);
+    EXPECT_THROW(dataframe.addRows({{"4", "3.5", "c"}, {"x", "4.5", "d"}}), DataTypeMismatch);
+    for (auto col : dataframe) {
+        EXPECT_EQ(3, col->getSize()) << "rows that throw should not be added";
+    }
+}
+
 }  // namespace inviwo
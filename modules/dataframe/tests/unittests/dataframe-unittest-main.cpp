@@ -36,6 +36,8 @@
 
 #include <inviwo/testutil/configurablegtesteventlistener.h>
 
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/datastructures/representationutil.h>
 #include <inviwo/core/datastructures/representationfactorymanager.h>
 
@@ -45,6 +47,10 @@
 #include <warn/pop>
 
 int main(int argc, char** argv) {
+    inviwo::LogCentral::init();
+    // The application provides the thread pool used by the parallel algorithms
+    inviwo::InviwoApplication app(argc, argv, "Inviwo-Unittests-DataFrame");
+
     inviwo::RepresentationFactoryManager rfm;
     inviwo::util::registerCoreRepresentations(rfm);
 
@@ -0,0 +1,202 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/util/dataframequery.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<DataFrame> createDataFrame() {
+    auto df = std::make_shared<DataFrame>();
+    df->addColumn("mass", std::vector<float>{5.0f, 12.0f, 3.0f, 12.0f, 8.0f, 20.0f});
+    df->addColumn("id", std::vector<int>{1, 2, 3, 4, 5, 6});
+    df->addCategoricalColumn("type", {"star", "planet", "star", "moon", "planet", "star"});
+    df->updateIndexBuffer();
+    return df;
+}
+
+std::vector<std::string> columnAsStrings(const DataFrame& df, const std::string& header) {
+    auto col = df.getColumn(header);
+    std::vector<std::string> result;
+    for (size_t i = 0; i < col->getSize(); ++i) {
+        result.push_back(col->getAsString(i));
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(DataFrameQuery, RowSelection) {
+    dataframe::RowSelection a{130};
+    dataframe::RowSelection b{130};
+    a.set(0);
+    a.set(64);
+    a.set(129);
+    b.set(64);
+    b.set(100);
+
+    EXPECT_EQ(3, a.count());
+    EXPECT_EQ((std::vector<std::uint32_t>{64}), (a & b).rows());
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 64, 100, 129}), (a | b).rows());
+    EXPECT_EQ(127, (~a).count()) << "Padding bits must not be selected after negation";
+    EXPECT_THROW(a &= dataframe::RowSelection{10}, Exception);
+}
+
+TEST(DataFrameQuery, Filter) {
+    auto df = createDataFrame();
+    const auto& mass = *df->getColumn("mass");
+
+    using dataframe::CompareOp;
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 3, 5}),
+              dataframe::filter(mass, CompareOp::Greater, 10.0).rows());
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 2}),
+              dataframe::filter(mass, CompareOp::Less, 8.0).rows());
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 4}),
+              dataframe::filterRange(mass, 4.0, 10.0).rows());
+
+    auto type = std::dynamic_pointer_cast<const CategoricalColumn>(df->getColumn("type"));
+    ASSERT_TRUE(type);
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 2, 5}),
+              dataframe::filter(*type, CompareOp::Equal, "star").rows());
+    EXPECT_EQ(0, dataframe::filter(*type, CompareOp::Equal, "comet").count());
+}
+
+TEST(DataFrameQuery, FilterNaN) {
+    auto df = std::make_shared<DataFrame>();
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    df->addColumn("x", std::vector<double>{1.0, nan, 3.0});
+    df->updateIndexBuffer();
+
+    using dataframe::CompareOp;
+    const auto& x = *df->getColumn("x");
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 2}),
+              dataframe::filter(x, CompareOp::GreaterEqual, 0.0).rows());
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 1}),
+              dataframe::filter(x, CompareOp::NotEqual, 3.0).rows());
+}
+
+TEST(DataFrameQuery, SortMultipleKeys) {
+    auto df = createDataFrame();
+    auto rows = dataframe::sortRows(*df, {0, 1, 2, 3, 4, 5}, {{"mass", false}, {"id", true}});
+    EXPECT_EQ((std::vector<std::uint32_t>{5, 1, 3, 4, 0, 2}), rows);
+
+    rows = dataframe::sortRows(*df, {0, 1, 2, 3, 4, 5}, {{"type", true}, {"mass", true}});
+    EXPECT_EQ((std::vector<std::uint32_t>{3, 4, 1, 2, 0, 5}), rows)
+        << "Categorical columns should be sorted alphabetically";
+}
+
+TEST(DataFrameQuery, GroupBy) {
+    auto df = createDataFrame();
+    auto result = dataframe::DataFrameView{df}.groupBy(
+        {"type"}, {{"", dataframe::Aggregate::Count},
+                   {"mass", dataframe::Aggregate::Sum},
+                   {"mass", dataframe::Aggregate::Max, "heaviest"}});
+
+    ASSERT_EQ(3, result->getNumberOfRows());
+    EXPECT_EQ((std::vector<std::string>{"star", "planet", "moon"}),
+              columnAsStrings(*result, "type"))
+        << "Groups should be ordered by first occurrence";
+    EXPECT_EQ((std::vector<std::string>{"3", "2", "1"}), columnAsStrings(*result, "count"));
+
+    auto sum = std::dynamic_pointer_cast<const TemplateColumn<double>>(
+        result->getColumn("sum(mass)"));
+    ASSERT_TRUE(sum);
+    EXPECT_DOUBLE_EQ(28.0, sum->get(0));
+    EXPECT_DOUBLE_EQ(20.0, sum->get(1));
+    EXPECT_DOUBLE_EQ(12.0, sum->get(2));
+
+    auto heaviest =
+        std::dynamic_pointer_cast<const TemplateColumn<double>>(result->getColumn("heaviest"));
+    ASSERT_TRUE(heaviest);
+    EXPECT_DOUBLE_EQ(20.0, heaviest->get(0));
+}
+
+TEST(DataFrameQuery, ViewMaterialize) {
+    auto df = createDataFrame();
+    auto result = dataframe::DataFrameView{df}
+                      .filter("type", dataframe::CompareOp::NotEqual, "moon")
+                      .sort({{"mass", false}})
+                      .head(3)
+                      .materialize({"id", "type"});
+
+    ASSERT_EQ(3, result->getNumberOfColumns()) << "Index column + 'id' + 'type'";
+    EXPECT_EQ((std::vector<std::string>{"6", "2", "5"}), columnAsStrings(*result, "id"));
+    EXPECT_EQ((std::vector<std::string>{"star", "planet", "planet"}),
+              columnAsStrings(*result, "type"));
+
+    EXPECT_THROW(dataframe::DataFrameView{df}.filter("missing", dataframe::CompareOp::Equal, 1.0),
+                 Exception);
+}
+
+TEST(DataFrameQuery, ParallelSort) {
+    // Large enough to be sorted in several chunks on the thread pool and merged
+    const size_t rows = 300000;
+    std::mt19937 rand(0);
+    std::uniform_int_distribution<int> dist(0, 99);
+    std::vector<int> keys(rows);
+    std::generate(keys.begin(), keys.end(), [&]() { return dist(rand); });
+
+    DataFrame dataframe;
+    dataframe.addColumn("key", keys);
+    dataframe.updateIndexBuffer();
+
+    auto app = InviwoApplication::getPtr();
+    const auto poolSize = app->getPoolSize();
+    app->resizePool(4);
+
+    std::vector<std::uint32_t> all(rows);
+    std::iota(all.begin(), all.end(), 0u);
+    auto expected = all;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](std::uint32_t a, std::uint32_t b) { return keys[a] > keys[b]; });
+
+    const auto sorted = dataframe::sortRows(dataframe, all, {{"key", false}});
+    app->resizePool(poolSize);
+
+    EXPECT_EQ(expected, sorted) << "parallel sort is not a stable sort";
+}
+
+}  // namespace inviwo
@@ -34,6 +34,7 @@
 
 #include <inviwo/core/io/tempfilehandle.h>
 #include <inviwo/dataframe/io/jsonreader.h>
+#include <inviwo/dataframe/jsondataframeconversion.h>
 
 #include <sstream>
 
@@ -82,4 +83,82 @@ TEST(JSONdata, nullItem) {
     ASSERT_EQ(2, dataframe->getNumberOfRows()) << "row count does not match";
 }
 
+TEST(JSONdata, inferredTypes) {
+    // the type is inferred from all sampled rows, missing keys are filled
+    std::istringstream ss(
+        "[{\"a\" : 1, \"b\" : 1, \"c\" : true, \"d\" : \"x\"},"
+        "{\"a\" : 2.5, \"b\" : -2, \"d\" : \"y\"},"
+        "{\"a\" : 3, \"b\" : 3, \"c\" : false, \"d\" : \"x\"}]");
+
+    JSONDataFrameReader reader;
+    float progress = 0.0f;
+    reader.setProgressCallback([&](float p) { progress = p; });
+
+    auto dataframe = reader.readData(ss);
+    ASSERT_EQ(5, dataframe->getNumberOfColumns()) << "column count does not match";
+    ASSERT_EQ(3, dataframe->getNumberOfRows()) << "row count does not match";
+    EXPECT_EQ(NumericType::Float,
+              dataframe->getColumn(1)->getBuffer()->getDataFormat()->getNumericType());
+    EXPECT_EQ(NumericType::SignedInteger,
+              dataframe->getColumn(2)->getBuffer()->getDataFormat()->getNumericType());
+    EXPECT_EQ(DataUInt8::id(), dataframe->getColumn(3)->getBuffer()->getDataFormat()->getId());
+    EXPECT_EQ(0.0, dataframe->getColumn(3)->getAsDouble(1)) << "missing value not filled";
+    EXPECT_EQ(1.0, dataframe->getColumn(3)->getAsDouble(0));
+    EXPECT_EQ("x", dataframe->getDataItem(2).at(4)->toString()) << "categories are not quoted";
+    EXPECT_EQ(1.0f, progress);
+}
+
+TEST(JSONdata, wideIntegers) {
+    // integers that do not fit in 32 bits give float columns
+    std::istringstream ss(
+        "[{\"s\" : -1, \"u\" : 5000000000, \"n\" : 1},"
+        "{\"s\" : 3000000000, \"u\" : 1, \"n\" : 2}]");
+
+    JSONDataFrameReader reader;
+    auto dataframe = reader.readData(ss);
+    EXPECT_EQ(DataFloat32::id(), dataframe->getColumn("s")->getBuffer()->getDataFormat()->getId());
+    EXPECT_EQ(DataFloat32::id(), dataframe->getColumn("u")->getBuffer()->getDataFormat()->getId());
+    EXPECT_EQ(DataUInt32::id(), dataframe->getColumn("n")->getBuffer()->getDataFormat()->getId());
+    EXPECT_EQ(5e9, dataframe->getColumn("u")->getAsDouble(0));
+}
+
+TEST(JSONdata, valuesOutsideInferredType) {
+    // only the first row is used to infer the types, later values that do not fit are missing
+    std::istringstream ss(
+        "[{\"b\" : true, \"s\" : -1, \"u\" : 1},"
+        "{\"b\" : 2, \"s\" : 2.5, \"u\" : -2},"
+        "{\"b\" : 0, \"s\" : 5000000000, \"u\" : 5000000000},"
+        "{\"b\" : 1, \"s\" : 4.0, \"u\" : 4}]");
+
+    DataFrame dataframe;
+    JSONDataFrameBuilder builder(dataframe, 1);
+    json::sax_parse(ss, &builder);
+    builder.finish();
+
+    ASSERT_EQ(4, dataframe.getNumberOfRows()) << "row count does not match";
+    auto b = dataframe.getColumn("b");
+    auto s = dataframe.getColumn("s");
+    auto u = dataframe.getColumn("u");
+    EXPECT_EQ(DataUInt8::id(), b->getBuffer()->getDataFormat()->getId());
+    EXPECT_EQ(DataInt32::id(), s->getBuffer()->getDataFormat()->getId());
+    EXPECT_EQ(DataUInt32::id(), u->getBuffer()->getDataFormat()->getId());
+
+    EXPECT_EQ(0.0, b->getAsDouble(1)) << "2 is not a boolean";
+    EXPECT_EQ(0.0, s->getAsDouble(1)) << "fractions are not truncated";
+    EXPECT_EQ(0.0, u->getAsDouble(1)) << "negative values do not wrap around";
+    EXPECT_EQ(0.0, s->getAsDouble(2)) << "wide integers are not truncated";
+    EXPECT_EQ(0.0, u->getAsDouble(2)) << "wide integers are not truncated";
+
+    EXPECT_EQ(1.0, b->getAsDouble(3));
+    EXPECT_EQ(4.0, s->getAsDouble(3)) << "integral floats fit";
+    EXPECT_EQ(4.0, u->getAsDouble(3));
+}
+
+TEST(JSONdata, invalid) {
+    std::istringstream ss("[{\"a\" : 1}, {\"a\" : }]");
+
+    JSONDataFrameReader reader;
+    EXPECT_THROW(reader.readData(ss), JSONConversionException);
+}
+
 }  // namespace inviwo
@@ -39,6 +39,7 @@
 #include <inviwo/dataframe/datastructures/column.h>
 #include <inviwo/dataframe/datastructures/dataframe.h>
 #include <inviwo/dataframe/datastructures/datapoint.h>
+#include <inviwo/dataframe/util/dataframequery.h>
 #include <inviwo/dataframe/util/dataframeutil.h>
 
 #include <inviwo/core/util/defaultvalues.h>
@@ -298,6 +299,127 @@ are undefined.
 Parameters
 ----------
 keycolumns    list of headers of the columns used as key for the join operation
+)delim");
+
+    py::enum_<dataframe::CompareOp>(m, "CompareOp")
+        .value("Equal", dataframe::CompareOp::Equal)
+        .value("NotEqual", dataframe::CompareOp::NotEqual)
+        .value("Less", dataframe::CompareOp::Less)
+        .value("LessEqual", dataframe::CompareOp::LessEqual)
+        .value("Greater", dataframe::CompareOp::Greater)
+        .value("GreaterEqual", dataframe::CompareOp::GreaterEqual);
+
+    py::enum_<dataframe::Aggregate>(m, "Aggregate")
+        .value("Count", dataframe::Aggregate::Count)
+        .value("Sum", dataframe::Aggregate::Sum)
+        .value("Mean", dataframe::Aggregate::Mean)
+        .value("Min", dataframe::Aggregate::Min)
+        .value("Max", dataframe::Aggregate::Max);
+
+    py::class_<dataframe::SortKey>(m, "SortKey")
+        .def(py::init([](std::string column, bool ascending) {
+                 return dataframe::SortKey{std::move(column), ascending};
+             }),
+             py::arg("column"), py::arg("ascending") = true)
+        .def_readwrite("column", &dataframe::SortKey::column)
+        .def_readwrite("ascending", &dataframe::SortKey::ascending);
+
+    py::class_<dataframe::Aggregation>(m, "Aggregation")
+        .def(py::init([](std::string column, dataframe::Aggregate op, std::string header) {
+                 return dataframe::Aggregation{std::move(column), op, std::move(header)};
+             }),
+             py::arg("column"), py::arg("op") = dataframe::Aggregate::Count,
+             py::arg("header") = std::string{})
+        .def_readwrite("column", &dataframe::Aggregation::column)
+        .def_readwrite("op", &dataframe::Aggregation::op)
+        .def_readwrite("header", &dataframe::Aggregation::header);
+
+    py::class_<dataframe::RowSelection>(m, "RowSelection")
+        .def(py::init<size_t, bool>(), py::arg("rows") = 0, py::arg("selected") = false)
+        .def("__len__", &dataframe::RowSelection::size)
+        .def("__getitem__",
+             [](const dataframe::RowSelection& s, size_t i) {
+                 if (i >= s.size()) throw py::index_error();
+                 return s.test(i);
+             })
+        .def("__setitem__",
+             [](dataframe::RowSelection& s, size_t i, bool selected) {
+                 if (i >= s.size()) throw py::index_error();
+                 s.set(i, selected);
+             })
+        .def_property_readonly("count", &dataframe::RowSelection::count)
+        .def_property_readonly("rows", &dataframe::RowSelection::rows)
+        .def("__and__", [](const dataframe::RowSelection& a,
+                           const dataframe::RowSelection& b) { return a & b; })
+        .def("__or__", [](const dataframe::RowSelection& a,
+                          const dataframe::RowSelection& b) { return a | b; })
+        .def("__invert__", &dataframe::RowSelection::operator~);
+
+    py::class_<dataframe::DataFrameView>(m, "DataFrameView")
+        .def(py::init<std::shared_ptr<const DataFrame>>(), py::arg("dataframe"))
+        .def(py::init<std::shared_ptr<const DataFrame>, std::vector<std::uint32_t>>(),
+             py::arg("dataframe"), py::arg("rows"))
+        .def_property_readonly("dataframe", &dataframe::DataFrameView::getDataFrame)
+        .def_property_readonly("rows", &dataframe::DataFrameView::getRows)
+        .def("__len__", &dataframe::DataFrameView::getNumberOfRows)
+        .def("filter", py::overload_cast<const dataframe::RowSelection&>(
+                           &dataframe::DataFrameView::filter, py::const_),
+             py::arg("selection"))
+        .def("filter",
+             py::overload_cast<const std::string&, dataframe::CompareOp, double>(
+                 &dataframe::DataFrameView::filter, py::const_),
+             py::arg("column"), py::arg("op"), py::arg("value"))
+        .def("filter",
+             [](const dataframe::DataFrameView& v, const std::string& column,
+                dataframe::CompareOp op, const std::string& value) {
+                 return v.filter(column, op, std::string_view{value});
+             },
+             py::arg("column"), py::arg("op"), py::arg("category"))
+        .def("filterRange", &dataframe::DataFrameView::filterRange, py::arg("column"),
+             py::arg("min"), py::arg("max"))
+        .def("sort", &dataframe::DataFrameView::sort, py::arg("keys"))
+        .def("head", &dataframe::DataFrameView::head, py::arg("count"))
+        .def("groupBy", &dataframe::DataFrameView::groupBy, py::arg("keys"),
+             py::arg("aggregations"))
+        .def("materialize", &dataframe::DataFrameView::materialize,
+             py::arg("columns") = std::vector<std::string>{});
+
+    m.def("filter",
+          py::overload_cast<const Column&, dataframe::CompareOp, double>(dataframe::filter),
+          py::arg("column"), py::arg("op"), py::arg("value"),
+          R"delim(
+Select all rows where the value of the column compares true to value. Values are compared
+in double precision, NaN only matches NotEqual.
+)delim")
+        .def("filter",
+             [](const CategoricalColumn& col, dataframe::CompareOp op, const std::string& value) {
+                 return dataframe::filter(col, op, std::string_view{value});
+             },
+             py::arg("column"), py::arg("op"), py::arg("category"),
+             R"delim(
+Select all rows of a categorical column matching (Equal) or not matching (NotEqual) category.
+)delim")
+        .def("filterRange", dataframe::filterRange, py::arg("column"), py::arg("min"),
+             py::arg("max"),
+             R"delim(
+Select all rows where min <= value <= max.
+)delim")
+        .def("sortRows", dataframe::sortRows, py::arg("dataframe"), py::arg("rows"),
+             py::arg("keys"),
+             R"delim(
+Stable sort of the row indices by the given list of SortKeys, the first key has the
+highest priority. NaN values are placed last.
+)delim")
+        .def("groupBy", dataframe::groupBy, py::arg("dataframe"), py::arg("rows"),
+             py::arg("keys"), py::arg("aggregations"),
+             R"delim(
+Group the given rows by the values of the key columns and compute the aggregations for
+each group. Returns a new DataFrame with one row per group.
+)delim")
+        .def("selectRows", dataframe::selectRows, py::arg("dataframe"), py::arg("rows"),
+             py::arg("columns") = std::vector<std::string>{},
+             R"delim(
+Create a new DataFrame holding the given rows of dataframe, optionally only the given columns.
 )delim");
 
     exposeStandardDataPorts<DataFrame>(m, "DataFrame");
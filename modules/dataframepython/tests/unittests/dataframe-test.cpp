@@ -273,4 +273,33 @@ d.updateIndex()
     }
 }
 
+TEST(DataFrameTests, RowSelectionIndex) {
+    const std::string source = R"delim(
+import inviwopy
+import ivwdataframe
+
+s = ivwdataframe.RowSelection(3)
+s[2] = True
+selected = s[2]
+getError = False
+setError = False
+try:
+    s[3]
+except IndexError:
+    getError = True
+try:
+    s[3] = True
+except IndexError:
+    setError = True
+)delim";
+
+    auto dict = py::cast<py::dict>(PyDict_Copy(py::globals().ptr()));
+
+    py::eval<py::eval_statements>(source, dict);
+
+    EXPECT_TRUE(dict["selected"].cast<bool>());
+    EXPECT_TRUE(dict["getError"].cast<bool>()) << "no IndexError when reading out of bounds";
+    EXPECT_TRUE(dict["setError"].cast<bool>()) << "no IndexError when writing out of bounds";
+}
+
 }  // namespace inviwo
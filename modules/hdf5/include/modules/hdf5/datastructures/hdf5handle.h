@@ -79,14 +79,31 @@ public:
 
     Document getInfo() const;
 
+    /**
+     * The opened group, any HDF5 call using it has to hold hdf5::libraryMutex()
+     */
     const H5::Group& getGroup() const;
 
     Handle* getHandleForPath(const std::string& path) const;
 
+    /**
+     * Read the hyperslab \p selection of the dataset at \p path into a volume, converting it to
+     * \p type if not nullptr. The data range of the volume is set to the range of the read data.
+     */
     std::shared_ptr<Volume> getVolumeAtPathAsType(const Path& path,
                                                   std::vector<Selection> selection,
                                                   const DataFormatBase* type) const;
 
+    /**
+     * Create a volume for the hyperslab \p selection of the dataset at \p path without reading
+     * it. The data is read when a VolumeRAM representation is requested, see VolumeRAMLoader.
+     * Integer data gets the full range of the type as data range, for floating point data the
+     * range is estimated from a subsampled selection.
+     */
+    std::shared_ptr<Volume> getLazyVolumeAtPathAsType(const Path& path,
+                                                      std::vector<Selection> selection,
+                                                      const DataFormatBase* type) const;
+
     template <typename T>
     std::vector<T> getVectorAtPath(const Path& path) const;
 
@@ -98,6 +115,11 @@ public:
     static const std::string dataName;
 
 private:
+    std::shared_ptr<Volume> getLazyVolumeAtPathAsType(const Path& path,
+                                                      std::vector<Selection> selection,
+                                                      const DataFormatBase* type,
+                                                      bool estimateRange) const;
+
     double getMin(const DataFormatBase* type) const;
     double getMax(const DataFormatBase* type) const;
 
@@ -108,6 +130,7 @@ private:
 
 template <typename T>
 std::vector<T> Handle::getVectorAtPath(const Path& path) const {
+    std::scoped_lock lock{libraryMutex()};
     H5::DataSet ds = data_.openDataSet(path);
     size_t rank = ds.getSpace().getSimpleExtentNdims();
 
@@ -131,6 +154,7 @@ std::vector<T> Handle::getVectorAtPath(const Path& path) const {
 
 template <typename T>
 std::vector<glm::tvec3<T, glm::defaultp>> Handle::getVectorOfVec3AtPath(const Path& path) const {
+    std::scoped_lock lock{libraryMutex()};
     H5::DataSet ds = data_.openDataSet(path);
     size_t rank = ds.getSpace().getSimpleExtentNdims();
 
@@ -0,0 +1,101 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/hdf5/hdf5moduledefine.h>
+#include <modules/hdf5/datastructures/hdf5handle.h>
+#include <modules/hdf5/datastructures/hdf5path.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+/**
+ * Loads a hyperslab of an HDF5 dataset into a VolumeRAM when it is first requested. Used as the
+ * loader of the VolumeDisk representations created by Handle::getVolumeAtPathAsType.
+ *
+ * The selection is read chunk by chunk following the chunk layout of the dataset. Contiguous
+ * datasets are split into slabs along their slowest dimension instead. Only chunks that contain
+ * selected elements are read, so strided selections and selections of a single time step only
+ * touch the needed parts of the file. Decoded chunks are kept in a cache shared by all loaders,
+ * which makes changing the selection within the same dataset cheap.
+ *
+ * HDF5 calls are serialized using hdf5::libraryMutex, while copying the selected elements out of
+ * the chunks runs in parallel on the thread pool.
+ */
+class IVW_MODULE_HDF5_API VolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    /**
+     * @param filename the HDF5 file
+     * @param group path of the group that \p dataset is relative to
+     * @param dataset path of the dataset
+     * @param selection one selection per dataset dimension in column major order, at most three
+     * of them may select more than one element.
+     */
+    VolumeRAMLoader(std::string filename, Path group, Path dataset,
+                    std::vector<Handle::Selection> selection);
+    virtual VolumeRAMLoader* clone() const override;
+    virtual ~VolumeRAMLoader() = default;
+
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override;
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                      const VolumeRepresentation& src) const override;
+
+    /**
+     * The dimensions of the volume resulting from \p selection, throws if more than three
+     * dimensions have more than one element selected.
+     */
+    static size3_t getDimensions(const std::vector<Handle::Selection>& selection);
+
+    /**
+     * Set the maximum number of bytes of decoded chunks to keep in memory, 512 MB by default.
+     */
+    static void setCacheSize(size_t bytes);
+    static size_t getCacheSize();
+
+private:
+    template <typename T>
+    void read(T* dst) const;
+
+    std::string filename_;
+    Path group_;
+    Path dataset_;
+    std::vector<Handle::Selection> selection_;
+};
+
+}  // namespace hdf5
+
+}  // namespace inviwo
@@ -39,6 +39,7 @@
 #include <H5Cpp.h>
 #include <warn/pop>
 
+#include <mutex>
 #include <vector>
 
 namespace inviwo {
@@ -59,6 +60,15 @@ IVW_MODULE_HDF5_API Paths findpaths(const H5::Group& grp, const Path& path,
 IVW_MODULE_HDF5_API bool isOfType(const H5::Group& grp, const std::string& type);
 IVW_MODULE_HDF5_API VolumeInfos getVolumeInfo(const H5::DataSet& ds, const Path& path);
 
+/**
+ * The bundled HDF5 library is built without thread safety, hence every HDF5 call on any thread,
+ * including copying and destroying HDF5 objects, has to hold this lock. The functions of this
+ * module take it themselves, code using the objects they return, like Handle::getGroup(), has to
+ * take it explicitly. The lock is recursive, but should not be held while requesting a
+ * representation of a lazily loaded volume, since the loading runs on several threads.
+ */
+IVW_MODULE_HDF5_API std::recursive_mutex& libraryMutex();
+
 }  // namespace hdf5
 
 }  // namespace inviwo
@@ -64,6 +64,10 @@ namespace hdf5 {
  *   * __Value range__ ...
  *   * __Dimensions__ ...
  *   * __Automatic loading__ ...
+ *   * __Load on demand__ Only read the data from the file once it is used. Reading is done in
+ *     parallel chunk by chunk, and decoded chunks are cached, which makes it cheap to step through
+ *     a time series or change the selection. The data range is then not computed from the data,
+ *     integer types use the full range of the type and floating point data use an estimate.
  *   * __Basis__ ...
  *   * __Use Range__ ...
  *   * __Spacing__ ...
@@ -146,6 +150,7 @@ private:
     OptionPropertyString volumeSelection_;
 
     BoolProperty automaticEvaluation_;
+    BoolProperty loadOnDemand_;
     ButtonProperty evaluate_;
 
     CompositeProperty basisGroup_;
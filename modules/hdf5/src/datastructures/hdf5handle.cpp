@@ -30,10 +30,12 @@
  *********************************************************************************/
 
 #include <modules/hdf5/datastructures/hdf5handle.h>
+#include <modules/hdf5/datastructures/hdf5volumeloader.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/formatdispatching.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
 
 #include <modules/base/algorithm/dataminmax.h>
 
@@ -45,6 +47,7 @@ namespace hdf5 {
 
 namespace {
 H5::Group load(const std::string& filename, const std::string& path) {
+    std::scoped_lock lock{libraryMutex()};
     H5::H5File hdfFile(filename, H5F_ACC_RDONLY);
     return hdfFile.openGroup(path);
 }
@@ -66,6 +69,7 @@ Handle& Handle::operator=(Handle&& that) {
     if (this != &that) {
         filename_ = that.filename_;
         path_ = that.path_;
+        std::scoped_lock lock{libraryMutex()};
         data_.close();
         H5::H5File hdfFile(filename_, H5F_ACC_RDONLY);
         data_ = hdfFile.openGroup(path_);
@@ -77,6 +81,7 @@ Handle& Handle::operator=(const Handle& that) {
     if (this != &that) {
         filename_ = that.filename_;
         path_ = that.path_;
+        std::scoped_lock lock{libraryMutex()};
         data_.close();
         H5::H5File hdfFile(filename_, H5F_ACC_RDONLY);
         data_ = hdfFile.openGroup(path_);
@@ -84,7 +89,10 @@ Handle& Handle::operator=(const Handle& that) {
     return *this;
 }
 
-Handle::~Handle() { data_.close(); }
+Handle::~Handle() {
+    std::scoped_lock lock{libraryMutex()};
+    data_.close();
+}
 
 Handle* Handle::getHandleForPath(const std::string& path) const {
     return new Handle(this->filename_, path_ + path);
@@ -126,100 +134,75 @@ double Handle::getMax(const DataFormatBase* type) const {
 std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
                                                       std::vector<Selection> selection,
                                                       const DataFormatBase* type) const {
+    auto volume = getLazyVolumeAtPathAsType(path, selection, type, false);
 
-    auto dataset = data_.openDataSet(path);
-    ::inviwo::util::OnScopeExit closedataset{[&]() { dataset.close(); }};
-
-    const H5::DataSpace dataSpace = dataset.getSpace();
-    const size_t rank = dataSpace.getSimpleExtentNdims();
-    if (selection.size() != rank) {
-        throw Exception("Selection not of the same rank as the data", IVW_CONTEXT);
-    }
-
-    std::vector<hsize_t> dataDimensions(rank);
-    dataSpace.getSimpleExtentDims(dataDimensions.data());
-    const hsize_t dataSize = dataSpace.getSelectNpoints();
-
-    std::vector<hsize_t> start(rank);
-    std::vector<hsize_t> count(rank);
-    std::vector<hsize_t> stride(rank);
-
-    /*
-     * Column major, i.e. the FIRST listed dimension is the fasted changing
-     * Inviwo, OpenGL, matlab, Fortran
-     *
-     * Row major, i.e. the LAST listed dimension is the fasted changing
-     * HDF, C/C++, Mathematica, Python
-     *
-     * Solution reverse all the dimension lists.
-     * Row major version of the selection to match the hdf row major dataDimensions.
-     */
-    std::reverse(selection.begin(), selection.end());
-
-    size3_t volumeDimensions(1);
-    int resRank = 0;
-    std::vector<hsize_t> memoryDimensions{1, 1, 1};
-
-    for (size_t i = 0; i < rank; ++i) {
-        start[i] = selection[i].start;
-        count[i] =
-            static_cast<hsize_t>((selection[i].end - selection[i].start) / selection[i].stride);
-        stride[i] = selection[i].stride;
-
-        if (count[i] > 1) {
-            if (resRank > 2) throw Exception("Invalid selection, resulting rank > 3", IVW_CONTEXT);
-            memoryDimensions[resRank] = count[i];
-            volumeDimensions[resRank] = count[i];
-            resRank++;
-        }
-    }
-
-    dataSpace.selectHyperslab(H5S_SELECT_SET, count.data(), start.data(), stride.data(), nullptr);
+    const auto volumeram = volume->getRepresentation<VolumeRAM>();
+    const auto minmax =
+        volumeram->dispatch<std::pair<dvec4, dvec4>, dispatching::filter::Scalars>(
+            [](auto vrprecision) {
+                return ::inviwo::util::dataMinMax(vrprecision->getDataTyped(),
+                                                  glm::compMul(vrprecision->getDimensions()));
+            });
 
-    H5::DataSpace memorySpace(3, memoryDimensions.data());
-    memorySpace.selectAll();
-
-    hsize_t selectionSize = memorySpace.getSelectNpoints();
-
-    LogInfo("Data rank: " << rank << " dims " << joinString(dataDimensions, " x ") << " size "
-                          << dataSize << " selection " << dataSpace.getSelectNpoints()
-                          << " memory size " << memorySpace.getSelectNpoints() << " memory dim "
-                          << volumeDimensions);
-
-    const DataFormatBase* format = type ? type : util::getDataFormatFromDataSet(dataset);
-
-    // Reverse back the Column major
-    std::reverse(&volumeDimensions[0], &volumeDimensions[0] + volumeDimensions.length());
-    auto volumeram = createVolumeRAM(volumeDimensions, format);
-
-    auto minmax = volumeram->dispatch<std::pair<dvec4, dvec4>, dispatching::filter::Scalars>(
-        [&](auto vrprecision) {
-            using ValueType = ::inviwo::util::PrecisionValueType<decltype(vrprecision)>;
+    volume->dataMap_.dataRange.x = glm::compMin(minmax.first);
+    volume->dataMap_.dataRange.y = glm::compMax(minmax.second);
+    volume->dataMap_.valueRange = volume->dataMap_.dataRange;
 
-            ValueType* data = vrprecision->getDataTyped();
+    LogInfo("Read HDF volume type: " << volume->getDataFormat()->getString() << " dims "
+                                     << volume->getDimensions() << " data range: "
+                                     << volume->dataMap_.dataRange << " file: " << filename_);
+    return volume;
+}
 
-            try {
-                dataset.read(data, TypeMap<ValueType>::getType(), memorySpace, dataSpace);
-            } catch (H5::DataSetIException& e) {
-                throw Exception("HDF: unable to read data: " + e.getDetailMsg(), IVW_CONTEXT);
-            }
+std::shared_ptr<Volume> Handle::getLazyVolumeAtPathAsType(const Path& path,
+                                                          std::vector<Selection> selection,
+                                                          const DataFormatBase* type) const {
+    return getLazyVolumeAtPathAsType(path, std::move(selection), type, true);
+}
 
-            auto res = ::inviwo::util::dataMinMax(data, selectionSize);
+std::shared_ptr<Volume> Handle::getLazyVolumeAtPathAsType(const Path& path,
+                                                          std::vector<Selection> selection,
+                                                          const DataFormatBase* type,
+                                                          bool estimateRange) const {
+    const DataFormatBase* format = type;
+    {
+        std::scoped_lock lock{libraryMutex()};
+        auto dataset = data_.openDataSet(path);
+        ::inviwo::util::OnScopeExit closedataset{[&]() { dataset.close(); }};
+
+        const size_t rank = dataset.getSpace().getSimpleExtentNdims();
+        if (selection.size() != rank) {
+            throw Exception("Selection not of the same rank as the data", IVW_CONTEXT);
+        }
+        if (!format) format = util::getDataFormatFromDataSet(dataset);
+    }
 
-            LogInfo("Read HDF volume type: " << DataFormat<ValueType>::str()
-                                             << " data range: " << res.first << ", " << res.second
-                                             << " file: " << dataset.getFileName());
+    const auto dimensions = VolumeRAMLoader::getDimensions(selection);
+    auto disk = std::make_shared<VolumeDisk>(filename_, dimensions, format);
+    disk->setLoader(new VolumeRAMLoader(filename_, path_, path, selection));
+    auto volume = std::make_shared<Volume>(disk);
 
-            return res;
-        });
+    if (!estimateRange) return volume;
 
-    auto volume = std::make_shared<Volume>(volumeDimensions, format);
-    volume->dataMap_.dataRange.x = glm::compMin(minmax.first);
-    volume->dataMap_.dataRange.y = glm::compMax(minmax.second);
+    if (format->getNumericType() == NumericType::Float) {
+        // Estimate the range from a subsampled selection, at most 32 elements per dimension
+        for (auto& sel : selection) {
+            const auto count = std::max<size_t>((sel.end - sel.start) / sel.stride, 1);
+            sel.stride *= (count + 31) / 32;
+        }
+        auto sample = getLazyVolumeAtPathAsType(path, selection, format, false);
+        const auto ram = sample->getRepresentation<VolumeRAM>();
+        const auto minmax =
+            ram->dispatch<std::pair<dvec4, dvec4>, dispatching::filter::Scalars>(
+                [](auto vrprecision) {
+                    return ::inviwo::util::dataMinMax(
+                        vrprecision->getDataTyped(), glm::compMul(vrprecision->getDimensions()));
+                });
+        volume->dataMap_.dataRange = dvec2{glm::compMin(minmax.first), glm::compMax(minmax.second)};
+    } else {
+        volume->dataMap_.dataRange = dvec2{format->getLowest(), format->getMax()};
+    }
     volume->dataMap_.valueRange = volume->dataMap_.dataRange;
-
-    volume->addRepresentation(volumeram);
-
     return volume;
 }
 
@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <modules/hdf5/datastructures/hdf5metadata.h>
+#include <modules/hdf5/hdf5utils.h>
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/stringconversion.h>
 
@@ -88,6 +89,7 @@ std::vector<MetaData> getAttributeMetaData(const T& grp, Path path) {
 }
 
 IVW_MODULE_HDF5_API std::vector<MetaData> getMetaData(const H5::Group& grp, Path path) {
+    std::scoped_lock lock{libraryMutex()};
     std::vector<MetaData> metadata{};
     metadata.emplace_back(path, MetaData::HDFType::Group);
 
@@ -123,6 +125,7 @@ IVW_MODULE_HDF5_API std::vector<MetaData> getMetaData(const H5::Group& grp, Path
 }
 
 IVW_MODULE_HDF5_API std::vector<size_t> getDimensions(const H5::DataSpace space) {
+    std::scoped_lock lock{libraryMutex()};
     if (space.getSimpleExtentType() == H5S_SCALAR) {
         return std::vector<size_t>{1};
     } else if (space.getSimpleExtentType() == H5S_SIMPLE) {
@@ -137,6 +140,7 @@ IVW_MODULE_HDF5_API std::vector<size_t> getDimensions(const H5::DataSpace space)
 }
 
 IVW_MODULE_HDF5_API const DataFormatBase* getDataFormat(const H5::DataType type) {
+    std::scoped_lock lock{libraryMutex()};
     if (type == H5::PredType::NATIVE_FLOAT)
         return DataFormatBase::get(DataFormatId::Float32);
     else if (type == H5::PredType::NATIVE_DOUBLE)
@@ -0,0 +1,337 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/hdf5/datastructures/hdf5volumeloader.h>
+#include <modules/hdf5/hdf5types.h>
+#include <modules/hdf5/hdf5utils.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+namespace {
+
+/**
+ * A least recently used cache of decoded chunks, keyed on file, dataset, type and chunk position
+ */
+class ChunkCache {
+public:
+    std::shared_ptr<const void> get(const std::string& key) {
+        std::scoped_lock lock{mutex_};
+        auto it = index_.find(key);
+        if (it == index_.end()) return nullptr;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->data;
+    }
+
+    void add(const std::string& key, std::shared_ptr<const void> data, size_t bytes) {
+        std::scoped_lock lock{mutex_};
+        if (bytes > capacity_ || index_.count(key) != 0) return;
+        entries_.push_front(Entry{key, std::move(data), bytes});
+        index_[key] = entries_.begin();
+        bytes_ += bytes;
+        evict();
+    }
+
+    void setCapacity(size_t bytes) {
+        std::scoped_lock lock{mutex_};
+        capacity_ = bytes;
+        evict();
+    }
+
+    size_t getCapacity() {
+        std::scoped_lock lock{mutex_};
+        return capacity_;
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<const void> data;
+        size_t bytes;
+    };
+
+    void evict() {
+        while (bytes_ > capacity_ && !entries_.empty()) {
+            bytes_ -= entries_.back().bytes;
+            index_.erase(entries_.back().key);
+            entries_.pop_back();
+        }
+    }
+
+    std::mutex mutex_;
+    std::list<Entry> entries_;  ///< most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    size_t bytes_ = 0;
+    size_t capacity_ = size_t{512} << 20;
+};
+
+ChunkCache& chunkCache() {
+    static ChunkCache cache;
+    return cache;
+}
+
+// Contiguous datasets are read in slabs of about this size
+constexpr size_t slabBytes = size_t{8} << 20;
+
+struct Dim {
+    hsize_t start;
+    hsize_t stride;
+    hsize_t count;
+};
+
+/**
+ * The selection in row major order, i.e. the order of the dimensions in the HDF5 file
+ */
+std::vector<Dim> rowMajor(const std::vector<Handle::Selection>& selection) {
+    std::vector<Dim> dims;
+    for (auto it = selection.rbegin(); it != selection.rend(); ++it) {
+        const hsize_t stride = std::max<size_t>(it->stride, 1);
+        const hsize_t count = std::max<hsize_t>((it->end - it->start) / stride, 1);
+        dims.push_back(Dim{it->start, stride, count});
+    }
+    return dims;
+}
+
+/**
+ * The selected elements along one dimension that fall within the same chunk
+ */
+struct ChunkRange {
+    hsize_t chunk;
+    hsize_t begin;
+    hsize_t end;
+};
+
+std::vector<hsize_t> rowMajorStrides(const std::vector<hsize_t>& sizes) {
+    std::vector<hsize_t> strides(sizes.size(), 1);
+    for (size_t i = sizes.size(); i-- > 1;) strides[i - 1] = strides[i] * sizes[i];
+    return strides;
+}
+
+}  // namespace
+
+VolumeRAMLoader::VolumeRAMLoader(std::string filename, Path group, Path dataset,
+                                 std::vector<Handle::Selection> selection)
+    : filename_{std::move(filename)}
+    , group_{std::move(group)}
+    , dataset_{std::move(dataset)}
+    , selection_{std::move(selection)} {}
+
+VolumeRAMLoader* VolumeRAMLoader::clone() const { return new VolumeRAMLoader(*this); }
+
+size3_t VolumeRAMLoader::getDimensions(const std::vector<Handle::Selection>& selection) {
+    size3_t dims{1};
+    size_t resRank = 0;
+    for (const auto& dim : rowMajor(selection)) {
+        if (dim.count > 1) {
+            if (resRank > 2) {
+                throw Exception("Invalid selection, resulting rank > 3",
+                                IVW_CONTEXT_CUSTOM("hdf5::VolumeRAMLoader"));
+            }
+            dims[resRank++] = dim.count;
+        }
+    }
+    // Reverse back to column major
+    std::reverse(&dims[0], &dims[0] + dims.length());
+    return dims;
+}
+
+void VolumeRAMLoader::setCacheSize(size_t bytes) { chunkCache().setCapacity(bytes); }
+
+size_t VolumeRAMLoader::getCacheSize() { return chunkCache().getCapacity(); }
+
+std::shared_ptr<VolumeRepresentation> VolumeRAMLoader::createRepresentation(
+    const VolumeRepresentation& src) const {
+    auto volumeram = createVolumeRAM(src.getDimensions(), src.getDataFormat(), nullptr,
+                                     src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    updateRepresentation(volumeram, src);
+    return volumeram;
+}
+
+void VolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                           const VolumeRepresentation& src) const {
+    auto volumeram = std::static_pointer_cast<VolumeRAM>(dest);
+    if (volumeram->getDimensions() != getDimensions(selection_)) {
+        throw Exception("Selection does not match the volume dimensions", IVW_CONTEXT);
+    }
+    if (src.getDataFormat() != volumeram->getDataFormat()) {
+        throw Exception("Data format mismatch", IVW_CONTEXT);
+    }
+    volumeram->dispatch<void, dispatching::filter::Scalars>(
+        [&](auto vrprecision) { read(vrprecision->getDataTyped()); });
+}
+
+template <typename T>
+void VolumeRAMLoader::read(T* dst) const {
+    const auto dims = rowMajor(selection_);
+    const auto rank = dims.size();
+    if (rank == 0) throw Exception("Empty selection", IVW_CONTEXT);
+
+    std::optional<H5::H5File> file;
+    std::optional<H5::DataSet> dataset;
+    ::inviwo::util::OnScopeExit close{[&]() {
+        std::scoped_lock lock{libraryMutex()};
+        dataset.reset();
+        file.reset();
+    }};
+
+    std::vector<hsize_t> extent(rank);
+    std::vector<hsize_t> chunk(rank);
+    try {
+        std::scoped_lock lock{libraryMutex()};
+        file.emplace(filename_, H5F_ACC_RDONLY);
+        dataset.emplace(file->openGroup(group_).openDataSet(dataset_));
+
+        const auto space = dataset->getSpace();
+        if (static_cast<size_t>(space.getSimpleExtentNdims()) != rank) {
+            throw Exception("Selection not of the same rank as the data", IVW_CONTEXT);
+        }
+        space.getSimpleExtentDims(extent.data());
+
+        const auto plist = dataset->getCreatePlist();
+        if (plist.getLayout() == H5D_CHUNKED) {
+            plist.getChunk(static_cast<int>(rank), chunk.data());
+        } else {
+            // Split contiguous data into slabs along the slowest dimension
+            chunk = extent;
+            const auto sliceBytes = std::accumulate(extent.begin() + 1, extent.end(),
+                                                    hsize_t{sizeof(T)}, std::multiplies<>{});
+            chunk[0] = std::clamp<hsize_t>(slabBytes / std::max<hsize_t>(sliceBytes, 1), 1,
+                                           std::max<hsize_t>(extent[0], 1));
+        }
+    } catch (const H5::Exception& e) {
+        throw Exception("HDF: unable to open data: " + e.getDetailMsg(), IVW_CONTEXT);
+    }
+
+    // Group the selected elements of each dimension by chunk
+    std::vector<std::vector<ChunkRange>> ranges(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        if (dims[i].start + (dims[i].count - 1) * dims[i].stride >= extent[i]) {
+            throw Exception("Selection is outside of the data", IVW_CONTEXT);
+        }
+        for (hsize_t k = 0; k < dims[i].count; ++k) {
+            const auto c = (dims[i].start + k * dims[i].stride) / chunk[i];
+            if (ranges[i].empty() || ranges[i].back().chunk != c) {
+                ranges[i].push_back(ChunkRange{c, k, k + 1});
+            } else {
+                ranges[i].back().end = k + 1;
+            }
+        }
+    }
+
+    std::vector<hsize_t> counts(rank);
+    std::transform(dims.begin(), dims.end(), counts.begin(), [](auto& d) { return d.count; });
+    const auto dstStrides = rowMajorStrides(counts);
+
+    const auto keyPrefix = fmt::format("{}|{}|{}|{}|", filename_, (group_ + dataset_).toString(),
+                                       DataFormat<T>::str(), joinString(chunk, ","));
+
+    const size_t tasks = std::accumulate(ranges.begin(), ranges.end(), size_t{1},
+                                         [](size_t n, auto& r) { return n * r.size(); });
+
+    ::inviwo::util::parallelFor(tasks, [&](size_t task) {
+        std::vector<const ChunkRange*> range(rank);
+        std::vector<hsize_t> start(rank);
+        std::vector<hsize_t> count(rank);
+        for (size_t i = rank; i-- > 0;) {
+            range[i] = &ranges[i][task % ranges[i].size()];
+            task /= ranges[i].size();
+            start[i] = range[i]->chunk * chunk[i];
+            count[i] = std::min(chunk[i], extent[i] - start[i]);
+        }
+
+        const auto key = keyPrefix + joinString(::inviwo::util::transform(
+                                                    range, [](auto r) { return r->chunk; }),
+                                                ",");
+        auto data = std::static_pointer_cast<const std::vector<T>>(chunkCache().get(key));
+        if (!data) {
+            auto buffer = std::make_shared<std::vector<T>>(std::accumulate(
+                count.begin(), count.end(), size_t{1}, std::multiplies<>{}));
+            try {
+                std::scoped_lock lock{libraryMutex()};
+                H5::DataSpace fileSpace = dataset->getSpace();
+                fileSpace.selectHyperslab(H5S_SELECT_SET, count.data(), start.data());
+                H5::DataSpace memorySpace(static_cast<int>(rank), count.data());
+                dataset->read(buffer->data(), TypeMap<T>::getType(), memorySpace, fileSpace);
+            } catch (const H5::Exception& e) {
+                throw Exception("HDF: unable to read data: " + e.getDetailMsg(), IVW_CONTEXT);
+            }
+            chunkCache().add(key, buffer, buffer->size() * sizeof(T));
+            data = buffer;
+        }
+
+        // Copy the selected elements of the chunk, the last dimension is the fastest varying
+        const auto srcStrides = rowMajorStrides(count);
+        const auto& last = *range[rank - 1];
+        const auto& lastDim = dims[rank - 1];
+        std::vector<hsize_t> k(rank);
+        for (size_t i = 0; i < rank; ++i) k[i] = range[i]->begin;
+
+        const auto advance = [&]() {
+            for (size_t i = rank - 1; i-- > 0;) {
+                if (++k[i] < range[i]->end) return true;
+                k[i] = range[i]->begin;
+            }
+            return false;
+        };
+
+        do {
+            size_t srcIndex = 0;
+            size_t dstIndex = 0;
+            for (size_t i = 0; i + 1 < rank; ++i) {
+                srcIndex += (dims[i].start + k[i] * dims[i].stride - start[i]) * srcStrides[i];
+                dstIndex += k[i] * dstStrides[i];
+            }
+            for (auto j = last.begin; j < last.end; ++j) {
+                dst[dstIndex + j] =
+                    (*data)[srcIndex + lastDim.start + j * lastDim.stride - start[rank - 1]];
+            }
+        } while (advance());
+    });
+}
+
+}  // namespace hdf5
+
+}  // namespace inviwo
@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <modules/hdf5/hdf5types.h>
+#include <modules/hdf5/hdf5utils.h>
 #include <inviwo/core/util/logcentral.h>
 
 namespace inviwo {
@@ -39,6 +40,7 @@ namespace hdf5 {
 
 IVW_MODULE_HDF5_API const DataFormatBase* util::getDataFormatFromDataSet(
     const H5::DataSet& dataset) {
+    std::scoped_lock lock{libraryMutex()};
     NumericType numerictype;
     const int components = 1;
     size_t presision = 8;
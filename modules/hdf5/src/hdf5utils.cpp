@@ -35,6 +35,7 @@ namespace inviwo {
 namespace hdf5 {
 
 Paths findpaths(const H5::Group& grp, const Path& path, const std::string& type) {
+    std::scoped_lock lock{libraryMutex()};
     Paths paths;
 
     if (isOfType(grp, type)) {
@@ -53,6 +54,7 @@ Paths findpaths(const H5::Group& grp, const Path& path, const std::string& type)
 }
 
 VolumeInfos getVolumeInfo(const H5::DataSet& ds, const Path& path) {
+    std::scoped_lock lock{libraryMutex()};
     auto size = std::make_unique<hsize_t[]>(ds.getSpace().getSimpleExtentNdims());
     ds.getSpace().getSimpleExtentDims(size.get());
     int sub_densities = (int)size[0];
@@ -74,6 +76,7 @@ VolumeInfos getVolumeInfo(const H5::DataSet& ds, const Path& path) {
 }
 
 bool isOfType(const H5::Group& grp, const std::string& type) {
+    std::scoped_lock lock{libraryMutex()};
     bool result = false;
     try {
         if (grp.attrExists("type")) {
@@ -95,6 +98,11 @@ bool isOfType(const H5::Group& grp, const std::string& type) {
     return result;
 }
 
+std::recursive_mutex& libraryMutex() {
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
 }  // namespace hdf5
 
 }  // namespace inviwo
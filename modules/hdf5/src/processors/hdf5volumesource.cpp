@@ -58,6 +58,7 @@ HDF5ToVolume::HDF5ToVolume()
 
     , automaticEvaluation_("automaticEvaluation", "Automatic loading", true,
                            InvalidationLevel::Valid)
+    , loadOnDemand_("loadOnDemand", "Load on demand", false)
     , evaluate_("evaluate", "Load")
 
     , basisGroup_("basisGroup", "Basis")
@@ -102,6 +103,11 @@ HDF5ToVolume::HDF5ToVolume()
 
     evaluate_.onChange([this]() { dirty_ = true; });
 
+    loadOnDemand_.onChange([this]() {
+        dirty_ = true;
+        if (automaticEvaluation_) invalidate(InvalidationLevel::InvalidOutput);
+    });
+
     basisGroup_.addProperties(basisSelection_, spacing_, basis_);
 
     basisSelection_.onChange([this]() { onBasisSelecionChange(); });
@@ -120,8 +126,8 @@ HDF5ToVolume::HDF5ToVolume()
         }
     });
 
-    addProperties(volumeSelection_, automaticEvaluation_, evaluate_, basisGroup_, information_,
-                  outputGroup_);
+    addProperties(volumeSelection_, automaticEvaluation_, loadOnDemand_, evaluate_, basisGroup_,
+                  information_, outputGroup_);
 }
 
 HDF5ToVolume::~HDF5ToVolume() = default;
@@ -193,6 +199,7 @@ mat4 HDF5ToVolume::getBasisFromMeta(MetaData meta) {
 
     if (inport_.hasData()) {
         const auto data = inport_.getData();
+        std::scoped_lock lock{libraryMutex()};
         H5::DataSet dataset = data->getGroup().openDataSet(meta.path_);
         H5::DataSpace space = dataset.getSpace();
         int rank = space.getSimpleExtentNdims();
@@ -332,9 +339,16 @@ void HDF5ToVolume::makeVolume() {
                 }
             }();
 
-            volume_ = std::shared_ptr<Volume>(
-                data->getVolumeAtPathAsType(Path(data->getGroup().getObjName()) + volumeMeta.path_,
-                                            selection_.getSelection(), format));
+            const auto path = [&]() {
+                std::scoped_lock lock{libraryMutex()};
+                return Path(data->getGroup().getObjName()) + volumeMeta.path_;
+            }();
+            if (loadOnDemand_) {
+                volume_ =
+                    data->getLazyVolumeAtPathAsType(path, selection_.getSelection(), format);
+            } else {
+                volume_ = data->getVolumeAtPathAsType(path, selection_.getSelection(), format);
+            }
 
             dataRange_.set(volume_->dataMap_.dataRange);
             outport_.setData(volume_);
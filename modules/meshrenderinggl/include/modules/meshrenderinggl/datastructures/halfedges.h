@@ -135,6 +135,17 @@ public:
 private:
     friend EdgeIter;
 
+    /**
+     * \brief Append the half edges of all triangles in \p indexBuffer
+     */
+    void addTriangles(const Mesh::MeshInfo& info, const IndexBuffer& indexBuffer);
+
+    /**
+     * \brief Link each half edge to its twin, using a hash table of the directed edges that is
+     * built and queried in parallel. If an edge occurs more than once, the first one is used.
+     */
+    void findTwins();
+
     /**
      * \brief A single half edge
      */
@@ -34,13 +34,79 @@
 #include <inviwo/core/datastructures/buffer/bufferram.h>
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>
 
+#include <inviwo/core/util/threadutil.h>
+
 #include <modules/base/algorithm/meshutils.h>
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+
 namespace inviwo {
 
 namespace meshutil {
 using Mode = CalculateMeshNormalsMode;
 
+namespace {
+
+constexpr size_t chunkSize = 1 << 14;
+
+/**
+ * The weighted normal a triangle contributes to each of its corners, zero if degenerated
+ */
+std::array<vec3, 3> cornerNormals(const dvec3& v0, const dvec3& v1, const dvec3& v2, Mode mode) {
+    const dvec3 n = cross(v1 - v0, v2 - v0);
+    double l = glm::length(n);
+    if (l < std::numeric_limits<float>::epsilon()) {
+        // degenerated triangle
+        return {vec3{0.0f}, vec3{0.0f}, vec3{0.0f}};
+    }
+    // weighting factor
+    double weightA;
+    double weightB;
+    double weightC;
+    switch (mode) {
+        case Mode::WeightArea:
+            // area = norm of cross product
+            weightA = 1;
+            weightB = 1;
+            weightC = 1;
+            break;
+        case Mode::WeightAngle: {
+            // based on the angle between the edges
+            const dvec3 e0 = glm::normalize(v1 - v2);
+            const dvec3 e1 = glm::normalize(v2 - v0);
+            const dvec3 e2 = glm::normalize(v1 - v0);
+            weightA = acos(dot(e1, e2)) / l;
+            weightB = acos(dot(e0, e2)) / l;
+            weightC = acos(dot(e0, e1)) / l;
+            break;
+        }
+        case Mode::WeightNMax: {
+            const auto edge = [](auto a, auto b) {
+                auto e = a - b;
+                auto l = glm::length(e);
+                return std::make_pair(e / l, l);
+            };
+            const auto [e0, l0] = edge(v1, v2);
+            const auto [e1, l1] = edge(v2, v0);
+            const auto [e2, l2] = edge(v1, v0);
+            weightA = sin(acos(dot(e1, e2))) / (l * l1 * l2);
+            weightB = sin(acos(dot(e0, e2))) / (l * l0 * l2);
+            weightC = sin(acos(dot(e0, e1))) / (l * l0 * l1);
+            break;
+        }
+        case Mode::NoWeighting:
+        default:
+            weightA = 1.0 / l;
+            weightB = 1.0 / l;
+            weightC = 1.0 / l;
+    }
+    return {vec3(n * weightA), vec3(n * weightB), vec3(n * weightC)};
+}
+
+}  // namespace
+
 void calculateMeshNormals(Mesh& mesh, CalculateMeshNormalsMode mode) {
     if (mode == Mode::PassThrough) {
         return;
@@ -59,81 +125,65 @@ void calculateMeshNormals(Mesh& mesh, CalculateMeshNormalsMode mode) {
     }
 
     auto vertices = positions->getRepresentation<BufferRAM>();
-    std::vector<vec3> normals(vertices->getSize(), vec3(0.0f));
+    const auto nVertices = vertices->getSize();
 
-    // loop over index buffers
+    // gather the triangles of all index buffers
+    std::vector<glm::u32vec3> triangles;
     for (auto [meshInfo, buffer] : mesh.getIndexBuffers()) {
         if (meshInfo.dt != DrawType::Triangles) continue;
+        meshutil::forEachTriangle(meshInfo, *buffer, [&](auto i0, auto i1, auto i2) {
+            if (i0 >= nVertices || i1 >= nVertices || i2 >= nVertices) {
+                throw Exception("Triangle index out of range",
+                                IVW_CONTEXT_CUSTOM("meshutil::calculateMeshNormals"));
+            }
+            triangles.emplace_back(i0, i1, i2);
+        });
+    }
+    const auto nCorners = 3 * triangles.size();
+
+    // the contribution of each triangle corner, computed in parallel
+    std::vector<vec3> contributions(nCorners);
+    vertices->dispatch<void, dispatching::filter::Floats>([&](auto ram) {
+        const auto& vert = ram->getDataContainer();
+        util::parallelFor(triangles.size(), chunkSize, [&](size_t begin, size_t end) {
+            for (size_t t = begin; t < end; ++t) {
+                const auto& tri = triangles[t];
+                const auto corners = cornerNormals(util::glm_convert<dvec3>(vert[tri[0]]),
+                                                   util::glm_convert<dvec3>(vert[tri[1]]),
+                                                   util::glm_convert<dvec3>(vert[tri[2]]), mode);
+                std::copy(corners.begin(), corners.end(), contributions.begin() + 3 * t);
+            }
+        });
+    });
 
-        vertices->dispatch<void, dispatching::filter::Floats>(
-            [&, mi = meshInfo, buf = buffer](auto ram) {
-                const auto& vert = ram->getDataContainer();
-
-                meshutil::forEachTriangle(mi, *buf, [&](auto i0, auto i1, auto i2) {
-                    const auto v0 = util::glm_convert<dvec3>(vert[i0]);
-                    const auto v1 = util::glm_convert<dvec3>(vert[i1]);
-                    const auto v2 = util::glm_convert<dvec3>(vert[i2]);
-
-                    const dvec3 n = cross(v1 - v0, v2 - v0);
-                    double l = glm::length(n);
-                    if (l < std::numeric_limits<float>::epsilon()) {
-                        // degenerated triangle
-                        return;
-                    }
-                    // weighting factor
-                    double weightA;
-                    double weightB;
-                    double weightC;
-                    switch (mode) {
-                        case Mode::WeightArea:
-                            // area = norm of cross product
-                            weightA = 1;
-                            weightB = 1;
-                            weightC = 1;
-                            break;
-                        case Mode::WeightAngle: {
-                            // based on the angle between the edges
-                            const dvec3 e0 = glm::normalize(v1 - v2);
-                            const dvec3 e1 = glm::normalize(v2 - v0);
-                            const dvec3 e2 = glm::normalize(v1 - v0);
-                            weightA = acos(dot(e1, e2)) / l;
-                            weightB = acos(dot(e0, e2)) / l;
-                            weightC = acos(dot(e0, e1)) / l;
-                            break;
-                        }
-                        case Mode::WeightNMax: {
-                            const auto edge = [](auto a, auto b) {
-                                auto e = a - b;
-                                auto l = glm::length(e);
-                                return std::make_pair(e / l, l);
-                            };
-                            const auto [e0, l0] = edge(v1, v2);
-                            const auto [e1, l1] = edge(v2, v0);
-                            const auto [e2, l2] = edge(v1, v0);
-                            weightA = sin(acos(dot(e1, e2))) / (l * l1 * l2);
-                            weightB = sin(acos(dot(e0, e2))) / (l * l0 * l2);
-                            weightC = sin(acos(dot(e0, e1))) / (l * l0 * l1);
-                            break;
-                        }
-                        case Mode::NoWeighting:
-                        default:
-                            weightA = 1.0 / l;
-                            weightB = 1.0 / l;
-                            weightC = 1.0 / l;
-                    }
-                    // add it to the vertices
-                    normals[i0] += vec3(n * weightA);
-                    normals[i1] += vec3(n * weightB);
-                    normals[i2] += vec3(n * weightC);
-                });
-            });
+    // group the corners by vertex, keeping them in triangle order
+    std::vector<size_t> offsets(nVertices + 1, 0);
+    for (const auto& tri : triangles) {
+        ++offsets[tri[0] + 1];
+        ++offsets[tri[1] + 1];
+        ++offsets[tri[2] + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<size_t> cornersByVertex(nCorners);
+    {
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+        for (size_t c = 0; c < nCorners; ++c) {
+            cornersByVertex[next[triangles[c / 3][c % 3]]++] = c;
+        }
     }
 
-    // normalize normals
-    std::transform(normals.begin(), normals.end(), normals.begin(), [](auto n) {
-        const auto l = glm::length(n);
-        if (l < std::numeric_limits<float>::epsilon()) return n;
-        return n / l;
+    // sum and normalize the normals in parallel, each vertex adds its corners in the same order
+    // as a serial loop over the triangles would
+    std::vector<vec3> normals(nVertices);
+    util::parallelFor(nVertices, chunkSize, [&](size_t begin, size_t end) {
+        for (size_t v = begin; v < end; ++v) {
+            vec3 n{0.0f};
+            for (auto i = offsets[v]; i < offsets[v + 1]; ++i) {
+                n += contributions[cornersByVertex[i]];
+            }
+            const auto l = glm::length(n);
+            normals[v] = l < std::numeric_limits<float>::epsilon() ? n : n / l;
+        }
     });
 
     auto bufferRAM = std::make_shared<BufferRAMPrecision<vec3>>(std::move(normals));
@@ -29,88 +29,129 @@
 
 #include <modules/meshrenderinggl/datastructures/halfedges.h>
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/util/threadutil.h>
 #include <modules/base/algorithm/meshutils.h>
 
-#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <memory>
 
 namespace inviwo {
 
+namespace {
+
+constexpr size_t chunkSize = 1 << 14;
+
+std::uint64_t edgeKey(std::uint32_t from, std::uint32_t to) {
+    return (static_cast<std::uint64_t>(from) << 32) | to;
+}
+
+std::uint64_t twinKey(std::uint64_t key) { return (key << 32) | (key >> 32); }
+
+// Mix the bits of the key (the murmur3 finalizer) before masking out the slot
+size_t slotOf(std::uint64_t key, size_t mask) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key) & mask;
+}
+
+}  // namespace
+
 HalfEdges::HalfEdges(Mesh::MeshInfo info, const IndexBuffer& indexBuffer) {
-    // map to fill in the opposite direction
-    // (start_vertex, end_vertex) -> edge_index
-    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
+    addTriangles(info, indexBuffer);
+    findTwins();
+}
+
+HalfEdges::HalfEdges(const Mesh& mesh) {
+    for (auto [info, indexBuffer] : mesh.getIndexBuffers()) {
+        if (info.dt != DrawType::Triangles) continue;
+        addTriangles(info, *indexBuffer);
+    }
+    findTwins();
+}
 
-    std::uint32_t face = 0;
+void HalfEdges::addTriangles(const Mesh::MeshInfo& info, const IndexBuffer& indexBuffer) {
+    auto face = static_cast<std::uint32_t>(faceToEdge_.size());
     meshutil::forEachTriangle(info, indexBuffer,
                               [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
                                   // a-b, b-c, c-a
                                   const auto count = static_cast<std::uint32_t>(edges_.size());
                                   edges_.push_back(HalfEdge{a, face, count + 1, count + 2});
-                                  edgeMap.try_emplace({a, b}, count + 0);
                                   vertexToEdge_.try_emplace(a, count + 0);
 
                                   edges_.push_back(HalfEdge{b, face, count + 2, count + 0});
-                                  edgeMap.try_emplace({b, c}, count + 1);
                                   vertexToEdge_.try_emplace(b, count + 1);
 
                                   edges_.push_back(HalfEdge{c, face, count + 0, count + 1});
-                                  edgeMap.try_emplace({c, a}, count + 2);
                                   vertexToEdge_.try_emplace(c, count + 2);
 
                                   faceToEdge_.try_emplace(face, count);
 
                                   ++face;
                               });
-
-    for (auto& edge : edges_) {
-        const auto a = edge.vertex;
-        const auto b = edges_[edge.next].vertex;
-
-        auto it = edgeMap.find(std::pair{b, a});
-        if (it != edgeMap.end()) {
-            edge.twin = it->second;
-        }
-    }
 }
 
-HalfEdges::HalfEdges(const Mesh& mesh) {
-
-    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
-    std::uint32_t face = 0;
-
-    for (auto [info, indexBuffer] : mesh.getIndexBuffers()) {
-        if (info.dt != DrawType::Triangles) continue;
-        meshutil::forEachTriangle(info, *indexBuffer,
-                                  [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
-                                      // a-b, b-c, c-a
-                                      const auto count = static_cast<std::uint32_t>(edges_.size());
-                                      edges_.push_back(HalfEdge{a, face, count + 1, count + 2});
-                                      edgeMap.try_emplace({a, b}, count + 0);
-                                      vertexToEdge_.try_emplace(a, count + 0);
-
-                                      edges_.push_back(HalfEdge{b, face, count + 2, count + 0});
-                                      edgeMap.try_emplace({b, c}, count + 1);
-                                      vertexToEdge_.try_emplace(b, count + 1);
-
-                                      edges_.push_back(HalfEdge{c, face, count + 0, count + 1});
-                                      edgeMap.try_emplace({c, a}, count + 2);
-                                      vertexToEdge_.try_emplace(c, count + 2);
-
-                                      faceToEdge_.try_emplace(face, count);
-
-                                      ++face;
-                                  });
-    }
-
-    for (auto& edge : edges_) {
-        const auto a = edge.vertex;
-        const auto b = edges_[edge.next].vertex;
+void HalfEdges::findTwins() {
+    const auto nEdges = edges_.size();
 
-        auto it = edgeMap.find(std::pair{b, a});
-        if (it != edgeMap.end()) {
-            edge.twin = it->second;
+    // (start_vertex, end_vertex) of each edge
+    std::vector<std::uint64_t> keys(nEdges);
+    util::parallelFor(nEdges, chunkSize, [&](size_t begin, size_t end) {
+        for (size_t e = begin; e < end; ++e) {
+            keys[e] = edgeKey(edges_[e].vertex, edges_[edges_[e].next].vertex);
         }
-    }
+    });
+
+    // Open addressing with linear probing, at most half full. A slot holds edge index + 1, 0
+    // marks an empty slot. Once set, the key of a slot never changes, only the edge index can
+    // be lowered to the first edge with that key.
+    size_t capacity = 1;
+    while (capacity < 2 * nEdges) capacity <<= 1;
+    const size_t mask = capacity - 1;
+    const std::unique_ptr<std::atomic<std::uint32_t>[]> table{
+        new std::atomic<std::uint32_t>[capacity]};
+
+    util::parallelFor(capacity, chunkSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            table[i].store(0, std::memory_order_relaxed);
+        }
+    });
+
+    util::parallelFor(nEdges, chunkSize, [&](size_t begin, size_t end) {
+        for (size_t e = begin; e < end; ++e) {
+            const auto key = keys[e];
+            const auto id = static_cast<std::uint32_t>(e + 1);
+            for (auto slot = slotOf(key, mask);; slot = (slot + 1) & mask) {
+                auto& item = table[slot];
+                auto current = item.load(std::memory_order_relaxed);
+                while (current == 0 && !item.compare_exchange_weak(current, id)) {
+                }
+                if (current == 0) break;
+                if (keys[current - 1] == key) {
+                    while (id < current && !item.compare_exchange_weak(current, id)) {
+                    }
+                    break;
+                }
+            }
+        }
+    });
+
+    util::parallelFor(nEdges, chunkSize, [&](size_t begin, size_t end) {
+        for (size_t e = begin; e < end; ++e) {
+            const auto key = twinKey(keys[e]);
+            for (auto slot = slotOf(key, mask);; slot = (slot + 1) & mask) {
+                const auto current = table[slot].load(std::memory_order_relaxed);
+                if (current == 0) break;
+                if (keys[current - 1] == key) {
+                    edges_[e].twin = current - 1;
+                    break;
+                }
+            }
+        }
+    });
 }
 
 IndexBuffer HalfEdges::createIndexBuffer() const {
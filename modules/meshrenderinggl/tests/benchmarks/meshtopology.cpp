@@ -0,0 +1,128 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <modules/meshrenderinggl/datastructures/halfedges.h>
+#include <modules/meshrenderinggl/algorithm/calcnormals.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <utility>
+
+#include <warn/push>
+#include <warn/ignore/unused-function>
+
+using namespace inviwo;
+
+// A wavy grid of size x size quads, i.e. 2 * size^2 triangles
+static std::unique_ptr<Mesh> makeGrid(size_t size) {
+    const auto n = static_cast<std::uint32_t>(size);
+    util::IndexMapper<2, std::uint32_t> im{glm::uvec2{n + 1, n + 1}};
+
+    std::vector<vec3> positions;
+    positions.reserve((size + 1) * (size + 1));
+    for (std::uint32_t y = 0; y <= n; ++y) {
+        for (std::uint32_t x = 0; x <= n; ++x) {
+            const auto px = static_cast<float>(x) / static_cast<float>(n);
+            const auto py = static_cast<float>(y) / static_cast<float>(n);
+            positions.emplace_back(px, py, 0.1f * std::sin(20.0f * px) * std::cos(20.0f * py));
+        }
+    }
+
+    std::vector<std::uint32_t> indices;
+    indices.reserve(6 * size * size);
+    for (std::uint32_t y = 0; y < n; ++y) {
+        for (std::uint32_t x = 0; x < n; ++x) {
+            indices.insert(indices.end(), {im(x, y), im(x + 1, y), im(x, y + 1)});
+            indices.insert(indices.end(), {im(x + 1, y), im(x + 1, y + 1), im(x, y + 1)});
+        }
+    }
+
+    auto mesh = std::make_unique<Mesh>();
+    mesh->addBuffer(BufferType::PositionAttrib, util::makeBuffer(std::move(positions)));
+    mesh->addIndices(Mesh::MeshInfo{DrawType::Triangles, ConnectivityType::None},
+                     util::makeIndexBuffer(std::move(indices)));
+    return mesh;
+}
+
+static void HalfEdgesGrid(benchmark::State& state) {
+    const auto mesh = makeGrid(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        HalfEdges edges(*mesh);
+        benchmark::DoNotOptimize(edges);
+        benchmark::ClobberMemory();
+    }
+    state.counters["Triangles"] = static_cast<double>(2 * state.range(0) * state.range(0));
+}
+
+static void NormalsGrid(benchmark::State& state, meshutil::CalculateMeshNormalsMode mode) {
+    const auto mesh = makeGrid(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto result = meshutil::calculateMeshNormals(std::as_const(*mesh), mode);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    state.counters["Triangles"] = static_cast<double>(2 * state.range(0) * state.range(0));
+}
+
+BENCHMARK(HalfEdgesGrid)->RangeMultiplier(2)->Range(256, 2048)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(NormalsGrid, Area, meshutil::CalculateMeshNormalsMode::WeightArea)
+    ->RangeMultiplier(2)
+    ->Range(256, 2048)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NormalsGrid, NMax, meshutil::CalculateMeshNormalsMode::WeightNMax)
+    ->RangeMultiplier(2)
+    ->Range(256, 2048)
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+
+    // The application provides the thread pool used by the parallel algorithms
+    InviwoApplication app("bm-meshtopology");
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
+
+#include <warn/pop>
@@ -0,0 +1,105 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/meshrenderinggl/algorithm/calcnormals.h>
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+
+#include <utility>
+
+namespace inviwo {
+
+namespace {
+
+// A unit square in the xy plane split into two triangles, and a triangle in the xz plane
+// sharing the edge v0-v1
+std::unique_ptr<Mesh> createFold() {
+    auto mesh = std::make_unique<Mesh>();
+    mesh->addBuffer(BufferType::PositionAttrib,
+                    util::makeBuffer(std::vector<vec3>{
+                        {0.0f, 0.0f, 0.0f},
+                        {1.0f, 0.0f, 0.0f},
+                        {1.0f, 1.0f, 0.0f},
+                        {0.0f, 1.0f, 0.0f},
+                        {0.5f, 0.0f, -1.0f},
+                    }));
+    mesh->addIndices(Mesh::MeshInfo{DrawType::Triangles, ConnectivityType::None},
+                     util::makeIndexBuffer(std::vector<std::uint32_t>{0, 1, 2, 0, 2, 3, 1, 0, 4}));
+    return mesh;
+}
+
+const std::vector<vec3>& getNormals(const Mesh& mesh) {
+    return static_cast<const BufferRAMPrecision<vec3>*>(
+               mesh.getBuffer(BufferType::NormalAttrib)->getRepresentation<BufferRAM>())
+        ->getDataContainer();
+}
+
+}  // namespace
+
+TEST(CalcNormals, WeightArea) {
+    const auto fold = createFold();
+    const auto mesh = meshutil::calculateMeshNormals(
+        std::as_const(*fold), meshutil::CalculateMeshNormalsMode::WeightArea);
+    const auto& normals = getNormals(*mesh);
+    ASSERT_EQ(normals.size(), 5);
+
+    // v0 and v1 are shared by the flat and the folded part, all triangles have the same area
+    const auto expectNear = [](const vec3& a, const vec3& b) {
+        EXPECT_NEAR(a.x, b.x, 1e-6f);
+        EXPECT_NEAR(a.y, b.y, 1e-6f);
+        EXPECT_NEAR(a.z, b.z, 1e-6f);
+    };
+    expectNear(normals[0], glm::normalize(vec3{0.0f, -1.0f, 2.0f}));
+    expectNear(normals[1], glm::normalize(vec3{0.0f, -1.0f, 1.0f}));
+    for (auto i : {2, 3}) {
+        EXPECT_EQ(normals[i], vec3(0.0f, 0.0f, 1.0f));
+    }
+    EXPECT_EQ(normals[4], vec3(0.0f, -1.0f, 0.0f));
+}
+
+TEST(CalcNormals, DegeneratedTriangle) {
+    auto mesh = std::make_unique<Mesh>();
+    mesh->addBuffer(BufferType::PositionAttrib,
+                    util::makeBuffer(std::vector<vec3>{
+                        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}}));
+    mesh->addIndices(Mesh::MeshInfo{DrawType::Triangles, ConnectivityType::None},
+                     util::makeIndexBuffer(std::vector<std::uint32_t>{0, 1, 2}));
+
+    meshutil::calculateMeshNormals(*mesh, meshutil::CalculateMeshNormalsMode::WeightNMax);
+    for (const auto& n : getNormals(*mesh)) {
+        EXPECT_EQ(n, vec3(0.0f));
+    }
+}
+
+}  // namespace inviwo
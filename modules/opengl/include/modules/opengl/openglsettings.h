@@ -50,6 +50,9 @@ public:
     ButtonProperty btnOpenGLInfo_;
     TemplateOptionProperty<Shader::UniformWarning> uniformWarnings_;
     TemplateOptionProperty<Shader::OnError> shaderObjectErrors_;
+    BoolProperty shaderCache_;
+    ButtonProperty btnClearShaderCache_;
+    BoolProperty parallelShaderCompilation_;
 
     TemplateOptionProperty<utilgl::debug::Mode> debugMessages_;
     TemplateOptionProperty<utilgl::debug::Severity> debugSeverity_;
@@ -113,8 +113,18 @@ public:
     virtual ~Shader();
 
     void link();
+    /**
+     * Preprocess, compile, and link all shader objects. If the driver supports parallel shader
+     * compilation the shaders are only submitted, and the result is checked the first time the
+     * program is used, i.e. in isReady, activate, or setUniform. Errors are reported then,
+     * according to ShaderManager::getOnShaderError, except in isReady which always logs them.
+     */
     void build();
-    bool isReady() const;  // returns whether the shader has been built and linked successfully
+    /**
+     * Returns whether the shader has been built and linked successfully. Finishes a pending
+     * parallel build, errors are logged and never thrown.
+     */
+    bool isReady() const;
 
     GLuint getID() const { return program_.id; }
 
@@ -160,12 +170,17 @@ public:
 private:
     void bindAttributes();
 
-    void handleError(OpenGLException& e);
+    void handleError(OpenGLException& e) const;
     std::string processLog(std::string log) const;
 
     void rebuildShader(ShaderObject* obj);
     void linkShader(bool notifyRebuild = false);
     bool checkLinkStatus() const;
+    void checkLinkResult() const;
+    /// Check the result of a build that was submitted for parallel compilation
+    void finishBuild() const;
+    /// The preprocessed sources of all shader objects, used as key for the program cache
+    std::string programSources() const;
 
     void attach();
     void detach();
@@ -180,7 +195,12 @@ private:
     std::vector<bool> attached_;
     std::vector<std::shared_ptr<ShaderObject::Callback>> callbacks_;
 
-    bool ready_ = false;
+    // A build submitted for parallel compilation is finished lazily, also from const functions
+    mutable bool ready_ = false;
+    mutable bool pending_ = false;
+    // False if the program was loaded from the cache without compiling the shader objects
+    bool compiled_ = true;
+    mutable std::string pendingSources_;
 
     UniformWarning warningLevel_;
     // Uniform location cache. Clear after linking.
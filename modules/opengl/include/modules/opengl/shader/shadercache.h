@@ -0,0 +1,193 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/opengl/openglmoduledefine.h>
+#include <modules/opengl/inviwoopengl.h>
+#include <modules/opengl/shader/linenumberresolver.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace inviwo {
+
+class ShaderResource;
+
+/**
+ * \brief Caches preprocessed shader sources in memory and linked programs on disk
+ *
+ * Preprocessing a ShaderObject, i.e. resolving all includes and segments, gives the same result for
+ * the same header (version, defines, extensions, and declarations), resource, and segments, as
+ * long as none of the involved resources have changed. The preprocessed sources are kept in memory
+ * and validated against the current content of the resources on each lookup.
+ *
+ * Linked programs are stored with glGetProgramBinary in a directory, keyed by a hash of the
+ * preprocessed sources of all shader objects and the OpenGL vendor, renderer, and version. A later
+ * build of the same program, even in a later session, can then skip compiling and linking. If the
+ * driver rejects a stored binary, for example after a driver update, the entry is removed and the
+ * program is built from source. The least recently used binaries are removed from the directory
+ * when their total size exceeds a limit.
+ */
+class IVW_MODULE_OPENGL_API ShaderCache {
+public:
+    struct Include {
+        std::string path;  ///< The path used in the include statement
+        std::shared_ptr<const ShaderResource> resource;
+        std::uint64_t hash;  ///< Hash of the source of the resource when it was preprocessed
+    };
+    struct Preprocessed {
+        std::string source;
+        LineNumberResolver lnr;
+        std::shared_ptr<const ShaderResource> resource;
+        std::uint64_t hash;
+        std::vector<Include> includes;
+    };
+    using GetResource = std::function<std::shared_ptr<const ShaderResource>(std::string_view)>;
+
+    struct Binary {
+        GLenum format;
+        std::uint64_t check;  ///< Second hash of the sources, guards against key collisions
+        std::vector<char> data;
+    };
+
+    static constexpr size_t defaultMaxBinaryBytes = size_t{64} << 20;
+    static constexpr size_t defaultMaxDiskBytes = size_t{256} << 20;
+
+    /**
+     * @param directory where to store program binaries, if empty no binaries are stored on disk
+     * @param maxBinaryBytes the size of the program binaries to keep in memory, the least
+     * recently used binaries are removed first
+     * @param maxDiskBytes the size of the program binaries to keep in \p directory
+     */
+    explicit ShaderCache(std::string directory = "",
+                         size_t maxBinaryBytes = defaultMaxBinaryBytes,
+                         size_t maxDiskBytes = defaultMaxDiskBytes);
+    ShaderCache(const ShaderCache&) = delete;
+    ShaderCache& operator=(const ShaderCache&) = delete;
+    ~ShaderCache() = default;
+
+    /**
+     * Look up a preprocessed source. The entry is only returned if it was made from \p resource
+     * and if all resources still have the same content and the include paths still resolve to the
+     * same resources using \p getResource.
+     */
+    std::shared_ptr<const Preprocessed> getPreprocessed(std::string_view key,
+                                                        const ShaderResource& resource,
+                                                        const GetResource& getResource) const;
+    void addPreprocessed(std::string key, std::shared_ptr<const Preprocessed> preprocessed);
+    size_t getNumberOfPreprocessed() const;
+
+    static std::uint64_t hash(std::string_view source);
+
+    void setProgramCacheEnabled(bool enabled);
+    /**
+     * Returns true if the program cache is enabled and supported by the current OpenGL context.
+     */
+    bool isProgramCacheEnabled();
+
+    /**
+     * Has to be called before linking a program that should be stored
+     */
+    void prepareProgram(GLuint program);
+    /**
+     * Try to load the program binary for the given sources into \p program. Returns true if
+     * the program was successfully loaded and linked.
+     */
+    bool loadProgram(GLuint program, std::string_view sources);
+    void storeProgram(GLuint program, std::string_view sources);
+    /**
+     * Remove all program binaries, both in memory and on disk
+     */
+    void clearPrograms();
+
+    /**
+     * The key, used as file name, and the check of the program binary for the given driver
+     * description and sources. Both are stable hashes, the same in every build and session.
+     */
+    static std::pair<std::uint64_t, std::uint64_t> programKey(std::string_view driver,
+                                                              std::string_view sources);
+    /**
+     * Remove the least recently used program binaries in \p directory, judged by their
+     * modification time, until their total size is at most \p maxBytes. The most recently used
+     * binary is always kept. Loading a binary from disk updates its modification time.
+     */
+    static void trimDirectory(const std::string& directory, size_t maxBytes);
+    /**
+     * Write \p binary in the on-disk format: the "IVWPROG1" magic, the check, the format, the
+     * size, and the data.
+     */
+    static void writeBinary(std::ostream& os, const Binary& binary);
+    /**
+     * Read a binary written by writeBinary. Returns nullptr if the magic does not match, the
+     * check is not \p check, the size is larger than \p maxBytes, or the data is truncated.
+     */
+    static std::shared_ptr<Binary> readBinary(std::istream& is, std::uint64_t check,
+                                              size_t maxBytes = defaultMaxBinaryBytes);
+
+    /**
+     * Find the binary for \p key in memory or on disk. Returns nullptr if there is none, or if
+     * it was stored for other sources, i.e. the check differs.
+     */
+    std::shared_ptr<const Binary> findBinary(std::uint64_t key, std::uint64_t check);
+    /**
+     * Keep \p binary in memory, removes the least recently used binaries when the total size
+     * exceeds the limit. The last added binary is always kept.
+     */
+    void addBinary(std::uint64_t key, std::shared_ptr<const Binary> binary);
+    void removeBinary(std::uint64_t key);
+    size_t getNumberOfBinaries() const;
+    size_t getBinaryBytes() const;
+
+private:
+    std::string programFile(std::uint64_t key) const;
+
+    std::map<std::string, std::shared_ptr<const Preprocessed>, std::less<>> preprocessed_;
+    std::deque<std::string> preprocessedOrder_;
+
+    std::string directory_;
+    bool programCacheEnabled_;
+    std::optional<bool> programCacheSupported_;
+    std::string driver_;
+    std::map<std::uint64_t, std::shared_ptr<const Binary>> binaries_;
+    std::deque<std::uint64_t> binaryOrder_;  // least recently used first
+    size_t binaryBytes_;
+    size_t maxBinaryBytes_;
+    size_t maxDiskBytes_;
+};
+
+}  // namespace inviwo
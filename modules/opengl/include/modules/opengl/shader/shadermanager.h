@@ -34,10 +34,14 @@
 
 #include <modules/opengl/shader/shader.h>
 #include <modules/opengl/shader/shaderobject.h>
+#include <modules/opengl/shader/shadercache.h>
 #include <inviwo/core/util/singleton.h>
 #include <inviwo/core/util/dispatcher.h>
 
+#include <functional>
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -47,6 +51,7 @@ namespace inviwo {
 class OpenGLSettings;
 class ShaderResource;
 class OpenGLCapabilities;
+class BoolProperty;
 
 template <typename T>
 class TemplateOptionProperty;
@@ -72,6 +77,13 @@ public:
     void addShaderResource(std::string key, std::string resource);
     void addShaderResource(std::unique_ptr<ShaderResource> resource);
     void addShaderResource(std::shared_ptr<ShaderResource> resource);
+    /**
+     * Add a shader resource with a source that is embedded in a module library, see
+     * ivw_generate_shader_resource. The source is neither copied nor parsed until the resource is
+     * requested the first time. The source must remain valid until the module is unregistered,
+     * at that point any remaining sources are copied.
+     */
+    void addEmbeddedShaderResource(std::string key, std::string_view source);
     std::shared_ptr<ShaderResource> getShaderResource(std::string_view key);
 
     const std::vector<Shader*>& getShaders() const;
@@ -88,6 +100,19 @@ public:
 
     OpenGLCapabilities* getOpenGLCapabilities();
 
+    /**
+     * The cache for preprocessed shader sources and linked program binaries. Program binaries are
+     * stored in the "shader_cache" folder of the settings directory.
+     */
+    ShaderCache& getShaderCache();
+
+    /**
+     * Returns true if shaders should be submitted for compilation without waiting for the result,
+     * i.e. if GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile is supported and
+     * parallel compilation is enabled in the OpenGL settings.
+     */
+    bool useParallelCompilation();
+
 private:
     bool addShaderSearchPathImpl(const std::string&);
     std::vector<Shader*> shaders_;
@@ -96,9 +121,14 @@ private:
 
     std::vector<std::shared_ptr<ShaderResource>> ownedResources_;
     std::map<std::string, std::weak_ptr<ShaderResource>, std::less<>> shaderResources_;
+    std::map<std::string, std::string_view, std::less<>> embeddedResources_;
+    std::shared_ptr<std::function<void()>> onModulesWillUnregister_;
+    ShaderCache shaderCache_;
+    std::optional<bool> parallelCompilationSupported_;
 
     TemplateOptionProperty<Shader::UniformWarning>* uniformWarnings_;  // non-owning reference
     TemplateOptionProperty<Shader::OnError>* shaderObjectErrors_;      // non-owning reference
+    BoolProperty* parallelCompilation_;                                // non-owning reference
 
     Dispatcher<void(GLuint)> shaderAddCallbacks_;
     Dispatcher<void(GLuint)> shaderRemoveCallbacks_;
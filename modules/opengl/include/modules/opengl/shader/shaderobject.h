@@ -121,9 +121,24 @@ public:
     void preprocess();
     void upload();
     void compile();
+    /**
+     * Submit the shader for compilation without waiting for the result. With
+     * GL_KHR_parallel_shader_compile the driver compiles in the background until the result is
+     * queried, @see checkCompileStatus
+     */
+    void startCompile();
+    /**
+     * Wait for the compilation to finish, throws an OpenGLException if it failed
+     */
+    void checkCompileStatus() const;
     void build();
     bool isReady() const;
 
+    /**
+     * The source after the last call to preprocess, with all includes and segments resolved
+     */
+    const std::string& getProcessedSource() const;
+
     /**
      * Add a define to the shader as
      *     \#define name value
@@ -233,7 +248,7 @@ public:
 private:
     static std::shared_ptr<const ShaderResource> loadResource(std::string fileName);
     void addDefines(std::ostringstream& source);
-    void parseSource(std::ostringstream& output);
+    void parseSource(std::ostringstream& output, std::vector<std::string>& includePaths);
     std::string resolveLog(std::string_view compileLog) const;
 
     // state variables
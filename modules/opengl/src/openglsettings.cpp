@@ -49,6 +49,9 @@ OpenGLSettings::OpenGLSettings()
                           {{"warn", "Print warning", Shader::OnError::Warn},
                            {"throw", "Throw error", Shader::OnError::Throw}},
                           0)
+    , shaderCache_("shaderCache", "Cache compiled shaders", true)
+    , btnClearShaderCache_("clearShaderCache", "Clear Shader Cache")
+    , parallelShaderCompilation_("parallelShaderCompilation", "Parallel shader compilation", true)
     , debugMessages_("debugMessages", "Debug",
                      {{utilgl::debug::Mode::Off},
                       {utilgl::debug::Mode::Debug},
@@ -72,6 +75,9 @@ OpenGLSettings::OpenGLSettings()
     addProperty(btnOpenGLInfo_);
     addProperty(uniformWarnings_);
     addProperty(shaderObjectErrors_);
+    addProperty(shaderCache_);
+    addProperty(btnClearShaderCache_);
+    addProperty(parallelShaderCompilation_);
     addProperty(debugMessages_);
     addProperty(debugSeverity_);
     addProperty(breakOnMessage_);
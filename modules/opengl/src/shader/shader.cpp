@@ -147,10 +147,14 @@ Shader::Shader(Shader&& rhs)
     , shaderObjects_{std::move(rhs.shaderObjects_)}
     , attached_{std::move(rhs.attached_)}
     , ready_(rhs.ready_)
+    , pending_(rhs.pending_)
+    , compiled_(rhs.compiled_)
+    , pendingSources_{std::move(rhs.pendingSources_)}
     , warningLevel_{rhs.warningLevel_} {
 
     rhs.callbacks_.clear();
     rhs.ready_ = false;
+    rhs.pending_ = false;
 
     for (auto& elem : shaderObjects_) {
         callbacks_.emplace_back(elem.onChange([this](ShaderObject* o) { rebuildShader(o); }));
@@ -175,6 +179,8 @@ Shader& Shader::operator=(const Shader& that) {
                 shaderObjects_.back().onChange([this](ShaderObject* o) { rebuildShader(o); }));
         }
         warningLevel_ = that.warningLevel_;
+        pending_ = false;
+        compiled_ = true;
 
         if (that.isReady()) build();
         if (!ShaderManager::getPtr()->isRegistered(this)) {
@@ -199,11 +205,15 @@ Shader& Shader::operator=(Shader&& that) {
 
         program_ = std::move(that.program_);
         ready_ = that.ready_;
+        pending_ = that.pending_;
+        compiled_ = that.compiled_;
+        pendingSources_ = std::move(that.pendingSources_);
         warningLevel_ = that.warningLevel_;
         shaderObjects_ = std::move(that.shaderObjects_);
         attached_ = std::move(that.attached_);
 
         that.ready_ = false;
+        that.pending_ = false;
         that.callbacks_.clear();
 
         for (auto& elem : shaderObjects_) {
@@ -241,8 +251,56 @@ void Shader::detach() {
 void Shader::build() {
     try {
         ready_ = false;
-        for (auto& elem : shaderObjects_) elem.build();
+        pending_ = false;
+        for (auto& elem : shaderObjects_) elem.preprocess();
+
+        auto manager = ShaderManager::getPtr();
+        auto& cache = manager->getShaderCache();
+        auto sources = programSources();
+        if (cache.loadProgram(program_.id, sources)) {
+            // The shader objects are compiled if the program has to be linked again
+            compiled_ = false;
+            uniformLookup_.clear();
+            ready_ = true;
+            return;
+        }
+
+        for (auto& elem : shaderObjects_) elem.upload();
+
+        if (manager->useParallelCompilation()) {
+            // Submit everything and leave the driver to compile in the background. The result is
+            // checked the first time the program is needed, see finishBuild.
+            for (auto& elem : shaderObjects_) elem.startCompile();
+            compiled_ = true;
+            attach();
+            uniformLookup_.clear();
+            bindAttributes();
+            cache.prepareProgram(program_.id);
+            glLinkProgram(program_.id);
+            pendingSources_ = std::move(sources);
+            pending_ = true;
+            return;
+        }
+
+        for (auto& elem : shaderObjects_) elem.compile();
+        compiled_ = true;
         linkShader();
+        if (ready_) cache.storeProgram(program_.id, sources);
+    } catch (OpenGLException& e) {
+        handleError(e);
+    }
+}
+
+void Shader::finishBuild() const {
+    if (!pending_) return;
+    pending_ = false;
+    try {
+        for (const auto& elem : shaderObjects_) elem.checkCompileStatus();
+        checkLinkResult();
+        LGL_ERROR_CLASS;
+        ready_ = true;
+        ShaderManager::getPtr()->getShaderCache().storeProgram(program_.id, pendingSources_);
+        pendingSources_.clear();
     } catch (OpenGLException& e) {
         handleError(e);
     }
@@ -251,6 +309,7 @@ void Shader::build() {
 void Shader::link() {
     try {
         ready_ = false;
+        pending_ = false;
         linkShader();
     } catch (OpenGLException& e) {
         handleError(e);
@@ -258,6 +317,13 @@ void Shader::link() {
 }
 
 void Shader::linkShader(bool notifyRebuild) {
+    if (!compiled_) {
+        for (auto& elem : shaderObjects_) {
+            elem.upload();
+            elem.compile();
+        }
+        compiled_ = true;
+    }
     attach();
 
     uniformLookup_.clear();  // clear uniform location cache.
@@ -269,8 +335,16 @@ void Shader::linkShader(bool notifyRebuild) {
         return;
     }
 
+    ShaderManager::getPtr()->getShaderCache().prepareProgram(program_.id);
     glLinkProgram(program_.id);
+    checkLinkResult();
 
+    LGL_ERROR_CLASS;
+    ready_ = true;
+    if (notifyRebuild) onReloadCallback_.invokeAll();
+}
+
+void Shader::checkLinkResult() const {
     if (!checkLinkStatus()) {
         throw OpenGLException("Id: " + toString(program_.id) + " " +
                                   processLog(utilgl::getProgramInfoLog(program_.id)),
@@ -283,10 +357,15 @@ void Shader::linkShader(bool notifyRebuild) {
                   "Id: " + toString(program_.id) + " (" + shaderNames() + ") " + processLog(log),
                   LogLevel::Info, LogAudience::User);
     }
+}
 
-    LGL_ERROR_CLASS;
-    ready_ = true;
-    if (notifyRebuild) onReloadCallback_.invokeAll();
+std::string Shader::programSources() const {
+    std::string sources;
+    for (const auto& obj : shaderObjects_) {
+        fmt::format_to(std::back_inserter(sources), "{}\n{}\n", obj.getShaderType().name(),
+                       obj.getProcessedSource());
+    }
+    return sources;
 }
 
 bool Shader::checkLinkStatus() const {
@@ -313,6 +392,7 @@ void Shader::bindAttributes() {
 void Shader::rebuildShader(ShaderObject* obj) {
     try {
         ready_ = false;
+        pending_ = false;
         obj->build();
         linkShader();
 
@@ -334,7 +414,7 @@ void Shader::rebuildShader(ShaderObject* obj) {
     }
 }
 
-void Shader::handleError(OpenGLException& e) {
+void Shader::handleError(OpenGLException& e) const {
     auto onError = ShaderManager::getPtr()->getOnShaderError();
     switch (onError) {
         case Shader::OnError::Warn:
@@ -383,9 +463,17 @@ std::string Shader::processLog(std::string log) const {
     return result.str();
 }
 
-bool Shader::isReady() const { return ready_; }
+bool Shader::isReady() const {
+    try {
+        finishBuild();
+    } catch (const OpenGLException& e) {
+        util::log(e.getContext(), e.getMessage(), LogLevel::Error, LogAudience::User);
+    }
+    return ready_;
+}
 
 void Shader::activate() {
+    finishBuild();
     if (!ready_)
         throw OpenGLException(
             "Shader Id: " + toString(program_.id) + " not ready: " + shaderNames(), IVW_CONTEXT);
@@ -419,6 +507,7 @@ std::string Shader::shaderNames() const {
 }
 
 GLint Shader::findUniformLocation(std::string_view name) const {
+    finishBuild();
     auto it = uniformLookup_.find(name);
     if (it != uniformLookup_.end()) {
         return it->second;
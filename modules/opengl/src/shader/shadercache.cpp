@@ -0,0 +1,318 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/opengl/shader/shadercache.h>
+
+#include <modules/opengl/shader/shaderresource.h>
+#include <modules/opengl/openglcapabilities.h>
+#include <inviwo/core/util/constexprhash.h>
+#include <inviwo/core/util/filesystem.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <system_error>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t maxPreprocessed = 1024;
+constexpr std::array<char, 8> magic{'I', 'V', 'W', 'P', 'R', 'O', 'G', '1'};
+
+// 64 bit FNV-1a, the keys are used as file names and have to be the same in every build
+constexpr std::uint64_t fnv1a(std::string_view str,
+                              std::uint64_t hash = 0xcbf29ce484222325ULL) {
+    for (const auto c : str) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string glString(GLenum name) {
+    const auto str = glGetString(name);
+    return str ? std::string{reinterpret_cast<const char*>(str)} : std::string{};
+}
+
+}  // namespace
+
+ShaderCache::ShaderCache(std::string directory, size_t maxBinaryBytes, size_t maxDiskBytes)
+    : preprocessed_{}
+    , preprocessedOrder_{}
+    , directory_{std::move(directory)}
+    , programCacheEnabled_{true}
+    , programCacheSupported_{}
+    , driver_{}
+    , binaries_{}
+    , binaryOrder_{}
+    , binaryBytes_{0}
+    , maxBinaryBytes_{maxBinaryBytes}
+    , maxDiskBytes_{maxDiskBytes} {}
+
+std::uint64_t ShaderCache::hash(std::string_view source) { return util::constexpr_hash(source); }
+
+auto ShaderCache::getPreprocessed(std::string_view key, const ShaderResource& resource,
+                                  const GetResource& getResource) const
+    -> std::shared_ptr<const Preprocessed> {
+    const auto it = preprocessed_.find(key);
+    if (it == preprocessed_.end()) return nullptr;
+
+    const auto& entry = *it->second;
+    if (entry.resource.get() != &resource || entry.hash != hash(resource.source())) {
+        return nullptr;
+    }
+    for (const auto& inc : entry.includes) {
+        if (getResource(inc.path) != inc.resource || inc.hash != hash(inc.resource->source())) {
+            return nullptr;
+        }
+    }
+    return it->second;
+}
+
+void ShaderCache::addPreprocessed(std::string key,
+                                  std::shared_ptr<const Preprocessed> preprocessed) {
+    auto [it, inserted] = preprocessed_.insert_or_assign(key, std::move(preprocessed));
+    if (!inserted) return;
+
+    preprocessedOrder_.push_back(std::move(key));
+    while (preprocessedOrder_.size() > maxPreprocessed) {
+        preprocessed_.erase(preprocessedOrder_.front());
+        preprocessedOrder_.pop_front();
+    }
+}
+
+size_t ShaderCache::getNumberOfPreprocessed() const { return preprocessed_.size(); }
+
+void ShaderCache::setProgramCacheEnabled(bool enabled) { programCacheEnabled_ = enabled; }
+
+bool ShaderCache::isProgramCacheEnabled() {
+    if (!programCacheEnabled_) return false;
+    if (!programCacheSupported_) {
+        GLint formats = 0;
+        if (OpenGLCapabilities::getOpenGLVersion() >= 410 ||
+            OpenGLCapabilities::isExtensionSupported("GL_ARB_get_program_binary")) {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        programCacheSupported_ = formats > 0;
+        driver_ = glString(GL_VENDOR) + "\n" + glString(GL_RENDERER) + "\n" +
+                  glString(GL_VERSION) + "\n" + glString(GL_SHADING_LANGUAGE_VERSION);
+    }
+    return *programCacheSupported_;
+}
+
+void ShaderCache::prepareProgram(GLuint program) {
+    if (!isProgramCacheEnabled()) return;
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+bool ShaderCache::loadProgram(GLuint program, std::string_view sources) {
+    if (!isProgramCacheEnabled()) return false;
+
+    const auto [key, check] = programKey(driver_, sources);
+    const auto binary = findBinary(key, check);
+    if (!binary) return false;
+
+    glProgramBinary(program, binary->format, binary->data.data(),
+                    static_cast<GLsizei>(binary->data.size()));
+    // An unsupported format gives GL_INVALID_ENUM, which is handled by the link status below
+    glGetError();
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        removeBinary(key);
+        if (!directory_.empty()) std::remove(programFile(key).c_str());
+        return false;
+    }
+    return true;
+}
+
+void ShaderCache::storeProgram(GLuint program, std::string_view sources) {
+    if (!isProgramCacheEnabled()) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    const auto [key, check] = programKey(driver_, sources);
+    auto binary = std::make_shared<Binary>();
+    binary->check = check;
+    binary->data.resize(static_cast<size_t>(length));
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &binary->format, binary->data.data());
+    if (written <= 0) return;
+    binary->data.resize(static_cast<size_t>(written));
+
+    if (!directory_.empty()) {
+        {
+            auto out = filesystem::ofstream(programFile(key), std::ios::out | std::ios::binary);
+            writeBinary(out, *binary);
+        }
+        trimDirectory(directory_, maxDiskBytes_);
+    }
+    addBinary(key, std::move(binary));
+}
+
+void ShaderCache::clearPrograms() {
+    if (!directory_.empty()) {
+        for (const auto& file : filesystem::getDirectoryContents(directory_)) {
+            if (filesystem::getFileExtension(file) == "bin") {
+                std::remove((directory_ + "/" + file).c_str());
+            }
+        }
+    }
+    binaries_.clear();
+    binaryOrder_.clear();
+    binaryBytes_ = 0;
+}
+
+std::pair<std::uint64_t, std::uint64_t> ShaderCache::programKey(std::string_view driver,
+                                                                std::string_view sources) {
+    // the driver description never contains a null character, separates it from the sources
+    const auto key = fnv1a(sources, fnv1a(std::string_view{"\0", 1}, fnv1a(driver)));
+    return {key, util::constexpr_hash(driver) * 31 + util::constexpr_hash(sources)};
+}
+
+void ShaderCache::trimDirectory(const std::string& directory, size_t maxBytes) {
+    namespace fs = std::filesystem;
+    struct File {
+        fs::path path;
+        fs::file_time_type time;
+        std::uintmax_t size;
+    };
+    std::vector<File> files;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(fs::u8path(directory), ec)) {
+        if (entry.path().extension() != ".bin") continue;
+        const auto time = entry.last_write_time(ec);
+        if (ec) continue;
+        const auto size = entry.file_size(ec);
+        if (ec) continue;
+        files.push_back({entry.path(), time, size});
+    }
+    // most recently used first
+    std::sort(files.begin(), files.end(),
+              [](const File& a, const File& b) { return a.time > b.time; });
+
+    std::uintmax_t bytes = 0;
+    for (size_t i = 0; i < files.size(); ++i) {
+        bytes += files[i].size;
+        if (i > 0 && bytes > maxBytes) fs::remove(files[i].path, ec);
+    }
+}
+
+void ShaderCache::writeBinary(std::ostream& os, const Binary& binary) {
+    const std::uint32_t format = binary.format;
+    const std::uint64_t size = binary.data.size();
+    os.write(magic.data(), magic.size());
+    os.write(reinterpret_cast<const char*>(&binary.check), sizeof(binary.check));
+    os.write(reinterpret_cast<const char*>(&format), sizeof(format));
+    os.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    os.write(binary.data.data(), binary.data.size());
+}
+
+auto ShaderCache::readBinary(std::istream& is, std::uint64_t check, size_t maxBytes)
+    -> std::shared_ptr<Binary> {
+    std::array<char, 8> fileMagic{};
+    std::uint64_t fileCheck = 0;
+    std::uint32_t format = 0;
+    std::uint64_t size = 0;
+    is.read(fileMagic.data(), fileMagic.size());
+    is.read(reinterpret_cast<char*>(&fileCheck), sizeof(fileCheck));
+    is.read(reinterpret_cast<char*>(&format), sizeof(format));
+    is.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!is || fileMagic != magic || fileCheck != check || size > maxBytes) return nullptr;
+
+    auto binary = std::make_shared<Binary>();
+    binary->format = static_cast<GLenum>(format);
+    binary->check = fileCheck;
+    binary->data.resize(static_cast<size_t>(size));
+    is.read(binary->data.data(), binary->data.size());
+    if (!is) return nullptr;
+    return binary;
+}
+
+std::string ShaderCache::programFile(std::uint64_t key) const {
+    return fmt::format("{}/{:016x}.bin", directory_, key);
+}
+
+auto ShaderCache::findBinary(std::uint64_t key, std::uint64_t check)
+    -> std::shared_ptr<const Binary> {
+    if (auto it = binaries_.find(key); it != binaries_.end()) {
+        if (it->second->check != check) return nullptr;
+        binaryOrder_.erase(std::find(binaryOrder_.begin(), binaryOrder_.end(), key));
+        binaryOrder_.push_back(key);
+        return it->second;
+    }
+    if (directory_.empty()) return nullptr;
+
+    auto in = filesystem::ifstream(programFile(key), std::ios::in | std::ios::binary);
+    if (!in) return nullptr;
+
+    std::shared_ptr<const Binary> binary = readBinary(in, check, maxBinaryBytes_);
+    if (binary) {
+        addBinary(key, binary);
+        // mark it as recently used for trimDirectory
+        std::error_code ec;
+        std::filesystem::last_write_time(std::filesystem::u8path(programFile(key)),
+                                         std::filesystem::file_time_type::clock::now(), ec);
+    }
+    return binary;
+}
+
+void ShaderCache::addBinary(std::uint64_t key, std::shared_ptr<const Binary> binary) {
+    removeBinary(key);
+    binaryBytes_ += binary->data.size();
+    binaries_[key] = std::move(binary);
+    binaryOrder_.push_back(key);
+
+    while (binaryBytes_ > maxBinaryBytes_ && binaryOrder_.size() > 1) {
+        removeBinary(binaryOrder_.front());
+    }
+}
+
+void ShaderCache::removeBinary(std::uint64_t key) {
+    if (auto it = binaries_.find(key); it != binaries_.end()) {
+        binaryBytes_ -= it->second->data.size();
+        binaries_.erase(it);
+        binaryOrder_.erase(std::find(binaryOrder_.begin(), binaryOrder_.end(), key));
+    }
+}
+
+size_t ShaderCache::getNumberOfBinaries() const { return binaries_.size(); }
+
+size_t ShaderCache::getBinaryBytes() const { return binaryBytes_; }
+
+}  // namespace inviwo
@@ -48,7 +48,27 @@ namespace inviwo {
 ShaderManager* ShaderManager::instance_ = nullptr;
 
 ShaderManager::ShaderManager()
-    : openGLInfoRef_{nullptr}, uniformWarnings_(nullptr), shaderObjectErrors_{nullptr} {}
+    : openGLInfoRef_{nullptr}
+    , shaderCache_{InviwoApplication::isInitialized()
+                       ? InviwoApplication::getPtr()->getPath(PathType::Settings, "/shader_cache",
+                                                              true)
+                       : ""}
+    , parallelCompilationSupported_{}
+    , uniformWarnings_(nullptr)
+    , shaderObjectErrors_{nullptr}
+    , parallelCompilation_{nullptr} {
+
+    if (InviwoApplication::isInitialized()) {
+        // Embedded sources point into module libraries, which might be unloaded after this.
+        onModulesWillUnregister_ =
+            InviwoApplication::getPtr()->getModuleManager().onModulesWillUnregister([this]() {
+                while (!embeddedResources_.empty()) {
+                    const std::string key = embeddedResources_.begin()->first;
+                    getShaderResource(key);
+                }
+            });
+    }
+}
 
 void ShaderManager::setOpenGLSettings(OpenGLSettings* settings) {
     uniformWarnings_ = &(settings->uniformWarnings_);
@@ -63,6 +83,30 @@ void ShaderManager::setOpenGLSettings(OpenGLSettings* settings) {
     });
 
     shaderObjectErrors_ = &(settings->shaderObjectErrors_);
+
+    shaderCache_.setProgramCacheEnabled(settings->shaderCache_.get());
+    settings->shaderCache_.onChange(
+        [this, settings]() { shaderCache_.setProgramCacheEnabled(settings->shaderCache_.get()); });
+    settings->btnClearShaderCache_.onChange([this]() { shaderCache_.clearPrograms(); });
+
+    parallelCompilation_ = &(settings->parallelShaderCompilation_);
+}
+
+ShaderCache& ShaderManager::getShaderCache() { return shaderCache_; }
+
+bool ShaderManager::useParallelCompilation() {
+    if (parallelCompilation_ && !parallelCompilation_->get()) return false;
+
+    if (!parallelCompilationSupported_) {
+        // The KHR and ARB extensions share enums and entry point, but glew only loads the ARB one
+        parallelCompilationSupported_ =
+            OpenGLCapabilities::isExtensionSupported("GL_KHR_parallel_shader_compile") ||
+            OpenGLCapabilities::isExtensionSupported("GL_ARB_parallel_shader_compile");
+        if (*parallelCompilationSupported_ && glMaxShaderCompilerThreadsARB) {
+            glMaxShaderCompilerThreadsARB(0xFFFFFFFF);  // Let the driver decide
+        }
+    }
+    return *parallelCompilationSupported_;
 }
 
 Shader::OnError ShaderManager::getOnShaderError() const { return shaderObjectErrors_->get(); }
@@ -99,21 +143,36 @@ void ShaderManager::addShaderResource(std::string key, std::string src) {
     replaceInString(src, "NEWLINE", "\n");
     auto resource = std::make_shared<StringShaderResource>(key, src);
     ownedResources_.push_back(resource);
+    embeddedResources_.erase(key);
     shaderResources_[key] = std::weak_ptr<ShaderResource>(resource);
 }
 
 void ShaderManager::addShaderResource(std::unique_ptr<ShaderResource> resource) {
     std::shared_ptr<ShaderResource> res(std::move(resource));
     ownedResources_.push_back(res);
+    embeddedResources_.erase(res->key());
     shaderResources_[res->key()] = std::weak_ptr<ShaderResource>(res);
 }
 
 void ShaderManager::addShaderResource(std::shared_ptr<ShaderResource> resource) {
     ownedResources_.push_back(resource);
+    embeddedResources_.erase(resource->key());
     shaderResources_[resource->key()] = std::weak_ptr<ShaderResource>(resource);
 }
 
+void ShaderManager::addEmbeddedShaderResource(std::string key, std::string_view source) {
+    shaderResources_.erase(key);
+    embeddedResources_[std::move(key)] = source;
+}
+
 std::shared_ptr<ShaderResource> ShaderManager::getShaderResource(std::string_view key) {
+    auto embedded = embeddedResources_.find(key);
+    if (embedded != embeddedResources_.end()) {
+        auto [resourceKey, source] = *embedded;
+        embeddedResources_.erase(embedded);
+        addShaderResource(resourceKey, std::string{source});
+    }
+
     auto it1 = shaderResources_.find(key);
     if (it1 != shaderResources_.end()) {
         if (!it1->second.expired()) {
@@ -438,10 +438,57 @@ void ShaderObject::preprocess() {
     auto holdOntoResources = includeResources_;  // Don't release until we have processed again.
     includeResources_.clear();
 
+    std::sort(shaderSegments_.begin(), shaderSegments_.end(),
+              [](const ShaderSegment& a, const ShaderSegment& b) {
+                  return std::tie(a.placeholder, a.priority) < std::tie(b.placeholder, b.priority);
+              });
+
     std::ostringstream source;
     addDefines(source);
-    parseSource(source);
+
+    auto manager = ShaderManager::getPtr();
+    auto& cache = manager->getShaderCache();
+    const auto getResource = [manager](std::string_view path) {
+        return std::shared_ptr<const ShaderResource>{manager->getShaderResource(path)};
+    };
+
+    // The header contains the version, defines, extensions, and declarations
+    std::string key = source.str();
+    fmt::format_to(std::back_inserter(key), "\n{}\n", resource_->key());
+    for (const auto& segment : shaderSegments_) {
+        fmt::format_to(std::back_inserter(key), "{}\n{}\n{}\n{}\n", segment.placeholder.key,
+                       segment.name, segment.priority, segment.snippet);
+    }
+
+    if (auto cached = cache.getPreprocessed(key, *resource_, getResource)) {
+        sourceProcessed_ = cached->source;
+        lnr_ = cached->lnr;
+        includeResources_.push_back(resource_);
+        for (const auto& inc : cached->includes) {
+            includeResources_.push_back(inc.resource);
+        }
+        for (const auto& res : includeResources_) {
+            resourceCallbacks_.push_back(
+                res->onChange([this](const ShaderResource*) { callbacks_.invoke(this); }));
+        }
+        return;
+    }
+
+    std::vector<std::string> includePaths;
+    parseSource(source, includePaths);
     sourceProcessed_ = source.str();
+
+    auto preprocessed = std::make_shared<ShaderCache::Preprocessed>();
+    preprocessed->source = sourceProcessed_;
+    preprocessed->lnr = lnr_;
+    preprocessed->resource = resource_;
+    preprocessed->hash = ShaderCache::hash(resource_->source());
+    // The first resource is the main resource, followed by the includes in order
+    for (size_t i = 0; i < includePaths.size(); ++i) {
+        const auto& res = includeResources_[i + 1];
+        preprocessed->includes.push_back({includePaths[i], res, ShaderCache::hash(res->source())});
+    }
+    cache.addPreprocessed(std::move(key), std::move(preprocessed));
 }
 
 void ShaderObject::addDefines(std::ostringstream& source) {
@@ -514,13 +561,13 @@ void ShaderObject::addStandardVertexInDeclarations() {
     addInDeclaration(InDeclaration{"in_TexCoord", 3, "vec3"});
 }
 
-void ShaderObject::parseSource(std::ostringstream& output) {
+void ShaderObject::parseSource(std::ostringstream& output, std::vector<std::string>& includePaths) {
     includeResources_.push_back(resource_);
     resourceCallbacks_.push_back(
         resource_->onChange([this](const ShaderResource*) { callbacks_.invoke(this); }));
 
-    auto getSource =
-        [this](std::string_view path) -> std::optional<std::pair<std::string, std::string>> {
+    auto getSource = [this, &includePaths](std::string_view path)
+        -> std::optional<std::pair<std::string, std::string>> {
         auto inc = ShaderManager::getPtr()->getShaderResource(path);
         if (!inc) {
             throw OpenGLException(
@@ -530,6 +577,7 @@ void ShaderObject::parseSource(std::ostringstream& output) {
         // Only include files once.
         if (util::find(includeResources_, inc) == includeResources_.end()) {
             includeResources_.push_back(inc);
+            includePaths.emplace_back(path);
             resourceCallbacks_.push_back(
                 inc->onChange([this](const ShaderResource*) { callbacks_.invoke(this); }));
             return std::pair{inc->key(), inc->source()};
@@ -538,10 +586,6 @@ void ShaderObject::parseSource(std::ostringstream& output) {
         }
     };
 
-    std::sort(shaderSegments_.begin(), shaderSegments_.end(),
-              [](const ShaderSegment& a, const ShaderSegment& b) {
-                  return std::tie(a.placeholder, a.priority) < std::tie(b.placeholder, b.priority);
-              });
     std::unordered_map<typename ShaderSegment::Placeholder, std::vector<ShaderSegment>>
         replacements;
     for (const auto& segment : shaderSegments_) {
@@ -583,6 +627,8 @@ void ShaderObject::upload() {
     }
 }
 
+const std::string& ShaderObject::getProcessedSource() const { return sourceProcessed_; }
+
 bool ShaderObject::isReady() const {
     if (id_ == 0) return false;
     GLint res = GL_FALSE;
@@ -591,9 +637,18 @@ bool ShaderObject::isReady() const {
 }
 
 void ShaderObject::compile() {
+    startCompile();
+    checkCompileStatus();
+}
+
+void ShaderObject::startCompile() {
     LGL_ERROR_CLASS;
     create();
     glCompileShader(id_);
+}
+
+void ShaderObject::checkCompileStatus() const {
+    LGL_ERROR_CLASS;
     if (!isReady()) {
         throw OpenGLException(resource_->key() + " " + resolveLog(utilgl::getShaderInfoLog(id_)),
                               IVW_CONTEXT);
@@ -0,0 +1,254 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/opengl/shader/shadercache.h>
+#include <modules/opengl/shader/shaderresource.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace inviwo {
+
+namespace {
+
+struct CacheFixture {
+    CacheFixture() {
+        auto preprocessed = std::make_shared<ShaderCache::Preprocessed>();
+        preprocessed->source = "main\ninc";
+        preprocessed->resource = main;
+        preprocessed->hash = ShaderCache::hash(main->source());
+        preprocessed->includes.push_back({"inc", inc, ShaderCache::hash(inc->source())});
+        cache.addPreprocessed("key", preprocessed);
+    }
+
+    std::shared_ptr<const ShaderResource> getResource(std::string_view path) const {
+        return path == "inc" ? current : nullptr;
+    }
+
+    std::shared_ptr<StringShaderResource> main =
+        std::make_shared<StringShaderResource>("main", "main\n#include \"inc\"");
+    std::shared_ptr<StringShaderResource> inc =
+        std::make_shared<StringShaderResource>("inc", "inc");
+    std::shared_ptr<const ShaderResource> current = inc;
+    ShaderCache cache;
+};
+
+}  // namespace
+
+TEST(ShaderCache, PreprocessedHit) {
+    CacheFixture f;
+    auto getResource = [&](std::string_view path) { return f.getResource(path); };
+
+    auto cached = f.cache.getPreprocessed("key", *f.main, getResource);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ("main\ninc", cached->source);
+    EXPECT_FALSE(f.cache.getPreprocessed("other", *f.main, getResource));
+}
+
+TEST(ShaderCache, PreprocessedChangedSource) {
+    CacheFixture f;
+    auto getResource = [&](std::string_view path) { return f.getResource(path); };
+
+    f.inc->setSource("changed");
+    EXPECT_FALSE(f.cache.getPreprocessed("key", *f.main, getResource));
+    f.inc->setSource("inc");
+    EXPECT_TRUE(f.cache.getPreprocessed("key", *f.main, getResource));
+}
+
+TEST(ShaderCache, PreprocessedChangedResource) {
+    CacheFixture f;
+    auto getResource = [&](std::string_view path) { return f.getResource(path); };
+
+    // An include path that resolves to another resource, for example after adding a search path
+    f.current = std::make_shared<StringShaderResource>("inc", "inc");
+    EXPECT_FALSE(f.cache.getPreprocessed("key", *f.main, getResource));
+
+    f.current = f.inc;
+    StringShaderResource otherMain("main", "main\n#include \"inc\"");
+    EXPECT_FALSE(f.cache.getPreprocessed("key", otherMain, getResource));
+}
+
+namespace {
+
+std::shared_ptr<ShaderCache::Binary> makeBinary(size_t size, std::uint64_t check = 1) {
+    auto binary = std::make_shared<ShaderCache::Binary>();
+    binary->format = 42;
+    binary->check = check;
+    binary->data.resize(size);
+    for (size_t i = 0; i < size; ++i) binary->data[i] = static_cast<char>(i);
+    return binary;
+}
+
+}  // namespace
+
+TEST(ShaderCache, ProgramKey) {
+    const auto [key, check] = ShaderCache::programKey("driver", "sources");
+    EXPECT_EQ(std::make_pair(key, check), ShaderCache::programKey("driver", "sources"));
+    // The key names the file on disk, it must not change between builds or sessions
+    EXPECT_EQ(std::uint64_t{0xd4ab4bd5aa3aadf9}, key);
+
+    const auto [otherDriverKey, otherDriverCheck] = ShaderCache::programKey("update", "sources");
+    EXPECT_NE(key, otherDriverKey);
+    EXPECT_NE(check, otherDriverCheck);
+    const auto [otherSourcesKey, otherSourcesCheck] = ShaderCache::programKey("driver", "other");
+    EXPECT_NE(key, otherSourcesKey);
+    EXPECT_NE(check, otherSourcesCheck);
+}
+
+TEST(ShaderCache, BinaryFormat) {
+    const auto binary = makeBinary(100, 7);
+    std::stringstream ss;
+    ShaderCache::writeBinary(ss, *binary);
+
+    const auto str = ss.str();
+    ASSERT_EQ(8 + 8 + 4 + 8 + 100, str.size());
+    EXPECT_EQ("IVWPROG1", str.substr(0, 8));
+
+    auto read = ShaderCache::readBinary(ss, 7);
+    ASSERT_TRUE(read);
+    EXPECT_EQ(binary->format, read->format);
+    EXPECT_EQ(binary->check, read->check);
+    EXPECT_EQ(binary->data, read->data);
+}
+
+TEST(ShaderCache, BinaryRejected) {
+    const auto binary = makeBinary(100, 7);
+    std::stringstream ss;
+    ShaderCache::writeBinary(ss, *binary);
+    const auto str = ss.str();
+
+    {
+        SCOPED_TRACE("Stale check");
+        std::stringstream in{str};
+        EXPECT_FALSE(ShaderCache::readBinary(in, 8));
+    }
+    {
+        SCOPED_TRACE("Bad magic");
+        auto bad = str;
+        bad[7] = '2';
+        std::stringstream in{bad};
+        EXPECT_FALSE(ShaderCache::readBinary(in, 7));
+    }
+    {
+        SCOPED_TRACE("Too large");
+        std::stringstream in{str};
+        EXPECT_FALSE(ShaderCache::readBinary(in, 7, 99));
+    }
+    {
+        SCOPED_TRACE("Truncated data");
+        std::stringstream in{str.substr(0, str.size() - 1)};
+        EXPECT_FALSE(ShaderCache::readBinary(in, 7));
+    }
+    {
+        SCOPED_TRACE("Truncated header");
+        std::stringstream in{str.substr(0, 12)};
+        EXPECT_FALSE(ShaderCache::readBinary(in, 7));
+    }
+}
+
+TEST(ShaderCache, BinaryLRU) {
+    ShaderCache cache{"", 250};
+
+    cache.addBinary(1, makeBinary(100, 11));
+    cache.addBinary(2, makeBinary(100, 12));
+    EXPECT_EQ(2, cache.getNumberOfBinaries());
+    EXPECT_EQ(200, cache.getBinaryBytes());
+
+    EXPECT_TRUE(cache.findBinary(1, 11));
+    EXPECT_FALSE(cache.findBinary(1, 12)) << "binary stored for other sources";
+    EXPECT_FALSE(cache.findBinary(3, 13));
+
+    // 1 was used more recently than 2, so 2 is removed first
+    cache.addBinary(3, makeBinary(100, 13));
+    EXPECT_EQ(2, cache.getNumberOfBinaries());
+    EXPECT_EQ(200, cache.getBinaryBytes());
+    EXPECT_TRUE(cache.findBinary(1, 11));
+    EXPECT_FALSE(cache.findBinary(2, 12));
+    EXPECT_TRUE(cache.findBinary(3, 13));
+
+    // Replacing a binary does not count it twice
+    cache.addBinary(3, makeBinary(50, 13));
+    EXPECT_EQ(2, cache.getNumberOfBinaries());
+    EXPECT_EQ(150, cache.getBinaryBytes());
+
+    // The last added binary is kept even if it is larger than the limit
+    cache.addBinary(4, makeBinary(300, 14));
+    EXPECT_EQ(1, cache.getNumberOfBinaries());
+    EXPECT_EQ(300, cache.getBinaryBytes());
+    EXPECT_TRUE(cache.findBinary(4, 14));
+
+    cache.removeBinary(4);
+    EXPECT_EQ(0, cache.getNumberOfBinaries());
+    EXPECT_EQ(0, cache.getBinaryBytes());
+}
+
+TEST(ShaderCache, TrimDirectory) {
+    namespace fs = std::filesystem;
+    const auto dir = fs::temp_directory_path() / "inviwo-shadercache-test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    // four binaries of 100 bytes, 0.bin is the least recently used
+    const auto now = fs::file_time_type::clock::now();
+    for (int i = 0; i < 4; ++i) {
+        const auto file = dir / (std::to_string(i) + ".bin");
+        {
+            std::ofstream out{file, std::ios::binary};
+            out << std::string(100, 'x');
+        }
+        fs::last_write_time(file, now - std::chrono::hours{4 - i});
+    }
+    {
+        std::ofstream out{dir / "other.txt"};
+        out << std::string(1000, 'x');
+    }
+
+    ShaderCache::trimDirectory(dir.string(), 250);
+    EXPECT_FALSE(fs::exists(dir / "0.bin"));
+    EXPECT_FALSE(fs::exists(dir / "1.bin"));
+    EXPECT_TRUE(fs::exists(dir / "2.bin"));
+    EXPECT_TRUE(fs::exists(dir / "3.bin"));
+    EXPECT_TRUE(fs::exists(dir / "other.txt")) << "only binaries are removed";
+
+    // The most recently used binary is kept even if it is larger than the limit
+    ShaderCache::trimDirectory(dir.string(), 50);
+    EXPECT_FALSE(fs::exists(dir / "2.bin"));
+    EXPECT_TRUE(fs::exists(dir / "3.bin"));
+
+    fs::remove_all(dir);
+}
+
+}  // namespace inviwo
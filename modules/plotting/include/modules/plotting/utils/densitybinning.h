@@ -0,0 +1,155 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/plotting/plottingmoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace plot {
+
+/**
+ * \brief A 2D histogram of points, with the number of selected points kept separately for each
+ * bin. Bins are stored row by row, i.e. x varies fastest.
+ */
+struct IVW_MODULE_PLOTTING_API Histogram2D {
+    size2_t bins{0};
+    std::vector<std::uint32_t> counts;
+    std::vector<std::uint32_t> selected;
+    std::uint32_t maxCount = 0;
+
+    size_t index(size_t x, size_t y) const { return y * bins.x + x; }
+    std::uint32_t count(size_t x, size_t y) const { return counts[index(x, y)]; }
+    std::uint32_t selectedCount(size_t x, size_t y) const { return selected[index(x, y)]; }
+};
+
+/**
+ * \brief Data axis used for binning. Values inside \p range are mapped linearly onto \p bins
+ * equally sized bins, the upper bound is included in the last bin. Values outside the range and
+ * NaNs are not counted.
+ */
+struct IVW_MODULE_PLOTTING_API BinningAxis {
+    std::shared_ptr<const BufferBase> data;
+    dvec2 range{0.0, 1.0};
+    size_t bins = 1;
+};
+
+/**
+ * \class DensityBinner
+ * \brief Computes 2D histograms for pairs of data axes, progressively in chunks of rows.
+ *
+ * Each call to update() bins the next chunk of rows in parallel and adds it to the histograms,
+ * which makes it possible to show a partial result while binning large data sets over several
+ * frames. Filtered rows are skipped and selected rows are, in addition to the bin counts,
+ * counted into Histogram2D::selected. The binning does not depend on OpenGL.
+ *
+ * Only buffers with scalar formats are supported.
+ */
+class IVW_MODULE_PLOTTING_API DensityBinner {
+public:
+    using AxisPair = std::pair<size_t, size_t>;
+    static constexpr size_t defaultChunkSize = 1 << 20;
+
+    DensityBinner() = default;
+
+    /**
+     * \brief restart binning of \p axes. One histogram is computed for each pair of axis indices
+     * in \p pairs, where the first axis is mapped onto x and the second one onto y. The number
+     * of rows is given by the smallest axis. \p filtered and \p selected are indexed by row and
+     * can be shorter than the number of rows or empty, missing rows are neither filtered nor
+     * selected.
+     */
+    void reset(std::vector<BinningAxis> axes, std::vector<AxisPair> pairs,
+               std::vector<bool> filtered = {}, std::vector<bool> selected = {});
+    /**
+     * \brief remove all axes and histograms
+     */
+    void clear();
+
+    /**
+     * \brief bin the next \p maxRows rows
+     * @return true if all rows have been binned
+     */
+    bool update(size_t maxRows = defaultChunkSize);
+    /**
+     * \brief bin all remaining rows
+     */
+    void finish();
+
+    bool isComplete() const { return processed_ >= rows_; }
+    /**
+     * \brief fraction of rows that have been binned so far, in [0, 1]
+     */
+    double getProgress() const;
+    size_t getNumberOfRows() const { return rows_; }
+    size_t getNumberOfProcessedRows() const { return processed_; }
+
+    const std::vector<AxisPair>& getPairs() const { return pairs_; }
+    const std::vector<Histogram2D>& getHistograms() const { return histograms_; }
+
+private:
+    std::vector<BinningAxis> axes_;
+    std::vector<AxisPair> pairs_;
+    std::vector<bool> filtered_;
+    std::vector<bool> selected_;
+    std::vector<Histogram2D> histograms_;
+    size_t rows_ = 0;
+    size_t processed_ = 0;
+};
+
+/**
+ * \brief map the rows [begin, end) of \p data onto \p bins equally sized bins within \p range.
+ * Rows outside the range are set to \p invalid. \p data has to be of a scalar format.
+ * @see BinningAxis
+ */
+IVW_MODULE_PLOTTING_API void computeBinIndices(const BufferRAM& data, dvec2 range, size_t bins,
+                                               size_t begin, size_t end,
+                                               std::vector<std::uint32_t>& result,
+                                               std::uint32_t invalid);
+
+/**
+ * \brief compute the 2D histogram of \p x and \p y in one go
+ * @see DensityBinner
+ */
+IVW_MODULE_PLOTTING_API Histogram2D binPoints(const BinningAxis& x, const BinningAxis& y,
+                                              std::vector<bool> filtered = {},
+                                              std::vector<bool> selected = {});
+
+}  // namespace plot
+
+}  // namespace inviwo
@@ -0,0 +1,157 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/plotting/plottingmoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/datastructures/buffer/buffer.h>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace inviwo {
+
+namespace plot {
+
+/**
+ * \class PointIndexCache
+ * \brief Keeps the filter and selection state of a set of points together with the index lists
+ * needed for drawing them.
+ *
+ * The index lists are maintained from the changes in brushing state rather than being rebuilt
+ * on every change. Selecting or deselecting points only touches the changed points, while a
+ * change in filtering recreates the list of visible points by a parallel compaction. If radii
+ * are given, the visible points are ordered by decreasing radius. This order is computed once
+ * and reused until different radii are set.
+ *
+ * All indices are point (row) indices, which are mapped through the index map, if any, in the
+ * resulting index lists.
+ */
+class IVW_MODULE_PLOTTING_API PointIndexCache {
+public:
+    PointIndexCache() = default;
+
+    size_t size() const { return filtered_.size(); }
+    /**
+     * \brief change the number of points. Existing points keep their state, new points are
+     * neither filtered nor selected.
+     */
+    void resize(size_t size);
+
+    const std::vector<bool>& getFiltered() const { return filtered_; }
+    const std::vector<bool>& getSelected() const { return selected_; }
+    bool isFiltered(size_t index) const { return filtered_[index]; }
+    bool isSelected(size_t index) const { return selected_[index]; }
+    size_t getNumberOfFiltered() const { return nFiltered_; }
+
+    /**
+     * \brief update the filter state of all points, the cache is resized if necessary
+     * @return number of points whose state changed
+     */
+    size_t setFiltered(const std::vector<bool>& filtered);
+    /**
+     * \brief update the selection state of all points, the cache is resized if necessary
+     * @return number of points whose state changed
+     */
+    size_t setSelected(const std::vector<bool>& selected);
+    /**
+     * \brief select exactly the points in \p indices, indices outside the cache are ignored
+     * @return number of points whose state changed
+     */
+    size_t setSelected(const std::unordered_set<size_t>& indices);
+    void setSelected(size_t index, bool selected);
+
+    /**
+     * \brief map point indices to the values of \p map in the index lists, nullptr for identity
+     */
+    void setIndexMap(std::shared_ptr<const Buffer<std::uint32_t>> map);
+    /**
+     * \brief order the visible points by decreasing radius, nullptr for increasing point index.
+     * The order is only recomputed if \p radii is a different buffer than the current one.
+     */
+    void setRadii(std::shared_ptr<const BufferBase> radii);
+
+    /**
+     * \brief all points that are not filtered, ordered by decreasing radius if radii are set
+     */
+    const std::vector<std::uint32_t>& getVisibleIndices();
+    /**
+     * \brief all points that are selected and not filtered, in no particular order
+     */
+    const std::vector<std::uint32_t>& getSelectedIndices();
+    /**
+     * \brief incremented each time the content of getVisibleIndices() changes
+     */
+    size_t getVisibleVersion() const { return visibleVersion_; }
+    /**
+     * \brief incremented each time the content of getSelectedIndices() changes
+     */
+    size_t getSelectedVersion() const { return selectedVersion_; }
+
+    /**
+     * \brief sort the point indices in \p indices by decreasing radius, using the cached order.
+     * Does nothing if no radii are set.
+     */
+    void sortByRadius(std::vector<std::uint32_t>& indices);
+
+private:
+    void updateOrder();
+    // remove points that are filtered or no longer selected from selectedPoints_
+    void pruneSelectedPoints();
+    const std::vector<std::uint32_t>* indexMapData() const;
+
+    std::vector<bool> filtered_;
+    std::vector<bool> selected_;
+    size_t nFiltered_ = 0;
+
+    std::shared_ptr<const Buffer<std::uint32_t>> indexMap_;
+
+    std::shared_ptr<const BufferBase> radii_;
+    bool orderDirty_ = false;
+    std::vector<std::uint32_t> order_;  ///< points ordered by decreasing radius
+    std::vector<std::uint32_t> rank_;   ///< position of each point in order_
+
+    // selected and not filtered points, in point indices
+    std::vector<std::uint32_t> selectedPoints_;
+
+    bool visibleDirty_ = true;
+    size_t visibleVersion_ = 0;
+    std::vector<std::uint32_t> visible_;
+
+    bool selectedDirty_ = true;
+    size_t selectedVersion_ = 0;
+    std::vector<std::uint32_t> selectedIndices_;
+};
+
+}  // namespace plot
+
+}  // namespace inviwo
@@ -0,0 +1,212 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/plotting/utils/densitybinning.h>
+
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace inviwo {
+
+namespace plot {
+
+namespace {
+
+constexpr std::uint32_t invalidBin = std::numeric_limits<std::uint32_t>::max();
+
+// Chunks smaller than this are binned in a single job
+constexpr size_t minRowsPerJob = 1 << 16;
+
+size_t numberOfJobs(size_t rows, size_t totalBins) {
+    // Each job fills its own histograms, which are merged afterwards. Only split the rows if
+    // the merge is cheap compared to the binning itself.
+    const auto rowsPerJob = std::max(minRowsPerJob, totalBins);
+    const auto threads = util::parallelForThreads();
+    if (threads <= 1 || rows < 2 * rowsPerJob) return 1;
+    return std::min(threads, rows / rowsPerJob);
+}
+
+Histogram2D emptyHistogram(size2_t bins) {
+    Histogram2D hist;
+    hist.bins = bins;
+    hist.counts.resize(bins.x * bins.y, 0);
+    hist.selected.resize(bins.x * bins.y, 0);
+    return hist;
+}
+
+}  // namespace
+
+void DensityBinner::reset(std::vector<BinningAxis> axes, std::vector<AxisPair> pairs,
+                          std::vector<bool> filtered, std::vector<bool> selected) {
+    for (auto& pair : pairs) {
+        if (pair.first >= axes.size() || pair.second >= axes.size()) {
+            throw Exception("Axis pair refers to a non-existing axis",
+                            IVW_CONTEXT_CUSTOM("DensityBinner"));
+        }
+    }
+
+    rows_ = axes.empty() ? 0 : std::numeric_limits<size_t>::max();
+    for (auto& axis : axes) {
+        rows_ = std::min(rows_, axis.data ? axis.data->getSize() : size_t{0});
+    }
+    processed_ = 0;
+
+    histograms_.clear();
+    histograms_.reserve(pairs.size());
+    for (auto& pair : pairs) {
+        histograms_.push_back(emptyHistogram({axes[pair.first].bins, axes[pair.second].bins}));
+    }
+
+    axes_ = std::move(axes);
+    pairs_ = std::move(pairs);
+    filtered_ = std::move(filtered);
+    selected_ = std::move(selected);
+}
+
+void DensityBinner::clear() { reset({}, {}); }
+
+bool DensityBinner::update(size_t maxRows) {
+    if (isComplete()) return true;
+
+    const size_t begin = processed_;
+    const size_t end = begin + std::min(maxRows, rows_ - begin);
+
+    // representations have to be accessed from this thread
+    std::vector<const BufferRAM*> rams;
+    for (auto& axis : axes_) rams.push_back(axis.data->getRepresentation<BufferRAM>());
+
+    size_t totalBins = 0;
+    for (auto& hist : histograms_) totalBins += hist.counts.size();
+
+    const auto jobs = numberOfJobs(end - begin, totalBins);
+    const auto rowsPerJob = (end - begin + jobs - 1) / jobs;
+    std::vector<std::vector<Histogram2D>> partial(jobs > 1 ? jobs : 0);
+
+    util::parallelFor(jobs, [&](size_t job) {
+        const auto jobBegin = begin + job * rowsPerJob;
+        const auto jobEnd = std::min(end, jobBegin + rowsPerJob);
+        if (jobBegin >= jobEnd) return;
+
+        std::vector<std::vector<std::uint32_t>> binIndices(axes_.size());
+        for (size_t i = 0; i < axes_.size(); ++i) {
+            computeBinIndices(*rams[i], axes_[i].range, axes_[i].bins, jobBegin, jobEnd,
+                              binIndices[i], invalidBin);
+        }
+
+        if (jobs > 1) {
+            for (auto& hist : histograms_) partial[job].push_back(emptyHistogram(hist.bins));
+        }
+        auto& dest = jobs > 1 ? partial[job] : histograms_;
+
+        for (size_t p = 0; p < pairs_.size(); ++p) {
+            const auto& xs = binIndices[pairs_[p].first];
+            const auto& ys = binIndices[pairs_[p].second];
+            auto& hist = dest[p];
+            for (size_t i = 0; i < xs.size(); ++i) {
+                if (xs[i] == invalidBin || ys[i] == invalidBin) continue;
+                const auto row = jobBegin + i;
+                if (row < filtered_.size() && filtered_[row]) continue;
+
+                const auto bin = hist.index(xs[i], ys[i]);
+                ++hist.counts[bin];
+                if (row < selected_.size() && selected_[row]) ++hist.selected[bin];
+            }
+        }
+    });
+
+    for (auto& jobHistograms : partial) {
+        for (size_t p = 0; p < jobHistograms.size(); ++p) {
+            auto& hist = histograms_[p];
+            const auto& src = jobHistograms[p];
+            for (size_t i = 0; i < hist.counts.size(); ++i) {
+                hist.counts[i] += src.counts[i];
+                hist.selected[i] += src.selected[i];
+            }
+        }
+    }
+    for (auto& hist : histograms_) {
+        hist.maxCount = hist.counts.empty()
+                            ? 0
+                            : *std::max_element(hist.counts.begin(), hist.counts.end());
+    }
+
+    processed_ = end;
+    return isComplete();
+}
+
+void DensityBinner::finish() { update(rows_ - processed_); }
+
+double DensityBinner::getProgress() const {
+    if (rows_ == 0) return 1.0;
+    return static_cast<double>(processed_) / static_cast<double>(rows_);
+}
+
+void computeBinIndices(const BufferRAM& data, dvec2 range, size_t bins, size_t begin, size_t end,
+                       std::vector<std::uint32_t>& result, std::uint32_t invalid) {
+    result.resize(end - begin);
+    if (bins == 0) {
+        std::fill(result.begin(), result.end(), invalid);
+        return;
+    }
+
+    const double extent = range.y - range.x;
+    const double scale = extent > 0.0 ? static_cast<double>(bins) / extent : 0.0;
+    const auto lastBin = static_cast<std::uint32_t>(bins - 1);
+
+    data.dispatch<void, dispatching::filter::Scalars>([&](auto ram) {
+        const auto values = ram->getDataTyped();
+        for (size_t i = begin; i < end; ++i) {
+            const auto v = static_cast<double>(values[i]);
+            // written to also reject NaN
+            if (!(v >= range.x && v <= range.y)) {
+                result[i - begin] = invalid;
+            } else {
+                const auto bin = static_cast<std::uint32_t>((v - range.x) * scale);
+                result[i - begin] = std::min(bin, lastBin);
+            }
+        }
+    });
+}
+
+Histogram2D binPoints(const BinningAxis& x, const BinningAxis& y, std::vector<bool> filtered,
+                      std::vector<bool> selected) {
+    DensityBinner binner;
+    binner.reset({x, y}, {{0, 1}}, std::move(filtered), std::move(selected));
+    binner.finish();
+    return binner.getHistograms().front();
+}
+
+}  // namespace plot
+
+}  // namespace inviwo
@@ -0,0 +1,264 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/plotting/utils/pointindexcache.h>
+
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace inviwo {
+
+namespace plot {
+
+namespace {
+
+// Point sets smaller than twice this are compacted in a single job
+constexpr size_t minPointsPerJob = 1 << 18;
+
+}  // namespace
+
+void PointIndexCache::resize(size_t size) {
+    const auto oldSize = filtered_.size();
+    if (size == oldSize) return;
+
+    for (size_t i = size; i < oldSize; ++i) {
+        if (filtered_[i]) --nFiltered_;
+    }
+    filtered_.resize(size, false);
+    selected_.resize(size, false);
+    if (size < oldSize) {
+        util::erase_remove_if(selectedPoints_, [size](auto point) { return point >= size; });
+    }
+    orderDirty_ = true;
+    visibleDirty_ = true;
+    selectedDirty_ = true;
+}
+
+size_t PointIndexCache::setFiltered(const std::vector<bool>& filtered) {
+    resize(filtered.size());
+
+    size_t changed = 0;
+    bool removedSelected = false;
+    bool addedSelected = false;
+    for (size_t i = 0; i < filtered.size(); ++i) {
+        if (filtered[i] == filtered_[i]) continue;
+
+        filtered_[i] = filtered[i];
+        ++changed;
+        if (filtered[i]) {
+            ++nFiltered_;
+        } else {
+            --nFiltered_;
+        }
+        if (selected_[i]) {
+            if (filtered[i]) {
+                removedSelected = true;
+            } else {
+                selectedPoints_.push_back(static_cast<std::uint32_t>(i));
+                addedSelected = true;
+            }
+        }
+    }
+    if (removedSelected) pruneSelectedPoints();
+    if (removedSelected || addedSelected) selectedDirty_ = true;
+    if (changed > 0) visibleDirty_ = true;
+    return changed;
+}
+
+size_t PointIndexCache::setSelected(const std::vector<bool>& selected) {
+    resize(selected.size());
+
+    size_t changed = 0;
+    bool removedSelected = false;
+    for (size_t i = 0; i < selected.size(); ++i) {
+        if (selected[i] == selected_[i]) continue;
+
+        selected_[i] = selected[i];
+        ++changed;
+        if (filtered_[i]) continue;
+        if (selected[i]) {
+            selectedPoints_.push_back(static_cast<std::uint32_t>(i));
+        } else {
+            removedSelected = true;
+        }
+        selectedDirty_ = true;
+    }
+    if (removedSelected) pruneSelectedPoints();
+    return changed;
+}
+
+size_t PointIndexCache::setSelected(const std::unordered_set<size_t>& indices) {
+    std::vector<bool> selected(size(), false);
+    for (auto i : indices) {
+        if (i < selected.size()) selected[i] = true;
+    }
+    return setSelected(selected);
+}
+
+void PointIndexCache::setSelected(size_t index, bool selected) {
+    if (selected_[index] == selected) return;
+
+    selected_[index] = selected;
+    if (filtered_[index]) return;
+    if (selected) {
+        selectedPoints_.push_back(static_cast<std::uint32_t>(index));
+    } else {
+        util::erase_remove(selectedPoints_, static_cast<std::uint32_t>(index));
+    }
+    selectedDirty_ = true;
+}
+
+void PointIndexCache::setIndexMap(std::shared_ptr<const Buffer<std::uint32_t>> map) {
+    if (map == indexMap_) return;
+    indexMap_ = map;
+    visibleDirty_ = true;
+    selectedDirty_ = true;
+}
+
+void PointIndexCache::setRadii(std::shared_ptr<const BufferBase> radii) {
+    if (radii == radii_) return;
+    radii_ = radii;
+    orderDirty_ = true;
+    visibleDirty_ = true;
+}
+
+const std::vector<std::uint32_t>& PointIndexCache::getVisibleIndices() {
+    if (orderDirty_) updateOrder();
+    if (!visibleDirty_) return visible_;
+
+    const size_t n = size();
+    const auto* order = order_.empty() ? nullptr : order_.data();
+    const auto* indexMap = indexMapData();
+
+    // Write the visible points of [begin, end) in draw order to out
+    auto compact = [&](size_t begin, size_t end, std::uint32_t* out) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto point = order ? order[i] : static_cast<std::uint32_t>(i);
+            if (!filtered_[point]) *out++ = indexMap ? (*indexMap)[point] : point;
+        }
+    };
+
+    visible_.resize(n - nFiltered_);
+    const auto threads = util::parallelForThreads();
+    if (threads <= 1 || n < 2 * minPointsPerJob) {
+        compact(0, n, visible_.data());
+    } else {
+        // count the visible points of each chunk first to know where its output goes
+        const size_t chunk = std::max(minPointsPerJob, util::rangeCount(n, threads));
+        std::vector<size_t> offsets(util::rangeCount(n, chunk) + 1, 0);
+        util::parallelFor(n, chunk, [&](size_t begin, size_t end) {
+            size_t count = 0;
+            for (size_t i = begin; i < end; ++i) {
+                const auto point = order ? order[i] : i;
+                if (!filtered_[point]) ++count;
+            }
+            offsets[begin / chunk + 1] = count;
+        });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        util::parallelFor(n, chunk, [&](size_t begin, size_t end) {
+            compact(begin, end, visible_.data() + offsets[begin / chunk]);
+        });
+    }
+
+    visibleDirty_ = false;
+    ++visibleVersion_;
+    return visible_;
+}
+
+const std::vector<std::uint32_t>& PointIndexCache::getSelectedIndices() {
+    if (!selectedDirty_) return selectedIndices_;
+
+    if (const auto* indexMap = indexMapData()) {
+        selectedIndices_.resize(selectedPoints_.size());
+        std::transform(selectedPoints_.begin(), selectedPoints_.end(), selectedIndices_.begin(),
+                       [indexMap](auto point) { return (*indexMap)[point]; });
+    } else {
+        selectedIndices_ = selectedPoints_;
+    }
+
+    selectedDirty_ = false;
+    ++selectedVersion_;
+    return selectedIndices_;
+}
+
+void PointIndexCache::sortByRadius(std::vector<std::uint32_t>& indices) {
+    if (orderDirty_) updateOrder();
+    if (rank_.empty()) return;
+    std::sort(indices.begin(), indices.end(),
+              [this](std::uint32_t a, std::uint32_t b) { return rank_[a] < rank_[b]; });
+}
+
+void PointIndexCache::updateOrder() {
+    orderDirty_ = false;
+    order_.clear();
+    rank_.clear();
+    if (!radii_ || radii_->getSize() != size()) return;
+
+    order_.resize(size());
+    std::iota(order_.begin(), order_.end(), std::uint32_t{0});
+    radii_->getRepresentation<BufferRAM>()->dispatch<void, dispatching::filter::Scalars>(
+        [&](auto bufferpr) {
+            const auto& radii = bufferpr->getDataContainer();
+            // NaN radii are drawn last, ties are kept in point order
+            auto key = [&radii](std::uint32_t i) {
+                const auto r = static_cast<double>(radii[i]);
+                return std::isnan(r) ? -std::numeric_limits<double>::infinity() : r;
+            };
+            std::sort(order_.begin(), order_.end(), [&key](std::uint32_t a, std::uint32_t b) {
+                const auto ka = key(a);
+                const auto kb = key(b);
+                return ka > kb || (ka == kb && a < b);
+            });
+        });
+    rank_.resize(order_.size());
+    for (size_t i = 0; i < order_.size(); ++i) {
+        rank_[order_[i]] = static_cast<std::uint32_t>(i);
+    }
+    visibleDirty_ = true;
+}
+
+void PointIndexCache::pruneSelectedPoints() {
+    util::erase_remove_if(selectedPoints_,
+                          [this](auto point) { return filtered_[point] || !selected_[point]; });
+}
+
+const std::vector<std::uint32_t>* PointIndexCache::indexMapData() const {
+    return indexMap_ ? &indexMap_->getRAMRepresentation()->getDataContainer() : nullptr;
+}
+
+}  // namespace plot
+
+}  // namespace inviwo
@@ -0,0 +1,169 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <modules/plotting/utils/pointindexcache.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+#include <warn/push>
+#include <warn/ignore/unused-function>
+
+using namespace inviwo;
+
+namespace {
+
+std::shared_ptr<Buffer<float>> makeRadii(size_t count) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<float> radii(count);
+    std::generate(radii.begin(), radii.end(), [&]() { return dist(gen); });
+    return util::makeBuffer(std::move(radii));
+}
+
+// filter roughly a fraction of the points
+std::vector<bool> makeFilter(size_t count, double fraction, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::bernoulli_distribution dist(fraction);
+    std::vector<bool> filtered(count);
+    for (size_t i = 0; i < count; ++i) filtered[i] = dist(gen);
+    return filtered;
+}
+
+// The index building as done before the PointIndexCache, a full scan and sort for every change
+std::vector<std::uint32_t> rebuildIndices(const std::vector<bool>& filtered,
+                                          const std::vector<float>& radii) {
+    std::vector<std::uint32_t> inds;
+    inds.reserve(filtered.size());
+    for (size_t i = 0; i < filtered.size(); ++i) {
+        if (!filtered[i]) inds.push_back(static_cast<std::uint32_t>(i));
+    }
+    std::sort(inds.begin(), inds.end(),
+              [&radii](std::uint32_t a, std::uint32_t b) { return radii[a] > radii[b]; });
+    return inds;
+}
+
+void setPointRate(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+static void FullRebuild(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto radii = makeRadii(count);
+    const auto& radiiData = radii->getRAMRepresentation()->getDataContainer();
+    const std::array<std::vector<bool>, 2> filters = {makeFilter(count, 0.1, 1),
+                                                      makeFilter(count, 0.1, 2)};
+    size_t i = 0;
+    for (auto _ : state) {
+        auto inds = rebuildIndices(filters[++i % 2], radiiData);
+        benchmark::DoNotOptimize(inds);
+    }
+    setPointRate(state);
+}
+
+static void FilterChange(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const std::array<std::vector<bool>, 2> filters = {makeFilter(count, 0.1, 1),
+                                                      makeFilter(count, 0.1, 2)};
+    plot::PointIndexCache cache;
+    cache.resize(count);
+    cache.setRadii(makeRadii(count));
+    cache.getVisibleIndices();
+
+    size_t i = 0;
+    for (auto _ : state) {
+        cache.setFiltered(filters[++i % 2]);
+        benchmark::DoNotOptimize(cache.getVisibleIndices().data());
+    }
+    setPointRate(state);
+}
+
+static void SelectionToggle(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    plot::PointIndexCache cache;
+    cache.resize(count);
+    cache.setRadii(makeRadii(count));
+    cache.getVisibleIndices();
+
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto point = (i++ * 7919) % count;
+        cache.setSelected(point, !cache.isSelected(point));
+        benchmark::DoNotOptimize(cache.getSelectedIndices().data());
+        benchmark::DoNotOptimize(cache.getVisibleIndices().data());
+    }
+    setPointRate(state);
+}
+
+static void RadiusOrder(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    plot::PointIndexCache cache;
+    cache.resize(count);
+
+    for (auto _ : state) {
+        cache.setRadii(makeRadii(count));
+        benchmark::DoNotOptimize(cache.getVisibleIndices().data());
+    }
+    setPointRate(state);
+}
+
+BENCHMARK(FullRebuild)->RangeMultiplier(10)->Range(10000, 10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(FilterChange)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(SelectionToggle)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(RadiusOrder)->RangeMultiplier(10)->Range(10000, 10000000)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+
+    // The application provides the thread pool used to compact the visible indices
+    InviwoApplication app("bm-plotting-pointindexcache");
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
+
+#include <warn/pop>
@@ -0,0 +1,126 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/plotting/utils/densitybinning.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/util/exception.h>
+
+#include <cmath>
+#include <limits>
+
+namespace inviwo {
+
+TEST(DensityBinning, binIndices) {
+    auto buffer = util::makeBuffer<float>(
+        {0.0f, 0.24f, 0.25f, 0.99f, 1.0f, -0.1f, 1.1f, std::numeric_limits<float>::quiet_NaN()});
+    std::vector<std::uint32_t> bins;
+    plot::computeBinIndices(*buffer->getRepresentation<BufferRAM>(), {0.0, 1.0}, 4, 0,
+                            buffer->getSize(), bins, 99);
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 0, 1, 3, 3, 99, 99, 99}), bins);
+
+    plot::computeBinIndices(*buffer->getRepresentation<BufferRAM>(), {0.0, 1.0}, 4, 2, 4, bins,
+                            99);
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 3}), bins);
+}
+
+TEST(DensityBinning, histogram) {
+    auto x = util::makeBuffer<int>({0, 1, 2, 3, 3, 3});
+    auto y = util::makeBuffer<double>({0.0, 0.0, 1.0, 1.0, 1.0, 5.0});
+
+    auto hist = plot::binPoints({x, {0.0, 3.0}, 2}, {y, {0.0, 1.0}, 2});
+    EXPECT_EQ(size2_t(2, 2), hist.bins);
+    EXPECT_EQ(2, hist.count(0, 0));
+    EXPECT_EQ(0, hist.count(1, 0));
+    EXPECT_EQ(0, hist.count(0, 1));
+    EXPECT_EQ(3, hist.count(1, 1));
+    EXPECT_EQ(3, hist.maxCount);
+}
+
+TEST(DensityBinning, brushing) {
+    auto x = util::makeBuffer<float>({0.1f, 0.2f, 0.3f, 0.8f, 0.9f});
+    auto y = util::makeBuffer<float>({0.1f, 0.2f, 0.3f, 0.8f, 0.9f});
+
+    auto hist = plot::binPoints({x, {0.0, 1.0}, 2}, {y, {0.0, 1.0}, 2},
+                                {false, true, false, false, false}, {true, true, false, true});
+    EXPECT_EQ(2, hist.count(0, 0)) << "Filtered rows should not be counted";
+    EXPECT_EQ(1, hist.selectedCount(0, 0)) << "Filtered rows should not count as selected";
+    EXPECT_EQ(2, hist.count(1, 1));
+    EXPECT_EQ(1, hist.selectedCount(1, 1));
+}
+
+TEST(DensityBinning, progressive) {
+    const size_t size = 1000;
+    std::vector<float> a(size);
+    std::vector<float> b(size);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] = static_cast<float>(i) / size;
+        b[i] = std::sin(static_cast<float>(i));
+    }
+    auto bufA = util::makeBuffer(std::move(a));
+    auto bufB = util::makeBuffer(std::move(b));
+
+    const std::vector<plot::BinningAxis> axes{{bufA, {0.0, 1.0}, 10}, {bufB, {-1.0, 1.0}, 8}};
+
+    plot::DensityBinner complete;
+    complete.reset(axes, {{0, 1}, {1, 0}});
+    complete.finish();
+    ASSERT_TRUE(complete.isComplete());
+
+    plot::DensityBinner chunked;
+    chunked.reset(axes, {{0, 1}, {1, 0}});
+    size_t steps = 0;
+    while (!chunked.update(64)) {
+        ++steps;
+        EXPECT_LT(chunked.getProgress(), 1.0);
+    }
+    EXPECT_EQ(size / 64, steps);
+    EXPECT_EQ(1.0, chunked.getProgress());
+
+    ASSERT_EQ(2, chunked.getHistograms().size());
+    for (size_t i = 0; i < 2; ++i) {
+        EXPECT_EQ(complete.getHistograms()[i].counts, chunked.getHistograms()[i].counts);
+        EXPECT_EQ(complete.getHistograms()[i].maxCount, chunked.getHistograms()[i].maxCount);
+    }
+    EXPECT_EQ(size2_t(10, 8), chunked.getHistograms()[0].bins);
+    EXPECT_EQ(size2_t(8, 10), chunked.getHistograms()[1].bins);
+    EXPECT_EQ(complete.getHistograms()[0].count(3, 5), complete.getHistograms()[1].count(5, 3));
+}
+
+TEST(DensityBinning, invalidPair) {
+    auto x = util::makeBuffer<float>({0.1f});
+    plot::DensityBinner binner;
+    EXPECT_THROW(binner.reset({{x, {0.0, 1.0}, 2}}, {{0, 1}}), Exception);
+}
+
+}  // namespace inviwo
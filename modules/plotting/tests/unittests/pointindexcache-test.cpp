@@ -0,0 +1,108 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/plotting/utils/pointindexcache.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+
+#include <algorithm>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<std::uint32_t> sorted(std::vector<std::uint32_t> v) {
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+}  // namespace
+
+TEST(PointIndexCache, filtering) {
+    plot::PointIndexCache cache;
+    cache.resize(5);
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 2, 3, 4}), cache.getVisibleIndices());
+
+    EXPECT_EQ(2, cache.setFiltered({false, true, false, true, false}));
+    EXPECT_EQ(2, cache.getNumberOfFiltered());
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 2, 4}), cache.getVisibleIndices());
+
+    const auto version = cache.getVisibleVersion();
+    EXPECT_EQ(0, cache.setFiltered({false, true, false, true, false}));
+    cache.getVisibleIndices();
+    EXPECT_EQ(version, cache.getVisibleVersion()) << "Unchanged filter should not rebuild";
+}
+
+TEST(PointIndexCache, selection) {
+    plot::PointIndexCache cache;
+    cache.resize(6);
+    cache.setSelected({true, true, false, false, true, false});
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 1, 4}), sorted(cache.getSelectedIndices()));
+
+    cache.setFiltered({false, true, false, false, false, false});
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 4}), sorted(cache.getSelectedIndices()))
+        << "Filtered points should not be part of the selection";
+
+    cache.setSelected(0, false);
+    cache.setSelected(3, true);
+    EXPECT_EQ((std::vector<std::uint32_t>{3, 4}), sorted(cache.getSelectedIndices()));
+
+    cache.setFiltered(std::vector<bool>(6, false));
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 3, 4}), sorted(cache.getSelectedIndices()))
+        << "Selected points should reappear when no longer filtered";
+
+    cache.setSelected(std::unordered_set<size_t>{2, 5});
+    EXPECT_EQ((std::vector<std::uint32_t>{2, 5}), sorted(cache.getSelectedIndices()));
+}
+
+TEST(PointIndexCache, radiusOrder) {
+    auto radii = util::makeBuffer(std::vector<float>{1.0f, 3.0f, 2.0f, 3.0f});
+    auto indexMap = util::makeBuffer(std::vector<std::uint32_t>{10, 11, 12, 13});
+
+    plot::PointIndexCache cache;
+    cache.resize(4);
+    cache.setRadii(radii);
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 3, 2, 0}), cache.getVisibleIndices());
+
+    cache.setFiltered({false, false, false, true});
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 2, 0}), cache.getVisibleIndices());
+
+    cache.setIndexMap(indexMap);
+    EXPECT_EQ((std::vector<std::uint32_t>{11, 12, 10}), cache.getVisibleIndices());
+
+    std::vector<std::uint32_t> external{0, 2, 3};
+    cache.sortByRadius(external);
+    EXPECT_EQ((std::vector<std::uint32_t>{3, 2, 0}), external);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,60 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include "utils/structs.glsl"
+
+uniform sampler2D density;  // r: normalized log density, g: fraction of selected points
+uniform sampler2D densityTransferFunction;
+uniform vec4 selectionColor;
+
+uniform vec4 margins;  // top, right, bottom, left [pixel]
+uniform vec2 dims;
+
+in vec3 texCoord_;
+
+void main(void) {
+    vec2 pixel = texCoord_.xy * dims;
+    vec2 lowerLeft = margins.wz;
+    vec2 upperRight = dims - margins.yx;
+    if (any(lessThan(pixel, lowerLeft)) || any(greaterThan(pixel, upperRight))) {
+        discard;
+    }
+
+    vec2 value = texture(density, (pixel - lowerLeft) / (upperRight - lowerLeft)).rg;
+    if (value.r <= 0.0) {
+        discard;
+    }
+
+    vec4 color = texture(densityTransferFunction, vec2(value.r, 0.5));
+    color.rgb = mix(color.rgb, selectionColor.rgb, value.g * selectionColor.a);
+
+    color.rgb *= color.a;
+    FragData0 = color;
+    PickingData = vec4(0.0);
+}
@@ -33,6 +33,7 @@
 #include <inviwo/core/datastructures/transferfunction.h>
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <inviwo/core/interaction/pickingmapper.h>
+#include <inviwo/core/properties/optionproperty.h>
 #include <inviwo/core/properties/transferfunctionproperty.h>
 #include <inviwo/core/ports/imageport.h>
 #include <inviwo/core/util/dispatcher.h>
@@ -50,10 +51,13 @@
 #include <modules/plotting/properties/marginproperty.h>
 #include <modules/plotting/properties/axisproperty.h>
 #include <modules/plotting/properties/axisstyleproperty.h>
+#include <modules/plotting/utils/densitybinning.h>
+#include <modules/plotting/utils/pointindexcache.h>
 
 #include <modules/plottinggl/rendering/boxselectionrenderer.h>
 #include <modules/plottinggl/utils/axisrenderer.h>
 
+#include <memory>
 #include <optional>
 #include <unordered_set>
 
@@ -62,6 +66,7 @@ namespace inviwo {
 class Processor;
 class PickingEvent;
 class BufferObjectArray;
+class Layer;
 
 namespace plot {
 
@@ -72,6 +77,13 @@ public:
     using SelectionFunc = void(const std::vector<bool>&);
     using SelectionCallbackHandle = std::shared_ptr<std::function<SelectionFunc>>;
 
+    /**
+     * Points draws one glyph per row. Density aggregates the rows into screen space bins, which
+     * are binned progressively over several frames and drawn in constant time with respect to
+     * the number of rows.
+     */
+    enum class RenderMode { Points, Density };
+
     class Properties : public CompositeProperty {
     public:
         virtual std::string getClassIdentifier() const override;
@@ -85,10 +97,13 @@ public:
         virtual Properties* clone() const override;
         virtual ~Properties() = default;
 
+        TemplateOptionProperty<RenderMode> renderMode_;
         BoolProperty useCircle_;
         FloatProperty radiusRange_;
         FloatProperty minRadius_;
         TransferFunctionProperty tf_;
+        IntProperty densityBinSize_;  ///! Size of the density bins in pixels
+        TransferFunctionProperty densityTf_;
         FloatVec4Property color_;
         FloatVec4Property hoverColor_;
         FloatVec4Property selectionColor_;
@@ -107,14 +122,16 @@ public:
 
     private:
         auto props() {
-            return std::tie(radiusRange_, useCircle_, minRadius_, tf_, color_, hoverColor_,
-                            selectionColor_, boxSelectionSettings_, margins_, axisMargin_,
-                            borderWidth_, borderColor_, hovering_, axisStyle_, xAxis_, yAxis_);
+            return std::tie(renderMode_, radiusRange_, useCircle_, minRadius_, tf_,
+                            densityBinSize_, densityTf_, color_, hoverColor_, selectionColor_,
+                            boxSelectionSettings_, margins_, axisMargin_, borderWidth_,
+                            borderColor_, hovering_, axisStyle_, xAxis_, yAxis_);
         }
         auto props() const {
-            return std::tie(radiusRange_, useCircle_, minRadius_, tf_, color_, hoverColor_,
-                            selectionColor_, boxSelectionSettings_, margins_, axisMargin_,
-                            borderWidth_, borderColor_, hovering_, axisStyle_, xAxis_, yAxis_);
+            return std::tie(renderMode_, radiusRange_, useCircle_, minRadius_, tf_,
+                            densityBinSize_, densityTf_, color_, hoverColor_, selectionColor_,
+                            boxSelectionSettings_, margins_, axisMargin_, borderWidth_,
+                            borderColor_, hovering_, axisStyle_, xAxis_, yAxis_);
         }
     };
 
@@ -156,15 +173,17 @@ public:
 
     Properties properties_;
     Shader shader_;
+    Shader densityShader_;
 
 protected:
     void plot(const size2_t& dims, IndexBuffer* indices, bool useAxisRanges);
     void renderAxis(const size2_t& dims);
+    void renderDensity(const size2_t& dims, IndexBuffer* indices, bool useAxisRanges);
 
     void objectPicked(PickingEvent* p);
     uint32_t getGlobalPickId(uint32_t localIndex) const;
     /*
-     * Resizes selected_ and filtered_ according to currently set axes buffer size.
+     * Resizes the selection and filtering state according to currently set axes buffer size.
      */
     void ensureSelectAndFilterSizes();
 
@@ -184,11 +203,9 @@ protected:
     std::array<AxisRenderer, 2> axisRenderers_;
 
     PickingMapper picking_;
-    std::vector<bool> filtered_;
-    std::vector<bool> selected_;
-    size_t nSelectedButNotFiltered_ = 0;
-    bool filteringDirty_ = true;
-    bool selectedIndicesGLDirty_ = true;
+    PointIndexCache indexCache_;
+    std::optional<size_t> indicesVersion_;  ///< visible version of the cache held by indices_
+    std::optional<size_t> selectedIndicesGLVersion_;
     BufferObject selectedIndicesGL_ = BufferObject(sizeof(uint32_t), DataUInt32::get(),
                                                    BufferUsage::Dynamic, BufferTarget::Index);
     std::optional<uint32_t> hoverIndex_;
@@ -199,6 +216,23 @@ protected:
     std::unique_ptr<IndexBuffer> indices_;
     std::unique_ptr<BufferObjectArray> boa_;
 
+    // Input of the current density binning, binning restarts when any of these change
+    struct DensityInput {
+        std::shared_ptr<const BufferBase> x;
+        std::shared_ptr<const BufferBase> y;
+        dvec2 rangeX{0.0};
+        dvec2 rangeY{0.0};
+        size2_t bins{0};
+        std::vector<bool> filtered;
+        std::vector<bool> selected;
+    };
+    DensityInput densityInput_;
+    std::vector<std::uint32_t> densityIndices_;  ///< copy of the last external index buffer
+    std::vector<bool> densityFiltered_;          ///< filtering given by densityIndices_
+    std::shared_ptr<DensityBinner> densityBinner_ = std::make_shared<DensityBinner>();
+    std::optional<size_t> densityLayerRows_;  ///< number of binned rows shown in densityLayer_
+    std::shared_ptr<Layer> densityLayer_;
+
     Processor* processor_;
 
     Dispatcher<ToolTipFunc> tooltipCallback_;
@@ -31,6 +31,7 @@
 
 #include <modules/plottinggl/plottingglmoduledefine.h>
 #include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/datastructures/buffer/buffer.h>
 #include <inviwo/core/datastructures/geometry/typedmesh.h>
 #include <inviwo/core/interaction/pickingmapper.h>
 #include <inviwo/core/ports/imageport.h>
@@ -54,6 +55,7 @@
 #include <inviwo/dataframe/properties/dataframeproperty.h>
 #include <inviwo/dataframe/properties/dataframecolormapproperty.h>
 #include <modules/plotting/properties/marginproperty.h>
+#include <modules/plotting/utils/densitybinning.h>
 
 #include <modules/plottinggl/utils/axisrenderer.h>
 
@@ -63,6 +65,8 @@ class PickingEvent;
 /** \docpage{org.inviwo.ParallelCoordinates, Parallel Coordinates}
  * ![](org.inviwo.ParallelCoordinates.png?classIdentifier=org.inviwo.ParallelCoordinates)
  * This processor plots a given DataFrame using a Parallel Coordinate Plot.
+ * For large tables, the Density render mode aggregates the lines between neighboring axes into
+ * bins and draws one line per bin instead of one line per row.
  *
  * ### Inports
  *   * __DataFrame__  data input for plotting
@@ -81,6 +85,7 @@ public:
     enum class BlendMode { None = 0, Additive = 1, Sutractive = 2, Regular = 3 };
     enum class LabelPosition { None, Above, Below };
     enum class AxisSelection { Single, Multiple, None };
+    enum class RenderMode { Lines, Density };
 
 public:
     ParallelCoordinates();
@@ -107,6 +112,9 @@ public:
     TemplateOptionProperty<AxisSelection> axisSelection_;
 
     CompositeProperty lineSettings_;
+    TemplateOptionProperty<RenderMode> renderMode_;
+    IntSizeTProperty densityBins_;
+    FloatVec4Property densityColor_;
     TemplateOptionProperty<BlendMode> blendMode_;
     FloatProperty falllofPower_;
     FloatProperty lineWidth_;
@@ -171,6 +179,10 @@ private:
     void drawHandles(size2_t size);
     void drawLines(size2_t size);
 
+    void buildDensityAxes();
+    void updateDensity();
+    void drawDensity(size2_t size);
+
     void updateBrushing();
 
     std::pair<size2_t, size2_t> axisPos(size_t columnId) const;
@@ -218,6 +230,13 @@ private:
     };
     Lines lines_;
 
+    // Density mode: normalized values of each axis, binned for each pair of neighboring axes
+    std::vector<std::shared_ptr<Buffer<float>>> densityAxes_;
+    std::shared_ptr<DensityBinner> densityBinner_ = std::make_shared<DensityBinner>();
+    bool densityDirty_ = true;
+    Shader densityShader_;
+    ColoredMesh densityMesh_;
+
     std::pair<vec2, vec2> marginsInternal_;  // Margins with/without considering labels
     int hoveredLine_ = -1;
     int hoveredAxis_ = -1;
@@ -31,6 +31,7 @@
 #include <modules/opengl/buffer/buffergl.h>
 #include <modules/opengl/buffer/bufferobject.h>
 #include <modules/opengl/buffer/bufferobjectarray.h>
+#include <modules/opengl/image/layergl.h>
 #include <modules/opengl/shader/shaderutils.h>
 #include <modules/opengl/texture/textureutils.h>
 #include <modules/opengl/openglutils.h>
@@ -42,6 +43,8 @@
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <inviwo/core/datastructures/buffer/bufferram.h>
 #include <inviwo/core/datastructures/geometry/basicmesh.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
 #include <inviwo/core/properties/cameraproperty.h>
 #include <inviwo/core/util/colorconversion.h>
 #include <inviwo/core/util/zip.h>
@@ -59,11 +62,19 @@ ScatterPlotGL::Properties::Properties(std::string identifier, std::string displa
                                       InvalidationLevel invalidationLevel,
                                       PropertySemantics semantics)
     : CompositeProperty(identifier, displayName, invalidationLevel, semantics)
+    , renderMode_("renderMode", "Render Mode",
+                  {{"points", "Points", RenderMode::Points},
+                   {"density", "Density", RenderMode::Density}},
+                  0)
     , useCircle_("useCircle", "Use Circles (else squares)", true)
     , radiusRange_("radius", "Radius", 5, 0, 10, 0.01f)
     , minRadius_("minRadius", "Min Radius", 0.1f, 0, 10, 0.01f)
     , tf_("transferFunction", "Transfer Function",
           TransferFunction({{0.0, vec4(1.0f)}, {1.0, vec4(1.0f)}}))
+    , densityBinSize_("densityBinSize", "Density Bin Size", 4, 1, 32)
+    , densityTf_("densityTransferFunction", "Density Transfer Function",
+                 TransferFunction({{0.0, vec4(0.8f, 0.85f, 1.0f, 0.3f)},
+                                   {1.0, vec4(0.05f, 0.15f, 0.4f, 1.0f)}}))
     , color_("color", "Color", vec4(1, 0, 0, 1), vec4(0), vec4(1), vec4(0.1f),
              InvalidationLevel::InvalidOutput, PropertySemantics::Color)
     , hoverColor_("hoverColor", "Hover Color", vec4(1.0f, 0.906f, 0.612f, 1))
@@ -93,15 +104,23 @@ ScatterPlotGL::Properties::Properties(std::string identifier, std::string displa
     tf_.setVisible(!color_.getVisible());
     minRadius_.setVisible(false);
 
+    const auto isDensity = [](auto& p) { return p.get() == RenderMode::Density; };
+    densityBinSize_.visibilityDependsOn(renderMode_, isDensity);
+    densityTf_.visibilityDependsOn(renderMode_, isDensity);
+
     tf_.setCurrentStateAsDefault();
+    densityTf_.setCurrentStateAsDefault();
 }
 
 ScatterPlotGL::Properties::Properties(const ScatterPlotGL::Properties& rhs)
     : CompositeProperty(rhs)
+    , renderMode_(rhs.renderMode_)
     , useCircle_(rhs.useCircle_)
     , radiusRange_(rhs.radiusRange_)
     , minRadius_(rhs.minRadius_)
     , tf_(rhs.tf_)
+    , densityBinSize_(rhs.densityBinSize_)
+    , densityTf_(rhs.densityTf_)
     , color_(rhs.color_)
     , hoverColor_(rhs.hoverColor_)
     , selectionColor_(rhs.selectionColor_)
@@ -126,6 +145,7 @@ ScatterPlotGL::Properties* ScatterPlotGL::Properties::clone() const {
 ScatterPlotGL::ScatterPlotGL(Processor* processor)
     : properties_("scatterplot", "Scatterplot")
     , shader_("scatterplot.vert", "scatterplot.geom", "scatterplot.frag")
+    , densityShader_("img_texturequad.vert", "scatterplotdensity.frag")
     , xAxis_(nullptr)
     , yAxis_(nullptr)
     , color_(nullptr)
@@ -162,6 +182,8 @@ ScatterPlotGL::ScatterPlotGL(Processor* processor)
     , selectionRectRenderer_(properties_.boxSelectionSettings_) {
     if (processor_) {
         shader_.onReload([this]() { processor_->invalidate(InvalidationLevel::InvalidOutput); });
+        densityShader_.onReload(
+            [this]() { processor_->invalidate(InvalidationLevel::InvalidOutput); });
     }
     properties_.hovering_.onChange([this]() {
         if (!properties_.hovering_.get()) {
@@ -170,34 +192,18 @@ ScatterPlotGL::ScatterPlotGL(Processor* processor)
     });
 
     boxSelectionChangedCallBack_ = boxSelectionHandler_.addSelectionChangedCallback(
-        [this](const std::vector<bool>& selected, bool append) {
+        [this](const std::vector<bool>& selected, bool) {
             ensureSelectAndFilterSizes();
-            for (auto&& [ind, elem] : util::enumerate(selected)) {
-                if (append && elem)
-                    selected_[ind] = elem;
-                else {
-                    selected_[ind] = elem;
-                }
-            }
-
-            selectedIndicesGLDirty_ = true;
+            indexCache_.setSelected(selected);
             // selection changed, inform processor
-            selectionChangedCallback_.invoke(selected_);
+            selectionChangedCallback_.invoke(indexCache_.getSelected());
         });
     boxFilteringChangedCallBack_ = boxSelectionHandler_.addFilteringChangedCallback(
-        [this](const std::vector<bool>& filtered, bool append) {
+        [this](const std::vector<bool>& filtered, bool) {
             ensureSelectAndFilterSizes();
-            for (auto&& [ind, elem] : util::enumerate(filtered)) {
-                if (append && elem)
-                    filtered_[ind] = elem;
-                else {
-                    filtered_[ind] = elem;
-                }
-            }
-            filteringDirty_ = true;
             // May filter selected points
-            selectedIndicesGLDirty_ = true;
-            filteringChangedCallback_.invoke(filtered_);
+            indexCache_.setFiltered(filtered);
+            filteringChangedCallback_.invoke(indexCache_.getFiltered());
         });
 }
 
@@ -234,6 +240,12 @@ void ScatterPlotGL::plot(const ivec2& start, const ivec2& size, IndexBuffer* ind
 
 void ScatterPlotGL::plot(const size2_t& dims, IndexBuffer* indexBuffer, bool useAxisRanges) {
     ensureSelectAndFilterSizes();
+    if (properties_.renderMode_.get() == RenderMode::Density) {
+        renderDensity(dims, indexBuffer, useAxisRanges);
+        selectionRectRenderer_.render(boxSelectionHandler_.getDragRectangle(), dims);
+        renderAxis(dims);
+        return;
+    }
     // adjust all margins by axis margin
     vec4 margins = properties_.margins_.getAsVec4() + properties_.axisMargin_.get();
 
@@ -321,66 +333,27 @@ void ScatterPlotGL::plot(const size2_t& dims, IndexBuffer* indexBuffer, bool use
     }
     // Will be called if no indexBuffer is specified.
     // (assuming brushing & linking filters, so internal filters should not be applied)
-    auto setupInternalFiltering = [this, xbuf]() {
-        if (!filteringDirty_) return;
-
-        std::vector<uint32_t> selectedIndices;
-
-        // no indices given, draw all non-filtered data points
-        size_t nFiltered = std::count(filtered_.begin(), filtered_.end(), true);
-        // std::reduce<size_t>(filtered_.begin(), filtered_.end(), size_t(0), [);
-        auto nNotFiltered = xbuf->getSize() - nFiltered;
-
-        if (!indices_) indices_ = std::make_unique<IndexBuffer>(nNotFiltered);
-        auto& inds = indices_->getEditableRAMRepresentation()->getDataContainer();
-        inds.clear();
-        inds.reserve(nNotFiltered);
-
-        if (indexColumn_) {
-            auto& indexCol =
-                indexColumn_->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
-            for (auto [ind, filtered] : util::enumerate(filtered_)) {
-                if (!filtered) {
-                    inds.push_back(indexCol[ind]);
-                }
-            }
-        } else {
-            auto indicesSeq =
-                util::make_sequence<unsigned int>(0, static_cast<unsigned int>(xbuf->getSize()), 1);
-            std::copy_if(indicesSeq.begin(), indicesSeq.end(), std::back_inserter(inds),
-                         [this](auto val) { return !filtered_[val]; });
-        }
-        filteringDirty_ = false;
+    // The visible indices are already ordered by radius, if any.
+    auto setupInternalFiltering = [this]() {
+        const auto& visible = indexCache_.getVisibleIndices();
+        if (indices_ && indicesVersion_ == indexCache_.getVisibleVersion()) return;
+
+        if (!indices_) indices_ = std::make_unique<IndexBuffer>();
+        indices_->getEditableRAMRepresentation()->getDataContainer() = visible;
+        indicesVersion_ = indexCache_.getVisibleVersion();
     };
     IndexBuffer* indices;
-    if (radius_) {
-
-        if (indexBuffer) {
-            // copy selected indices
-            indices_ = std::unique_ptr<IndexBuffer>(indexBuffer->clone());
-        } else {
-            setupInternalFiltering();
-        }
+    if (radius_ && indexBuffer) {
+        // copy selected indices and sort according to radii, larger first
+        indices_ = std::unique_ptr<IndexBuffer>(indexBuffer->clone());
+        indicesVersion_.reset();
+        indexCache_.sortByRadius(indices_->getEditableRAMRepresentation()->getDataContainer());
         indices = indices_.get();
-
-        // sort according to radii, larger first
-        auto& inds = indices->getEditableRAMRepresentation()->getDataContainer();
-
-        radius_->getRepresentation<BufferRAM>()->dispatch<void, dispatching::filter::Scalars>(
-            [&inds](auto bufferpr) {
-                auto& radii = bufferpr->getDataContainer();
-                std::sort(inds.begin(), inds.end(), [&radii](const uint32_t& a, const uint32_t& b) {
-                    return radii[a] > radii[b];
-                });
-            });
+    } else if (indexBuffer) {
+        indices = indexBuffer;
     } else {
-        if (indexBuffer) {
-            // copy selected indices
-            indices = indexBuffer;
-        } else {
-            setupInternalFiltering();
-            indices = indices_.get();
-        }
+        setupInternalFiltering();
+        indices = indices_.get();
     }
 
     boa_->bind();
@@ -391,43 +364,23 @@ void ScatterPlotGL::plot(const size2_t& dims, IndexBuffer* indexBuffer, bool use
     indicesGL->getBufferObject()->unbind();
     // draw selected and hovered points on top
 
-    if (selectedIndicesGLDirty_ || nSelectedButNotFiltered_ > 0) {
+    const auto& selectedIndices = indexCache_.getSelectedIndices();
+    if (selectedIndicesGLVersion_ != indexCache_.getSelectedVersion()) {
+        if (selectedIndicesGL_.getSizeInBytes() <
+            static_cast<GLsizeiptr>(selectedIndices.size() * sizeof(uint32_t))) {
+            selectedIndicesGL_.setSizeInBytes(selectedIndices.size() * sizeof(uint32_t));
+        }
+        selectedIndicesGL_.upload(selectedIndices.data(),
+                                  selectedIndices.size() * sizeof(uint32_t));
+        selectedIndicesGLVersion_ = indexCache_.getSelectedVersion();
+    }
+    if (!selectedIndices.empty()) {
         shader_.setUniform("has_color", 0);
         shader_.setUniform("default_color", properties_.selectionColor_.get());
-        if (selectedIndicesGLDirty_) {
-            nSelectedButNotFiltered_ = 0;
-            std::vector<uint32_t> selectedIndices;
-            if (indexColumn_) {
-                auto& indexCol =
-                    indexColumn_->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
-                for (auto [ind, selected, filtered] : util::enumerate(selected_, filtered_)) {
-                    if (selected && !filtered) {
-                        selectedIndices.push_back(indexCol[ind]);
-                    }
-                }
-            } else {
-                for (auto [ind, selected, filtered] : util::enumerate(selected_, filtered_)) {
-                    if (selected && !filtered) {
-                        selectedIndices.push_back(static_cast<uint32_t>(ind));
-                    }
-                }
-            }
-
-            if (selectedIndicesGL_.getSizeInBytes() <
-                static_cast<GLsizeiptr>(selectedIndices.size() * sizeof(uint32_t))) {
-                selectedIndicesGL_.setSizeInBytes(selectedIndices.size() * sizeof(uint32_t));
-            }
-            nSelectedButNotFiltered_ = selectedIndices.size();
-            selectedIndicesGL_.upload(selectedIndices.data(),
-                                      selectedIndices.size() * sizeof(uint32_t));
-            selectedIndicesGLDirty_ = false;
-        }
-        if (nSelectedButNotFiltered_ > 0) {
-            selectedIndicesGL_.bind();
-            glDrawElements(GL_POINTS, static_cast<uint32_t>(nSelectedButNotFiltered_),
-                           selectedIndicesGL_.getFormatType(), nullptr);
-            selectedIndicesGL_.unbind();
-        }
+        selectedIndicesGL_.bind();
+        glDrawElements(GL_POINTS, static_cast<uint32_t>(selectedIndices.size()),
+                       selectedIndicesGL_.getFormatType(), nullptr);
+        selectedIndicesGL_.unbind();
     }
     if (hoverIndex_) {
         shader_.setUniform("has_color", 0);
@@ -453,6 +406,94 @@ void ScatterPlotGL::plot(const size2_t& dims, IndexBuffer* indexBuffer, bool use
     renderAxis(dims);
 }  // namespace plot
 
+void ScatterPlotGL::renderDensity(const size2_t& dims, IndexBuffer* indexBuffer,
+                                  bool useAxisRanges) {
+    const vec4 margins = properties_.margins_.getAsVec4() + properties_.axisMargin_.get();
+    const vec2 plotSize =
+        glm::max(vec2(dims) - vec2(margins.y + margins.w, margins.x + margins.z), vec2(1.0f));
+    const size2_t bins{glm::ceil(plotSize / static_cast<float>(properties_.densityBinSize_.get()))};
+
+    const dvec2 rangeX = useAxisRanges ? properties_.xAxis_.range_.get() : dvec2(minmaxX_);
+    const dvec2 rangeY = useAxisRanges ? properties_.yAxis_.range_.get() : dvec2(minmaxY_);
+
+    // An external index buffer holds the points to show, internal filtering is not applied
+    if (indexBuffer) {
+        const auto& indices = indexBuffer->getRAMRepresentation()->getDataContainer();
+        if (indices != densityIndices_ || densityFiltered_.size() != xAxis_->getSize()) {
+            densityIndices_ = indices;
+            densityFiltered_.assign(xAxis_->getSize(), true);
+            for (auto i : indices) {
+                if (i < densityFiltered_.size()) densityFiltered_[i] = false;
+            }
+        }
+    }
+    const auto& filtered = indexBuffer ? densityFiltered_ : indexCache_.getFiltered();
+
+    if (densityInput_.x != xAxis_ || densityInput_.y != yAxis_ || densityInput_.rangeX != rangeX ||
+        densityInput_.rangeY != rangeY || densityInput_.bins != bins ||
+        densityInput_.filtered != filtered || densityInput_.selected != indexCache_.getSelected()) {
+
+        densityInput_.x = xAxis_;
+        densityInput_.y = yAxis_;
+        densityInput_.rangeX = rangeX;
+        densityInput_.rangeY = rangeY;
+        densityInput_.bins = bins;
+        densityInput_.filtered = filtered;
+        densityInput_.selected = indexCache_.getSelected();
+
+        densityBinner_->reset({{xAxis_, rangeX, bins.x}, {yAxis_, rangeY, bins.y}}, {{0, 1}},
+                              densityInput_.filtered, densityInput_.selected);
+        densityLayerRows_.reset();
+    }
+
+    densityBinner_->update();
+
+    if (!densityLayer_ || densityLayer_->getDimensions() != bins) {
+        densityLayer_ = std::make_shared<Layer>(bins, DataVec2Float32::get(), LayerType::Color,
+                                                swizzlemasks::rgba, InterpolationType::Nearest);
+        densityLayerRows_.reset();
+    }
+    if (densityLayerRows_ != densityBinner_->getNumberOfProcessedRows()) {
+        const auto& hist = densityBinner_->getHistograms().front();
+        auto layerRAM = static_cast<LayerRAMPrecision<vec2>*>(
+            densityLayer_->getEditableRepresentation<LayerRAM>());
+        auto data = layerRAM->getDataTyped();
+
+        // log scale to keep sparse regions visible next to dense ones
+        const float logMax = std::log1p(static_cast<float>(hist.maxCount));
+        for (size_t i = 0; i < hist.counts.size(); ++i) {
+            const auto count = static_cast<float>(hist.counts[i]);
+            data[i] = hist.counts[i] == 0 ? vec2{0.0f}
+                                          : vec2{std::log1p(count) / logMax,
+                                                 static_cast<float>(hist.selected[i]) / count};
+        }
+        densityLayerRows_ = densityBinner_->getNumberOfProcessedRows();
+    }
+
+    densityShader_.activate();
+    TextureUnitContainer cont;
+    utilgl::bindAndSetUniforms(densityShader_, cont,
+                               *densityLayer_->getRepresentation<LayerGL>()->getTexture(),
+                               "density");
+    utilgl::bindAndSetUniforms(densityShader_, cont, properties_.densityTf_);
+    densityShader_.setUniform("selectionColor", properties_.selectionColor_.get());
+    densityShader_.setUniform("margins", margins);
+    densityShader_.setUniform("dims", vec2(dims));
+
+    utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    utilgl::singleDrawImagePlaneRect();
+    densityShader_.deactivate();
+
+    // Continue binning in the next frame. The invalidation has to be deferred since the
+    // processor is marked as valid after this evaluation.
+    if (!densityBinner_->isComplete() && processor_) {
+        dispatchFrontAndForget([binner = std::weak_ptr<DensityBinner>(densityBinner_),
+                                processor = processor_]() {
+            if (binner.lock()) processor->invalidate(InvalidationLevel::InvalidOutput);
+        });
+    }
+}
+
 void ScatterPlotGL::setXAxisLabel(const std::string& label) {
     properties_.xAxis_.setCaption(label);
 }
@@ -508,6 +549,7 @@ void ScatterPlotGL::setColorData(std::shared_ptr<const BufferBase> buffer) {
 
 void ScatterPlotGL::setRadiusData(std::shared_ptr<const BufferBase> buffer) {
     radius_ = buffer;
+    indexCache_.setRadii(buffer);
     if (buffer) {
         auto minmax = util::bufferMinMax(buffer.get(), IgnoreSpecialValues::Yes);
         minmaxR_.x = static_cast<float>(minmax.first.x);
@@ -518,6 +560,7 @@ void ScatterPlotGL::setRadiusData(std::shared_ptr<const BufferBase> buffer) {
 
 void ScatterPlotGL::setIndexColumn(std::shared_ptr<const TemplateColumn<uint32_t>> indexcol) {
     indexColumn_ = indexcol;
+    indexCache_.setIndexMap(indexColumn_ ? indexColumn_->getTypedBuffer() : nullptr);
 
     if (indexColumn_) {
         picking_.resize(indexColumn_->getSize());
@@ -534,12 +577,7 @@ void ScatterPlotGL::setIndexColumn(std::shared_ptr<const TemplateColumn<uint32_t
 
 void ScatterPlotGL::setSelectedIndices(const std::unordered_set<size_t>& indices) {
     ensureSelectAndFilterSizes();
-    std::fill(selected_.begin(), selected_.end(), false);
-    selected_.resize(xAxis_->getSize(), false);
-    for (auto i : indices) {
-        selected_[i] = true;
-    }
-    selectedIndicesGLDirty_ = true;
+    indexCache_.setSelected(indices);
 }
 
 auto ScatterPlotGL::addToolTipCallback(std::function<ToolTipFunc> callback)
@@ -629,11 +667,10 @@ void ScatterPlotGL::objectPicked(PickingEvent* p) {
         (p->getPressItem() == PickingPressItem::Primary) &&
         (p->getCurrentGlobalPickingId() == p->getPressedGlobalPickingId())) {
         ensureSelectAndFilterSizes();
-        selected_[id] = !selected_[id];
-        selectedIndicesGLDirty_ = true;
+        indexCache_.setSelected(id, !indexCache_.isSelected(id));
 
         // selection changed, inform processor
-        selectionChangedCallback_.invoke(selected_);
+        selectionChangedCallback_.invoke(indexCache_.getSelected());
     }
     p->setUsed(true);
 }
@@ -643,12 +680,7 @@ uint32_t ScatterPlotGL::getGlobalPickId(uint32_t localIndex) const {
 }
 
 void ScatterPlotGL::ensureSelectAndFilterSizes() {
-    if (xAxis_->getSize() != selected_.size() || xAxis_->getSize() != filtered_.size()) {
-        selected_.resize(xAxis_->getSize(), false);
-        filtered_.resize(xAxis_->getSize(), false);
-        selectedIndicesGLDirty_ = true;
-        filteringDirty_ = true;
-    }
+    indexCache_.resize(xAxis_->getSize());
 }
 
 }  // namespace plot
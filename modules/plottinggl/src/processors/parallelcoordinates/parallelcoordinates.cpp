@@ -31,6 +31,7 @@
 #include <modules/plottinggl/processors/parallelcoordinates/pcpaxissettings.h>
 #include <modules/plottinggl/plottingglmodule.h>
 
+#include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/datastructures/image/layer.h>
 #include <inviwo/core/datastructures/image/imageram.h>
 #include <inviwo/core/interaction/events/mouseevent.h>
@@ -55,6 +56,9 @@
 #include <inviwo/core/util/utilities.h>
 #include <inviwo/core/util/zip.h>
 
+#include <cmath>
+#include <future>
+
 namespace inviwo {
 
 namespace plot {
@@ -83,6 +87,14 @@ ParallelCoordinates::ParallelCoordinates()
                       {"none", "None", AxisSelection::None}},
                      1)
     , lineSettings_{"lines", "Line Settings"}
+    , renderMode_("renderMode", "Render Mode",
+                  {{"lines", "Lines", RenderMode::Lines},
+                   {"density", "Density", RenderMode::Density}},
+                  0)
+    , densityBins_("densityBins", "Density Bins", 64, 4, 512)
+    , densityColor_("densityColor", "Density Color", vec4(0.1f, 0.2f, 0.5f, 1.0f), vec4(0.0f),
+                    vec4(1.0f), vec4(0.01f), InvalidationLevel::InvalidOutput,
+                    PropertySemantics::Color)
     , blendMode_("blendMode", "Blend Mode",
                  {{"additive", "Additive", BlendMode::Additive},
                   {"subractive", "Subractive", BlendMode::Sutractive},
@@ -148,6 +160,8 @@ ParallelCoordinates::ParallelCoordinates()
                    [&](PickingEvent* p) { axisPicked(p, p->getPickedId(), PickType::Axis); })
     , lineShader_("pcp_lines.vert", "pcp_lines.geom", "pcp_lines.frag", Shader::Build::No)
     , lines_{}
+    , densityShader_("standard.vert", "standard.frag")
+    , densityMesh_(DrawType::Lines, ConnectivityType::None)
     , marginsInternal_(0.0f, 0.0f)
     , brushingDirty_(true)  // needs to be true after deserialization
 {
@@ -163,8 +177,12 @@ ParallelCoordinates::ParallelCoordinates()
     selectedLine_.setCollapsed(true);
 
     addProperty(lineSettings_);
-    lineSettings_.addProperties(blendMode_, falllofPower_, lineWidth_, selectedLine_, showFiltered_,
+    lineSettings_.addProperties(renderMode_, densityBins_, densityColor_, blendMode_,
+                                falllofPower_, lineWidth_, selectedLine_, showFiltered_,
                                 filterColor_, filterAlpha_, filterIntensity_);
+    const auto isDensity = [](auto& p) { return p.get() == RenderMode::Density; };
+    densityBins_.visibilityDependsOn(renderMode_, isDensity);
+    densityColor_.visibilityDependsOn(renderMode_, isDensity);
     lineSettings_.setCollapsed(true);
 
     addProperty(captionSettings_);
@@ -218,6 +236,7 @@ ParallelCoordinates::ParallelCoordinates()
         lineShader_.onReload([&]() { this->invalidate(InvalidationLevel::InvalidOutput); });
         lineShader_.build();
     }
+    densityShader_.onReload([&]() { this->invalidate(InvalidationLevel::InvalidOutput); });
 
     dataFrame_.onChange([&]() { createOrUpdateProperties(); });
 
@@ -298,7 +317,7 @@ void ParallelCoordinates::process() {
     }();
 
     if (brushingDirty_) updateBrushing();
-    if (colormap_.isModified() || dataFrame_.isChanged()) {
+    if (colormap_.isModified() || dataFrame_.isChanged() || renderMode_.isModified()) {
         buildLineMesh();
     } else if (enabledAxesModified_) {
         buildLineIndices();
@@ -317,13 +336,27 @@ void ParallelCoordinates::process() {
     utilgl::activateAndClearTarget(outport_, ImageType::ColorPicking);
     utilgl::GlBoolState depthTest(GL_DEPTH_TEST, false);
 
-    drawLines(dims);
+    if (renderMode_.get() == RenderMode::Density) {
+        if (densityBins_.isModified()) densityDirty_ = true;
+        updateDensity();
+        drawDensity(dims);
+    } else {
+        drawLines(dims);
+    }
     drawAxis(dims);
     drawHandles(dims);
 
     utilgl::deactivateCurrentTarget();
 
     enabledAxesModified_ = false;
+
+    // Continue binning in the next frame. The invalidation has to be deferred since the
+    // processor is set valid after this evaluation.
+    if (renderMode_.get() == RenderMode::Density && !densityBinner_->isComplete()) {
+        dispatchFrontAndForget([binner = std::weak_ptr<DensityBinner>(densityBinner_), this]() {
+            if (binner.lock()) invalidate(InvalidationLevel::InvalidOutput);
+        });
+    }
 }
 
 void ParallelCoordinates::createOrUpdateProperties() {
@@ -401,6 +434,11 @@ void ParallelCoordinates::createOrUpdateProperties() {
 }
 
 void ParallelCoordinates::buildLineMesh() {
+    if (renderMode_.get() == RenderMode::Density) {
+        buildDensityAxes();
+        return;
+    }
+
     auto& mesh = lines_.mesh;
 
     for (auto& item : mesh.getBuffers()) {
@@ -431,6 +469,12 @@ void ParallelCoordinates::buildLineMesh() {
 }
 
 void ParallelCoordinates::buildLineIndices() {
+    if (renderMode_.get() == RenderMode::Density) {
+        buildAxisPositions();
+        densityDirty_ = true;
+        return;
+    }
+
     const auto numberOfAxis = axes_.size();
     const auto numberOfEnabledAxis = enabledAxes_.size();
     const auto numberOfLines = dataFrame_.getData()->getNumberOfRows();
@@ -476,6 +520,11 @@ void ParallelCoordinates::buildAxisPositions() {
 }
 
 void ParallelCoordinates::partitionLines() {
+    if (renderMode_.get() == RenderMode::Density) {
+        densityDirty_ = true;
+        return;
+    }
+
     const auto numberOfEnabledAxis = enabledAxes_.size();
 
     const auto iCol = dataFrame_.getData()->getIndexColumn();
@@ -632,6 +681,123 @@ void ParallelCoordinates::drawLines(size2_t size) {
     lineShader_.deactivate();
 }
 
+void ParallelCoordinates::buildDensityAxes() {
+    const auto numberOfLines = dataFrame_.getData()->getNumberOfRows();
+
+    auto normalize = [numberOfLines](const PCPAxisSettings* pcp) {
+        std::vector<float> values(numberOfLines);
+        for (size_t i = 0; i < numberOfLines; ++i) {
+            values[i] = static_cast<float>(pcp->getNormalizedAt(i));
+        }
+        return util::makeBuffer(std::move(values));
+    };
+
+    densityAxes_.clear();
+    if (InviwoApplication::getPtr()->getPoolSize() > 0) {
+        std::vector<std::future<std::shared_ptr<Buffer<float>>>> futures;
+        for (auto& axis : axes_) {
+            futures.push_back(
+                dispatchPool([&normalize, pcp = axis.pcp]() { return normalize(pcp); }));
+        }
+        for (auto& f : futures) f.wait();
+        for (auto& f : futures) densityAxes_.push_back(f.get());
+    } else {
+        for (auto& axis : axes_) densityAxes_.push_back(normalize(axis.pcp));
+    }
+
+    buildAxisPositions();
+    densityDirty_ = true;
+    hoveredLine_ = -1;
+}
+
+void ParallelCoordinates::updateDensity() {
+    if (densityDirty_) {
+        densityDirty_ = false;
+
+        // The normalized values are in [0, 1], axis orientation is applied when drawing
+        const auto bins = densityBins_.get();
+        std::vector<BinningAxis> binAxes;
+        for (auto id : enabledAxes_) {
+            if (id < densityAxes_.size()) binAxes.push_back({densityAxes_[id], {0.0, 1.0}, bins});
+        }
+        std::vector<DensityBinner::AxisPair> pairs;
+        for (size_t i = 1; i < binAxes.size(); ++i) pairs.emplace_back(i - 1, i);
+
+        const auto iCol = dataFrame_.getData()->getIndexColumn();
+        const auto& indexCol = iCol->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+        std::vector<bool> filtered(indexCol.size());
+        std::vector<bool> selected(indexCol.size());
+        for (size_t i = 0; i < indexCol.size(); ++i) {
+            filtered[i] = brushingAndLinking_.isFiltered(indexCol[i]);
+            selected[i] = brushingAndLinking_.isSelected(indexCol[i]);
+        }
+
+        densityBinner_->reset(std::move(binAxes), std::move(pairs), std::move(filtered),
+                              std::move(selected));
+    }
+    densityBinner_->update();
+}
+
+void ParallelCoordinates::drawDensity(size2_t size) {
+    for (auto& item : densityMesh_.getBuffers()) {
+        item.second->getEditableRepresentation<BufferRAM>()->clear();
+    }
+
+    const auto& histograms = densityBinner_->getHistograms();
+    std::uint32_t maxCount = 0;
+    for (auto& hist : histograms) maxCount = std::max(maxCount, hist.maxCount);
+    if (maxCount == 0) return;
+
+    // One line between the bin centers of two neighboring axes for each non-empty 2D bin, with
+    // the opacity given by the (logarithmic) number of lines it represents
+    const float logMax = std::log1p(static_cast<float>(maxCount));
+    const auto color = densityColor_.get();
+    const auto selectColor = selectedLineColor_.get();
+    for (auto&& [hist, pair] : util::zip(histograms, densityBinner_->getPairs())) {
+        const auto axisA = enabledAxes_[pair.first];
+        const auto axisB = enabledAxes_[pair.second];
+        const auto xA = lines_.axisPositions[axisA];
+        const auto xB = lines_.axisPositions[axisB];
+        auto binCenter = [](size_t bin, size_t bins, bool flipped) {
+            const auto y = (static_cast<float>(bin) + 0.5f) / static_cast<float>(bins);
+            return flipped ? 1.0f - y : y;
+        };
+
+        for (size_t y = 0; y < hist.bins.y; ++y) {
+            for (size_t x = 0; x < hist.bins.x; ++x) {
+                const auto count = hist.count(x, y);
+                if (count == 0) continue;
+
+                auto c = glm::mix(color, selectColor,
+                                  static_cast<float>(hist.selectedCount(x, y)) / count);
+                c.a *= std::log1p(static_cast<float>(count)) / logMax;
+                densityMesh_.addVertex(
+                    vec3{xA, binCenter(x, hist.bins.x, lines_.axisFlipped[axisA] != 0), 0.0f}, c);
+                densityMesh_.addVertex(
+                    vec3{xB, binCenter(y, hist.bins.y, lines_.axisFlipped[axisB] != 0), 0.0f}, c);
+            }
+        }
+    }
+
+    // map the normalized plot area to clip space, see getPosWithSpacing in pcp_common.glsl
+    const auto rect = getDisplayRect(vec2{size});
+    const vec2 scale = 2.0f * (rect.second - rect.first) / vec2{size};
+    const vec2 offset = 2.0f * rect.first / vec2{size} - 1.0f;
+    mat4 dataToClip{1.0f};
+    dataToClip[0][0] = scale.x;
+    dataToClip[1][1] = scale.y;
+    dataToClip[3] = vec4{offset, 0.0f, 1.0f};
+
+    utilgl::BlendModeState blending(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    densityShader_.activate();
+    densityShader_.setUniform("dataToClip", dataToClip);
+    MeshDrawerGL::DrawObject drawer(densityMesh_.getRepresentation<MeshGL>(),
+                                    densityMesh_.getDefaultMeshInfo());
+    drawer.draw();
+    densityShader_.deactivate();
+}
+
 void ParallelCoordinates::linePicked(PickingEvent* p) {
     if (auto df = dataFrame_.getData()) {
         // Show tooltip about current line
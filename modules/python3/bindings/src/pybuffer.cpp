@@ -151,6 +151,7 @@ void exposeBuffer(pybind11::module& m) {
 
                 memcpy(rep->getData(), data.data(0), data.nbytes());
             })
+        .def_property_readonly("representationSizes", &pyutil::representationSizes<BufferBase>)
         .def("__repr__", [](const BufferBase& self) {
             return fmt::format("<Buffer: target = {} usage = {} format = {} size = {}>",
                                toString(self.getBufferTarget()), toString(self.getBufferUsage()),
@@ -182,6 +182,7 @@ void exposeImage(py::module& m) {
 
                 memcpy(rep->getData(), data.data(0), data.nbytes());
             })
+        .def_property_readonly("representationSizes", &pyutil::representationSizes<Layer>)
         .def("__repr__", [](const Layer& self) {
             return fmt::format(
                 "<Layer:\n  type = {}\n  format = {}\n  dimensions = {}\n  swizzlemask = {}>",
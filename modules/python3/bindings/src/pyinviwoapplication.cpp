@@ -31,10 +31,13 @@
 
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/common/inviwomodule.h>
+#include <inviwo/core/common/modulemanager.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwopy/vectoridentifierwrapper.h>
 #include <inviwo/core/util/commandlineparser.h>
 
+#include <pybind11/stl.h>
+
 namespace inviwo {
 
 class InviwoApplicationTrampoline : public InviwoApplication {
@@ -82,6 +85,16 @@ void exposeInviwoApplication(pybind11::module& m) {
              py::return_value_policy::reference)
         .def("getModuleSettings", &InviwoApplication::getModuleSettings,
              py::return_value_policy::reference)
+        .def_property_readonly(
+            "moduleRegistrationTimes",
+            [](InviwoApplication* app) {
+                std::vector<std::pair<std::string, double>> times;
+                for (const auto& item : app->getModuleManager().getRegistrationTimes()) {
+                    times.emplace_back(item.name, item.duration.count());
+                }
+                return times;
+            },
+            "Time in milliseconds spent registering each module")
 
         .def("waitForPool", &InviwoApplication::waitForPool)
         .def("resizePool", &InviwoApplication::resizePool)
@@ -35,12 +35,18 @@
 #include <inviwo/core/network/portconnection.h>
 #include <inviwo/core/links/propertylink.h>
 #include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/evaluationstatistics.h>
 #include <inviwo/core/ports/port.h>
 #include <inviwo/core/ports/inport.h>
 #include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/stringconversion.h>
 
 #include <inviwopy/vectoridentifierwrapper.h>
 
+#include <pybind11/stl.h>
+
+#include <sstream>
+
 namespace py = pybind11;
 
 namespace inviwo {
@@ -160,5 +166,56 @@ void exposeNetwork(py::module& m) {
                                                                  // throwing (we just want to pass
                                                                  // the exception on to python)
         });
+
+    py::class_<RollingStatistics>(m, "RollingStatistics")
+        .def(py::init<size_t>(), py::arg("window") = 100)
+        .def("add", &RollingStatistics::add)
+        .def("clear", &RollingStatistics::clear)
+        .def_property_readonly("count", &RollingStatistics::count)
+        .def_property_readonly("last", &RollingStatistics::last)
+        .def_property_readonly("min", &RollingStatistics::min)
+        .def_property_readonly("max", &RollingStatistics::max)
+        .def_property_readonly("mean", &RollingStatistics::mean)
+        .def_property_readonly("p95", &RollingStatistics::p95)
+        .def("__repr__", [](const RollingStatistics& s) {
+            std::ostringstream oss;
+            oss << "<RollingStatistics: count = " << s.count() << ", min = " << s.min()
+                << ", mean = " << s.mean() << ", p95 = " << s.p95() << ">";
+            return oss.str();
+        });
+
+    py::class_<EvaluationStatistics::ProcessorStatistics>(m, "ProcessorStatistics")
+        .def_readonly("initializeResources",
+                      &EvaluationStatistics::ProcessorStatistics::initializeResources)
+        .def_readonly("onChange", &EvaluationStatistics::ProcessorStatistics::onChange)
+        .def_readonly("process", &EvaluationStatistics::ProcessorStatistics::process);
+
+    py::class_<EvaluationStatistics>(m, "EvaluationStatistics")
+        .def(py::init<InviwoApplication*, size_t, size_t>(), py::arg("app"),
+             py::arg("window") = 100, py::arg("maxEvents") = 100000)
+        .def_property_readonly("processors", &EvaluationStatistics::getProcessorStatistics,
+                               py::return_value_policy::reference_internal)
+        .def_property_readonly("network", &EvaluationStatistics::getNetworkStatistics,
+                               py::return_value_policy::reference_internal)
+        .def_property_readonly("poolQueue", &EvaluationStatistics::getPoolQueueStatistics,
+                               py::return_value_policy::reference_internal)
+        .def_property_readonly("conversions",
+                               [](const EvaluationStatistics& stats) {
+                                   py::list res;
+                                   for (auto& e : stats.getConversions()) {
+                                       py::dict item;
+                                       item["source"] = parseTypeIdName(e.source.name());
+                                       item["destination"] = parseTypeIdName(e.destination.name());
+                                       item["count"] = e.count;
+                                       item["bytes"] = e.bytes;
+                                       res.append(item);
+                                   }
+                                   return res;
+                               })
+        .def("reset", &EvaluationStatistics::reset)
+        .def("exportChromeTrace",
+             py::overload_cast<const std::string&>(&EvaluationStatistics::exportChromeTrace,
+                                                   py::const_),
+             py::arg("filename"));
 }
 }  // namespace inviwo
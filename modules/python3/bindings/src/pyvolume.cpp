@@ -96,6 +96,7 @@ void exposeVolume(pybind11::module& m) {
 
                 memcpy(rep->getData(), data.data(0), data.nbytes());
             })
+        .def_property_readonly("representationSizes", &pyutil::representationSizes<Volume>)
         .def("__repr__", [](const Volume& volume) {
             std::ostringstream oss;
             oss << "<Volume:\n  dimensions = " << volume.getDimensions()
@@ -130,6 +130,19 @@ pybind11::array toNpArray(const std::vector<T>& v) {
     }
 }
 
+/**
+ * Memory held by each representation of \p data, as a dict from representation type name to
+ * size in bytes. See Data::getRepresentationSizes
+ */
+template <typename T>
+pybind11::dict representationSizes(const T& data) {
+    pybind11::dict sizes;
+    for (const auto& [type, bytes] : data.getRepresentationSizes()) {
+        sizes[pybind11::str(parseTypeIdName(type.name()))] = bytes;
+    }
+    return sizes;
+}
+
 }  // namespace pyutil
 
 }  // namespace inviwo
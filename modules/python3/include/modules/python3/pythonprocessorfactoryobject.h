@@ -34,6 +34,8 @@
 #include <inviwo/core/processors/processorfactoryobject.h>
 #include <inviwo/core/util/fileobserver.h>
 
+#include <functional>
+
 namespace inviwo {
 
 class InviwoApplication;
@@ -57,18 +59,35 @@ protected:
 class IVW_MODULE_PYTHON3_API PythonProcessorFactoryObject : public PythonProcessorFactoryObjectBase,
                                                             public FileObserver {
 public:
+    /**
+     * Run the script in \p file to retrieve the processor info.
+     */
     PythonProcessorFactoryObject(InviwoApplication* app, const std::string& file);
+    /**
+     * Use previously retrieved processor \p data. If \p scriptLoaded is false the script is run
+     * when the first processor is created.
+     */
+    PythonProcessorFactoryObject(InviwoApplication* app, PythonProcessorFactoryObjectData data,
+                                 bool scriptLoaded);
     virtual ~PythonProcessorFactoryObject() = default;
 
     virtual std::unique_ptr<Processor> create(InviwoApplication* app) override;
 
+    /**
+     * Set a callback that is called with the processor data every time the script is run.
+     */
+    void setOnLoad(std::function<void(const PythonProcessorFactoryObjectData&)> onLoad);
+
+    static PythonProcessorFactoryObjectData load(const std::string& file);
+
 private:
     InviwoApplication* app_;
+    bool loaded_;
+    std::function<void(const PythonProcessorFactoryObjectData&)> onLoad_;
+
     virtual void fileChanged(const std::string& filename) override;
 
     void reloadProcessors();
-
-    static PythonProcessorFactoryObjectData load(const std::string& file);
 };
 
 }  // namespace inviwo
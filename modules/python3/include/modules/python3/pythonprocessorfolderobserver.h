@@ -35,20 +35,35 @@
 #include <inviwo/core/util/fileobserver.h>
 #include <inviwo/core/processors/processorfactoryobject.h>
 
+#include <memory>
+
 namespace inviwo {
 
+struct PythonProcessorFactoryObjectData;
+
+/**
+ * Registers a python processor for each python file in a directory, and for files that are added
+ * later. The processor info of each file is cached in the settings folder, files that have not
+ * changed since they were cached are only run when the first processor is created.
+ */
 class IVW_MODULE_PYTHON3_API PythonProcessorFolderObserver : public FileObserver {
 public:
     PythonProcessorFolderObserver(InviwoApplication* app, const std::string& directory,
                                   InviwoModule& module);
-    virtual ~PythonProcessorFolderObserver() = default;
+    virtual ~PythonProcessorFolderObserver();
 
 private:
+    struct Cache;
+
     bool registerFile(const std::string& filename);
     virtual void fileChanged(const std::string& filename) override;
+    void updateCache(const PythonProcessorFactoryObjectData& data);
+    void writeCache();
 
     InviwoApplication* app_;
     std::string directory_;
+    std::string cacheFile_;
+    std::unique_ptr<Cache> cache_;
     std::vector<std::string> registeredFiles_;
     InviwoModule& module_;
 };
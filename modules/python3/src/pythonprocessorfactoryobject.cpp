@@ -51,15 +51,41 @@ namespace inviwo {
 
 PythonProcessorFactoryObject::PythonProcessorFactoryObject(InviwoApplication* app,
                                                            const std::string& file)
-    : PythonProcessorFactoryObjectBase(load(file)), FileObserver(app), app_{app} {
+    : PythonProcessorFactoryObjectBase(load(file)), FileObserver(app), app_{app}, loaded_{true} {
 
     startFileObservation(file);
 }
 
+PythonProcessorFactoryObject::PythonProcessorFactoryObject(InviwoApplication* app,
+                                                           PythonProcessorFactoryObjectData data,
+                                                           bool scriptLoaded)
+    : PythonProcessorFactoryObjectBase(std::move(data))
+    , FileObserver(app)
+    , app_{app}
+    , loaded_{scriptLoaded} {
+
+    startFileObservation(file_);
+}
+
+void PythonProcessorFactoryObject::setOnLoad(
+    std::function<void(const PythonProcessorFactoryObjectData&)> onLoad) {
+    onLoad_ = std::move(onLoad);
+}
+
 std::unique_ptr<Processor> PythonProcessorFactoryObject::create(InviwoApplication*) {
     namespace py = pybind11;
     const auto pi = getProcessorInfo();
 
+    if (!loaded_) {
+        auto data = load(file_);
+        loaded_ = true;
+        name_ = data.name;
+        if (pi != data.info) {
+            LogError("ProcessorInfo changes in \"" + name_ + "\" will not be reflected");
+        }
+        if (onLoad_) onLoad_(data);
+    }
+
     try {
         py::object proc = py::eval<py::eval_expr>(fmt::format(
             R"({}("{}", "{}"))", name_, util::stripIdentifier(pi.displayName), pi.displayName));
@@ -77,11 +103,13 @@ std::unique_ptr<Processor> PythonProcessorFactoryObject::create(InviwoApplicatio
 void PythonProcessorFactoryObject::fileChanged(const std::string&) {
     try {
         auto data = load(file_);
+        loaded_ = true;
         name_ = data.name;
         LogInfo("Reloaded python processor: \"" << name_ << "\" file: " << file_);
         if (getProcessorInfo() != data.info) {
             LogError("ProcessorInfo changes in \"" + name_ + "\" will not be reflected");
         }
+        if (onLoad_) onLoad_(data);
         reloadProcessors();
 
     } catch (const std::exception& e) {
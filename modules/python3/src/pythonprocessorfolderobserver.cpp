@@ -32,15 +32,138 @@
 
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/io/serialization/serializable.h>
+#include <inviwo/core/io/serialization/serializer.h>
+#include <inviwo/core/io/serialization/deserializer.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <optional>
 
 namespace inviwo {
 
+namespace {
+
+struct CachedProcessor : public Serializable {
+    CachedProcessor() = default;
+    CachedProcessor(const PythonProcessorFactoryObjectData& data)
+        : file{data.file}
+        , modified{filesystem::fileModificationTime(data.file)}
+        , name{data.name}
+        , classIdentifier{data.info.classIdentifier}
+        , displayName{data.info.displayName}
+        , category{data.info.category}
+        , codeState{data.info.codeState}
+        , tags{data.info.tags.getString()}
+        , visible{data.info.visible} {}
+
+    PythonProcessorFactoryObjectData data() const {
+        return {ProcessorInfo{classIdentifier, displayName, category, codeState, Tags{tags},
+                              visible},
+                name, file};
+    }
+
+    virtual void serialize(Serializer& s) const override {
+        s.serialize("file", file);
+        s.serialize("modified", static_cast<std::int64_t>(modified));
+        s.serialize("name", name);
+        s.serialize("classIdentifier", classIdentifier);
+        s.serialize("displayName", displayName);
+        s.serialize("category", category);
+        s.serialize("codeState", codeState);
+        s.serialize("tags", tags);
+        s.serialize("visible", visible);
+    }
+    virtual void deserialize(Deserializer& d) override {
+        std::int64_t time = 0;
+        d.deserialize("file", file);
+        d.deserialize("modified", time);
+        d.deserialize("name", name);
+        d.deserialize("classIdentifier", classIdentifier);
+        d.deserialize("displayName", displayName);
+        d.deserialize("category", category);
+        d.deserialize("codeState", codeState);
+        d.deserialize("tags", tags);
+        d.deserialize("visible", visible);
+        modified = static_cast<std::time_t>(time);
+    }
+
+    std::string file;
+    std::time_t modified = 0;
+    std::string name;
+    std::string classIdentifier;
+    std::string displayName;
+    std::string category;
+    CodeState codeState = CodeState::Experimental;
+    std::string tags;
+    bool visible = true;
+};
+
+std::vector<CachedProcessor> readCacheFile(const std::string& cacheFile) {
+    std::vector<CachedProcessor> cache;
+    if (!filesystem::fileExists(cacheFile)) return cache;
+    // A broken cache is not critical, all scripts will be run instead.
+    try {
+        Deserializer d(cacheFile);
+        d.deserialize("Processors", cache, "Processor");
+    } catch (const Exception& e) {
+        util::log(e.getContext(), e.getMessage(), LogLevel::Warn);
+        cache.clear();
+    } catch (const std::exception& e) {
+        LogWarnCustom("PythonProcessorFolderObserver", e.what());
+        cache.clear();
+    }
+    return cache;
+}
+
+void writeCacheFile(const std::string& cacheFile, const std::vector<CachedProcessor>& cache) {
+    try {
+        Serializer s(cacheFile);
+        s.serialize("Processors", cache, "Processor");
+        s.writeFile();
+    } catch (const Exception& e) {
+        util::log(e.getContext(), e.getMessage(), LogLevel::Warn);
+    } catch (const std::exception& e) {
+        LogWarnCustom("PythonProcessorFolderObserver", e.what());
+    }
+}
+
+std::optional<PythonProcessorFactoryObjectData> findCached(
+    const std::vector<CachedProcessor>& cache, const std::string& file) {
+    auto it = std::find_if(cache.begin(), cache.end(),
+                           [&](const CachedProcessor& item) { return item.file == file; });
+    if (it != cache.end() && it->modified == filesystem::fileModificationTime(file)) {
+        return it->data();
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+/**
+ * The cache is read once when the observer is created. Files registered while scanning the
+ * directory only update the cache in memory, it is written once after the scan and then each time
+ * a file is loaded.
+ */
+struct PythonProcessorFolderObserver::Cache {
+    std::vector<CachedProcessor> processors;
+    bool deferWrite = false;
+    bool modified = false;
+};
+
 PythonProcessorFolderObserver::PythonProcessorFolderObserver(InviwoApplication* app,
                                                              const std::string& directory,
                                                              InviwoModule& module)
-    : FileObserver(app), app_(app), directory_{directory}, module_{module} {
+    : FileObserver(app)
+    , app_(app)
+    , directory_{directory}
+    , cacheFile_{app->getPath(PathType::Settings, "/python_processor_cache", true) + "/" +
+                 toString(std::hash<std::string>{}(directory)) + ".ivs"}
+    , cache_{std::make_unique<Cache>(Cache{readCacheFile(cacheFile_), true, false})}
+    , module_{module} {
 
     if (filesystem::directoryExists(directory)) {
         const auto files = filesystem::getDirectoryContents(directory);
@@ -52,10 +175,14 @@ PythonProcessorFolderObserver::PythonProcessorFolderObserver(InviwoApplication*
             }
         }
     }
+    cache_->deferWrite = false;
+    if (cache_->modified) writeCache();
 
     startFileObservation(directory);
 }
 
+PythonProcessorFolderObserver::~PythonProcessorFolderObserver() = default;
+
 bool PythonProcessorFolderObserver::registerFile(const std::string& filename) {
     const auto isEmpty = [](const std::string& file) {
         auto ifs = filesystem::ifstream(file);
@@ -68,7 +195,20 @@ bool PythonProcessorFolderObserver::registerFile(const std::string& filename) {
         if (isEmpty(filename)) return false;
 
         try {
-            auto pfo = std::make_unique<PythonProcessorFactoryObject>(app_, filename);
+            auto pfo = [&]() {
+                if (auto data = findCached(cache_->processors, filename)) {
+                    return std::make_unique<PythonProcessorFactoryObject>(app_, std::move(*data),
+                                                                          false);
+                } else {
+                    auto loaded = PythonProcessorFactoryObject::load(filename);
+                    updateCache(loaded);
+                    return std::make_unique<PythonProcessorFactoryObject>(app_, std::move(loaded),
+                                                                          true);
+                }
+            }();
+            pfo->setOnLoad([this](const PythonProcessorFactoryObjectData& data) {
+                updateCache(data);
+            });
             module_.registerProcessor(std::move(pfo));
             registeredFiles_.push_back(filename);
             return true;
@@ -107,4 +247,25 @@ void PythonProcessorFolderObserver::fileChanged(const std::string& changed) {
     }
 }
 
+void PythonProcessorFolderObserver::updateCache(const PythonProcessorFactoryObjectData& data) {
+    auto& cache = cache_->processors;
+    cache.erase(std::remove_if(cache.begin(), cache.end(),
+                               [&](const CachedProcessor& item) { return item.file == data.file; }),
+                cache.end());
+    cache.emplace_back(data);
+    cache_->modified = true;
+    if (!cache_->deferWrite) writeCache();
+}
+
+void PythonProcessorFolderObserver::writeCache() {
+    auto& cache = cache_->processors;
+    cache.erase(std::remove_if(cache.begin(), cache.end(),
+                               [&](const CachedProcessor& item) {
+                                   return !filesystem::fileExists(item.file);
+                               }),
+                cache.end());
+    writeCacheFile(cacheFile_, cache);
+    cache_->modified = false;
+}
+
 }  // namespace inviwo
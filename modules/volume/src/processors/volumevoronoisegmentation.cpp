@@ -80,7 +80,7 @@ constexpr auto copyColumn = [](const Column& col, auto& dstContainer, auto assig
 void VolumeVoronoiSegmentation::process() {
     auto calc = [dataFrame = dataFrame_.getData(), volume = volume_.getData(), iCol = iCol_.get(),
                  xCol = xCol_.get(), yCol = yCol_.get(), zCol = zCol_.get(), wCol = wCol_.get(),
-                 weighted = weighted_.get()]() {
+                 weighted = weighted_.get()](pool::Stop stop, pool::Progress progress) {
         const auto nrows = dataFrame->getIndexColumn()->getSize();
         std::vector<std::pair<uint32_t, vec3>> seedPointsWithIndices(nrows);
 
@@ -111,7 +111,8 @@ void VolumeVoronoiSegmentation::process() {
 
         const auto voronoiVolume = util::voronoiSegmentation(
             volume->getDimensions(), volume->getCoordinateTransformer().getIndexToModelMatrix(),
-            seedPointsWithIndices, volume->getWrapping(), radii);
+            seedPointsWithIndices, volume->getWrapping(), radii, progress, stop);
+        if (!voronoiVolume) return voronoiVolume;
 
         voronoiVolume->setModelMatrix(volume->getModelMatrix());
         voronoiVolume->setWorldMatrix(volume->getWorldMatrix());
@@ -121,6 +122,7 @@ void VolumeVoronoiSegmentation::process() {
 
     outport_.setData(nullptr);
     dispatchOne(calc, [this](std::shared_ptr<Volume> result) {
+        if (!result) return;
         outport_.setData(result);
         newResults();
     });
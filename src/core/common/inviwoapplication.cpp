@@ -71,6 +71,9 @@
 #include <inviwo/core/util/commandlineparser.h>
 
 #include <inviwo/core/resourcemanager/resourcemanagerobserver.h>
+#include <inviwo/core/datastructures/representationmanager.h>
+#include <inviwo/core/datastructures/storagepool.h>
+#include <inviwo/core/network/processornetworkevaluationobserver.h>
 
 namespace inviwo {
 
@@ -89,6 +92,32 @@ struct AppResourceManagerObserver : ResourceManagerObserver {
     ResourceManager* manager = nullptr;
 };
 
+/**
+ * Releases RAM representations exceeding the RepresentationManager budget after each network
+ * evaluation. Representations are only released when no background jobs are running or queued
+ * and the thread pool is idle, since running tasks might hold on to representation pointers.
+ * Representations kept after the evaluation, for example by samplers, are shared and never
+ * released.
+ */
+struct AppRepresentationBudgetObserver : ProcessorNetworkEvaluationObserver {
+    AppRepresentationBudgetObserver(ProcessorNetworkEvaluator* evaluator, ProcessorNetwork* network,
+                                    ThreadPool* pool)
+        : network{network}, pool{pool} {
+        evaluator->addObserver(this);
+    }
+
+    virtual void onProcessorNetworkEvaluationEnd() override {
+        if (!RepresentationManager::isEnabled() || network->runningBackgroundJobs() > 0 ||
+            !pool->isIdle()) {
+            return;
+        }
+        RepresentationManager::enforceBudget();
+    }
+
+    ProcessorNetwork* network = nullptr;
+    ThreadPool* pool = nullptr;
+};
+
 InviwoApplication* InviwoApplication::instance_ = nullptr;
 
 InviwoApplication::InviwoApplication(int argc, char** argv, std::string displayName)
@@ -160,6 +189,8 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string displayN
     , processorNetwork_{std::make_unique<ProcessorNetwork>(this)}
     , processorNetworkEvaluator_{std::make_unique<ProcessorNetworkEvaluator>(
           processorNetwork_.get())}
+    , representationBudgetObserver_{std::make_unique<AppRepresentationBudgetObserver>(
+          processorNetworkEvaluator_.get(), processorNetwork_.get(), &pool_)}
     , workspaceManager_{std::make_unique<WorkspaceManager>(this)}
     , propertyPresetManager_{std::make_unique<PropertyPresetManager>(this)}
     , portInspectorManager_{std::make_unique<PortInspectorManager>(this)} {
@@ -174,6 +205,27 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string displayN
     resourceManager_->setEnabled(systemSettings_->enableResourceManager_.get());
     systemSettings_->enableResourceManager_.onChange(
         [this]() { resourceManager_->setEnabled(systemSettings_->enableResourceManager_.get()); });
+    RepresentationManager::setBudget(systemSettings_->representationBudget_.get() * 1024 * 1024);
+    systemSettings_->representationBudget_.onChange([this]() {
+        RepresentationManager::setBudget(systemSettings_->representationBudget_.get() * 1024 *
+                                         1024);
+    });
+    RepresentationManager::setSpillToDisk(systemSettings_->spillRepresentationsToDisk_.get());
+    systemSettings_->spillRepresentationsToDisk_.onChange([this]() {
+        RepresentationManager::setSpillToDisk(systemSettings_->spillRepresentationsToDisk_.get());
+    });
+
+    StoragePool::setMaxCachedBytes(systemSettings_->storagePoolSize_.get() * 1024 * 1024);
+    systemSettings_->storagePoolSize_.onChange([this]() {
+        StoragePool::setMaxCachedBytes(systemSettings_->storagePoolSize_.get() * 1024 * 1024);
+    });
+
+    resourceManager_->setMemoryBudget(systemSettings_->resourceManagerBudget_.get() * 1024 *
+                                      1024);
+    systemSettings_->resourceManagerBudget_.onChange([this]() {
+        resourceManager_->setMemoryBudget(systemSettings_->resourceManagerBudget_.get() * 1024 *
+                                          1024);
+    });
     if (commandLineParser_->getDisableResourceManager()) {
         resourceManager_->setEnabled(false);
     }
@@ -231,7 +283,10 @@ InviwoApplication::InviwoApplication() : InviwoApplication(0, nullptr, "Inviwo")
 InviwoApplication::InviwoApplication(std::string displayName)
     : InviwoApplication(0, nullptr, displayName) {}
 
-InviwoApplication::~InviwoApplication() { resizePool(0); }
+InviwoApplication::~InviwoApplication() {
+    resizePool(0);
+    StoragePool::setMaxCachedBytes(0);
+}
 
 void InviwoApplication::registerModules(
     std::vector<std::unique_ptr<InviwoModuleFactoryObject>> moduleFactories) {
@@ -31,6 +31,7 @@
 #include <inviwo/core/util/zip.h>
 #include <inviwo/core/util/exception.h>
 
+#include <algorithm>
 #include <unordered_set>
 
 namespace inviwo {
@@ -120,4 +121,39 @@ void topologicalModuleFactoryObjectSort(
     });
 }
 
+std::vector<std::string> removeModuleFactoryObjectsAndDependents(
+    std::vector<std::unique_ptr<InviwoModuleFactoryObject>>& modules,
+    const std::vector<std::string>& names) {
+    std::unordered_set<std::string> removed;
+    for (const auto& name : names) removed.insert(toLower(name));
+
+    const auto dependsOnRemoved = [&](const auto& module) {
+        return std::any_of(module->dependencies.begin(), module->dependencies.end(),
+                           [&](const auto& dep) { return removed.count(toLower(dep.first)) != 0; });
+    };
+
+    // Propagate until no more modules are found, dependencies might appear in any order
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const auto& module : modules) {
+            auto lname = toLower(module->name);
+            if (removed.count(lname) == 0 && dependsOnRemoved(module)) {
+                removed.insert(lname);
+                changed = true;
+            }
+        }
+    }
+
+    std::vector<std::string> removedNames;
+    modules.erase(std::remove_if(modules.begin(), modules.end(),
+                                 [&](const auto& module) {
+                                     if (removed.count(toLower(module->name)) == 0) return false;
+                                     removedNames.push_back(module->name);
+                                     return true;
+                                 }),
+                  modules.end());
+    return removedNames;
+}
+
 }  // namespace inviwo
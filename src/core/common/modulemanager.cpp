@@ -39,11 +39,28 @@
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/inviwocommondefines.h>
 
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
 #include <string>
 #include <functional>
 
 namespace inviwo {
 
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+template <typename F>
+std::chrono::duration<double, std::milli> timed(F&& func) {
+    const auto start = clock::now();
+    func();
+    return clock::now() - start;
+}
+
+}  // namespace
+
 ModuleManager::ModuleManager(InviwoApplication* app)
     : app_{app}
     , protected_{}
@@ -62,6 +79,7 @@ ModuleManager::ModuleManager(InviwoApplication* app)
     })
     , factoryObjects_{}
     , modules_{}
+    , registrationTimes_{}
     , clearModules_([&]() {
         // Need to clear the modules in reverse order since the might depend on each other.
         // The destruction order of vector is undefined.
@@ -81,12 +99,17 @@ void ModuleManager::registerModules(std::vector<std::unique_ptr<InviwoModuleFact
     // Topological sort to make sure that we load modules in correct order
     topologicalModuleFactoryObjectSort(std::begin(factoryObjects_), std::end(factoryObjects_));
 
+    const auto start = clock::now();
+    const auto firstTime = registrationTimes_.size();
     for (auto& obj : factoryObjects_) {
         app_->postProgress("Loading module: " + obj->name);
         if (getModuleByIdentifier(obj->name)) continue;  // already loaded
         if (!checkDependencies(*obj)) continue;
         try {
-            registerModule(obj->create(app_));
+            std::unique_ptr<InviwoModule> module;
+            const auto duration = timed([&]() { module = obj->create(app_); });
+            registrationTimes_.push_back({obj->name, duration});
+            registerModule(std::move(module));
         } catch (const ModuleInitException& e) {
             auto dereg = deregisterDependetModules(e.getModulesToDeregister());
             auto err = (!dereg.empty() ? "\nUnregistered dependent modules: " +
@@ -98,14 +121,35 @@ void ModuleManager::registerModules(std::vector<std::unique_ptr<InviwoModuleFact
     }
 
     app_->postProgress("Loading Capabilities");
-    for (auto& module : modules_) {
-        for (auto& elem : module->getCapabilities()) {
-            elem->retrieveStaticInfo();
-            elem->printInfo();
+    const auto capabilitiesTime = timed([&]() {
+        for (auto& module : modules_) {
+            for (auto& elem : module->getCapabilities()) {
+                elem->retrieveStaticInfo();
+                elem->printInfo();
+            }
         }
-    }
+    });
+    registrationTimes_.push_back({"Capabilities", capabilitiesTime});
 
     onModulesDidRegister_.invoke();
+
+    const std::chrono::duration<double, std::milli> total = clock::now() - start;
+    std::vector<RegistrationTime> slowest(registrationTimes_.begin() + firstTime,
+                                          registrationTimes_.end());
+    std::sort(slowest.begin(), slowest.end(),
+              [](const auto& a, const auto& b) { return a.duration > b.duration; });
+    slowest.resize(std::min(slowest.size(), size_t{3}));
+    std::stringstream ss;
+    ss << "Registered modules in " << std::fixed << std::setprecision(0) << total.count()
+       << " ms, slowest:";
+    for (const auto& item : slowest) {
+        ss << " " << item.name << " " << item.duration.count() << " ms";
+    }
+    LogInfo(ss.str());
+}
+
+const std::vector<ModuleManager::RegistrationTime>& ModuleManager::getRegistrationTimes() const {
+    return registrationTimes_;
 }
 
 std::function<bool(const std::string&)> ModuleManager::getEnabledFilter() {
@@ -150,6 +194,8 @@ void ModuleManager::registerModules(RuntimeModuleLoading) {
     // 4. Start observing file if reloadLibrariesWhenChanged
     // 5. Pass module factories to registerModules
 
+    const auto start = clock::now();
+
     // Find unique files and directories in specified search paths
     auto librarySearchPaths = util::getLibrarySearchPaths();
     std::set<std::string> libraryFiles;
@@ -253,6 +299,7 @@ void ModuleManager::registerModules(RuntimeModuleLoading) {
     auto dependencies = getProtectedDependencies(protected_, modules);
     protected_.insert(dependencies.begin(), dependencies.end());
 
+    registrationTimes_.push_back({"Loading libraries", clock::now() - start});
     registerModules(std::move(modules));
 }
 
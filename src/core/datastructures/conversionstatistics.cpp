@@ -0,0 +1,102 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/conversionstatistics.h>
+#include <inviwo/core/util/stdextensions.h>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace inviwo {
+
+namespace {
+
+struct Counters {
+    size_t count = 0;
+    size_t bytes = 0;
+};
+
+struct Statistics {
+    std::atomic<bool> enabled{false};
+    std::mutex mutex;
+    std::unordered_map<std::pair<std::type_index, std::type_index>, Counters> counters;
+};
+
+Statistics& statistics() {
+    static Statistics stats;
+    return stats;
+}
+
+}  // namespace
+
+void ConversionStatistics::setEnabled(bool enabled) { statistics().enabled = enabled; }
+
+bool ConversionStatistics::isEnabled() { return statistics().enabled; }
+
+void ConversionStatistics::record(std::type_index source, std::type_index destination,
+                                  size_t bytes) {
+    auto& stats = statistics();
+    if (!stats.enabled) return;
+
+    std::scoped_lock lock{stats.mutex};
+    auto& counter = stats.counters[{source, destination}];
+    ++counter.count;
+    counter.bytes += bytes;
+}
+
+std::vector<ConversionStatistics::Entry> ConversionStatistics::getEntries() {
+    auto& stats = statistics();
+    std::scoped_lock lock{stats.mutex};
+    std::vector<Entry> entries;
+    entries.reserve(stats.counters.size());
+    for (const auto& [key, counter] : stats.counters) {
+        entries.push_back({key.first, key.second, counter.count, counter.bytes});
+    }
+    return entries;
+}
+
+std::pair<size_t, size_t> ConversionStatistics::getTotals() {
+    auto& stats = statistics();
+    std::scoped_lock lock{stats.mutex};
+    std::pair<size_t, size_t> totals{0, 0};
+    for (const auto& item : stats.counters) {
+        totals.first += item.second.count;
+        totals.second += item.second.bytes;
+    }
+    return totals;
+}
+
+void ConversionStatistics::reset() {
+    auto& stats = statistics();
+    std::scoped_lock lock{stats.mutex};
+    stats.counters.clear();
+}
+
+}  // namespace inviwo
@@ -65,7 +65,8 @@ std::shared_ptr<HistogramCalculationState> HistogramSupplier::startCalculation(
                       stop = calculation_->stop_, volumeRam, dataRange, bins]() {
             auto histograms = volumeRam->dispatch<HistogramContainer>([&](auto vr) {
                 return HistogramContainer(dataRange, bins, vr->getDataTyped(),
-                                          vr->getDataTyped() + glm::compMul(vr->getDimensions()));
+                                          vr->getDataTyped() + glm::compMul(vr->getDimensions()),
+                                          [&stop]() { return stop->load(); });
             });
             if (*stop) return;
             dispatchFrontAndForget([hist = std::move(histograms), weakState]() {
@@ -35,6 +35,10 @@ namespace inviwo {
 LayerRepresentation::LayerRepresentation(LayerType type, const DataFormatBase* format)
     : DataRepresentation(format), layerType_(type) {}
 
+size_t LayerRepresentation::getNumberOfBytes() const {
+    return glm::compMul(getDimensions()) * getDataFormat()->getSize();
+}
+
 LayerType LayerRepresentation::getLayerType() const { return layerType_; }
 
 }  // namespace inviwo
@@ -0,0 +1,339 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/representationmanager.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/image/layerdisk.h>
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <variant>
+
+namespace inviwo {
+
+namespace {
+
+using Entry = std::variant<std::weak_ptr<VolumeRepresentation>, std::weak_ptr<LayerRepresentation>,
+                           std::weak_ptr<BufferRepresentation>>;
+
+struct State {
+    std::atomic<size_t> budget{0};
+    std::atomic<bool> spill{false};
+    std::mutex mutex;
+    std::deque<Entry> entries;  // oldest first
+};
+
+State& state() {
+    static State state;
+    return state;
+}
+
+// Remove expired entries and return a copy of the rest, the state mutex has to be held.
+std::vector<Entry> prune(State& s) {
+    s.entries.erase(std::remove_if(s.entries.begin(), s.entries.end(),
+                                   [](const Entry& e) {
+                                       return std::visit([](auto& w) { return w.expired(); }, e);
+                                   }),
+                    s.entries.end());
+    return {s.entries.begin(), s.entries.end()};
+}
+
+bool isRAM(const VolumeRepresentation& repr) {
+    return dynamic_cast<const VolumeRAM*>(&repr) != nullptr;
+}
+bool isRAM(const LayerRepresentation& repr) {
+    return dynamic_cast<const LayerRAM*>(&repr) != nullptr;
+}
+bool isRAM(const BufferRepresentation& repr) {
+    return dynamic_cast<const BufferRAM*>(&repr) != nullptr;
+}
+
+/**
+ * A temporary file holding the data of a spilled representation. The file is removed when the
+ * last disk representation referring to it is destroyed.
+ */
+class SpillFile {
+public:
+    SpillFile(const void* data, size_t bytes) : file_{"inviwo", ".raw"} {
+        auto out = filesystem::ofstream(file_.getFileName(), std::ios::out | std::ios::binary);
+        out.write(static_cast<const char*>(data), bytes);
+        if (!out) {
+            throw Exception("Could not write to '" + file_.getFileName() + "'",
+                            IVW_CONTEXT_CUSTOM("RepresentationManager"));
+        }
+    }
+
+    void read(void* dest, size_t bytes) const {
+        auto in = filesystem::ifstream(file_.getFileName(), std::ios::in | std::ios::binary);
+        in.read(static_cast<char*>(dest), bytes);
+        if (!in) {
+            throw DataReaderException("Could not read from '" + file_.getFileName() + "'",
+                                      IVW_CONTEXT_CUSTOM("RepresentationManager"));
+        }
+    }
+
+private:
+    util::TempFileHandle file_;
+};
+
+class SpilledVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    explicit SpilledVolumeRAMLoader(std::shared_ptr<SpillFile> file) : file_{std::move(file)} {}
+
+    virtual SpilledVolumeRAMLoader* clone() const override {
+        return new SpilledVolumeRAMLoader(*this);
+    }
+
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        auto volumeRAM = createVolumeRAM(src.getDimensions(), src.getDataFormat(), nullptr,
+                                         src.getSwizzleMask(), src.getInterpolation(),
+                                         src.getWrapping());
+        file_->read(volumeRAM->getData(), volumeRAM->getNumberOfBytes());
+        return volumeRAM;
+    }
+
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                      const VolumeRepresentation& src) const override {
+        auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
+        if (src.getDimensions() != volumeDst->getDimensions()) {
+            volumeDst->setDimensions(src.getDimensions());
+        }
+        file_->read(volumeDst->getData(), volumeDst->getNumberOfBytes());
+        volumeDst->setSwizzleMask(src.getSwizzleMask());
+        volumeDst->setInterpolation(src.getInterpolation());
+        volumeDst->setWrapping(src.getWrapping());
+    }
+
+private:
+    std::shared_ptr<SpillFile> file_;
+};
+
+class SpilledLayerRAMLoader : public DiskRepresentationLoader<LayerRepresentation> {
+public:
+    explicit SpilledLayerRAMLoader(std::shared_ptr<SpillFile> file) : file_{std::move(file)} {}
+
+    virtual SpilledLayerRAMLoader* clone() const override {
+        return new SpilledLayerRAMLoader(*this);
+    }
+
+    virtual std::shared_ptr<LayerRepresentation> createRepresentation(
+        const LayerRepresentation& src) const override {
+        auto layerRAM =
+            createLayerRAM(src.getDimensions(), src.getLayerType(), src.getDataFormat(),
+                           src.getSwizzleMask(), src.getInterpolation(), src.getWrapping());
+        file_->read(layerRAM->getData(), layerRAM->getNumberOfBytes());
+        return layerRAM;
+    }
+
+    virtual void updateRepresentation(std::shared_ptr<LayerRepresentation> dest,
+                                      const LayerRepresentation& src) const override {
+        auto layerDst = std::static_pointer_cast<LayerRAM>(dest);
+        if (src.getDimensions() != layerDst->getDimensions()) {
+            layerDst->setDimensions(src.getDimensions());
+        }
+        file_->read(layerDst->getData(), layerDst->getNumberOfBytes());
+        layerDst->setSwizzleMask(src.getSwizzleMask());
+        layerDst->setInterpolation(src.getInterpolation());
+        layerDst->setWrapping(src.getWrapping());
+    }
+
+private:
+    std::shared_ptr<SpillFile> file_;
+};
+
+std::shared_ptr<VolumeRepresentation> spill(const VolumeRepresentation& repr) {
+    const auto& ram = static_cast<const VolumeRAM&>(repr);
+    auto file = std::make_shared<SpillFile>(ram.getData(), ram.getNumberOfBytes());
+    auto disk = std::make_shared<VolumeDisk>(ram.getDimensions(), ram.getDataFormat(),
+                                             ram.getSwizzleMask(), ram.getInterpolation(),
+                                             ram.getWrapping());
+    disk->setLoader(new SpilledVolumeRAMLoader(std::move(file)));
+    return disk;
+}
+
+std::shared_ptr<LayerRepresentation> spill(const LayerRepresentation& repr) {
+    const auto& ram = static_cast<const LayerRAM&>(repr);
+    auto file = std::make_shared<SpillFile>(ram.getData(), ram.getNumberOfBytes());
+    auto disk = std::make_shared<LayerDisk>(ram.getDimensions(), ram.getDataFormat(),
+                                            ram.getLayerType(), ram.getSwizzleMask(),
+                                            ram.getInterpolation(), ram.getWrapping());
+    disk->setLoader(new SpilledLayerRAMLoader(std::move(file)));
+    return disk;
+}
+
+// There is no disk representation for buffers, hence they can only be released if there is another
+// valid representation.
+std::shared_ptr<BufferRepresentation> spill(const BufferRepresentation&) { return nullptr; }
+
+}  // namespace
+
+void RepresentationManager::setBudget(size_t bytes) {
+    auto& s = state();
+    s.budget = bytes;
+    if (bytes == 0) {
+        std::scoped_lock lock{s.mutex};
+        s.entries.clear();
+    }
+}
+
+size_t RepresentationManager::getBudget() { return state().budget; }
+
+bool RepresentationManager::isEnabled() { return state().budget != 0; }
+
+void RepresentationManager::setSpillToDisk(bool spill) { state().spill = spill; }
+
+bool RepresentationManager::getSpillToDisk() { return state().spill; }
+
+template <typename Repr>
+void RepresentationManager::track(const std::shared_ptr<Repr>& representation) {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    s.entries.emplace_back(std::weak_ptr<Repr>{representation});
+}
+
+template void RepresentationManager::track<VolumeRepresentation>(
+    const std::shared_ptr<VolumeRepresentation>&);
+template void RepresentationManager::track<LayerRepresentation>(
+    const std::shared_ptr<LayerRepresentation>&);
+template void RepresentationManager::track<BufferRepresentation>(
+    const std::shared_ptr<BufferRepresentation>&);
+
+std::vector<std::pair<std::type_index, size_t>> RepresentationManager::getUsage() {
+    auto& s = state();
+    std::unordered_map<std::type_index, size_t> usage;
+    {
+        std::scoped_lock lock{s.mutex};
+        for (auto& entry : prune(s)) {
+            std::visit(
+                [&](auto& weak) {
+                    if (auto repr = weak.lock()) {
+                        usage[repr->getTypeIndex()] += repr->getNumberOfBytes();
+                    }
+                },
+                entry);
+        }
+    }
+    return {usage.begin(), usage.end()};
+}
+
+size_t RepresentationManager::getRAMUsage() {
+    auto& s = state();
+    std::vector<Entry> entries;
+    {
+        std::scoped_lock lock{s.mutex};
+        entries = prune(s);
+    }
+    size_t usage = 0;
+    for (auto& entry : entries) {
+        std::visit(
+            [&](auto& weak) {
+                if (auto repr = weak.lock(); repr && isRAM(*repr)) {
+                    usage += repr->getNumberOfBytes();
+                }
+            },
+            entry);
+    }
+    return usage;
+}
+
+RepresentationManager::Result RepresentationManager::enforceBudget() {
+    auto& s = state();
+    const size_t budget = s.budget;
+    if (budget == 0) return {};
+
+    auto usage = getRAMUsage();
+    if (usage <= budget) return {};
+
+    std::vector<Entry> entries;
+    {
+        std::scoped_lock lock{s.mutex};
+        entries = prune(s);
+    }
+
+    Result result;
+    for (auto& entry : entries) {
+        if (usage <= budget) break;
+        std::visit(
+            [&](auto& weak) {
+                auto repr = weak.lock();
+                if (!repr || !isRAM(*repr)) return;
+                auto owner = repr->getOwner();
+                if (!owner) return;
+
+                // Held by the Data, by us, and maybe as the last valid representation. Anything
+                // more means someone shares it and it will not be released.
+                if (repr.use_count() > 3) return;
+
+                const auto bytes = repr->getNumberOfBytes();
+                const auto* ptr = repr.get();
+                repr.reset();  // Our reference would make the representation look shared
+
+                bool released = owner->releaseRepresentation(ptr);
+                if (!released && s.spill) {
+                    try {
+                        decltype(spill(*weak.lock())) replacement;
+                        if (auto locked = weak.lock()) replacement = spill(*locked);
+                        if (replacement) {
+                            released = owner->releaseRepresentation(ptr, replacement);
+                            if (released) result.spilled += bytes;
+                        }
+                    } catch (const Exception& e) {
+                        LogErrorCustom("RepresentationManager",
+                                       "Failed to spill representation to disk: "
+                                           << e.getMessage());
+                    }
+                }
+                if (released) {
+                    usage -= std::min(usage, bytes);
+                    result.released += bytes;
+                }
+            },
+            entry);
+    }
+    return result;
+}
+
+}  // namespace inviwo
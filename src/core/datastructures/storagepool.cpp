@@ -0,0 +1,186 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/storagepool.h>
+
+#include <inviwo/tracy/tracy.h>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t pageSize = size_t{4} << 10;
+constexpr size_t hugePageSize = size_t{2} << 20;
+
+constexpr size_t roundUp(size_t bytes, size_t multiple) {
+    return ((bytes + multiple - 1) / multiple) * multiple;
+}
+
+// Allocations smaller than this are not pooled
+constexpr size_t minPooledSize = pageSize;
+
+// Size classes are powers of two with four steps in between, rounded up to whole pages
+constexpr size_t sizeClass(size_t bytes) {
+    size_t pow2 = pageSize;
+    while (pow2 < bytes / 2) pow2 *= 2;
+    return roundUp(bytes, std::max(pow2 / 4, pageSize));
+}
+
+constexpr std::align_val_t alignment(size_t sizeClass) {
+    return std::align_val_t{sizeClass >= hugePageSize ? hugePageSize : pageSize};
+}
+
+struct State {
+    std::mutex mutex;
+    std::unordered_map<size_t, std::vector<void*>> free;
+    size_t maxCached = 0;
+    StoragePool::Statistics stats;
+};
+
+State& state() {
+    static State state;
+    return state;
+}
+
+void* allocateNew(size_t size) {
+    auto ptr = ::operator new(size, alignment(size));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (size >= hugePageSize) madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+    return ptr;
+}
+
+void deallocateNow(void* ptr, size_t size) { ::operator delete(ptr, alignment(size)); }
+
+// Release cached memory until the cached size is within the limit, the mutex has to be held.
+void trim(State& s, size_t limit) {
+    for (auto it = s.free.begin(); it != s.free.end() && s.stats.cachedBytes > limit;) {
+        auto& [size, ptrs] = *it;
+        while (!ptrs.empty() && s.stats.cachedBytes > limit) {
+            deallocateNow(ptrs.back(), size);
+            ptrs.pop_back();
+            s.stats.cachedBytes -= size;
+        }
+        it = ptrs.empty() ? s.free.erase(it) : std::next(it);
+    }
+}
+
+}  // namespace
+
+void* StoragePool::allocate(size_t bytes) {
+    if (bytes < minPooledSize) return ::operator new(std::max(bytes, size_t{1}));
+    const auto size = sizeClass(bytes);
+    auto& s = state();
+    {
+        std::scoped_lock lock{s.mutex};
+        ++s.stats.allocations;
+        s.stats.liveBytes += size;
+        auto it = s.free.find(size);
+        if (it != s.free.end() && !it->second.empty()) {
+            auto ptr = it->second.back();
+            it->second.pop_back();
+            s.stats.cachedBytes -= size;
+            ++s.stats.reused;
+            TRACY_PLOT("Storage Pool Cached", static_cast<int64_t>(s.stats.cachedBytes));
+            return ptr;
+        }
+    }
+    try {
+        return allocateNew(size);
+    } catch (...) {
+        std::scoped_lock lock{s.mutex};
+        s.stats.liveBytes -= size;
+        throw;
+    }
+}
+
+void StoragePool::deallocate(void* ptr, size_t bytes) {
+    if (!ptr) return;
+    if (bytes < minPooledSize) return ::operator delete(ptr);
+    const auto size = sizeClass(bytes);
+    auto& s = state();
+    {
+        std::scoped_lock lock{s.mutex};
+        ++s.stats.deallocations;
+        s.stats.liveBytes -= size;
+        if (s.stats.cachedBytes + size <= s.maxCached) {
+            s.free[size].push_back(ptr);
+            s.stats.cachedBytes += size;
+            TRACY_PLOT("Storage Pool Cached", static_cast<int64_t>(s.stats.cachedBytes));
+            return;
+        }
+    }
+    deallocateNow(ptr, size);
+}
+
+void StoragePool::setMaxCachedBytes(size_t bytes) {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    s.maxCached = bytes;
+    trim(s, bytes);
+}
+
+size_t StoragePool::getMaxCachedBytes() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    return s.maxCached;
+}
+
+void StoragePool::clear() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    trim(s, 0);
+}
+
+StoragePool::Statistics StoragePool::getStatistics() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    return s.stats;
+}
+
+void StoragePool::resetStatistics() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    s.stats.allocations = 0;
+    s.stats.reused = 0;
+    s.stats.deallocations = 0;
+}
+
+}  // namespace inviwo
@@ -75,4 +75,6 @@ void VolumeDisk::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping;
 
 Wrapping3D VolumeDisk::getWrapping() const { return wrapping_; }
 
+size_t VolumeDisk::getNumberOfBytes() const { return 0; }
+
 }  // namespace inviwo
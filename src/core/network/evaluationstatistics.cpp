@@ -0,0 +1,294 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/network/evaluationstatistics.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <numeric>
+#include <ostream>
+#include <string_view>
+
+namespace inviwo {
+
+RollingStatistics::RollingStatistics(size_t window)
+    : values_{}, window_{std::max(window, size_t{1})}, next_{0}, count_{0} {
+    values_.reserve(window_);
+}
+
+void RollingStatistics::add(double value) {
+    if (values_.size() < window_) {
+        values_.push_back(value);
+    } else {
+        values_[next_] = value;
+    }
+    next_ = (next_ + 1) % window_;
+    ++count_;
+}
+
+void RollingStatistics::clear() {
+    values_.clear();
+    next_ = 0;
+    count_ = 0;
+}
+
+size_t RollingStatistics::count() const { return count_; }
+
+double RollingStatistics::last() const {
+    if (values_.empty()) return 0.0;
+    return values_[(next_ + window_ - 1) % window_];
+}
+
+double RollingStatistics::min() const {
+    if (values_.empty()) return 0.0;
+    return *std::min_element(values_.begin(), values_.end());
+}
+
+double RollingStatistics::max() const {
+    if (values_.empty()) return 0.0;
+    return *std::max_element(values_.begin(), values_.end());
+}
+
+double RollingStatistics::mean() const {
+    if (values_.empty()) return 0.0;
+    return std::accumulate(values_.begin(), values_.end(), 0.0) /
+           static_cast<double>(values_.size());
+}
+
+double RollingStatistics::p95() const {
+    if (values_.empty()) return 0.0;
+    auto sorted = values_;
+    const auto n = static_cast<size_t>(0.95 * static_cast<double>(sorted.size() - 1) + 0.5);
+    std::nth_element(sorted.begin(), sorted.begin() + n, sorted.end());
+    return sorted[n];
+}
+
+namespace {
+
+const char* category(EvaluationType type) {
+    switch (type) {
+        case EvaluationType::InitResource:
+            return "initializeResources";
+        case EvaluationType::PortOnChange:
+            return "onChange";
+        case EvaluationType::Process:
+            return "process";
+        case EvaluationType::NotReady:
+        default:
+            return "doIfNotReady";
+    }
+}
+
+double toMilliseconds(EvaluationStatistics::clock::duration d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+long long toMicroseconds(EvaluationStatistics::clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+}
+
+void writeJSONString(std::ostream& os, std::string_view str) {
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    os << ' ';
+                } else {
+                    os << c;
+                }
+        }
+    }
+    os << '"';
+}
+
+}  // namespace
+
+EvaluationStatistics::EvaluationStatistics(InviwoApplication* app, size_t window,
+                                           size_t maxEvents)
+    : app_{app}
+    , window_{window}
+    , maxEvents_{maxEvents}
+    , conversionsWereEnabled_{ConversionStatistics::isEnabled()}
+    , epoch_{clock::now()}
+    , networkStart_{epoch_}
+    , processorStart_{}
+    , processors_{}
+    , network_{window}
+    , poolQueue_{window}
+    , events_{}
+    , counters_{} {
+
+    ConversionStatistics::setEnabled(true);
+    app_->getProcessorNetworkEvaluator()->addObserver(this);
+}
+
+EvaluationStatistics::~EvaluationStatistics() {
+    ConversionStatistics::setEnabled(conversionsWereEnabled_);
+}
+
+const std::map<std::string, EvaluationStatistics::ProcessorStatistics>&
+EvaluationStatistics::getProcessorStatistics() const {
+    return processors_;
+}
+
+const RollingStatistics& EvaluationStatistics::getNetworkStatistics() const { return network_; }
+
+const RollingStatistics& EvaluationStatistics::getPoolQueueStatistics() const {
+    return poolQueue_;
+}
+
+std::vector<ConversionStatistics::Entry> EvaluationStatistics::getConversions() const {
+    return ConversionStatistics::getEntries();
+}
+
+auto EvaluationStatistics::getTraceEvents() const -> const std::deque<TraceEvent>& {
+    return events_;
+}
+
+auto EvaluationStatistics::getCounterEvents() const -> const std::deque<CounterEvent>& {
+    return counters_;
+}
+
+void EvaluationStatistics::reset() {
+    processors_.clear();
+    network_.clear();
+    poolQueue_.clear();
+    events_.clear();
+    counters_.clear();
+    ConversionStatistics::reset();
+}
+
+void EvaluationStatistics::onProcessorNetworkEvaluationBegin() { networkStart_ = clock::now(); }
+
+void EvaluationStatistics::onProcessorNetworkEvaluationEnd() {
+    const auto now = clock::now();
+    network_.add(toMilliseconds(now - networkStart_));
+    addEvent({"Network Evaluation", "network", networkStart_ - epoch_, now - networkStart_});
+
+    const auto queueSize = app_->getThreadPool().getQueueSize();
+    poolQueue_.add(static_cast<double>(queueSize));
+    const auto [conversions, bytes] = ConversionStatistics::getTotals();
+    counters_.push_back({now - epoch_, queueSize, conversions, bytes});
+    if (counters_.size() > maxEvents_) counters_.pop_front();
+}
+
+void EvaluationStatistics::onProcessorEvaluationBegin(Processor*, EvaluationType) {
+    processorStart_.push_back(clock::now());
+}
+
+void EvaluationStatistics::onProcessorEvaluationEnd(Processor* processor, EvaluationType type) {
+    if (processorStart_.empty()) return;
+    const auto now = clock::now();
+    const auto start = processorStart_.back();
+    processorStart_.pop_back();
+
+    const auto& id = processor->getIdentifier();
+    auto it = processors_.find(id);
+    if (it == processors_.end()) {
+        it = processors_.emplace(id, ProcessorStatistics{window_}).first;
+    }
+    const auto ms = toMilliseconds(now - start);
+    switch (type) {
+        case EvaluationType::InitResource:
+            it->second.initializeResources.add(ms);
+            break;
+        case EvaluationType::PortOnChange:
+            it->second.onChange.add(ms);
+            break;
+        case EvaluationType::Process:
+            it->second.process.add(ms);
+            break;
+        case EvaluationType::NotReady:
+            break;
+    }
+    addEvent({id, category(type), start - epoch_, now - start});
+}
+
+void EvaluationStatistics::addEvent(TraceEvent event) {
+    events_.push_back(std::move(event));
+    if (events_.size() > maxEvents_) events_.pop_front();
+}
+
+void EvaluationStatistics::exportChromeTrace(std::ostream& os) const {
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    const auto separator = [&]() {
+        if (!first) os << ",\n";
+        first = false;
+    };
+    for (const auto& event : events_) {
+        separator();
+        os << "{\"name\":";
+        writeJSONString(os, event.name);
+        os << ",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":"
+           << toMicroseconds(event.start) << ",\"dur\":" << toMicroseconds(event.duration)
+           << ",\"pid\":1,\"tid\":1}";
+    }
+    for (const auto& counter : counters_) {
+        separator();
+        os << "{\"name\":\"Pool Queue Size\",\"ph\":\"C\",\"ts\":" << toMicroseconds(counter.time)
+           << ",\"pid\":1,\"args\":{\"size\":" << counter.poolQueueSize << "}},\n";
+        os << "{\"name\":\"Representation Conversions\",\"ph\":\"C\",\"ts\":"
+           << toMicroseconds(counter.time) << ",\"pid\":1,\"args\":{\"count\":"
+           << counter.conversions << "}},\n";
+        os << "{\"name\":\"Converted Bytes\",\"ph\":\"C\",\"ts\":" << toMicroseconds(counter.time)
+           << ",\"pid\":1,\"args\":{\"bytes\":" << counter.conversionBytes << "}}";
+    }
+    os << "]}\n";
+}
+
+void EvaluationStatistics::exportChromeTrace(const std::string& filename) const {
+    auto os = filesystem::ofstream(filename);
+    if (!os) {
+        throw Exception("Could not open file '" + filename + "' for writing", IVW_CONTEXT);
+    }
+    exportChromeTrace(os);
+}
+
+}  // namespace inviwo
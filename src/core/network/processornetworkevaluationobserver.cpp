@@ -41,4 +41,17 @@ void ProcessorNetworkEvaluationObservable::notifyObserversProcessorNetworkEvalua
         [](ProcessorNetworkEvaluationObserver* o) { o->onProcessorNetworkEvaluationEnd(); });
 }
 
+void ProcessorNetworkEvaluationObservable::notifyObserversProcessorEvaluationBegin(
+    Processor* p, EvaluationType type) {
+    forEachObserver([&](ProcessorNetworkEvaluationObserver* o) {
+        o->onProcessorEvaluationBegin(p, type);
+    });
+}
+
+void ProcessorNetworkEvaluationObservable::notifyObserversProcessorEvaluationEnd(
+    Processor* p, EvaluationType type) {
+    forEachObserver(
+        [&](ProcessorNetworkEvaluationObserver* o) { o->onProcessorEvaluationEnd(p, type); });
+}
+
 }  // namespace inviwo
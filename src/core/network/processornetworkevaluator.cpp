@@ -36,6 +36,8 @@
 #include <inviwo/core/network/networklock.h>
 #include <inviwo/core/util/clock.h>
 
+#include <inviwo/tracy/tracy.h>
+
 namespace inviwo {
 
 ProcessorNetworkEvaluator::ProcessorNetworkEvaluator(ProcessorNetwork* processorNetwork)
@@ -96,6 +98,7 @@ void ProcessorNetworkEvaluator::requestEvaluate() {
 void ProcessorNetworkEvaluator::evaluate() {
     // lock processor network to avoid concurrent evaluation
     NetworkLock lock(processorNetwork_);
+    TRACY_ZONE_SCOPED_NC("Evaluate Network", 0xAA0000);
 
     notifyObserversProcessorNetworkEvaluationBegin();
 
@@ -107,6 +110,15 @@ void ProcessorNetworkEvaluator::evaluate() {
                 try {
                     // re-initialize resources (e.g., shaders) if necessary
                     if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
+                        notifyObserversProcessorEvaluationBegin(processor,
+                                                                EvaluationType::InitResource);
+                        util::OnScopeExit end{[&]() {
+                            notifyObserversProcessorEvaluationEnd(processor,
+                                                                  EvaluationType::InitResource);
+                        }};
+                        TRACY_ZONE_SCOPED_NC("Initialize Resources", 0x880088);
+                        TRACY_ZONE_TEXT(processor->getIdentifier().c_str(),
+                                        processor->getIdentifier().size());
                         processor->initializeResources();
                     }
                 } catch (...) {
@@ -115,6 +127,12 @@ void ProcessorNetworkEvaluator::evaluate() {
                 }
 
                 try {
+                    notifyObserversProcessorEvaluationBegin(processor,
+                                                            EvaluationType::PortOnChange);
+                    util::OnScopeExit end{[&]() {
+                        notifyObserversProcessorEvaluationEnd(processor,
+                                                              EvaluationType::PortOnChange);
+                    }};
                     // call onChange for all invalid inports
                     for (auto inport : processor->getInports()) {
                         inport->callOnChangeIfChanged();
@@ -127,7 +145,14 @@ void ProcessorNetworkEvaluator::evaluate() {
                 processor->notifyObserversAboutToProcess(processor);
 
                 try {
+                    notifyObserversProcessorEvaluationBegin(processor, EvaluationType::Process);
+                    util::OnScopeExit end{[&]() {
+                        notifyObserversProcessorEvaluationEnd(processor, EvaluationType::Process);
+                    }};
                     IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
+                    TRACY_ZONE_SCOPED_NC("Process", 0x008800);
+                    TRACY_ZONE_TEXT(processor->getIdentifier().c_str(),
+                                    processor->getIdentifier().size());
                     // do the actual processing
                     processor->process();
 
@@ -144,6 +169,10 @@ void ProcessorNetworkEvaluator::evaluate() {
 
             } else {
                 try {
+                    notifyObserversProcessorEvaluationBegin(processor, EvaluationType::NotReady);
+                    util::OnScopeExit end{[&]() {
+                        notifyObserversProcessorEvaluationEnd(processor, EvaluationType::NotReady);
+                    }};
                     processor->doIfNotReady();
                 } catch (...) {
                     exceptionHandler_(processor, EvaluationType::NotReady, IVW_CONTEXT);
@@ -153,6 +182,7 @@ void ProcessorNetworkEvaluator::evaluate() {
     }
 
     notifyObserversProcessorNetworkEvaluationEnd();
+    TRACY_FRAME_MARK_NAMED("Network Evaluation");
 }
 
 void ProcessorNetworkEvaluator::onProcessorSinkChanged(Processor*) {
@@ -32,6 +32,8 @@
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/util/stdextensions.h>
 
+#include <inviwo/tracy/tracy.h>
+
 namespace inviwo {
 
 Inport::Inport(std::string identifier)
@@ -147,6 +149,8 @@ const std::vector<Outport*>& Inport::getConnectedOutports() const { return conne
 
 void Inport::callOnChangeIfChanged() const {
     if (isChanged()) {
+        TRACY_ZONE_SCOPED_NC("Inport onChange", 0x0066CC);
+        TRACY_ZONE_TEXT(getIdentifier().c_str(), getIdentifier().size());
         onChangeCallback_.invokeAll();
     }
 }
@@ -111,6 +111,26 @@ void PoolProcessor::submit(Submission& job) {
     }
 }
 
+void PoolProcessor::enqueue(Submission&& job) {
+    if (delayDispatch()) {
+        queue_.clear();
+        queue_.push_back(std::move(job));
+        if (!delayBackgoundJobReset_) {
+            notifyObserversStartBackgroundWork(this, 1);
+            delayBackgoundJobReset_.setAction(
+                [this]() { notifyObserversFinishBackgroundWork(this, 1); });
+        }
+        delay_.start();
+
+    } else if (queuedDispatch() && !states_.empty()) {
+        queue_.clear();
+        queue_.push_back(std::move(job));
+
+    } else {
+        submit(job);
+    }
+}
+
 void PoolProcessor::invalidate(InvalidationLevel invalidationLevel, Property* source) {
     if (delayInvalidation()) {
         notifyObserversInvalidationBegin(this);
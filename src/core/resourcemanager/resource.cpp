@@ -29,8 +29,58 @@
 
 #include <inviwo/core/resourcemanager/resource.h>
 
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/image.h>
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+
 namespace inviwo {
 
 Resource::Resource(const std::string& key) : key_(key) {}
 
+namespace util {
+
+namespace {
+
+template <typename T>
+size_t sumRepresentationSizes(const T& data) {
+    size_t size = 0;
+    for (const auto& [type, bytes] : data.getRepresentationSizes()) {
+        size += bytes;
+    }
+    return size;
+}
+
+}  // namespace
+
+size_t resourceSizeInBytes(const Volume& volume) { return sumRepresentationSizes(volume); }
+
+size_t resourceSizeInBytes(const Layer& layer) { return sumRepresentationSizes(layer); }
+
+size_t resourceSizeInBytes(const Image& image) {
+    size_t size = 0;
+    for (size_t i = 0; i < image.getNumberOfColorLayers(); ++i) {
+        size += resourceSizeInBytes(*image.getColorLayer(i));
+    }
+    if (auto depth = image.getDepthLayer()) size += resourceSizeInBytes(*depth);
+    if (auto picking = image.getPickingLayer()) size += resourceSizeInBytes(*picking);
+    return size;
+}
+
+size_t resourceSizeInBytes(const BufferBase& buffer) { return sumRepresentationSizes(buffer); }
+
+size_t resourceSizeInBytes(const Mesh& mesh) {
+    size_t size = 0;
+    for (const auto& buffer : mesh.getBuffers()) {
+        size += resourceSizeInBytes(*buffer.second);
+    }
+    for (const auto& indices : mesh.getIndexBuffers()) {
+        size += resourceSizeInBytes(*indices.second);
+    }
+    return size;
+}
+
+}  // namespace util
+
 }  // namespace inviwo
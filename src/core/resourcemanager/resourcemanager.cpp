@@ -29,14 +29,18 @@
 
 #include <inviwo/core/resourcemanager/resourcemanager.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
 void ResourceManager::removeResource(const std::string& key, const std::type_index& type) {
     IVW_ASSERT(!key.empty(), "Key should not be empty string");
     auto it = resources_.find(std::make_pair(key, type));
     if (it != resources_.end()) {
-        notifyResourceRemoved(key, type, it->second.get());
+        notifyResourceRemoved(key, type, it->second.resource.get());
+        lru_.erase(it->second.lru);
         resources_.erase(it);
+        notifyMemoryUsageChanged(getMemoryUsage(), budget_);
     }
 }
 
@@ -58,4 +62,56 @@ void ResourceManager::setEnabled(bool enable) {
 
 size_t ResourceManager::numberOfResources() const { return resources_.size(); }
 
+void ResourceManager::setMemoryBudget(size_t bytes) {
+    if (bytes != budget_) {
+        budget_ = bytes;
+        evictUnreferenced();
+        notifyMemoryUsageChanged(getMemoryUsage(), budget_);
+    }
+}
+
+size_t ResourceManager::getMemoryBudget() const { return budget_; }
+
+size_t ResourceManager::getMemoryUsage() const {
+    size_t usage = 0;
+    for (const auto& item : resources_) {
+        usage += item.second.resource->sizeInBytes();
+    }
+    return usage;
+}
+
+size_t ResourceManager::enforceMemoryBudget() {
+    const auto released = evictUnreferenced();
+    if (released > 0) {
+        notifyMemoryUsageChanged(getMemoryUsage(), budget_);
+    }
+    return released;
+}
+
+void ResourceManager::touch(Entry& entry) { lru_.splice(lru_.end(), lru_, entry.lru); }
+
+size_t ResourceManager::evictUnreferenced() {
+    if (budget_ == 0) return 0;
+
+    auto usage = getMemoryUsage();
+    size_t released = 0;
+    for (auto lruIt = lru_.begin(); lruIt != lru_.end() && usage > budget_;) {
+        auto it = resources_.find(*lruIt);
+        ++lruIt;
+        auto resource = it->second.resource;
+        if (resource->isReferenced()) continue;
+
+        const auto size = resource->sizeInBytes();
+        const auto [key, type] = it->first;
+        notifyResourceEvicted(key, type, resource.get());
+        notifyResourceRemoved(key, type, resource.get());
+        lru_.erase(it->second.lru);
+        resources_.erase(it);
+
+        usage -= std::min(usage, size);
+        released += size;
+    }
+    return released;
+}
+
 }  // namespace inviwo
@@ -47,4 +47,15 @@ void ResourceManagerObservable::notifyEnableChanged() {
     forEachObserver([&](ResourceManagerObserver* o) { o->onResourceManagerEnableStateChanged(); });
 }
 
+void ResourceManagerObservable::notifyResourceEvicted(const std::string& key,
+                                                      const std::type_index& type,
+                                                      Resource* resource) {
+    forEachObserver([&](ResourceManagerObserver* o) { o->onResourceEvicted(key, type, resource); });
+}
+
+void ResourceManagerObservable::notifyMemoryUsageChanged(size_t usage, size_t budget) {
+    forEachObserver(
+        [&](ResourceManagerObserver* o) { o->onResourceMemoryUsageChanged(usage, budget); });
+}
+
 }  // namespace inviwo
@@ -0,0 +1,268 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/network/evaluationstatistics.h>
+#include <inviwo/core/datastructures/conversionstatistics.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string_view>
+#include <typeindex>
+
+namespace inviwo {
+
+TEST(RollingStatistics, Empty) {
+    RollingStatistics stats{10};
+    EXPECT_EQ(0, stats.count());
+    EXPECT_EQ(0.0, stats.min());
+    EXPECT_EQ(0.0, stats.mean());
+    EXPECT_EQ(0.0, stats.p95());
+}
+
+TEST(RollingStatistics, Values) {
+    RollingStatistics stats{100};
+    for (int i = 1; i <= 100; ++i) stats.add(static_cast<double>(i));
+    EXPECT_EQ(100, stats.count());
+    EXPECT_EQ(100.0, stats.last());
+    EXPECT_EQ(1.0, stats.min());
+    EXPECT_EQ(100.0, stats.max());
+    EXPECT_DOUBLE_EQ(50.5, stats.mean());
+    EXPECT_EQ(95.0, stats.p95());
+}
+
+TEST(RollingStatistics, Window) {
+    RollingStatistics stats{4};
+    for (int i = 1; i <= 10; ++i) stats.add(static_cast<double>(i));
+    EXPECT_EQ(10, stats.count());
+    EXPECT_EQ(10.0, stats.last());
+    EXPECT_EQ(7.0, stats.min());
+    EXPECT_EQ(10.0, stats.max());
+    EXPECT_DOUBLE_EQ(8.5, stats.mean());
+
+    stats.clear();
+    EXPECT_EQ(0, stats.count());
+    EXPECT_EQ(0.0, stats.max());
+}
+
+TEST(ConversionStatistics, Record) {
+    const auto wasEnabled = ConversionStatistics::isEnabled();
+    ConversionStatistics::reset();
+
+    ConversionStatistics::setEnabled(false);
+    ConversionStatistics::record(typeid(int), typeid(float), 4);
+    EXPECT_TRUE(ConversionStatistics::getEntries().empty());
+
+    ConversionStatistics::setEnabled(true);
+    ConversionStatistics::record(typeid(int), typeid(float), 4);
+    ConversionStatistics::record(typeid(int), typeid(float), 8);
+    ConversionStatistics::record(typeid(float), typeid(int), 16);
+
+    const auto entries = ConversionStatistics::getEntries();
+    ASSERT_EQ(2, entries.size());
+    for (const auto& e : entries) {
+        if (e.source == std::type_index(typeid(int))) {
+            EXPECT_EQ(2, e.count);
+            EXPECT_EQ(12, e.bytes);
+        } else {
+            EXPECT_EQ(1, e.count);
+            EXPECT_EQ(16, e.bytes);
+        }
+    }
+    const auto [count, bytes] = ConversionStatistics::getTotals();
+    EXPECT_EQ(3, count);
+    EXPECT_EQ(28, bytes);
+
+    ConversionStatistics::reset();
+    EXPECT_TRUE(ConversionStatistics::getEntries().empty());
+    ConversionStatistics::setEnabled(wasEnabled);
+}
+
+namespace {
+
+struct StatsTestProcessor : Processor {
+    StatsTestProcessor(const std::string& id) : Processor(id, id) {}
+
+    virtual const ProcessorInfo getProcessorInfo() const override { return processorInfo_; }
+
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override {
+        for (auto* outport : getOutports()) {
+            static_cast<DataOutport<int>*>(outport)->setData(std::make_shared<int>(0));
+        }
+    }
+};
+
+const ProcessorInfo StatsTestProcessor::processorInfo_{
+    "org.inviwo.StatsTestProcessor",  // Class identifier
+    "StatsTestProcessor",             // Display name
+    "Testing",                        // Category
+    CodeState::Stable,                // Code state
+    Tags::CPU,                        // Tags
+};
+
+}  // namespace
+
+TEST(EvaluationStatistics, Observe) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    EvaluationStatistics stats{InviwoApplication::getPtr(), 10};
+    evaluator.addObserver(&stats);
+    EXPECT_TRUE(ConversionStatistics::isEnabled());
+
+    auto at = std::make_unique<StatsTestProcessor>("a");
+    at->addPort(std::make_unique<DataOutport<int>>("out"));
+    auto a = network.addProcessor(std::move(at));
+    auto bt = std::make_unique<StatsTestProcessor>("b");
+    bt->addPort(std::make_unique<DataInport<int>>("in"));
+    auto b = network.addProcessor(std::move(bt));
+    network.addConnection(a->getOutports()[0], b->getInports()[0]);
+    a->invalidate(InvalidationLevel::InvalidOutput);
+
+    const auto& processors = stats.getProcessorStatistics();
+    ASSERT_EQ(1, processors.count("a"));
+    ASSERT_EQ(1, processors.count("b"));
+    EXPECT_EQ(2, processors.at("a").process.count());
+    EXPECT_EQ(2, processors.at("b").process.count());
+    EXPECT_EQ(1, processors.at("a").initializeResources.count());
+    EXPECT_LE(0.0, processors.at("a").process.min());
+
+    const auto evaluations = stats.getNetworkStatistics().count();
+    EXPECT_LE(2, evaluations);
+    EXPECT_EQ(evaluations, stats.getPoolQueueStatistics().count());
+    EXPECT_EQ(evaluations, stats.getCounterEvents().size());
+
+    const auto& events = stats.getTraceEvents();
+    const auto processEvents = std::count_if(events.begin(), events.end(), [](const auto& e) {
+        return std::string{e.category} == "process";
+    });
+    EXPECT_EQ(4, processEvents);
+    for (const auto& e : events) {
+        EXPECT_LE(EvaluationStatistics::clock::duration::zero(), e.start);
+        EXPECT_LE(EvaluationStatistics::clock::duration::zero(), e.duration);
+    }
+
+    stats.reset();
+    EXPECT_TRUE(stats.getProcessorStatistics().empty());
+    EXPECT_TRUE(stats.getTraceEvents().empty());
+    EXPECT_EQ(0, stats.getNetworkStatistics().count());
+
+    evaluator.removeObserver(&stats);
+}
+
+TEST(EvaluationStatistics, MaxEvents) {
+    StatsTestProcessor p{"p"};
+    EvaluationStatistics stats{InviwoApplication::getPtr(), 10, 3};
+    ProcessorNetworkEvaluationObserver& observer = stats;
+
+    for (int i = 0; i < 5; ++i) {
+        observer.onProcessorNetworkEvaluationBegin();
+        observer.onProcessorEvaluationBegin(&p, EvaluationType::Process);
+        observer.onProcessorEvaluationEnd(&p, EvaluationType::Process);
+        observer.onProcessorNetworkEvaluationEnd();
+    }
+    EXPECT_EQ(3, stats.getTraceEvents().size());
+    EXPECT_EQ(3, stats.getCounterEvents().size());
+    EXPECT_EQ(5, stats.getProcessorStatistics().at("p").process.count());
+    EXPECT_EQ(5, stats.getNetworkStatistics().count());
+}
+
+TEST(EvaluationStatistics, ChromeTrace) {
+    StatsTestProcessor p{"p\"quoted\"\\"};
+    EvaluationStatistics stats{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluationObserver& observer = stats;
+
+    observer.onProcessorNetworkEvaluationBegin();
+    observer.onProcessorEvaluationBegin(&p, EvaluationType::InitResource);
+    observer.onProcessorEvaluationEnd(&p, EvaluationType::InitResource);
+    observer.onProcessorEvaluationBegin(&p, EvaluationType::Process);
+    observer.onProcessorEvaluationEnd(&p, EvaluationType::Process);
+    observer.onProcessorNetworkEvaluationEnd();
+
+    std::stringstream ss;
+    stats.exportChromeTrace(ss);
+    const auto json = ss.str();
+
+    EXPECT_EQ(0, json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_EQ(json.size() - 3, json.rfind("]}\n"));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"p\\\"quoted\\\"\\\\\""));
+    EXPECT_NE(std::string::npos, json.find("\"cat\":\"initializeResources\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("\"cat\":\"process\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("\"cat\":\"network\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Pool Queue Size\",\"ph\":\"C\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Converted Bytes\",\"ph\":\"C\""));
+
+    const auto occurrences = [&](std::string_view str) {
+        size_t count = 0;
+        for (auto pos = json.find(str); pos != std::string::npos; pos = json.find(str, pos + 1)) {
+            ++count;
+        }
+        return count;
+    };
+    // network, initializeResources, and process events, and three counters for one evaluation
+    EXPECT_EQ(3, occurrences("\"ph\":\"X\""));
+    EXPECT_EQ(3, occurrences("\"ph\":\"C\""));
+
+    // balanced brackets outside of strings
+    int depth = 0;
+    bool inString = false;
+    for (size_t i = 0; i < json.size(); ++i) {
+        const auto c = json[i];
+        if (inString) {
+            if (c == '\\') {
+                ++i;
+            } else if (c == '"') {
+                inString = false;
+            }
+        } else if (c == '"') {
+            inString = true;
+        } else if (c == '{' || c == '[') {
+            ++depth;
+        } else if (c == '}' || c == ']') {
+            --depth;
+            EXPECT_LE(0, depth);
+        }
+    }
+    EXPECT_FALSE(inString);
+    EXPECT_EQ(0, depth);
+}
+
+}  // namespace inviwo
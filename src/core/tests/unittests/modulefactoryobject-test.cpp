@@ -0,0 +1,94 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwomodulefactoryobject.h>
+#include <inviwo/core/common/inviwomodule.h>
+
+#include <algorithm>
+
+namespace inviwo {
+
+namespace {
+
+struct TestModuleFactoryObject : InviwoModuleFactoryObject {
+    TestModuleFactoryObject(const std::string& name, std::vector<std::string> dependencies)
+        : InviwoModuleFactoryObject(name, Version{1, 0, 0}, "", Version{1, 0, 0}, dependencies,
+                                    std::vector<Version>(dependencies.size(), Version{1, 0, 0}),
+                                    {}, {}, ProtectedModule::off) {}
+
+    virtual std::unique_ptr<InviwoModule> create(InviwoApplication*) override { return nullptr; }
+};
+
+std::vector<std::unique_ptr<InviwoModuleFactoryObject>> testModules() {
+    std::vector<std::unique_ptr<InviwoModuleFactoryObject>> modules;
+    // Listed in an order where dependents appear before their dependencies
+    modules.push_back(std::make_unique<TestModuleFactoryObject>(
+        "PlottingGL", std::vector<std::string>{"Plotting", "BaseGL"}));
+    modules.push_back(std::make_unique<TestModuleFactoryObject>(
+        "BaseGL", std::vector<std::string>{"opengl", "Base"}));
+    modules.push_back(
+        std::make_unique<TestModuleFactoryObject>("Plotting", std::vector<std::string>{"Base"}));
+    modules.push_back(
+        std::make_unique<TestModuleFactoryObject>("OpenGL", std::vector<std::string>{}));
+    modules.push_back(
+        std::make_unique<TestModuleFactoryObject>("Base", std::vector<std::string>{}));
+    return modules;
+}
+
+std::vector<std::string> names(const std::vector<std::unique_ptr<InviwoModuleFactoryObject>>& m) {
+    std::vector<std::string> res;
+    std::transform(m.begin(), m.end(), std::back_inserter(res),
+                   [](const auto& item) { return item->name; });
+    return res;
+}
+
+}  // namespace
+
+TEST(ModuleFactoryObject, RemoveAndDependents) {
+    auto modules = testModules();
+    auto removed = removeModuleFactoryObjectsAndDependents(modules, {"OPENGL"});
+
+    EXPECT_EQ(names(modules), (std::vector<std::string>{"Plotting", "Base"}));
+    EXPECT_EQ(removed, (std::vector<std::string>{"PlottingGL", "BaseGL", "OpenGL"}));
+}
+
+TEST(ModuleFactoryObject, RemoveUnknown) {
+    auto modules = testModules();
+    auto removed = removeModuleFactoryObjectsAndDependents(modules, {"GLFW"});
+
+    EXPECT_EQ(modules.size(), size_t{5});
+    EXPECT_TRUE(removed.empty());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,86 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/processors/poolprocessor.h>
+
+#include <chrono>
+
+namespace inviwo {
+
+using namespace std::chrono_literals;
+
+TEST(PoolChannel, DeliversLatest) {
+    pool::detail::Channel<int> channel{2, 0ms};
+
+    EXPECT_TRUE(channel.publish(0, 1)) << "the first publish schedules a delivery";
+    EXPECT_FALSE(channel.publish(0, 2)) << "a delivery is already pending";
+    EXPECT_FALSE(channel.publish(0, 3)) << "a delivery is already pending";
+
+    auto results = channel.take();
+    ASSERT_EQ(2, results.size());
+    ASSERT_TRUE(results[0]);
+    EXPECT_EQ(3, *results[0]) << "the latest published result is delivered";
+    EXPECT_FALSE(results[1]) << "nothing published for the second job";
+
+    EXPECT_TRUE(channel.publish(1, 4)) << "no delivery is pending after take";
+    results = channel.take();
+    EXPECT_EQ(3, *results[0]) << "results are kept between deliveries";
+    EXPECT_EQ(4, *results[1]);
+}
+
+TEST(PoolChannel, Interval) {
+    pool::detail::Channel<int> channel{1, 1h};
+
+    EXPECT_TRUE(channel.publish(0, 1));
+    channel.take();
+    // Within the interval of the last delivery, nothing is scheduled and unless the job publishes
+    // again after the interval the result is never delivered
+    EXPECT_FALSE(channel.publish(0, 2));
+    EXPECT_FALSE(channel.pending);
+    EXPECT_EQ(2, *channel.results[0]);
+}
+
+TEST(PoolChannel, Store) {
+    pool::detail::Channel<int> channel{2, 0ms};
+
+    channel.store(1, 5);
+    EXPECT_FALSE(channel.pending) << "final results do not schedule deliveries";
+
+    EXPECT_TRUE(channel.publish(0, 1));
+    const auto results = channel.take();
+    EXPECT_EQ(1, *results[0]);
+    EXPECT_EQ(5, *results[1]) << "final results are delivered with the other jobs' results";
+}
+
+}  // namespace inviwo
@@ -0,0 +1,143 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/representationmanager.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+struct BudgetScope {
+    BudgetScope(size_t budget, bool spill)
+        : oldBudget{RepresentationManager::getBudget()}
+        , oldSpill{RepresentationManager::getSpillToDisk()} {
+        RepresentationManager::setBudget(budget);
+        RepresentationManager::setSpillToDisk(spill);
+    }
+    ~BudgetScope() {
+        RepresentationManager::setBudget(oldBudget);
+        RepresentationManager::setSpillToDisk(oldSpill);
+    }
+    size_t oldBudget;
+    bool oldSpill;
+};
+
+std::shared_ptr<Volume> makeVolume() {
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(size3_t{8, 8, 8});
+    auto data = ram->getDataTyped();
+    std::iota(data, data + 8 * 8 * 8, 0.0f);
+    return std::make_shared<Volume>(ram);
+}
+
+}  // namespace
+
+TEST(RepresentationManager, Usage) {
+    BudgetScope scope{1024 * 1024, false};
+    auto volume = makeVolume();
+    EXPECT_EQ(8 * 8 * 8 * sizeof(float), RepresentationManager::getRAMUsage());
+    volume.reset();
+    EXPECT_EQ(0, RepresentationManager::getRAMUsage());
+}
+
+TEST(RepresentationManager, KeepWithoutSpill) {
+    BudgetScope scope{1, false};
+    auto volume = makeVolume();
+    const auto result = RepresentationManager::enforceBudget();
+    EXPECT_EQ(0, result.released);
+    EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+}
+
+TEST(RepresentationManager, SpillToDisk) {
+    BudgetScope scope{1, true};
+    auto volume = makeVolume();
+    const auto result = RepresentationManager::enforceBudget();
+    EXPECT_EQ(8 * 8 * 8 * sizeof(float), result.released);
+    EXPECT_EQ(8 * 8 * 8 * sizeof(float), result.spilled);
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE(volume->hasRepresentation<VolumeDisk>());
+
+    auto ram = volume->getRepresentation<VolumeRAM>();
+    ASSERT_NE(nullptr, ram);
+    auto data = static_cast<const float*>(ram->getData());
+    for (size_t i = 0; i < 8 * 8 * 8; ++i) {
+        EXPECT_EQ(static_cast<float>(i), data[i]);
+    }
+}
+
+TEST(RepresentationManager, ReleaseRecreatable) {
+    BudgetScope scope{1, false};
+    auto volume = makeVolume();
+    auto ram = volume->getRepresentation<VolumeRAM>();
+    auto disk = std::make_shared<VolumeDisk>(ram->getDimensions(), ram->getDataFormat());
+    volume->addRepresentation(disk);
+
+    // The disk representation has no loader, but there is a converter to VolumeRAM so the RAM
+    // representation is considered recreatable.
+    EXPECT_TRUE(volume->releaseRepresentation(ram));
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+}
+
+TEST(RepresentationManager, KeepShared) {
+    BudgetScope scope{1, true};
+    auto volume = makeVolume();
+    auto shared = volume->getSharedRepresentation<VolumeRAM>();
+    const auto result = RepresentationManager::enforceBudget();
+    EXPECT_EQ(0, result.released);
+    EXPECT_FALSE(volume->releaseRepresentation(shared.get()));
+    EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+
+    shared.reset();
+    EXPECT_EQ(8 * 8 * 8 * sizeof(float), RepresentationManager::enforceBudget().released);
+}
+
+TEST(RepresentationManager, ReplacementKeepsExisting) {
+    BudgetScope scope{1, false};
+    auto volume = makeVolume();
+    auto ram = volume->getRepresentation<VolumeRAM>();
+    auto disk = std::make_shared<VolumeDisk>(ram->getDimensions(), ram->getDataFormat());
+    volume->addRepresentation(disk);
+    volume->getRepresentation<VolumeRAM>();
+
+    auto replacement = std::make_shared<VolumeDisk>(ram->getDimensions(), ram->getDataFormat());
+    EXPECT_TRUE(volume->releaseRepresentation(ram, replacement));
+    ASSERT_TRUE(volume->hasRepresentation<VolumeDisk>());
+    EXPECT_EQ(disk.get(), volume->getRepresentation<VolumeDisk>());
+}
+
+}  // namespace inviwo
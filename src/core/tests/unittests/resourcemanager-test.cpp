@@ -0,0 +1,115 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/resourcemanager/resourcemanager.h>
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<Buffer<float>> makeBuffer(size_t size) {
+    return std::make_shared<Buffer<float>>(std::make_shared<BufferRAMPrecision<float>>(size));
+}
+
+struct EvictionObserver : ResourceManagerObserver {
+    virtual void onResourceEvicted(const std::string& key, const std::type_index&,
+                                   Resource*) override {
+        evicted.push_back(key);
+    }
+    std::vector<std::string> evicted;
+};
+
+}  // namespace
+
+TEST(ResourceManager, MemoryUsage) {
+    ResourceManager rm;
+    rm.addResource("a", makeBuffer(100));
+    rm.addResource("b", makeBuffer(50));
+    EXPECT_EQ(150 * sizeof(float), rm.getMemoryUsage());
+
+    rm.removeResource<Buffer<float>>("a");
+    EXPECT_EQ(50 * sizeof(float), rm.getMemoryUsage());
+}
+
+TEST(ResourceManager, LRUEviction) {
+    ResourceManager rm;
+    EvictionObserver obs;
+    rm.addObserver(&obs);
+
+    rm.setMemoryBudget(3 * 100 * sizeof(float));
+    rm.addResource("a", makeBuffer(100));
+    rm.addResource("b", makeBuffer(100));
+    rm.addResource("c", makeBuffer(100));
+    EXPECT_EQ(3, rm.numberOfResources());
+    EXPECT_TRUE(obs.evicted.empty());
+
+    // Use "a" to make "b" the least recently used
+    rm.getResource<Buffer<float>>("a");
+
+    rm.addResource("d", makeBuffer(100));
+    EXPECT_EQ(3, rm.numberOfResources());
+    ASSERT_EQ(1, obs.evicted.size());
+    EXPECT_EQ("b", obs.evicted.front());
+    EXPECT_FALSE(rm.hasResource<Buffer<float>>("b"));
+    EXPECT_TRUE(rm.hasResource<Buffer<float>>("a"));
+
+    rm.removeObserver(&obs);
+}
+
+TEST(ResourceManager, ReferencedResourcesAreKept) {
+    ResourceManager rm;
+    rm.setMemoryBudget(100 * sizeof(float));
+
+    auto a = makeBuffer(100);
+    rm.addResource("a", a);
+    auto b = makeBuffer(100);
+    rm.addResource("b", b);
+    EXPECT_EQ(2, rm.numberOfResources());
+
+    b.reset();
+    EXPECT_EQ(100 * sizeof(float), rm.enforceMemoryBudget());
+    EXPECT_EQ(1, rm.numberOfResources());
+    EXPECT_TRUE(rm.hasResource<Buffer<float>>("a"));
+
+    a.reset();
+    rm.setMemoryBudget(0);
+    EXPECT_EQ(0, rm.enforceMemoryBudget());
+    EXPECT_EQ(1, rm.numberOfResources());
+}
+
+}  // namespace inviwo
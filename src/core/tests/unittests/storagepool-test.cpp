@@ -0,0 +1,131 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/storagepool.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+
+#include <algorithm>
+
+namespace inviwo {
+
+namespace {
+
+struct PoolScope {
+    explicit PoolScope(size_t maxCached) : oldMaxCached{StoragePool::getMaxCachedBytes()} {
+        StoragePool::setMaxCachedBytes(maxCached);
+        StoragePool::resetStatistics();
+    }
+    ~PoolScope() { StoragePool::setMaxCachedBytes(oldMaxCached); }
+    size_t oldMaxCached;
+};
+
+}  // namespace
+
+TEST(StoragePool, Reuse) {
+    PoolScope scope{size_t{64} << 20};
+
+    auto first = util::allocateStorage<float>(10000);
+    EXPECT_TRUE(std::all_of(first.get(), first.get() + 10000, [](float v) { return v == 0.0f; }));
+    auto ptr = first.get();
+    first.reset();
+    EXPECT_GT(StoragePool::getStatistics().cachedBytes, 0);
+
+    // A slightly larger allocation in the same size class
+    auto second = util::allocateStorage<float>(10100, StorageInit::Uninitialized);
+    EXPECT_EQ(ptr, second.get());
+
+    const auto stats = StoragePool::getStatistics();
+    EXPECT_EQ(2, stats.allocations);
+    EXPECT_EQ(1, stats.reused);
+    EXPECT_EQ(1, stats.deallocations);
+}
+
+TEST(StoragePool, NoCaching) {
+    PoolScope scope{0};
+    auto data = util::allocateStorage<float>(10000);
+    data.reset();
+    const auto stats = StoragePool::getStatistics();
+    EXPECT_EQ(0, stats.cachedBytes);
+    EXPECT_EQ(0, stats.reused);
+}
+
+TEST(StoragePool, SizeClasses) {
+    PoolScope scope{size_t{64} << 20};
+
+    for (const size_t bytes : {size_t{5} << 10, size_t{100} << 10, (size_t{2} << 20) + 1,
+                               (size_t{33} << 20) + 3}) {
+        SCOPED_TRACE(bytes);
+        const auto before = StoragePool::getStatistics().liveBytes;
+        auto data = util::allocateStorage<char>(bytes, StorageInit::Uninitialized);
+        const auto live = StoragePool::getStatistics().liveBytes - before;
+        EXPECT_GE(live, bytes);
+        EXPECT_LE(live, std::max(bytes / 4 * 5, size_t{16} << 10)) << "too much wasted";
+    }
+    // Sizes that differ by more than the step are in different size classes
+    auto small = util::allocateStorage<char>(size_t{64} << 10, StorageInit::Uninitialized);
+    auto ptr = small.get();
+    small.reset();
+    auto large = util::allocateStorage<char>(size_t{96} << 10, StorageInit::Uninitialized);
+    EXPECT_NE(ptr, large.get());
+}
+
+TEST(StoragePool, TinyAllocationsNotPooled) {
+    PoolScope scope{size_t{64} << 20};
+    auto data = util::allocateStorage<float>(16);
+    EXPECT_TRUE(std::all_of(data.get(), data.get() + 16, [](float v) { return v == 0.0f; }));
+    data.reset();
+
+    const auto stats = StoragePool::getStatistics();
+    EXPECT_EQ(0, stats.allocations);
+    EXPECT_EQ(0, stats.cachedBytes);
+}
+
+TEST(StoragePool, VolumeRAM) {
+    PoolScope scope{size_t{64} << 20};
+    const size3_t dims{16, 16, 16};
+    const void* ptr = nullptr;
+    {
+        VolumeRAMPrecision<float> volume{dims};
+        ptr = volume.getData();
+    }
+    VolumeRAMPrecision<float> volume{dims, StorageInit::Uninitialized};
+    EXPECT_EQ(ptr, volume.getData());
+    EXPECT_EQ(1, StoragePool::getStatistics().reused);
+
+    // Data handed to the volume using new[] should be released using delete[]
+    volume.setData(new float[8], size3_t{2, 2, 2});
+    EXPECT_EQ(size3_t(2, 2, 2), volume.getDimensions());
+}
+
+}  // namespace inviwo
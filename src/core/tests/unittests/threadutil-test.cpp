@@ -0,0 +1,92 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace inviwo {
+
+TEST(ParallelFor, RunsEveryTask) {
+    std::vector<std::atomic<int>> calls(1000);
+    util::parallelFor(calls.size(), [&](size_t i) { ++calls[i]; });
+    for (auto& c : calls) EXPECT_EQ(1, c.load());
+}
+
+TEST(ParallelFor, Ranges) {
+    EXPECT_EQ(size_t{0}, util::rangeCount(0, 10));
+    EXPECT_EQ(size_t{1}, util::rangeCount(10, 10));
+    EXPECT_EQ(size_t{2}, util::rangeCount(11, 10));
+
+    std::vector<std::atomic<int>> calls(1003);
+    std::atomic<size_t> ranges{0};
+    util::parallelFor(calls.size(), 10, [&](size_t begin, size_t end) {
+        EXPECT_EQ(size_t{0}, begin % 10);
+        EXPECT_EQ(std::min(begin + 10, calls.size()), end);
+        for (size_t i = begin; i < end; ++i) ++calls[i];
+        ++ranges;
+    });
+    EXPECT_EQ(util::rangeCount(calls.size(), 10), ranges.load());
+    for (auto& c : calls) EXPECT_EQ(1, c.load());
+}
+
+TEST(ParallelFor, RethrowsException) {
+    EXPECT_THROW(util::parallelFor(100,
+                                   [](size_t i) {
+                                       if (i == 50) throw std::runtime_error("task failed");
+                                   }),
+                 std::runtime_error);
+}
+
+TEST(ParallelFor, NestedInPoolJobs) {
+    auto app = InviwoApplication::getPtr();
+    const auto poolSize = app->getPoolSize();
+    app->resizePool(2);
+
+    // Occupy every pool thread with a job that runs its own parallel loop, the callers have to
+    // make progress on their own since no pool thread is free to help
+    std::atomic<size_t> sum{0};
+    util::parallelFor(4, [&](size_t) {
+        util::parallelFor(100, 10, [&](size_t begin, size_t end) { sum += end - begin; });
+    });
+    EXPECT_EQ(size_t{400}, sum.load());
+
+    app->resizePool(poolSize);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,133 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/volumesequencesampler.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+
+#include <algorithm>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<Volume> makeConstant(vec3 value) {
+    auto ram = std::make_shared<VolumeRAMPrecision<vec3>>(size3_t{4, 4, 4});
+    std::fill(ram->getDataTyped(), ram->getDataTyped() + 4 * 4 * 4, value);
+    return std::make_shared<Volume>(ram);
+}
+
+class ConstantLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    explicit ConstantLoader(vec3 value) : value_{value} {}
+    virtual ConstantLoader* clone() const override { return new ConstantLoader(*this); }
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        auto ram = std::make_shared<VolumeRAMPrecision<vec3>>(src.getDimensions());
+        std::fill(ram->getDataTyped(), ram->getDataTyped() + glm::compMul(src.getDimensions()),
+                  value_);
+        return ram;
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {}
+
+private:
+    vec3 value_;
+};
+
+std::shared_ptr<Volume> makeOnDisk(vec3 value) {
+    auto disk = std::make_shared<VolumeDisk>(size3_t{4, 4, 4}, DataVec3Float32::get());
+    disk->setLoader(new ConstantLoader(value));
+    return std::make_shared<Volume>(disk);
+}
+
+}  // namespace
+
+TEST(VolumeSequenceSampler, InterpolateInTime) {
+    auto seq = std::make_shared<VolumeSequence>();
+    seq->push_back(makeConstant(vec3{0.0f}));
+    seq->push_back(makeConstant(vec3{1.0f}));
+    seq->push_back(makeConstant(vec3{2.0f, 4.0f, 6.0f}));
+
+    VolumeSequenceSampler sampler(seq, false);
+    EXPECT_DOUBLE_EQ(0.5, sampler.sample(dvec4{0.5, 0.5, 0.5, 0.25}).x);
+    EXPECT_DOUBLE_EQ(1.5, sampler.sample(dvec4{0.5, 0.5, 0.5, 0.75}).x);
+    EXPECT_DOUBLE_EQ(2.5, sampler.sample(dvec4{0.5, 0.5, 0.5, 0.75}).y);
+    // back to the first bracket
+    EXPECT_DOUBLE_EQ(0.0, sampler.sample(dvec4{0.5, 0.5, 0.5, 0.0}).x);
+    // outside the volume
+    EXPECT_DOUBLE_EQ(0.0, sampler.sample(dvec4{1.5, 0.5, 0.5, 0.75}).x);
+}
+
+TEST(VolumeSequenceSampler, Timestamps) {
+    auto seq = std::make_shared<VolumeSequence>();
+    seq->push_back(makeConstant(vec3{4.0f}));
+    seq->push_back(makeConstant(vec3{0.0f}));
+    seq->front()->setMetaData<DoubleMetaData>("timestamp", 10.0);
+    seq->back()->setMetaData<DoubleMetaData>("timestamp", 2.0);
+
+    // the steps are sorted by timestamp
+    VolumeSequenceSampler sampler(seq, false);
+    EXPECT_DOUBLE_EQ(1.0, sampler.sample(dvec4{0.5, 0.5, 0.5, 4.0}).x);
+}
+
+TEST(VolumeSequenceSampler, LoopingDropsDuplicateLast) {
+    auto seq = std::make_shared<VolumeSequence>();
+    seq->push_back(makeConstant(vec3{0.0f}));
+    seq->push_back(makeConstant(vec3{2.0f}));
+    seq->push_back(makeConstant(vec3{0.0f}));
+
+    VolumeSequenceSampler sampler(seq, true, 2);
+    // The last step is the same as the first one, so the time range is [0, 1) and the second step
+    // has no next step to interpolate with
+    EXPECT_DOUBLE_EQ(2.0, sampler.sample(dvec4{0.5, 0.5, 0.5, 0.75}).x);
+    EXPECT_DOUBLE_EQ(1.0, sampler.sample(dvec4{0.5, 0.5, 0.5, 1.25}).x);
+}
+
+TEST(VolumeSequenceSampler, KeepsVolumesOnDisk) {
+    auto seq = std::make_shared<VolumeSequence>();
+    seq->push_back(makeOnDisk(vec3{0.0f}));
+    seq->push_back(makeOnDisk(vec3{1.0f}));
+    seq->push_back(makeOnDisk(vec3{3.0f}));
+
+    VolumeSequenceSampler sampler(seq, false, 2);
+    EXPECT_DOUBLE_EQ(0.5, sampler.sample(dvec4{0.5, 0.5, 0.5, 0.25}).x);
+    EXPECT_DOUBLE_EQ(2.0, sampler.sample(dvec4{0.5, 0.5, 0.5, 0.75}).x);
+    // The sampler reads its own copies, the volumes are not modified
+    for (const auto& volume : *seq) {
+        EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+    }
+}
+
+}  // namespace inviwo
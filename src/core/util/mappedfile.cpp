@@ -0,0 +1,158 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/mappedfile.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/stringconversion.h>
+
+#ifdef WIN32
+struct IUnknown;  // Workaround for "combaseapi.h(229): error C2187: syntax error: 'identifier' was
+                  // unexpected here" when using /permissive-
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+namespace inviwo {
+
+namespace util {
+
+MappedFile::MappedFile(const std::string& filePath) {
+#ifdef WIN32
+    file_ = CreateFileW(util::toWstring(filePath).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        file_ = nullptr;
+        throw FileException("Could not open file \"" + filePath + "\"", IVW_CONTEXT);
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file_, &fileSize)) {
+        unmap();
+        throw FileException("Could not query size of file \"" + filePath + "\"", IVW_CONTEXT);
+    }
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+    if (size_ == 0) return;
+
+    mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_) {
+        unmap();
+        throw FileException("Could not map file \"" + filePath + "\"", IVW_CONTEXT);
+    }
+    data_ = static_cast<const std::byte*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+        unmap();
+        throw FileException("Could not map file \"" + filePath + "\"", IVW_CONTEXT);
+    }
+#else
+    fd_ = ::open(filePath.c_str(), O_RDONLY);
+    if (fd_ == -1) {
+        throw FileException("Could not open file \"" + filePath + "\"", IVW_CONTEXT);
+    }
+    struct stat st;
+    if (::fstat(fd_, &st) == -1) {
+        unmap();
+        throw FileException("Could not query size of file \"" + filePath + "\"", IVW_CONTEXT);
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ == 0) return;
+
+    void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (ptr == MAP_FAILED) {
+        unmap();
+        throw FileException("Could not map file \"" + filePath + "\"", IVW_CONTEXT);
+    }
+    data_ = static_cast<const std::byte*>(ptr);
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& rhs) noexcept
+    : data_{std::exchange(rhs.data_, nullptr)}
+    , size_{std::exchange(rhs.size_, 0)}
+#ifdef WIN32
+    , file_{std::exchange(rhs.file_, nullptr)}
+    , mapping_{std::exchange(rhs.mapping_, nullptr)}
+#else
+    , fd_{std::exchange(rhs.fd_, -1)}
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept {
+    if (this != &rhs) {
+        unmap();
+        data_ = std::exchange(rhs.data_, nullptr);
+        size_ = std::exchange(rhs.size_, 0);
+#ifdef WIN32
+        file_ = std::exchange(rhs.file_, nullptr);
+        mapping_ = std::exchange(rhs.mapping_, nullptr);
+#else
+        fd_ = std::exchange(rhs.fd_, -1);
+#endif
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+void MappedFile::willNeed([[maybe_unused]] size_t offset, [[maybe_unused]] size_t size) const {
+#if !defined(WIN32)
+    if (!data_ || offset >= size_) return;
+    // madvise requires a page aligned address
+    const auto pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const auto begin = offset - offset % pageSize;
+    const auto end = std::min(offset + size, size_);
+    ::madvise(const_cast<std::byte*>(data_) + begin, end - begin, MADV_WILLNEED);
+#endif
+}
+
+void MappedFile::unmap() {
+#ifdef WIN32
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_) CloseHandle(mapping_);
+    if (file_) CloseHandle(file_);
+    mapping_ = nullptr;
+    file_ = nullptr;
+#else
+    if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+    if (fd_ != -1) ::close(fd_);
+    fd_ = -1;
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -53,6 +53,13 @@ SystemSettings::SystemSettings(InviwoApplication* app)
     , logStackTraceProperty_("logStackTraceProperty", "Error stack trace log", false)
     , runtimeModuleReloading_("runtimeModuleReloding", "Runtime Module Reloading", false)
     , enableResourceManager_("enableResourceManager", "Enable Resource Manager", false)
+    , resourceManagerBudget_("resourceManagerBudget", "Resource Manager Budget (MB)", 0, 0,
+                             1024 * 1024)
+    , representationBudget_("representationBudget", "RAM Representation Budget (MB)", 0, 0,
+                            1024 * 1024)
+    , spillRepresentationsToDisk_("spillRepresentationsToDisk",
+                                  "Spill RAM Representations to Disk", false)
+    , storagePoolSize_("storagePoolSize", "RAM Storage Pool Size (MB)", 256, 0, 64 * 1024)
     , breakOnMessage_{"breakOnMessage",
                       "Break on Message",
                       {MessageBreakLevel::Off, MessageBreakLevel::Error, MessageBreakLevel::Warn,
@@ -74,6 +81,10 @@ SystemSettings::SystemSettings(InviwoApplication* app)
     addProperty(logStackTraceProperty_);
     addProperty(runtimeModuleReloading_);
     addProperty(enableResourceManager_);
+    addProperty(resourceManagerBudget_);
+    addProperty(representationBudget_);
+    addProperty(spillRepresentationsToDisk_);
+    addProperty(storagePoolSize_);
     addProperty(breakOnMessage_);
     addProperty(breakOnException_);
     addProperty(stackTraceInException_);
@@ -32,6 +32,8 @@
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/threadutil.h>
 
+#include <inviwo/tracy/tracy.h>
+
 namespace inviwo {
 
 // the constructor just launches some amount of workers
@@ -75,6 +77,11 @@ size_t ThreadPool::getQueueSize() {
     return tasks.size();
 }
 
+bool ThreadPool::isIdle() {
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    return tasks.empty() && running == 0;
+}
+
 ThreadPool::~ThreadPool() {
     for (auto& worker : workers) worker->state = State::Abort;
     condition.notify_all();
@@ -99,12 +106,20 @@ ThreadPool::Worker::Worker(ThreadPool& pool)
                 if (state == State::Abort || (state == State::Stop && pool.tasks.empty())) break;
                 task = std::move(pool.tasks.front());
                 pool.tasks.pop();
+                ++pool.running;
+                TRACY_PLOT("Pool Queue Size", static_cast<int64_t>(pool.tasks.size()));
             }
             state = State::Working;
             try {
+                TRACY_ZONE_SCOPED_NC("Pool Task", 0x444444);
                 task();
             } catch (...) {  // Make sure we don't leak any exceptions.
             }
+            task = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(pool.queue_mutex);
+                --pool.running;
+            }
         }
         state = State::Done;
     }} {
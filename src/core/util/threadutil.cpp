@@ -29,6 +29,14 @@
 
 #include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/common/inviwoapplication.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
 
 #ifdef WIN32
 #include <windows.h>
@@ -60,4 +68,72 @@ void util::setThreadDescription(std::thread& thread, const std::string& desc) {
 #endif
 }
 
+void util::parallelFor(size_t count, std::function<void(size_t)> task, size_t maxThreads) {
+    struct Work {
+        Work(size_t count, std::function<void(size_t)> task)
+            : count{count}, task{std::move(task)} {}
+
+        void run() {
+            for (auto i = next++; i < count; i = next++) {
+                std::exception_ptr e;
+                try {
+                    task(i);
+                } catch (...) {
+                    e = std::current_exception();
+                }
+                std::scoped_lock lock{mutex};
+                ++finished;
+                if (e) {
+                    if (!error) error = e;
+                    // Skip all tasks that have not been started yet
+                    const auto unstarted = next.exchange(count);
+                    if (unstarted < count) finished += count - unstarted;
+                }
+                if (finished == count) done.notify_all();
+            }
+        }
+
+        const size_t count;
+        const std::function<void(size_t)> task;
+        std::atomic<size_t> next{0};
+        size_t finished = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+
+    auto work = std::make_shared<Work>(count, std::move(task));
+
+    size_t helpers = count > 0 ? count - 1 : 0;
+    helpers = std::min(helpers, parallelForThreads() - 1);
+    if (maxThreads > 0) helpers = std::min(helpers, maxThreads);
+
+    // Helpers that start after all tasks have been handed out return directly
+    for (size_t i = 0; i < helpers; ++i) {
+        dispatchPool([work]() { work->run(); });
+    }
+    work->run();
+
+    std::unique_lock lock{work->mutex};
+    work->done.wait(lock, [&]() { return work->finished == work->count; });
+    if (work->error) std::rethrow_exception(work->error);
+}
+
+void util::parallelFor(size_t count, size_t grain,
+                       std::function<void(size_t begin, size_t end)> task, size_t maxThreads) {
+    if (grain == 0) grain = 1;
+    parallelFor(
+        rangeCount(count, grain),
+        [&](size_t range) {
+            const auto begin = range * grain;
+            task(begin, std::min(count, begin + grain));
+        },
+        maxThreads);
+}
+
+size_t util::parallelForThreads() {
+    return 1 + (InviwoApplication::isInitialized() ? InviwoApplication::getPtr()->getPoolSize()
+                                                   : size_t{0});
+}
+
 }  // namespace inviwo
@@ -27,116 +27,305 @@
  *
  *********************************************************************************/
 
+#include <inviwo/core/datastructures/volume/volumedisk.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/util/volumesequencesampler.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/interpolation.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 namespace inviwo {
 
+namespace detail {
+
+using SampleFunction = dvec3 (*)(const void* data, const size3_t& dims, const dvec3& pos);
+
+struct SequenceSamplerResident {
+    SequenceSamplerResident(std::shared_ptr<const VolumeRAM> volumeRAM, SampleFunction sample)
+        : ram{std::move(volumeRAM)}
+        , data{ram->getData()}
+        , dims{ram->getDimensions()}
+        , sample{sample} {}
+    SequenceSamplerResident(const SequenceSamplerResident&) = delete;
+    SequenceSamplerResident& operator=(const SequenceSamplerResident&) = delete;
+
+    std::shared_ptr<const VolumeRAM> ram;
+    const void* data;
+    size3_t dims;
+    SampleFunction sample;
+};
+
+/**
+ * The pair of steps bracketing the last time sampled by a thread. Holding on to the residents
+ * keeps the steps loaded while the thread is sampling them. Only used by its own thread.
+ */
+struct SequenceSamplerBracket {
+    size_t step = 0;
+    double t0 = std::numeric_limits<double>::infinity();
+    double t1 = -std::numeric_limits<double>::infinity();
+    std::shared_ptr<const SequenceSamplerResident> first;
+    std::shared_ptr<const SequenceSamplerResident> second;
+};
+
+struct SequenceSamplerState {
+    std::mutex mutex;
+    /// The loaded steps, there is at most one resident per step at any time
+    std::vector<std::weak_ptr<const SequenceSamplerResident>> residents;
+    /// Steps that are being loaded, other threads wait for these instead of loading again
+    std::vector<std::shared_future<std::shared_ptr<const SequenceSamplerResident>>> loading;
+    /// The most recently used steps, kept loaded even when no thread is sampling them
+    std::deque<std::shared_ptr<const SequenceSamplerResident>> window;
+    std::unordered_map<std::thread::id, std::unique_ptr<SequenceSamplerBracket>> brackets;
+    size_t maxResident;
+};
+
+}  // namespace detail
+
+namespace {
+
+template <typename T>
+dvec3 trilinear(const void* data, const size3_t& dims, const dvec3& pos) {
+    const auto voxels = static_cast<const T*>(data);
+    const util::IndexMapper3D im(dims);
+    const size3_t last = dims - size3_t(1);
+
+    const dvec3 samplePos = pos * dvec3(last);
+    const size3_t indexPos = size3_t(samplePos);
+    const dvec3 interpolants = samplePos - dvec3(indexPos);
+
+    const auto voxel = [&](const size3_t& offset) {
+        return dvec3(util::glm_convert<dvec4>(voxels[im(glm::min(indexPos + offset, last))]));
+    };
+    const dvec3 samples[8] = {voxel(size3_t(0, 0, 0)), voxel(size3_t(1, 0, 0)),
+                              voxel(size3_t(0, 1, 0)), voxel(size3_t(1, 1, 0)),
+                              voxel(size3_t(0, 0, 1)), voxel(size3_t(1, 0, 1)),
+                              voxel(size3_t(0, 1, 1)), voxel(size3_t(1, 1, 1))};
+
+    return Interpolation<dvec3>::trilinear(samples, interpolants);
+}
+
+/**
+ * Share the RAM representation of the volume if there is one, otherwise read a private copy from
+ * disk, which is freed when the sampler no longer needs it without affecting other users of the
+ * volume.
+ */
+std::shared_ptr<const VolumeRAM> loadRAM(const Volume& volume) {
+    if (!volume.hasRepresentation<VolumeRAM>() && volume.hasRepresentation<VolumeDisk>()) {
+        try {
+            if (auto ram = std::dynamic_pointer_cast<const VolumeRAM>(
+                    volume.getRepresentation<VolumeDisk>()->createRepresentation())) {
+                return ram;
+            }
+        } catch (const Exception&) {
+            // The disk representation is outdated or has no loader, use the volume instead
+        }
+    }
+    return volume.getSharedRepresentation<VolumeRAM>();
+}
+
+/**
+ * The bracket of the sampler the thread used last. Only a raw pointer is kept here, the bracket
+ * is owned by the sampler. Sampler ids are never reused, so the pointer is only used while the
+ * sampler is alive.
+ */
+struct ThreadBracket {
+    size_t sampler = 0;
+    detail::SequenceSamplerBracket* bracket = nullptr;
+};
+
+thread_local ThreadBracket threadBracket;
+
+std::atomic<size_t> nextSamplerId{1};
+
+}  // namespace
+
 VolumeSequenceSampler::VolumeSequenceSampler(
-    std::shared_ptr<const std::vector<std::shared_ptr<Volume>>> volumeSequence, bool allowLooping)
+    std::shared_ptr<const std::vector<std::shared_ptr<Volume>>> volumeSequence, bool allowLooping,
+    size_t maxResidentSteps)
     : Spatial4DSampler<3, double>(volumeSequence->front())
-    , wrappers_()
+    , steps_()
+    , state_(std::make_shared<detail::SequenceSamplerState>())
+    , id_(nextSamplerId++)
     , allowLooping_(allowLooping)
     , timeRange_(0, 0)
     , totDuration_(0) {
 
     for (const auto& vol : (*volumeSequence.get())) {
-        wrappers_.emplace_back(std::make_shared<Wrapper>(vol));
+        Step step{vol, std::numeric_limits<double>::infinity(),
+                  std::numeric_limits<double>::infinity()};
+        if (vol->hasMetaData<DoubleMetaData>("timestamp")) {
+            step.timestamp = vol->getMetaData<DoubleMetaData>("timestamp")->get();
+        }
+        if (vol->hasMetaData<DoubleMetaData>("duration")) {
+            step.duration = vol->getMetaData<DoubleMetaData>("duration")->get();
+        }
+        steps_.push_back(std::move(step));
     }
 
-    auto lastWrapper = wrappers_.back();
-
-    auto infsTime = std::count_if(
-        wrappers_.begin(), wrappers_.end(), [&](const std::shared_ptr<Wrapper>& w) -> bool {
-            return w->timestamp_ == std::numeric_limits<double>::infinity();
-        });
+    auto infsTime = std::count_if(steps_.begin(), steps_.end(), [&](const Step& s) -> bool {
+        return s.timestamp == std::numeric_limits<double>::infinity();
+    });
 
-    auto infsDuration = std::count_if(
-        wrappers_.begin(), wrappers_.end(), [&](const std::shared_ptr<Wrapper>& w) -> bool {
-            return w->duration_ == std::numeric_limits<double>::infinity();
-        });
-    auto size = static_cast<decltype(infsTime)>(wrappers_.size());
+    auto infsDuration = std::count_if(steps_.begin(), steps_.end(), [&](const Step& s) -> bool {
+        return s.duration == std::numeric_limits<double>::infinity();
+    });
+    auto size = static_cast<decltype(infsTime)>(steps_.size());
 
     if (infsTime == 0) {  // all volumes has timestamps, make sure the volumes are in sorted order,
-        std::sort(wrappers_.begin(), wrappers_.end(), [](auto a, auto b) { return *a < *b; });
+        std::stable_sort(steps_.begin(), steps_.end(), [](const Step& a, const Step& b) {
+            return a.timestamp < b.timestamp;
+        });
     }
 
     if (!(infsTime == 0 || infsTime == size)) {
         LogWarn("Failed to create VolumeSequenceSampler due to missing data");
         LogInfo(infsTime << " volumes of " << size << " is missing a timestamp");
+        steps_.clear();
         return;
     }
     if (!(infsDuration == 0 || infsDuration == size)) {
         LogWarn("Failed to create VolumeSequenceSampler due to missing data");
         LogInfo(infsDuration << " volumes of " << size << " has unknown duration ");
+        steps_.clear();
         return;
     }
 
-    bool firstAndLastAreSame = true;
-    if (volumeSequence->size() >= 2) {
-        auto firstVol = volumeSequence->front();
-        auto lastVol = volumeSequence->back();
-        auto firstVolRam = firstVol->getRepresentation<VolumeRAM>();
-        auto firstData = static_cast<const char*>(firstVolRam->getData());
-        auto lastData =
-            static_cast<const char*>(lastVol->getRepresentation<VolumeRAM>()->getData());
-        auto dataSize1 = firstVolRam->getNumberOfBytes();
-
-        for (size_t i = 0; i < dataSize1 && firstAndLastAreSame; i++) {
-            firstAndLastAreSame &= firstData[i] == lastData[i];
-        }
-    }
+    state_->residents.resize(steps_.size());
+    state_->loading.resize(steps_.size());
+    state_->maxResident = std::max(maxResidentSteps, size_t{2});
 
-    auto prev = wrappers_.begin();
-    for (auto it = prev + 1; it != wrappers_.end(); ++it) {
-        prev->get()->next_ = *it;
-        prev = it;
+    bool firstAndLastAreSame = false;
+    if (steps_.size() >= 2) {
+        const auto first = acquire(0);
+        const auto last = acquire(steps_.size() - 1);
+        firstAndLastAreSame = first->dims == last->dims &&
+                              first->ram->getDataFormat() == last->ram->getDataFormat() &&
+                              std::memcmp(first->data, last->data,
+                                          first->ram->getNumberOfBytes()) == 0;
     }
 
     if (infsTime == size && infsDuration == size) {
         double dur = 1.0 / (size - 1.0);
         double t = 0;
-        for (auto& w : wrappers_) {
-            w->duration_ = dur;
-            w->timestamp_ = t;
+        for (auto& s : steps_) {
+            s.duration = dur;
+            s.timestamp = t;
             t += dur;
         }
     } else if (infsTime == size && infsDuration == 0) {
         double t = 0;
-        for (auto& w : wrappers_) {
-            w->timestamp_ = t;
-            t += w->duration_;
+        for (auto& s : steps_) {
+            s.timestamp = t;
+            t += s.duration;
         }
     } else {  // timestamps are set
 
         if (infsDuration == size) {  // we do not have durations
-            for (auto& w : wrappers_) {
-                if (auto next = w->next_.lock()) {
-                    w->duration_ = next->timestamp_ - w->timestamp_;
-                }
+            for (size_t i = 0; i + 1 < steps_.size(); ++i) {
+                steps_[i].duration = steps_[i + 1].timestamp - steps_[i].timestamp;
             }
         }
     }
 
-    if (firstAndLastAreSame && wrappers_.size() > 1) {
-        wrappers_.pop_back();
+    if (firstAndLastAreSame && steps_.size() > 1) {
+        steps_.pop_back();
     }
 
     totDuration_ = 0;
-    for (auto& w : wrappers_) {
-        totDuration_ += w->duration_;
+    for (auto& s : steps_) {
+        totDuration_ += s.duration;
     }
 
-    timeRange_.x = wrappers_.front()->timestamp_;
-    timeRange_.y = wrappers_.back()->timestamp_ + wrappers_.back()->duration_;
+    timeRange_.x = steps_.front().timestamp;
+    timeRange_.y = steps_.back().timestamp + steps_.back().duration;
+}
+
+VolumeSequenceSampler::~VolumeSequenceSampler() = default;
+
+detail::SequenceSamplerBracket& VolumeSequenceSampler::bracket() const {
+    if (threadBracket.sampler != id_) {
+        std::scoped_lock lock{state_->mutex};
+        auto& bracket = state_->brackets[std::this_thread::get_id()];
+        if (!bracket) bracket = std::make_unique<detail::SequenceSamplerBracket>();
+        threadBracket = ThreadBracket{id_, bracket.get()};
+    }
+    return *threadBracket.bracket;
 }
 
-VolumeSequenceSampler::~VolumeSequenceSampler() {}
+std::shared_ptr<const detail::SequenceSamplerResident> VolumeSequenceSampler::acquire(
+    size_t step) const {
+    // Residents dropped from the window are destroyed after unlocking
+    std::vector<std::shared_ptr<const detail::SequenceSamplerResident>> evicted;
+    std::unique_lock<std::mutex> lock{state_->mutex};
+
+    auto resident = state_->residents[step].lock();
+    if (!resident && state_->loading[step].valid()) {
+        // Another thread is loading the step
+        auto loading = state_->loading[step];
+        lock.unlock();
+        resident = loading.get();
+        lock.lock();
+    } else if (!resident) {
+        // Load without holding the lock, other threads can keep sampling the loaded steps
+        std::promise<std::shared_ptr<const detail::SequenceSamplerResident>> promise;
+        state_->loading[step] = promise.get_future().share();
+        lock.unlock();
+        try {
+            auto ram = loadRAM(*steps_[step].volume);
+            const auto sample = ram->dispatch<detail::SampleFunction>([](auto vrprecision) {
+                using ValueType = util::PrecisionValueType<decltype(vrprecision)>;
+                return &trilinear<ValueType>;
+            });
+            resident = std::make_shared<const detail::SequenceSamplerResident>(std::move(ram),
+                                                                               sample);
+        } catch (...) {
+            lock.lock();
+            state_->loading[step] = {};
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+        lock.lock();
+        state_->residents[step] = resident;
+        state_->loading[step] = {};
+        promise.set_value(resident);
+    }
+
+    auto& window = state_->window;
+    if (auto it = std::find(window.begin(), window.end(), resident); it != window.end()) {
+        window.erase(it);
+    }
+    window.push_back(resident);
+    while (window.size() > state_->maxResident) {
+        // Only the window holds on to unused steps, steps in a bracket are kept
+        auto it = std::find_if(window.begin(), window.end(),
+                               [](const auto& item) { return item.use_count() == 1; });
+        if (it == window.end()) break;
+        evicted.push_back(std::move(*it));
+        window.erase(it);
+    }
+    return resident;
+}
 
 dvec3 VolumeSequenceSampler::sampleDataSpace(const dvec4& pos) const {
     auto spatialPos = dvec3(pos);
     double t = pos.w;
 
+    if (steps_.empty() || !withinBoundsDataSpace(pos)) {
+        return dvec3(0);
+    }
+
     if (t < timeRange_.x || t > timeRange_.y) {
         if (!allowLooping_) {
             return dvec3(0);
@@ -149,19 +338,34 @@ dvec3 VolumeSequenceSampler::sampleDataSpace(const dvec4& pos) const {
         }
     }
 
-    auto it = std::upper_bound(
-        wrappers_.begin(), wrappers_.end(), t,
-        [](double t2, const std::shared_ptr<Wrapper> a) { return t2 < a->timestamp_; });
-    --it;
-    auto wrapper = *it;
+    auto& b = bracket();
+    if (t < b.t0 || t >= b.t1) {
+        auto it = std::upper_bound(steps_.begin(), steps_.end(), t,
+                                   [](double t2, const Step& s) { return t2 < s.timestamp; });
+        const size_t step =
+            it == steps_.begin() ? 0 : static_cast<size_t>(std::distance(steps_.begin(), it)) - 1;
+        const bool hasNext = step + 1 < steps_.size();
+
+        // Acquire before updating the bracket, if it throws the bracket is left unchanged
+        auto first = acquire(step);
+        auto second = hasNext ? acquire(step + 1) : nullptr;
+
+        b.step = step;
+        b.t0 = steps_[step].timestamp;
+        b.t1 = hasNext ? steps_[step + 1].timestamp : std::numeric_limits<double>::infinity();
+        b.first = std::move(first);
+        b.second = std::move(second);
+    }
 
-    auto val0 = dvec3(wrapper->sampler_.sample(spatialPos));
-    if (wrapper->next_.expired()) {
+    const auto& first = *b.first;
+    const auto val0 = first.sample(first.data, first.dims, spatialPos);
+    if (!b.second) {
         return val0;
     }
-    auto val1 = dvec3(wrapper->next_.lock()->sampler_.sample(spatialPos));
+    const auto& second = *b.second;
+    const auto val1 = second.sample(second.data, second.dims, spatialPos);
 
-    double x = (t - wrapper->timestamp_) / wrapper->duration_;
+    double x = (t - b.t0) / steps_[b.step].duration;
     return Interpolation<dvec3>::linear(val0, val1, x);
 }
 
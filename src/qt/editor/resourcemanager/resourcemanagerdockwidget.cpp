@@ -32,6 +32,7 @@
 #include <inviwo/core/resourcemanager/resourcemanager.h>
 #include <modules/qtwidgets/inviwoqtutils.h>
 #include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/formatconversion.h>
 
 #include <warn/push>
 #include <warn/ignore/all>
@@ -118,6 +119,10 @@ ResourceManagerDockWidget::ResourceManagerDockWidget(QWidget* parent, ResourceMa
 
     buttomRowLayout->addStretch();
 
+    memoryLabel_ = new QLabel();
+    buttomRowLayout->addWidget(memoryLabel_);
+    onResourceMemoryUsageChanged(manager_.getMemoryUsage(), manager_.getMemoryBudget());
+
     auto clearAllButton = new QPushButton("Clear all");
     buttomRowLayout->addWidget(clearAllButton);
 
@@ -171,4 +176,13 @@ void ResourceManagerDockWidget::onResourceManagerEnableStateChanged() {
     disabledCheckBox_->blockSignals(false);
 }
 
+void ResourceManagerDockWidget::onResourceMemoryUsageChanged(size_t usage, size_t budget) {
+    if (budget == 0) {
+        memoryLabel_->setText(utilqt::toQString(formatBytesToString(usage)));
+    } else {
+        memoryLabel_->setText(utilqt::toQString(formatBytesToString(usage) + " / " +
+                                                formatBytesToString(budget)));
+    }
+}
+
 }  // namespace inviwo
@@ -0,0 +1,22 @@
+#pragma once
+
+// Memory tracking of the data owned by RAM representations (VolumeRAM, LayerRAM).
+// The allocations are only reported when tracy is enabled and IVW_TRACY_MEMORY is defined, since
+// it adds a call into the profiler for every allocation and deallocation of representation data.
+// Enable by setting IVW_USE_TRACY and IVW_USE_TRACY_MEMORY in CMake.
+
+// clang-format off
+
+#include <inviwo/tracy/tracy.h>
+
+#if defined TRACY_ENABLE && defined IVW_TRACY_MEMORY
+
+#define TRACY_REPR_ALLOC(ptr, size) TRACY_ALLOC(ptr, size)
+#define TRACY_REPR_FREE(ptr) TRACY_FREE(ptr)
+
+#else
+
+#define TRACY_REPR_ALLOC(ptr, size)
+#define TRACY_REPR_FREE(ptr)
+
+#endif